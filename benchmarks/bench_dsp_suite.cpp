@@ -0,0 +1,379 @@
+/**
+ * DSP 구성 요소 네이티브 벤치마크 모음
+ *
+ * 브라우저 벤치마크 페이지(JS vs C++)는 실행마다 편차가 커서 회귀 비교에 쓰기 어려우므로
+ * 같은 입력 / 같은 반복 규칙으로 구성 요소를 하나씩 측정하고 JSON으로 남김
+ *
+ * 측정 대상 (입력: 음성 모델 신호, 모노):
+ *   - SimpleTimeStretcher::process   ratio 0.5 / 0.8 / 1.25 / 2.0
+ *   - SimplePitchShifter::process    -12 / -5 / +5 / +12 반음
+ *   - VoiceFilter::applyFilter       FilterType 전부 (param 0.5 / 0.5)
+ *   - PitchAnalyzer::analyze
+ *   - AudioPreprocessor::process
+ *   - AudioReverser::reverse
+ * 각 대상을 샘플레이트 x 길이 조합마다 실행
+ *
+ * 반복 규칙 (Google Benchmark와 같은 방식):
+ *   - 워밍업 1회 (스크래치 버퍼 / 계수 테이블 준비, 측정 제외)
+ *   - 누적 시간이 min-time 이상, 반복 3회 이상이 될 때까지 반복
+ *   - 시간 = 반복별 벽시계 시간의 중앙값 (CPU 시간은 평균, 작업자 스레드 포함)
+ *
+ * 측정 항목:
+ *   - time (ms): 한 번 처리 시간 (중앙값)
+ *   - ns/sample: 입력 샘플 하나당 처리 시간
+ *   - RTF: 처리 시간 / 오디오 길이 (1보다 작으면 실시간보다 빠름)
+ *
+ * JSON 출력 (--json): Google Benchmark JSON과 같은 키
+ *   { "context": {...}, "benchmarks": [ { "name", "iterations", "real_time", "cpu_time", "time_unit": "ns",
+ *                                          "sample_rate", "duration_s", "ns_per_sample", "rtf" }, ... ] }
+ *   (compare.py 같은 기존 비교 도구를 그대로 사용 가능)
+ *
+ * 사용법:
+ *   ./bench_dsp_suite
+ *   ./bench_dsp_suite --filter=VoiceFilter --rates=44100,48000 --durations=1,10 --min-time=1 --json=result.json
+ */
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include "src/audio/AudioPreprocessor.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/effects/AudioReverser.h"
+#include "src/effects/VoiceFilter.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const double DEFAULT_MIN_TIME = 0.5;   // 초
+const int MIN_ITERATIONS = 3;
+const int MAX_ITERATIONS = 1000;
+const float BASE_FREQUENCY = 150.0f;
+
+struct Options {
+    std::string filter;
+    std::vector<int> sampleRates = { 22050, 44100, 48000 };
+    std::vector<double> durations = { 1.0, 5.0 };
+    double minTime = DEFAULT_MIN_TIME;
+    std::string jsonPath;
+};
+
+// 측정 대상 하나 (입력 버퍼를 받아 한 번 처리)
+struct Case {
+    std::string name;
+    std::function<void(const AudioBuffer&)> run;
+};
+
+struct Result {
+    std::string name;
+    int sampleRate;
+    double duration;
+    int iterations;
+    double realNs;      // 반복별 중앙값
+    double cpuNs;       // 평균
+    double nsPerSample;
+    double rtf;
+};
+
+// 음성 모델 신호: 기본 주파수 + 1/k 감쇠 배음 + 비브라토 + 음절 단위 진폭 + 약한 잡음
+// (완전한 주기 신호는 WSOLA / 피치 분석이 첫 후보에서 끝나 비용이 과소평가됨)
+AudioBuffer generateVoice(int sampleRate, double duration) {
+    const int length = (int)(duration * sampleRate);
+    const int harmonics = std::min(30, (int)(sampleRate * 0.5 / (BASE_FREQUENCY * 1.05)) - 1);
+    std::vector<float> data(length, 0.0f);
+    double phase = 0.0;
+    unsigned int seed = 12345;
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / sampleRate;
+        double frequency = BASE_FREQUENCY * (1.0 + 0.1 * std::sin(2.0 * M_PI * 0.7 * t) +
+                                             0.02 * std::sin(2.0 * M_PI * 5.0 * t));
+        phase += 2.0 * M_PI * frequency / sampleRate;
+        double sum = 0.0;
+        for (int k = 1; k <= harmonics; ++k) {
+            sum += std::sin(phase * k) / k;
+        }
+        double syllable = 0.55 + 0.45 * std::sin(2.0 * M_PI * 3.0 * t);
+        seed = seed * 1664525u + 1013904223u;
+        double noise = ((seed >> 8) / 16777216.0 - 0.5) * 0.02;
+        data[i] = (float)(0.3 * sum * syllable + noise);
+    }
+    AudioBuffer buffer(sampleRate, 1);
+    buffer.setData(data);
+    return buffer;
+}
+
+std::string formatNumber(double value) {
+    std::ostringstream oss;
+    oss << value;
+    return oss.str();
+}
+
+std::vector<Case> buildCases() {
+    std::vector<Case> cases;
+
+    const float ratios[] = { 0.5f, 0.8f, 1.25f, 2.0f };
+    for (float ratio : ratios) {
+        cases.push_back({ "SimpleTimeStretcher/ratio:" + formatNumber(ratio), [ratio](const AudioBuffer& input) {
+            static SimpleTimeStretcher stretcher;
+            stretcher.process(input, ratio);
+        } });
+    }
+
+    const float semitones[] = { -12.0f, -5.0f, 5.0f, 12.0f };
+    for (float shift : semitones) {
+        cases.push_back({ "SimplePitchShifter/semitones:" + formatNumber(shift), [shift](const AudioBuffer& input) {
+            static SimplePitchShifter shifter;
+            shifter.process(input, shift);
+        } });
+    }
+
+    const std::pair<FilterType, const char*> filters[] = {
+        { FilterType::LOW_PASS, "LOW_PASS" },
+        { FilterType::HIGH_PASS, "HIGH_PASS" },
+        { FilterType::BAND_PASS, "BAND_PASS" },
+        { FilterType::ROBOT, "ROBOT" },
+        { FilterType::ECHO, "ECHO" },
+        { FilterType::REVERB, "REVERB" },
+        { FilterType::DISTORTION, "DISTORTION" },
+        { FilterType::AM_RADIO, "AM_RADIO" },
+        { FilterType::CHORUS, "CHORUS" },
+        { FilterType::FLANGER, "FLANGER" },
+        { FilterType::VOICE_CHANGER_MALE_TO_FEMALE, "VOICE_CHANGER_MALE_TO_FEMALE" },
+        { FilterType::VOICE_CHANGER_FEMALE_TO_MALE, "VOICE_CHANGER_FEMALE_TO_MALE" },
+    };
+    for (const auto& filter : filters) {
+        FilterType type = filter.first;
+        cases.push_back({ std::string("VoiceFilter/") + filter.second, [type](const AudioBuffer& input) {
+            static VoiceFilter voiceFilter;
+            voiceFilter.applyFilter(input, type, 0.5f, 0.5f);
+        } });
+    }
+
+    cases.push_back({ "PitchAnalyzer/analyze", [](const AudioBuffer& input) {
+        static PitchAnalyzer analyzer;
+        analyzer.analyze(input);
+    } });
+
+    cases.push_back({ "AudioPreprocessor/process", [](const AudioBuffer& input) {
+        static AudioPreprocessor preprocessor;
+        preprocessor.process(input);
+    } });
+
+    cases.push_back({ "AudioReverser/reverse", [](const AudioBuffer& input) {
+        static AudioReverser reverser;
+        reverser.reverse(input);
+    } });
+
+    return cases;
+}
+
+Result measure(const Case& benchmark, const AudioBuffer& input, double duration, double minTime) {
+    std::vector<double> samples;
+    double elapsed = 0.0;
+
+    // 처리기 로그는 측정에서 제외
+    std::ostringstream discard;
+    std::streambuf* original = std::cout.rdbuf(discard.rdbuf());
+
+    benchmark.run(input);   // 워밍업
+
+    std::clock_t cpuStart = std::clock();
+    while ((elapsed < minTime || (int)samples.size() < MIN_ITERATIONS) && (int)samples.size() < MAX_ITERATIONS) {
+        auto start = std::chrono::steady_clock::now();
+        benchmark.run(input);
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        samples.push_back(seconds * 1e9);
+        elapsed += seconds;
+        discard.str("");
+    }
+    std::clock_t cpuEnd = std::clock();
+    std::cout.rdbuf(original);
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    size_t middle = sorted.size() / 2;
+    double median = sorted.size() % 2 == 1 ? sorted[middle] : 0.5 * (sorted[middle - 1] + sorted[middle]);
+
+    Result result;
+    result.name = benchmark.name + "/" + std::to_string(input.getSampleRate()) + "Hz/" + formatNumber(duration) + "s";
+    result.sampleRate = input.getSampleRate();
+    result.duration = duration;
+    result.iterations = (int)samples.size();
+    result.realNs = median;
+    result.cpuNs = (double)(cpuEnd - cpuStart) / CLOCKS_PER_SEC * 1e9 / samples.size();
+    result.nsPerSample = median / std::max<size_t>(1, input.getLength());
+    result.rtf = median / 1e9 / duration;
+    return result;
+}
+
+std::string escapeJson(const std::string& text) {
+    std::string escaped;
+    for (char ch : text) {
+        if (ch == '"' || ch == '\\') escaped += '\\';
+        escaped += ch;
+    }
+    return escaped;
+}
+
+bool writeJson(const std::string& path, const Options& options, const std::vector<Result>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "[bench_dsp_suite] JSON 파일을 열 수 없음: " << path << std::endl;
+        return false;
+    }
+
+    std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    file << "{\n";
+    file << "  \"context\": {\n";
+    file << "    \"date\": \"" << date << "\",\n";
+    file << "    \"executable\": \"bench_dsp_suite\",\n";
+    file << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+    file << "    \"library_build_type\": \"release\",\n";
+#else
+    file << "    \"library_build_type\": \"debug\",\n";
+#endif
+    file << "    \"min_time\": " << options.minTime << "\n";
+    file << "  },\n";
+    file << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        file << (i == 0 ? "\n" : ",\n");
+        file << "    {\n";
+        file << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+        file << "      \"run_name\": \"" << escapeJson(result.name) << "\",\n";
+        file << "      \"run_type\": \"iteration\",\n";
+        file << "      \"iterations\": " << result.iterations << ",\n";
+        file << std::fixed << std::setprecision(1);
+        file << "      \"real_time\": " << result.realNs << ",\n";
+        file << "      \"cpu_time\": " << result.cpuNs << ",\n";
+        file << "      \"time_unit\": \"ns\",\n";
+        file << "      \"sample_rate\": " << result.sampleRate << ",\n";
+        file << std::setprecision(3);
+        file << "      \"duration_s\": " << result.duration << ",\n";
+        file << "      \"ns_per_sample\": " << result.nsPerSample << ",\n";
+        file << std::setprecision(6);
+        file << "      \"rtf\": " << result.rtf << "\n";
+        file << std::defaultfloat;
+        file << "    }";
+    }
+    file << "\n  ]\n";
+    file << "}\n";
+    return (bool)file;
+}
+
+template <typename T>
+std::vector<T> parseList(const std::string& text) {
+    std::vector<T> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back((T)std::atof(item.c_str()));
+        }
+    }
+    return values;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        std::string key = arg.substr(0, equals);
+        std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+        if (key == "--filter") {
+            options.filter = value;
+        } else if (key == "--rates") {
+            options.sampleRates = parseList<int>(value);
+        } else if (key == "--durations") {
+            options.durations = parseList<double>(value);
+        } else if (key == "--min-time") {
+            options.minTime = std::atof(value.c_str());
+        } else if (key == "--json") {
+            options.jsonPath = value;
+        } else {
+            std::cerr << "알 수 없는 인자: " << arg << std::endl;
+            std::cerr << "사용법: bench_dsp_suite [--filter=이름] [--rates=44100,48000] [--durations=1,5]"
+                      << " [--min-time=0.5] [--json=result.json]" << std::endl;
+            return false;
+        }
+    }
+    if (options.sampleRates.empty() || options.durations.empty()) {
+        std::cerr << "샘플레이트 / 길이 목록이 비어 있음" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    DSP 구성 요소 벤치마크" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    std::vector<Case> cases = buildCases();
+    std::vector<Result> results;
+
+    std::cout << std::left << std::setw(64) << "Benchmark"
+              << std::right << std::setw(12) << "time(ms)"
+              << std::setw(12) << "ns/sample"
+              << std::setw(10) << "RTF"
+              << std::setw(8) << "iters" << std::endl;
+    std::cout << std::string(106, '-') << std::endl;
+
+    for (int sampleRate : options.sampleRates) {
+        for (double duration : options.durations) {
+            AudioBuffer input = generateVoice(sampleRate, duration);
+
+            for (const Case& benchmark : cases) {
+                if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+                    continue;
+                }
+                Result result = measure(benchmark, input, duration, options.minTime);
+                results.push_back(result);
+
+                std::cout << std::left << std::setw(64) << result.name << std::right << std::fixed
+                          << std::setw(12) << std::setprecision(3) << result.realNs / 1e6
+                          << std::setw(12) << std::setprecision(2) << result.nsPerSample
+                          << std::setw(10) << std::setprecision(4) << result.rtf
+                          << std::setw(8) << result.iterations << std::endl;
+            }
+        }
+    }
+
+    if (!options.jsonPath.empty()) {
+        if (!writeJson(options.jsonPath, options, results)) {
+            return 1;
+        }
+        std::cout << std::endl << "JSON 저장: " << options.jsonPath << " (" << results.size() << "개)" << std::endl;
+    }
+
+    return 0;
+}
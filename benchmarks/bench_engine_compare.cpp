@@ -0,0 +1,599 @@
+/**
+ * 엔진 비교 벤치마크: Simple* vs SoundTouch
+ *
+ * main.cpp의 algorithm 문자열로 고를 수 있는 엔진을 같은 입력 / 같은 비율로 실행해
+ * 속도와 품질을 나란히 비교 (프리셋마다 어떤 엔진을 쓸지 수치로 결정하기 위한 자료)
+ *
+ * 엔진 (main.cpp applyUniformTimeStretch / applyUniformPitchShift와 같은 설정):
+ *   - simple:        SimpleTimeStretcher / SimplePitchShifter (LINEAR 리샘플링)
+ *   - simple-sinc16: SimplePitchShifter (SINC_16 리샘플링, pitch만)
+ *   - soundtouch:    soundtouch::SoundTouch (AA 필터 64, sequence 40 / seek 15 / overlap 8 ms)
+ * 호출 방식도 main.cpp와 같음: Simple*는 인스턴스 재사용, SoundTouch는 호출마다 생성
+ *
+ * 입력: 분석적으로 만든 신호 (speech: 성문 펄스열 + 포먼트, music: 화음 + 비브라토)
+ * 기준 출력: 같은 생성기로 "이상적인 결과"를 직접 합성
+ *   - tempo r: 시간축만 r배 (피치 / 포먼트 유지, 비브라토 / 진폭 변화는 r배 빠르게), 길이 / r
+ *   - pitch s: 모든 주파수(기본 주파수, 포먼트)만 2^(s/12)배, 길이 유지 (출력 Nyquist 밖 배음은 제외)
+ *
+ * 측정 항목:
+ *   - x RT: 처리 속도 (오디오 길이 / 처리 시간, 반복 중앙값)
+ *   - latency: 스트리밍 지연 (ms). 128 샘플씩 넣었을 때 첫 출력이 나올 때까지 넣은 입력 길이
+ *              (Simple*는 같은 커널을 쓰는 StreamingTimeStretcher / StreamingPitchShifter로 측정)
+ *   - peak KB / allocs: 엔진 생성부터 출력까지 최대 힙 사용량과 할당 횟수 (첫 호출, 입력 제외 / 출력 포함)
+ *              enable_memory_hooks로 빌드해 두 엔진을 같은 기준(MemoryTracker)으로 집계
+ *   - SC: spectral convergence = ||R| - |O||_F / ||R||_F (STFT 크기, 0에 가까울수록 좋음)
+ *   - LSD: log-spectral distance (dB, 프레임별 RMS의 평균, 작을수록 좋음)
+ *          (두 엔진의 출력 시작 위치 차이를 보정하기 위해 ±4 hop 범위에서 SC가 가장 작은 정렬 사용)
+ *   - len err: 기대 길이 대비 출력 길이 차이 (%)
+ *
+ * 사용법:
+ *   ./bench_engine_compare
+ *   ./bench_engine_compare --rate=48000 --duration=8 --csv=engines.csv
+ */
+
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/dsp/StreamingPitchShifter.h"
+#include "src/dsp/StreamingTimeStretcher.h"
+#include "src/external/kissfft/kiss_fft.h"
+#include "src/performance/MemoryTracker.h"
+#include <SoundTouch.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int ITERATIONS = 5;
+const int STREAM_BLOCK = 128;
+const int FFT_SIZE = 2048;
+const int FFT_HOP = 512;
+const int MAX_ALIGN_HOPS = 4;
+
+struct Options {
+    int sampleRate = 44100;
+    double duration = 4.0;
+    std::string csvPath;
+};
+
+enum class Operation {
+    TEMPO,   // 값: 속도 비율
+    PITCH    // 값: 반음
+};
+
+enum class Engine {
+    SIMPLE,
+    SIMPLE_SINC16,
+    SOUNDTOUCH
+};
+
+const char* engineName(Engine engine) {
+    switch (engine) {
+        case Engine::SIMPLE: return "simple";
+        case Engine::SIMPLE_SINC16: return "simple-sinc16";
+        case Engine::SOUNDTOUCH: return "soundtouch";
+    }
+    return "unknown";
+}
+
+enum class SignalKind {
+    SPEECH,
+    MUSIC
+};
+
+struct Result {
+    std::string signal;
+    Operation operation;
+    float value;
+    Engine engine;
+    double realtimeFactor;   // 오디오 길이 / 처리 시간
+    double latencyMs;
+    double peakKb;
+    uint64_t allocations;
+    double spectralConvergence;
+    double logSpectralDistance;
+    double lengthError;      // %
+};
+
+/**
+ * 분석적 신호 생성
+ * @param timeScale 출력 1초가 원래 신호의 몇 초에 해당하는지 (tempo 비율)
+ * @param pitchScale 모든 주파수에 곱하는 배율
+ */
+std::vector<float> generate(SignalKind kind, int sampleRate, int length, double timeScale, double pitchScale) {
+    std::vector<float> data(length, 0.0f);
+    const double nyquistLimit = 0.45 * sampleRate;
+
+    if (kind == SignalKind::SPEECH) {
+        const double formants[] = { 700.0, 1200.0, 2600.0 };
+        const double maxF0 = 140.0 * 1.18;
+        const int harmonics = (int)(5000.0 / maxF0);
+        double phase = 0.0;
+        for (int i = 0; i < length; ++i) {
+            double t = (double)i / sampleRate * timeScale;
+            double f0 = 140.0 * (1.0 + 0.15 * std::sin(2.0 * M_PI * 0.3 * t) + 0.03 * std::sin(2.0 * M_PI * 5.0 * t));
+            phase += 2.0 * M_PI * f0 * pitchScale / sampleRate;
+
+            double sum = 0.0;
+            for (int h = 1; h <= harmonics && maxF0 * h * pitchScale < nyquistLimit; ++h) {
+                double frequency = h * f0 * pitchScale;
+                double gain = 0.0;
+                for (double formant : formants) {
+                    double d = (frequency - formant * pitchScale) / (150.0 * pitchScale);
+                    gain += std::exp(-0.5 * d * d);
+                }
+                sum += (0.15 + gain) / h * std::sin(h * phase);
+            }
+            double syllable = 0.55 + 0.45 * std::sin(2.0 * M_PI * 2.0 * t);
+            data[i] = (float)(0.3 * sum * syllable);
+        }
+    } else {
+        const double notes[] = { 261.63, 329.63, 392.0 };
+        double phases[3] = { 0.0, 0.0, 0.0 };
+        for (int i = 0; i < length; ++i) {
+            double t = (double)i / sampleRate * timeScale;
+            double vibrato = 1.0 + 0.004 * std::sin(2.0 * M_PI * 5.5 * t);
+            double sum = 0.0;
+            for (int n = 0; n < 3; ++n) {
+                phases[n] += 2.0 * M_PI * notes[n] * vibrato * pitchScale / sampleRate;
+                for (int h = 1; h <= 4 && notes[n] * 1.004 * h * pitchScale < nyquistLimit; ++h) {
+                    sum += 0.5 / (h * h) * std::sin(h * phases[n]);
+                }
+            }
+            data[i] = (float)(0.25 * sum);
+        }
+    }
+    return data;
+}
+
+// ---------------------------------------------------------------------------
+// 엔진 실행
+// ---------------------------------------------------------------------------
+
+// Simple* 인스턴스 (main.cpp의 static 인스턴스처럼 호출 간 재사용)
+struct SimpleEngines {
+    SimpleTimeStretcher stretcher;
+    SimplePitchShifter shifter;
+};
+
+void configureSoundTouch(soundtouch::SoundTouch& st, int sampleRate, Operation operation, float value) {
+    st.setSampleRate(sampleRate);
+    st.setChannels(1);
+    if (operation == Operation::TEMPO) {
+        st.setPitchSemiTones(0.0f);
+        st.setTempo(value);
+    } else {
+        st.setPitchSemiTones(value);
+        st.setTempo(1.0f);
+    }
+    st.setSetting(SETTING_USE_AA_FILTER, 1);
+    st.setSetting(SETTING_AA_FILTER_LENGTH, 64);
+    st.setSetting(SETTING_SEQUENCE_MS, 40);
+    st.setSetting(SETTING_SEEKWINDOW_MS, 15);
+    st.setSetting(SETTING_OVERLAP_MS, 8);
+}
+
+// simple: SOUNDTOUCH이면 사용하지 않음 (nullptr 가능)
+void runEngine(Engine engine, SimpleEngines* simple, const std::vector<float>& input, int sampleRate,
+               Operation operation, float value, std::vector<float>& output) {
+    const int length = (int)input.size();
+
+    if (engine == Engine::SOUNDTOUCH) {
+        soundtouch::SoundTouch st;
+        configureSoundTouch(st, sampleRate, operation, value);
+        st.putSamples(input.data(), length);
+        st.flush();
+
+        float expected = operation == Operation::TEMPO ? length / value : (float)length;
+        output.resize((size_t)expected + 8192);
+        int received = st.receiveSamples(output.data(), output.size());
+        output.resize(received);
+        return;
+    }
+
+    if (operation == Operation::TEMPO) {
+        simple->stretcher.process(input.data(), length, sampleRate, value, output);
+    } else {
+        simple->shifter.setResamplerQuality(engine == Engine::SIMPLE_SINC16 ? ResamplerQuality::SINC_16
+                                                                            : ResamplerQuality::LINEAR);
+        simple->shifter.process(input.data(), length, sampleRate, value, output);
+    }
+}
+
+// 128 샘플씩 넣어 첫 출력이 나올 때까지 넣은 입력 샘플 수
+int measureLatency(Engine engine, const std::vector<float>& input, int sampleRate, Operation operation, float value) {
+    const int length = (int)input.size();
+    int fed = 0;
+
+    if (engine == Engine::SOUNDTOUCH) {
+        soundtouch::SoundTouch st;
+        configureSoundTouch(st, sampleRate, operation, value);
+        while (fed < length) {
+            int frames = std::min(STREAM_BLOCK, length - fed);
+            st.putSamples(input.data() + fed, frames);
+            fed += frames;
+            if (st.numSamples() > 0) {
+                break;
+            }
+        }
+        return fed;
+    }
+
+    std::vector<std::vector<float>> outputs(1);
+    StreamingTimeStretcher stretcher;
+    StreamingPitchShifter shifter;
+    if (operation == Operation::TEMPO) {
+        stretcher.setup(sampleRate, 1, value);
+    } else {
+        shifter.setResamplerQuality(engine == Engine::SIMPLE_SINC16 ? ResamplerQuality::SINC_16
+                                                                    : ResamplerQuality::LINEAR);
+        shifter.setup(sampleRate, 1, value, 1.0f);
+    }
+    while (fed < length && outputs[0].empty()) {
+        int frames = std::min(STREAM_BLOCK, length - fed);
+        const float* block = input.data() + fed;
+        if (operation == Operation::TEMPO) {
+            stretcher.process(&block, frames, outputs);
+        } else {
+            shifter.process(&block, frames, outputs);
+        }
+        fed += frames;
+    }
+    return fed;
+}
+
+// ---------------------------------------------------------------------------
+// 품질 측정
+// ---------------------------------------------------------------------------
+
+// STFT 파워 스펙트럼 (Hann 창, FFT_SIZE / FFT_HOP)
+std::vector<std::vector<float>> powerSpectrogram(const std::vector<float>& data) {
+    std::vector<std::vector<float>> frames;
+    if ((int)data.size() < FFT_SIZE) {
+        return frames;
+    }
+
+    kiss_fft_cfg config = kiss_fft_alloc(FFT_SIZE, 0, nullptr, nullptr);
+    std::vector<kiss_fft_cpx> in(FFT_SIZE);
+    std::vector<kiss_fft_cpx> out(FFT_SIZE);
+    std::vector<float> window(FFT_SIZE);
+    for (int i = 0; i < FFT_SIZE; ++i) {
+        window[i] = (float)(0.5 - 0.5 * std::cos(2.0 * M_PI * i / FFT_SIZE));
+    }
+
+    for (size_t start = 0; start + FFT_SIZE <= data.size(); start += FFT_HOP) {
+        for (int i = 0; i < FFT_SIZE; ++i) {
+            in[i].r = data[start + i] * window[i];
+            in[i].i = 0.0f;
+        }
+        kiss_fft(config, in.data(), out.data());
+
+        std::vector<float> power(FFT_SIZE / 2 + 1);
+        for (int k = 0; k <= FFT_SIZE / 2; ++k) {
+            power[k] = out[k].r * out[k].r + out[k].i * out[k].i;
+        }
+        frames.push_back(std::move(power));
+    }
+    kiss_fft_free(config);
+    return frames;
+}
+
+struct Quality {
+    double spectralConvergence;
+    double logSpectralDistance;
+};
+
+/**
+ * 기준 대비 spectral convergence / log-spectral distance
+ * 출력 프레임을 -MAX_ALIGN_HOPS ~ +MAX_ALIGN_HOPS hop 밀어 보고 SC가 가장 작은 정렬 사용
+ * LSD는 기준 에너지가 최대 프레임 대비 -60 dB 이상인 프레임만, 빈 파워는 최대값 -80 dB로 하한
+ */
+Quality compareSpectra(const std::vector<std::vector<float>>& reference,
+                       const std::vector<std::vector<float>>& output) {
+    Quality best = { 1e9, 1e9 };
+    if (reference.empty() || output.empty()) {
+        return best;
+    }
+
+    double maxBin = 0.0;
+    double maxFrame = 0.0;
+    std::vector<double> frameEnergy(reference.size(), 0.0);
+    for (size_t f = 0; f < reference.size(); ++f) {
+        for (float value : reference[f]) {
+            maxBin = std::max(maxBin, (double)value);
+            frameEnergy[f] += value;
+        }
+        maxFrame = std::max(maxFrame, frameEnergy[f]);
+    }
+    const double floor = maxBin * 1e-8;
+    const double activeFrame = maxFrame * 1e-6;
+
+    for (int shift = -MAX_ALIGN_HOPS; shift <= MAX_ALIGN_HOPS; ++shift) {
+        double difference = 0.0;
+        double energy = 0.0;
+        double lsdSum = 0.0;
+        int lsdFrames = 0;
+
+        for (size_t f = 0; f < reference.size(); ++f) {
+            long o = (long)f + shift;
+            if (o < 0 || o >= (long)output.size()) {
+                continue;
+            }
+            const std::vector<float>& r = reference[f];
+            const std::vector<float>& x = output[o];
+            double squaredLog = 0.0;
+            for (size_t k = 0; k < r.size(); ++k) {
+                double d = std::sqrt((double)r[k]) - std::sqrt((double)x[k]);
+                difference += d * d;
+                energy += r[k];
+                double l = 10.0 * std::log10((r[k] + floor) / (x[k] + floor));
+                squaredLog += l * l;
+            }
+            if (frameEnergy[f] > activeFrame) {
+                lsdSum += std::sqrt(squaredLog / r.size());
+                lsdFrames++;
+            }
+        }
+
+        if (energy <= 0.0 || lsdFrames == 0) {
+            continue;
+        }
+        double sc = std::sqrt(difference / energy);
+        if (sc < best.spectralConvergence) {
+            best.spectralConvergence = sc;
+            best.logSpectralDistance = lsdSum / lsdFrames;
+        }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+
+// 출력을 버리는 streambuf (할당 없음)
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int ch) override { return ch; }
+};
+
+Result measure(const std::string& signalName, const std::vector<float>& input,
+               const std::vector<std::vector<float>>& referenceSpectra, int referenceLength,
+               int sampleRate, Operation operation, float value, Engine engine) {
+    Result result;
+    result.signal = signalName;
+    result.operation = operation;
+    result.value = value;
+    result.engine = engine;
+
+    // 처리기 로그는 버림 (문자열 버퍼에 모으면 그 할당이 힙 사용량에 섞임)
+    NullBuffer discard;
+    std::streambuf* original = std::cout.rdbuf(&discard);
+
+    // 첫 호출: 엔진 생성부터 출력까지 최대 힙 사용량 / 할당 횟수
+    std::vector<float> output;
+    {
+        MemoryTracker::Snapshot before = MemoryTracker::snapshot();
+        int64_t previousPeak = MemoryTracker::beginPeakWindow();
+        {
+            std::unique_ptr<SimpleEngines> cold;
+            if (engine != Engine::SOUNDTOUCH) {
+                cold.reset(new SimpleEngines());
+            }
+            runEngine(engine, cold.get(), input, sampleRate, operation, value, output);
+        }
+        result.peakKb = (MemoryTracker::endPeakWindow(previousPeak) - before.liveBytes) / 1024.0;
+        result.allocations = MemoryTracker::snapshot().allocations - before.allocations;
+        output = std::vector<float>();
+    }
+
+    // 처리 속도 (main.cpp처럼 Simple*는 재사용, SoundTouch는 매번 생성)
+    SimpleEngines simple;
+    runEngine(engine, &simple, input, sampleRate, operation, value, output);   // 워밍업
+    std::vector<double> seconds;
+    for (int iter = 0; iter < ITERATIONS; ++iter) {
+        auto start = std::chrono::steady_clock::now();
+        runEngine(engine, &simple, input, sampleRate, operation, value, output);
+        auto end = std::chrono::steady_clock::now();
+        seconds.push_back(std::chrono::duration<double>(end - start).count());
+    }
+    std::sort(seconds.begin(), seconds.end());
+    double median = seconds[seconds.size() / 2];
+    result.realtimeFactor = (double)input.size() / sampleRate / std::max(median, 1e-9);
+
+    result.latencyMs = measureLatency(engine, input, sampleRate, operation, value) * 1000.0 / sampleRate;
+    std::cout.rdbuf(original);
+
+    Quality quality = compareSpectra(referenceSpectra, powerSpectrogram(output));
+    result.spectralConvergence = quality.spectralConvergence;
+    result.logSpectralDistance = quality.logSpectralDistance;
+    result.lengthError = 100.0 * ((double)output.size() - referenceLength) / referenceLength;
+    return result;
+}
+
+std::string formatValue(Operation operation, float value) {
+    std::ostringstream oss;
+    if (operation == Operation::TEMPO) {
+        oss << "tempo x" << value;
+    } else {
+        oss << "pitch " << (value > 0 ? "+" : "") << value;
+    }
+    return oss.str();
+}
+
+bool writeCsv(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "[bench_engine_compare] CSV 파일을 열 수 없음: " << path << std::endl;
+        return false;
+    }
+    file << "signal,operation,value,engine,x_realtime,latency_ms,peak_kb,allocations,spectral_convergence,lsd_db,length_error_pct\n";
+    for (const Result& result : results) {
+        file << result.signal << ","
+             << (result.operation == Operation::TEMPO ? "tempo" : "pitch") << ","
+             << result.value << ","
+             << engineName(result.engine) << ","
+             << result.realtimeFactor << ","
+             << result.latencyMs << ","
+             << result.peakKb << ","
+             << result.allocations << ","
+             << result.spectralConvergence << ","
+             << result.logSpectralDistance << ","
+             << result.lengthError << "\n";
+    }
+    return (bool)file;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        std::string key = arg.substr(0, equals);
+        std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+        if (key == "--rate") {
+            options.sampleRate = std::atoi(value.c_str());
+        } else if (key == "--duration") {
+            options.duration = std::atof(value.c_str());
+        } else if (key == "--csv") {
+            options.csvPath = value;
+        } else {
+            std::cerr << "알 수 없는 인자: " << arg << std::endl;
+            std::cerr << "사용법: bench_engine_compare [--rate=44100] [--duration=4] [--csv=result.csv]" << std::endl;
+            return false;
+        }
+    }
+    if (options.sampleRate < 8000 || options.duration < 0.5) {
+        std::cerr << "샘플레이트는 8000 이상, 길이는 0.5초 이상이어야 함" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    엔진 비교 벤치마크 (Simple* vs SoundTouch)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << options.sampleRate << " Hz, " << options.duration << " s, 반복 " << ITERATIONS << "회" << std::endl;
+    std::cout << std::endl;
+
+    const int sampleRate = options.sampleRate;
+    const int length = (int)(options.duration * sampleRate);
+
+    const std::vector<std::pair<std::string, SignalKind>> signals = {
+        { "speech", SignalKind::SPEECH },
+        { "music", SignalKind::MUSIC },
+    };
+    const float tempos[] = { 0.5f, 0.75f, 0.9f, 1.1f, 1.25f, 1.5f, 2.0f };
+    const float semitones[] = { -12.0f, -7.0f, -4.0f, -2.0f, 2.0f, 4.0f, 7.0f, 12.0f };
+
+    struct Sweep {
+        Operation operation;
+        float value;
+    };
+    std::vector<Sweep> sweeps;
+    for (float tempo : tempos) sweeps.push_back({ Operation::TEMPO, tempo });
+    for (float shift : semitones) sweeps.push_back({ Operation::PITCH, shift });
+
+    std::vector<Result> results;
+
+    for (const auto& signal : signals) {
+        std::vector<float> input = generate(signal.second, sampleRate, length, 1.0, 1.0);
+
+        std::cout << "[" << signal.first << "]" << std::endl;
+        std::cout << std::left << std::setw(14) << "  변환" << std::setw(16) << "engine"
+                  << std::right << std::setw(9) << "x RT"
+                  << std::setw(12) << "latency ms"
+                  << std::setw(10) << "peak KB"
+                  << std::setw(9) << "allocs"
+                  << std::setw(8) << "SC"
+                  << std::setw(10) << "LSD dB"
+                  << std::setw(10) << "len err%" << std::endl;
+
+        for (const Sweep& sweep : sweeps) {
+            int referenceLength;
+            std::vector<float> reference;
+            if (sweep.operation == Operation::TEMPO) {
+                referenceLength = (int)std::lround(length / sweep.value);
+                reference = generate(signal.second, sampleRate, referenceLength, sweep.value, 1.0);
+            } else {
+                referenceLength = length;
+                reference = generate(signal.second, sampleRate, length, 1.0, std::pow(2.0, sweep.value / 12.0));
+            }
+            std::vector<std::vector<float>> referenceSpectra = powerSpectrogram(reference);
+
+            std::vector<Engine> engines = { Engine::SIMPLE };
+            if (sweep.operation == Operation::PITCH) {
+                engines.push_back(Engine::SIMPLE_SINC16);
+            }
+            engines.push_back(Engine::SOUNDTOUCH);
+
+            for (Engine engine : engines) {
+                Result result = measure(signal.first, input, referenceSpectra, referenceLength, sampleRate,
+                                        sweep.operation, sweep.value, engine);
+                results.push_back(result);
+
+                std::cout << std::left << std::setw(14) << ("  " + formatValue(sweep.operation, sweep.value))
+                          << std::setw(16) << engineName(engine) << std::right << std::fixed
+                          << std::setw(9) << std::setprecision(1) << result.realtimeFactor
+                          << std::setw(12) << std::setprecision(1) << result.latencyMs
+                          << std::setw(10) << std::setprecision(0) << result.peakKb
+                          << std::setw(9) << result.allocations
+                          << std::setw(8) << std::setprecision(3) << result.spectralConvergence
+                          << std::setw(10) << std::setprecision(2) << result.logSpectralDistance
+                          << std::setw(10) << std::setprecision(2) << result.lengthError << std::endl;
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // 변환별 요약: 두 신호 평균 LSD가 가장 작은 엔진 / 가장 빠른 엔진
+    std::cout << "[요약] 변환별 품질 우선 / 속도 우선 엔진 (speech + music 평균)" << std::endl;
+    for (const Sweep& sweep : sweeps) {
+        std::map<Engine, double> lsd;
+        std::map<Engine, double> speed;
+        for (const Result& result : results) {
+            if (result.operation == sweep.operation && result.value == sweep.value) {
+                lsd[result.engine] += result.logSpectralDistance / signals.size();
+                speed[result.engine] += result.realtimeFactor / signals.size();
+            }
+        }
+        auto bestQuality = std::min_element(lsd.begin(), lsd.end(),
+                                            [](const auto& a, const auto& b) { return a.second < b.second; });
+        auto fastest = std::max_element(speed.begin(), speed.end(),
+                                        [](const auto& a, const auto& b) { return a.second < b.second; });
+        std::cout << std::left << std::setw(14) << ("  " + formatValue(sweep.operation, sweep.value))
+                  << "품질: " << std::setw(14) << engineName(bestQuality->first)
+                  << "(LSD " << std::setprecision(2) << bestQuality->second << " dB)   "
+                  << "속도: " << std::setw(14) << engineName(fastest->first)
+                  << "(x" << std::setprecision(1) << fastest->second << ")" << std::endl;
+    }
+
+    if (!options.csvPath.empty()) {
+        if (!writeCsv(options.csvPath, results)) {
+            return 1;
+        }
+        std::cout << std::endl << "CSV 저장: " << options.csvPath << " (" << results.size() << "행)" << std::endl;
+    }
+
+    return 0;
+}
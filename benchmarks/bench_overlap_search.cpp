@@ -0,0 +1,222 @@
+/**
+ * WSOLA 겹침 위치 탐색 벤치마크
+ *
+ * OverlapSearchMode::STANDARD(전체 해상도, 2샘플 간격)와
+ * OverlapSearchMode::HIERARCHICAL(4배 decimation 후 상위 후보만 정밀 확인),
+ * StretchParameterMode::AUTO(비율 기반 파라미터, 피치 곡선 사용 / 미사용)를 같은 입력으로 비교
+ *
+ * 측정 항목:
+ *   1. 세그먼트당 처리 시간 (us): 전체 stretch 시간 / 세그먼트 수
+ *      처리 속도 (ms/s): 입력 1초당 처리 시간 (AUTO는 세그먼트 길이가 달라 이 값으로 비교)
+ *   2. 품질: 이음새 흔들림 (dB)
+ *      - 5.8ms(256 샘플) 구간 에너지의 이웃 구간 간 변화량(dB, RMS)을 입력과 비교
+ *      - 겹침 위치가 어긋나면 크로스페이드 구간에서 위상 상쇄로 에너지가 꺼져 값이 커짐 (0에 가까울수록 좋음)
+ *   3. 품질 차이: 각 방식 - STANDARD (dB, 양수면 STANDARD보다 나쁨)
+ *
+ * 입력:
+ *   - speech: 피치가 흔들리는 성문 펄스열 + 포먼트 대역 강조 + 음절 단위 진폭 변화
+ *   - music: 화음(배음 포함) + 비브라토
+ *
+ * 사용법:
+ *   ./bench_overlap_search
+ */
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int SAMPLE_RATE = 44100;
+const int ITERATIONS = 5;
+const int DURATION_SECONDS = 10;
+
+// 음성과 비슷한 신호: 성문 펄스열(배음 다수) + 포먼트 3개 + 음절 진폭
+std::vector<float> generateSpeech(int length) {
+    std::vector<float> data(length, 0.0f);
+    const double formants[] = { 700.0, 1200.0, 2600.0 };
+    double phase = 0.0;
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / SAMPLE_RATE;
+        double f0 = 140.0 * (1.0 + 0.15 * std::sin(2.0 * M_PI * 0.7 * t) + 0.05 * std::sin(2.0 * M_PI * 5.3 * t));
+        phase += 2.0 * M_PI * f0 / SAMPLE_RATE;
+
+        double sum = 0.0;
+        for (int h = 1; h * f0 < 5000.0; ++h) {
+            double frequency = h * f0;
+            double gain = 0.0;
+            for (double formant : formants) {
+                double d = (frequency - formant) / 150.0;
+                gain += std::exp(-0.5 * d * d);
+            }
+            sum += (0.15 + gain) / h * std::sin(h * phase);
+        }
+
+        // 음절 (약 4 Hz), 음절 사이 짧은 무음
+        double syllable = std::max(0.0, std::sin(2.0 * M_PI * 4.0 * t));
+        data[i] = (float)(0.3 * sum * std::sqrt(syllable));
+    }
+    return data;
+}
+
+// 음악과 비슷한 신호: 3화음 (배음 4개) + 비브라토
+std::vector<float> generateMusic(int length) {
+    std::vector<float> data(length, 0.0f);
+    const double notes[] = { 261.63, 329.63, 392.0 };
+    double phases[3] = { 0.0, 0.0, 0.0 };
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / SAMPLE_RATE;
+        double vibrato = 1.0 + 0.004 * std::sin(2.0 * M_PI * 5.5 * t);
+        double sum = 0.0;
+        for (int n = 0; n < 3; ++n) {
+            phases[n] += 2.0 * M_PI * notes[n] * vibrato / SAMPLE_RATE;
+            for (int h = 1; h <= 4; ++h) {
+                sum += 0.5 / (h * h) * std::sin(h * phases[n]);
+            }
+        }
+        data[i] = (float)(0.25 * sum);
+    }
+    return data;
+}
+
+// 이웃한 256 샘플 구간의 에너지 변화량 (dB, RMS), 거의 무음인 구간은 제외
+double envelopeFlutter(const std::vector<float>& data) {
+    const int window = 256;
+    const double silence = 1e-4;
+    double previous = -1.0;
+    double sum = 0.0;
+    int count = 0;
+    for (size_t start = 0; start + window <= data.size(); start += window) {
+        double energy = 0.0;
+        for (int i = 0; i < window; ++i) {
+            energy += (double)data[start + i] * data[start + i];
+        }
+        energy /= window;
+        if (energy > silence && previous > silence) {
+            double change = 10.0 * std::log10(energy / previous);
+            sum += change * change;
+            count++;
+        }
+        previous = energy;
+    }
+    return count > 0 ? std::sqrt(sum / count) : 0.0;
+}
+
+struct Mode {
+    std::string name;
+    OverlapSearchMode search;
+    StretchParameterMode parameters;
+    bool pitchContour;
+};
+
+} // namespace
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    WSOLA 겹침 위치 탐색 벤치마크" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    const int length = SAMPLE_RATE * DURATION_SECONDS;
+
+    struct Signal {
+        std::string name;
+        std::vector<float> data;
+        std::vector<PitchPoint> contour;
+    };
+    std::vector<Signal> signals;
+    signals.push_back({ "speech", generateSpeech(length), {} });
+    signals.push_back({ "music", generateMusic(length), {} });
+
+    // AUTO + 피치 곡선용 (분석 시간은 측정에서 제외)
+    for (Signal& signal : signals) {
+        AudioBuffer buffer(SAMPLE_RATE, 1);
+        buffer.setData(signal.data);
+        PitchAnalyzer analyzer;
+        signal.contour = analyzer.analyze(buffer);
+    }
+
+    const float ratios[] = { 0.8f, 1.25f };
+    const std::vector<Mode> modes = {
+        { "standard", OverlapSearchMode::STANDARD, StretchParameterMode::FIXED, false },
+        { "hierarchical", OverlapSearchMode::HIERARCHICAL, StretchParameterMode::FIXED, false },
+        { "auto", OverlapSearchMode::STANDARD, StretchParameterMode::AUTO, false },
+        { "auto + pitch", OverlapSearchMode::STANDARD, StretchParameterMode::AUTO, true },
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (const Signal& signal : signals) {
+        const double inputFlutter = envelopeFlutter(signal.data);
+
+        for (float ratio : ratios) {
+            std::cout << "[" << signal.name << ", ratio " << ratio << "]" << std::endl;
+            std::cout << std::left << std::setw(18) << "  탐색"
+                      << std::right << std::setw(14) << "us/segment"
+                      << std::setw(10) << "ms/s"
+                      << std::setw(16) << "흔들림(dB)" << std::endl;
+
+            double baselineMs = 0.0;
+            double baselineFlutter = 0.0;
+
+            for (const Mode& mode : modes) {
+                SimpleTimeStretcher stretcher;
+                stretcher.setSearchMode(mode.search);
+                stretcher.setParameterMode(mode.parameters);
+                if (mode.pitchContour) {
+                    stretcher.setPitchContour(signal.contour);
+                }
+                std::vector<float> output;
+
+                std::ostringstream discard;
+                std::streambuf* original = std::cout.rdbuf(discard.rdbuf());
+
+                // 버퍼 확보 워밍업 (측정에서 제외)
+                stretcher.process(signal.data.data(), length, SAMPLE_RATE, ratio, output);
+
+                auto start = std::chrono::steady_clock::now();
+                for (int iter = 0; iter < ITERATIONS; ++iter) {
+                    stretcher.process(signal.data.data(), length, SAMPLE_RATE, ratio, output);
+                }
+                auto end = std::chrono::steady_clock::now();
+                std::cout.rdbuf(original);
+
+                double totalUs = std::chrono::duration<double, std::micro>(end - start).count();
+                // 세그먼트마다 출력이 (sequence - overlap)만큼 늘어남
+                int segmentStride = (stretcher.getSequenceMs() - stretcher.getOverlapMs()) * SAMPLE_RATE / 1000;
+                int segments = std::max<int>(1, (int)output.size() / segmentStride);
+                double usPerSegment = totalUs / ITERATIONS / segments;
+                double msPerSecond = totalUs / 1000.0 / ITERATIONS / DURATION_SECONDS;
+                double excess = envelopeFlutter(output) - inputFlutter;
+
+                std::cout << std::left << std::setw(18) << ("  " + mode.name)
+                          << std::right << std::setw(14) << usPerSegment
+                          << std::setw(10) << msPerSecond
+                          << std::setw(14) << excess;
+                if (&mode == &modes[0]) {
+                    baselineMs = msPerSecond;
+                    baselineFlutter = excess;
+                } else {
+                    std::cout << "   (속도 x" << (baselineMs / std::max(msPerSecond, 1e-9))
+                              << ", 품질 차이 " << (excess - baselineFlutter) << " dB)";
+                }
+                std::cout << std::endl;
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/**
+ * 내부 처리 샘플레이트 벤치마크
+ *
+ * 입력 샘플레이트(44.1k / 48k / 96k)마다 내부 처리 샘플레이트(원본 / 32k / 24k / 16k)를 바꿔가며
+ * EffectChain("pitch:4;tempo:1.2")과 PitchAnalyzer의 처리 시간과 품질 손실을 측정
+ *
+ * 측정 항목:
+ *   - chain ms / speedup: 변환 포함 EffectChain 처리 시간, 원본 샘플레이트 대비 배속
+ *   - analyze ms: 변환 포함 PitchAnalyzer::analyze 시간
+ *   - roundtrip SNR: 입력 -> 내부 샘플레이트 -> 입력 샘플레이트 왕복 오차
+ *                    (내부 Nyquist를 넘는 배음이 사라지는 대역 손실이 대부분)
+ *   - pitch err: 체인 출력의 중앙값 피치와 기대 피치의 차이 (%)
+ *
+ * 사용법:
+ *   ./bench_processing_rate
+ */
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include "src/dsp/SampleRateConverter.h"
+#include "src/effects/EffectChain.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const float BASE_FREQUENCY = 180.0f;
+const float PITCH_SEMITONES = 4.0f;
+const int ITERATIONS = 3;
+
+// 음성 모델 신호: 기본 주파수 + 1/k 감쇠 배음 (Nyquist 이하까지) + 비브라토 + 약한 잡음
+// (완전한 주기 신호는 WSOLA 탐색이 첫 후보에서 끝나 처리 비용이 과소평가됨)
+std::vector<float> generateVoice(int sampleRate, float duration) {
+    int length = (int)(duration * sampleRate);
+    std::vector<float> data(length, 0.0f);
+    int harmonics = (int)(sampleRate * 0.5f / (BASE_FREQUENCY * 1.02f)) - 1;
+    double phase = 0.0;
+    unsigned int seed = 12345;
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / sampleRate;
+        double frequency = BASE_FREQUENCY * (1.0 + 0.02 * std::sin(2.0 * M_PI * 5.0 * t));
+        phase += 2.0 * M_PI * frequency / sampleRate;
+        double sum = 0.0;
+        for (int k = 1; k <= harmonics; ++k) {
+            sum += std::sin(phase * k) / k;
+        }
+        seed = seed * 1664525u + 1013904223u;
+        double noise = ((seed >> 8) / 16777216.0 - 0.5) * 0.02;
+        data[i] = (float)(0.3 * sum + noise);
+    }
+    return data;
+}
+
+double nowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+float medianPitch(const std::vector<float>& data, int sampleRate) {
+    AudioBuffer buffer(sampleRate, 1);
+    buffer.setData(data);
+    PitchAnalyzer analyzer;
+    analyzer.setMinFrequency(80.0f);
+    analyzer.setMaxFrequency(600.0f);
+    auto points = analyzer.analyze(buffer, 0.03f);
+    if (points.empty()) {
+        return 0.0f;
+    }
+    std::vector<float> freqs;
+    for (const auto& point : points) {
+        freqs.push_back(point.frequency);
+    }
+    std::sort(freqs.begin(), freqs.end());
+    return freqs[freqs.size() / 2];
+}
+
+double roundTripSNR(const std::vector<float>& input, int sampleRate, int processingRate) {
+    if (processingRate >= sampleRate) {
+        return INFINITY;
+    }
+    SampleRateConverter down;
+    SampleRateConverter up;
+    down.setRates(sampleRate, processingRate);
+    up.setRates(processingRate, sampleRate);
+    std::vector<float> low;
+    std::vector<float> restored;
+    down.convert(input.data(), (int)input.size(), low);
+    up.convert(low.data(), (int)low.size(), restored);
+
+    const size_t margin = 1024;
+    size_t length = std::min(input.size(), restored.size());
+    double signal = 0.0;
+    double noise = 0.0;
+    for (size_t i = margin; i + margin < length; ++i) {
+        double diff = restored[i] - input[i];
+        signal += (double)input[i] * input[i];
+        noise += diff * diff;
+    }
+    return 10.0 * std::log10(signal / std::max(noise, 1e-20));
+}
+
+} // namespace
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    내부 처리 샘플레이트 벤치마크" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    const int inputRates[] = { 44100, 48000, 96000 };
+    const int processingRates[] = { 0, 32000, 24000, 16000 };
+    const float expectedPitch = BASE_FREQUENCY * std::pow(2.0f, PITCH_SEMITONES / 12.0f);
+
+    // DSP 로그 출력 억제 (측정 결과만 출력)
+    std::ostringstream discard;
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (int sampleRate : inputRates) {
+        std::vector<float> input = generateVoice(sampleRate, 3.0f);
+
+        std::cout << "[입력 " << sampleRate << " Hz, 3초]" << std::endl;
+        std::cout << std::left << std::setw(12) << "  rate"
+                  << std::right << std::setw(11) << "chain ms" << std::setw(9) << "speedup"
+                  << std::setw(13) << "analyze ms" << std::setw(16) << "roundtrip SNR"
+                  << std::setw(12) << "pitch err" << std::endl;
+
+        double baselineMs = 0.0;
+        for (int processingRate : processingRates) {
+            EffectChain chain;
+            std::ostringstream spec;
+            spec << "pitch:" << PITCH_SEMITONES << ";tempo:1.2";
+            if (processingRate > 0) {
+                spec << ";rate:" << processingRate;
+            }
+            chain.parse(spec.str());
+
+            std::streambuf* original = std::cout.rdbuf(discard.rdbuf());
+
+            // 체인 처리 (첫 호출은 워밍업: 버퍼/sinc 테이블 준비)
+            std::vector<float> output = chain.process(input.data(), (int)input.size(), sampleRate);
+            double start = nowMs();
+            for (int iter = 0; iter < ITERATIONS; ++iter) {
+                output = chain.process(input.data(), (int)input.size(), sampleRate);
+            }
+            double chainMs = (nowMs() - start) / ITERATIONS;
+
+            // 분석 (변환 포함)
+            int analysisRate = (processingRate > 0) ? processingRate : sampleRate;
+            start = nowMs();
+            std::vector<float> analysisInput = input;
+            if (processingRate > 0) {
+                SampleRateConverter converter;
+                converter.setRates(sampleRate, processingRate);
+                converter.convert(input.data(), (int)input.size(), analysisInput);
+            }
+            AudioBuffer analysisBuffer(analysisRate, 1);
+            analysisBuffer.setData(analysisInput);
+            PitchAnalyzer analyzer;
+            analyzer.analyze(analysisBuffer);
+            double analyzeMs = nowMs() - start;
+
+            float measured = medianPitch(output, sampleRate);
+            double snr = roundTripSNR(input, sampleRate, analysisRate);
+            std::cout.rdbuf(original);
+
+            if (processingRate == 0) {
+                baselineMs = chainMs;
+            }
+            float pitchError = std::abs(measured - expectedPitch) / expectedPitch * 100.0f;
+            std::string label = (processingRate > 0) ? std::to_string(processingRate) : "native";
+
+            std::cout << std::left << std::setw(12) << ("  " + label)
+                      << std::right << std::setw(11) << chainMs
+                      << std::setw(8) << baselineMs / chainMs << "x"
+                      << std::setw(13) << analyzeMs
+                      << std::setw(13) << snr << " dB"
+                      << std::setw(11) << pitchError << "%" << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,542 @@
+/**
+ * 성능 회귀 검사 (bench_dsp_suite 기준값 비교)
+ *
+ * bench_dsp_suite를 여러 번 실행해 벤치마크마다 real_time의 중앙값 / MAD를 구하고
+ * 기준 파일에 저장된 같은 기계의 값과 비교. 느려진 벤치마크가 있으면 표로 보여 주고 실패(종료 코드 1)
+ *
+ * 잡음 처리:
+ *   - 실행 간 흔들림은 평균 / 표준편차 대신 중앙값 / MAD(중앙 절대 편차)로 요약 (튀는 실행 하나에 흔들리지 않음)
+ *   - 회귀 판정: 변화율 > threshold 이고 차이 > noise-k * (기준 σ + 현재 σ), σ = 1.4826 * MAD
+ *     (두 조건을 모두 만족해야 하므로 원래 흔들림이 큰 벤치마크는 차이가 더 커야 회귀로 봄)
+ *
+ * 기준 파일 (JSON, 기계별로 따로 저장):
+ *   { "machines": { "<기계 ID>": { "date": "...", "runs": 5,
+ *                                  "benchmarks": { "<이름>": { "median": ns, "mad": ns }, ... } }, ... } }
+ *   기계 ID: 호스트 이름 / CPU 모델 / 코어 수 (--machine으로 지정 가능)
+ *
+ * 종료 코드: 0 = 통과 (또는 --update), 1 = 회귀 있음 / 실행 실패, 2 = 이 기계의 기준값 없음
+ *
+ * 사용법:
+ *   ./bench_regression --update                 (현재 결과를 이 기계의 기준값으로 저장)
+ *   ./bench_regression                          (기준값과 비교)
+ *   ./bench_regression --runs=7 --threshold=0.05 --filter=SimpleTimeStretcher --rates=44100 --durations=5
+ *
+ * 옵션:
+ *   --baseline=경로     기준 파일 (기본: 실행 파일 옆 bench_baseline.json)
+ *   --suite=경로        bench_dsp_suite 실행 파일 (기본: 실행 파일 옆)
+ *   --runs=N            suite 실행 횟수 (기본 5)
+ *   --threshold=비율    허용 변화율 (기본 0.10 = 10%)
+ *   --noise-k=배수      잡음 배수 (기본 3)
+ *   --machine=ID        기계 ID 직접 지정
+ *   --filter / --rates / --durations / --min-time   bench_dsp_suite에 그대로 전달
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+const double MAD_TO_SIGMA = 1.4826;   // 정규분포에서 MAD -> 표준편차
+
+struct Options {
+    std::string baselinePath;
+    std::string suitePath;
+    std::string machine;
+    std::string suiteArgs;   // bench_dsp_suite에 전달할 인자
+    int runs = 5;
+    double threshold = 0.10;
+    double noiseK = 3.0;
+    bool update = false;
+};
+
+// ---------------------------------------------------------------------------
+// 최소 JSON 읽기 (bench_dsp_suite 출력 / 기준 파일 용도)
+// ---------------------------------------------------------------------------
+
+struct JsonValue {
+    enum class Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+    Type type = Type::NUL;
+    double number = 0.0;
+    std::string text;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* find(const std::string& key) const {
+        for (const auto& member : members) {
+            if (member.first == key) {
+                return &member.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& source) : source_(source), pos_(0) {}
+
+    bool parse(JsonValue& value) {
+        if (!parseValue(value)) {
+            return false;
+        }
+        skipSpace();
+        return pos_ == source_.size();
+    }
+
+private:
+    const std::string& source_;
+    size_t pos_;
+
+    void skipSpace() {
+        while (pos_ < source_.size() && std::isspace((unsigned char)source_[pos_])) {
+            pos_++;
+        }
+    }
+
+    bool consume(char expected) {
+        skipSpace();
+        if (pos_ < source_.size() && source_[pos_] == expected) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool parseString(std::string& text) {
+        if (!consume('"')) {
+            return false;
+        }
+        text.clear();
+        while (pos_ < source_.size() && source_[pos_] != '"') {
+            char ch = source_[pos_++];
+            if (ch == '\\' && pos_ < source_.size()) {
+                char escaped = source_[pos_++];
+                switch (escaped) {
+                    case 'n': ch = '\n'; break;
+                    case 't': ch = '\t'; break;
+                    case 'r': ch = '\r'; break;
+                    default: ch = escaped; break;   // \" \\ \/ (\uXXXX는 이 도구의 입력에 없음)
+                }
+            }
+            text += ch;
+        }
+        return consume('"');
+    }
+
+    bool parseValue(JsonValue& value) {
+        skipSpace();
+        if (pos_ >= source_.size()) {
+            return false;
+        }
+        char ch = source_[pos_];
+
+        if (ch == '{') {
+            pos_++;
+            value.type = JsonValue::Type::OBJECT;
+            if (consume('}')) {
+                return true;
+            }
+            do {
+                std::pair<std::string, JsonValue> member;
+                if (!parseString(member.first) || !consume(':') || !parseValue(member.second)) {
+                    return false;
+                }
+                value.members.push_back(std::move(member));
+            } while (consume(','));
+            return consume('}');
+        }
+        if (ch == '[') {
+            pos_++;
+            value.type = JsonValue::Type::ARRAY;
+            if (consume(']')) {
+                return true;
+            }
+            do {
+                JsonValue item;
+                if (!parseValue(item)) {
+                    return false;
+                }
+                value.items.push_back(std::move(item));
+            } while (consume(','));
+            return consume(']');
+        }
+        if (ch == '"') {
+            value.type = JsonValue::Type::STRING;
+            return parseString(value.text);
+        }
+        if (source_.compare(pos_, 4, "true") == 0 || source_.compare(pos_, 5, "false") == 0) {
+            value.type = JsonValue::Type::BOOLEAN;
+            value.number = source_[pos_] == 't' ? 1.0 : 0.0;
+            pos_ += source_[pos_] == 't' ? 4 : 5;
+            return true;
+        }
+        if (source_.compare(pos_, 4, "null") == 0) {
+            value.type = JsonValue::Type::NUL;
+            pos_ += 4;
+            return true;
+        }
+
+        const char* start = source_.c_str() + pos_;
+        char* end = nullptr;
+        value.number = std::strtod(start, &end);
+        if (end == start) {
+            return false;
+        }
+        value.type = JsonValue::Type::NUMBER;
+        pos_ += end - start;
+        return true;
+    }
+};
+
+bool readJsonFile(const std::string& path, JsonValue& value) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string source = buffer.str();
+    JsonParser parser(source);
+    return parser.parse(value);
+}
+
+// ---------------------------------------------------------------------------
+// 기준값
+// ---------------------------------------------------------------------------
+
+struct Statistic {
+    double median = 0.0;   // ns
+    double mad = 0.0;      // ns
+};
+
+struct MachineBaseline {
+    std::string date;
+    int runs = 0;
+    std::map<std::string, Statistic> benchmarks;
+};
+
+using BaselineFile = std::map<std::string, MachineBaseline>;
+
+bool loadBaselines(const std::string& path, BaselineFile& baselines) {
+    JsonValue root;
+    if (!readJsonFile(path, root)) {
+        return false;
+    }
+    const JsonValue* machines = root.find("machines");
+    if (!machines || machines->type != JsonValue::Type::OBJECT) {
+        return false;
+    }
+    for (const auto& machine : machines->members) {
+        MachineBaseline& baseline = baselines[machine.first];
+        if (const JsonValue* date = machine.second.find("date")) baseline.date = date->text;
+        if (const JsonValue* runs = machine.second.find("runs")) baseline.runs = (int)runs->number;
+        const JsonValue* benchmarks = machine.second.find("benchmarks");
+        if (!benchmarks) {
+            continue;
+        }
+        for (const auto& benchmark : benchmarks->members) {
+            Statistic& statistic = baseline.benchmarks[benchmark.first];
+            if (const JsonValue* median = benchmark.second.find("median")) statistic.median = median->number;
+            if (const JsonValue* mad = benchmark.second.find("mad")) statistic.mad = mad->number;
+        }
+    }
+    return true;
+}
+
+std::string escapeJson(const std::string& text) {
+    std::string escaped;
+    for (char ch : text) {
+        if (ch == '"' || ch == '\\') escaped += '\\';
+        escaped += ch;
+    }
+    return escaped;
+}
+
+bool saveBaselines(const std::string& path, const BaselineFile& baselines) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "[bench_regression] 기준 파일을 쓸 수 없음: " << path << std::endl;
+        return false;
+    }
+    file << std::fixed << std::setprecision(1);
+    file << "{\n  \"machines\": {";
+    bool firstMachine = true;
+    for (const auto& machine : baselines) {
+        file << (firstMachine ? "\n" : ",\n");
+        firstMachine = false;
+        file << "    \"" << escapeJson(machine.first) << "\": {\n";
+        file << "      \"date\": \"" << escapeJson(machine.second.date) << "\",\n";
+        file << "      \"runs\": " << machine.second.runs << ",\n";
+        file << "      \"benchmarks\": {";
+        bool firstBenchmark = true;
+        for (const auto& benchmark : machine.second.benchmarks) {
+            file << (firstBenchmark ? "\n" : ",\n");
+            firstBenchmark = false;
+            file << "        \"" << escapeJson(benchmark.first) << "\": { \"median\": " << benchmark.second.median
+                 << ", \"mad\": " << benchmark.second.mad << " }";
+        }
+        file << "\n      }\n    }";
+    }
+    file << "\n  }\n}\n";
+    return (bool)file;
+}
+
+// ---------------------------------------------------------------------------
+// suite 실행
+// ---------------------------------------------------------------------------
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+Statistic summarize(const std::vector<double>& values) {
+    Statistic statistic;
+    statistic.median = median(values);
+    std::vector<double> deviations;
+    for (double value : values) {
+        deviations.push_back(std::abs(value - statistic.median));
+    }
+    statistic.mad = median(deviations);
+    return statistic;
+}
+
+/**
+ * bench_dsp_suite를 runs번 실행해 벤치마크별 real_time 목록을 모음
+ * @return 성공 여부 (실행 실패 / JSON 읽기 실패면 false)
+ */
+bool runSuite(const Options& options, std::map<std::string, std::vector<double>>& samples) {
+    const std::string jsonPath = (std::filesystem::temp_directory_path() /
+                                  ("bench_regression_" + std::to_string(getpid()) + ".json")).string();
+    const std::string command = "\"" + options.suitePath + "\" --json=\"" + jsonPath + "\"" + options.suiteArgs +
+                                " > /dev/null";
+
+    for (int run = 0; run < options.runs; ++run) {
+        std::cout << "  suite 실행 " << (run + 1) << "/" << options.runs << "..." << std::endl;
+        if (std::system(command.c_str()) != 0) {
+            std::cerr << "[bench_regression] suite 실행 실패: " << command << std::endl;
+            return false;
+        }
+
+        JsonValue root;
+        const JsonValue* benchmarks = nullptr;
+        if (readJsonFile(jsonPath, root)) {
+            benchmarks = root.find("benchmarks");
+        }
+        if (!benchmarks || benchmarks->type != JsonValue::Type::ARRAY) {
+            std::cerr << "[bench_regression] suite 결과를 읽을 수 없음: " << jsonPath << std::endl;
+            return false;
+        }
+        for (const JsonValue& benchmark : benchmarks->items) {
+            const JsonValue* name = benchmark.find("name");
+            const JsonValue* realTime = benchmark.find("real_time");
+            if (name && realTime) {
+                samples[name->text].push_back(realTime->number);
+            }
+        }
+    }
+    std::filesystem::remove(jsonPath);
+    return true;
+}
+
+std::string detectMachine() {
+    char host[256] = {};
+    if (gethostname(host, sizeof(host) - 1) != 0) {
+        std::snprintf(host, sizeof(host), "unknown");
+    }
+
+    std::string cpu = "unknown-cpu";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) {
+                cpu = line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+            break;
+        }
+    }
+    return std::string(host) + " / " + cpu + " / " + std::to_string(std::thread::hardware_concurrency()) + " cpus";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    const std::filesystem::path directory = std::filesystem::path(argv[0]).parent_path();
+    options.baselinePath = (directory / "bench_baseline.json").string();
+    options.suitePath = (directory / "bench_dsp_suite").string();
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        std::string key = arg.substr(0, equals);
+        std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+        if (key == "--baseline") {
+            options.baselinePath = value;
+        } else if (key == "--suite") {
+            options.suitePath = value;
+        } else if (key == "--runs") {
+            options.runs = std::atoi(value.c_str());
+        } else if (key == "--threshold") {
+            options.threshold = std::atof(value.c_str());
+        } else if (key == "--noise-k") {
+            options.noiseK = std::atof(value.c_str());
+        } else if (key == "--machine") {
+            options.machine = value;
+        } else if (key == "--update") {
+            options.update = true;
+        } else if (key == "--filter" || key == "--rates" || key == "--durations" || key == "--min-time") {
+            options.suiteArgs += " \"" + arg + "\"";
+        } else {
+            std::cerr << "알 수 없는 인자: " << arg << std::endl;
+            std::cerr << "사용법: bench_regression [--update] [--baseline=bench_baseline.json] [--runs=5]"
+                      << " [--threshold=0.1] [--noise-k=3] [--machine=ID] [--filter=...] [--rates=...]"
+                      << " [--durations=...] [--min-time=...]" << std::endl;
+            return false;
+        }
+    }
+    if (options.runs < 1 || options.threshold < 0.0 || options.noiseK < 0.0) {
+        std::cerr << "runs >= 1, threshold >= 0, noise-k >= 0 이어야 함" << std::endl;
+        return false;
+    }
+    if (options.machine.empty()) {
+        options.machine = detectMachine();
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    성능 회귀 검사" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "기계: " << options.machine << std::endl;
+    std::cout << "기준 파일: " << options.baselinePath << std::endl;
+    std::cout << std::endl;
+
+    BaselineFile baselines;
+    bool hasFile = loadBaselines(options.baselinePath, baselines);
+    if (!hasFile && std::filesystem::exists(options.baselinePath)) {
+        std::cerr << "[bench_regression] 기준 파일 형식 오류: " << options.baselinePath << std::endl;
+        return 1;
+    }
+
+    std::map<std::string, std::vector<double>> samples;
+    if (!runSuite(options, samples)) {
+        return 1;
+    }
+    std::map<std::string, Statistic> current;
+    for (const auto& entry : samples) {
+        current[entry.first] = summarize(entry.second);
+    }
+    std::cout << std::endl;
+
+    if (options.update) {
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        MachineBaseline& baseline = baselines[options.machine];
+        baseline.date = date;
+        baseline.runs = options.runs;
+        // 이번에 실행한 벤치마크만 갱신 (--filter로 일부만 다시 잰 경우 나머지는 유지)
+        for (const auto& entry : current) {
+            baseline.benchmarks[entry.first] = entry.second;
+        }
+        if (!saveBaselines(options.baselinePath, baselines)) {
+            return 1;
+        }
+        std::cout << "기준값 저장: " << current.size() << "개 (" << options.baselinePath << ")" << std::endl;
+        return 0;
+    }
+
+    auto machine = baselines.find(options.machine);
+    if (machine == baselines.end()) {
+        std::cerr << "이 기계의 기준값이 없음: " << options.machine << std::endl;
+        std::cerr << "먼저 --update로 기준값을 저장해야 함" << std::endl;
+        return 2;
+    }
+
+    std::cout << "기준값: " << machine->second.date << " (" << machine->second.runs << "회 실행)" << std::endl;
+    std::cout << "판정: 변화 > " << options.threshold * 100.0 << "% 이고 차이 > " << options.noiseK
+              << " x (기준 σ + 현재 σ)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << std::left << std::setw(64) << "Benchmark"
+              << std::right << std::setw(12) << "base(ms)"
+              << std::setw(12) << "now(ms)"
+              << std::setw(10) << "change"
+              << std::setw(10) << "noise"
+              << "  결과" << std::endl;
+    std::cout << std::string(114, '-') << std::endl;
+
+    int regressions = 0;
+    int improvements = 0;
+    int missing = 0;
+    for (const auto& entry : current) {
+        auto base = machine->second.benchmarks.find(entry.first);
+        if (base == machine->second.benchmarks.end()) {
+            std::cout << std::left << std::setw(64) << entry.first << std::right << std::setw(12) << "-"
+                      << std::fixed << std::setprecision(3) << std::setw(12) << entry.second.median / 1e6
+                      << std::setw(10) << "-" << std::setw(10) << "-" << "  (기준값 없음)" << std::endl;
+            missing++;
+            continue;
+        }
+
+        const Statistic& before = base->second;
+        const Statistic& now = entry.second;
+        double change = before.median > 0.0 ? now.median / before.median - 1.0 : 0.0;
+        double noise = options.noiseK * MAD_TO_SIGMA * (before.mad + now.mad);
+        double difference = now.median - before.median;
+
+        std::string verdict = "ok";
+        if (change > options.threshold && difference > noise) {
+            verdict = "REGRESSION";
+            regressions++;
+        } else if (-change > options.threshold && -difference > noise) {
+            verdict = "개선";
+            improvements++;
+        } else if (std::abs(change) > options.threshold) {
+            verdict = "ok (잡음 범위)";
+        }
+
+        std::cout << std::left << std::setw(64) << entry.first << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(12) << before.median / 1e6
+                  << std::setw(12) << now.median / 1e6
+                  << std::setprecision(1) << std::setw(9) << change * 100.0 << "%"
+                  << std::setw(9) << (now.median > 0.0 ? noise / now.median * 100.0 : 0.0) << "%"
+                  << "  " << verdict << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "회귀 " << regressions << "개, 개선 " << improvements << "개, 기준값 없음 " << missing << "개 / 전체 "
+              << current.size() << "개" << std::endl;
+    if (regressions > 0) {
+        std::cout << "성능 회귀 검사 실패" << std::endl;
+        return 1;
+    }
+    std::cout << "성능 회귀 검사 통과" << std::endl;
+    return 0;
+}
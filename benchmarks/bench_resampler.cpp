@@ -0,0 +1,194 @@
+/**
+ * 리샘플러 벤치마크
+ *
+ * Resampler 품질 단계(LINEAR / CUBIC / SINC_16 / SINC_64)와
+ * SoundTouch InterpolateShannon을 같은 입력으로 비교
+ *
+ * 측정 항목:
+ *   1. 처리 속도: 출력 샘플당 ns
+ *   2. 품질: 이상적인 결과(해석적으로 계산한 사인파 합) 대비 SNR (dB)
+ *      - pitch up (ratio 1.5): 새 Nyquist를 넘는 17kHz 성분이 앨리어싱으로 남는지 확인
+ *      - pitch down (ratio 0.8): 보간 오차 (고역 성분 손실)
+ *
+ * 사용법:
+ *   ./bench_resampler
+ */
+
+#include "src/dsp/Resampler.h"
+#include <FIFOSampleBuffer.h>
+#include <SoundTouch/RateTransposer.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int SAMPLE_RATE = 44100;
+const int ITERATIONS = 5;
+
+struct Tone {
+    double frequency;
+    double amplitude;
+};
+
+std::vector<float> generateTones(const std::vector<Tone>& tones, int length) {
+    std::vector<float> data(length, 0.0f);
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / SAMPLE_RATE;
+        double sum = 0.0;
+        for (const Tone& tone : tones) {
+            sum += tone.amplitude * std::sin(2.0 * M_PI * tone.frequency * t);
+        }
+        data[i] = (float)sum;
+    }
+    return data;
+}
+
+// 이상적인 리샘플 결과: 출력 Nyquist 이하 성분만 주파수 * ratio로 이동
+std::vector<float> idealOutput(const std::vector<Tone>& tones, double ratio, int length) {
+    std::vector<Tone> passed;
+    for (const Tone& tone : tones) {
+        if (tone.frequency * ratio < SAMPLE_RATE * 0.5) {
+            passed.push_back({ tone.frequency * ratio, tone.amplitude });
+        }
+    }
+    return generateTones(passed, length);
+}
+
+// SNR (dB): 양 끝 1024 샘플 제외, 지연 차이(-8 ~ +8 샘플) 중 최적값 사용
+double measureSNR(const std::vector<float>& output, const std::vector<float>& ideal) {
+    const int margin = 1024;
+    int length = (int)std::min(output.size(), ideal.size());
+    if (length <= margin * 2) {
+        return 0.0;
+    }
+
+    double best = -1e9;
+    for (int lag = -8; lag <= 8; ++lag) {
+        double signal = 0.0;
+        double noise = 0.0;
+        for (int i = margin; i < length - margin; ++i) {
+            double ref = ideal[i];
+            double diff = output[i + lag] - ref;
+            signal += ref * ref;
+            noise += diff * diff;
+        }
+        double snr = 10.0 * std::log10(signal / std::max(noise, 1e-20));
+        best = std::max(best, snr);
+    }
+    return best;
+}
+
+// SoundTouch InterpolateShannon (RateTransposer 내부 보간기, 안티앨리어싱 필터 없음)
+void processShannon(const std::vector<float>& input, double ratio, std::vector<float>& output) {
+    soundtouch::TransposerBase::setAlgorithm(soundtouch::TransposerBase::SHANNON);
+    std::unique_ptr<soundtouch::TransposerBase> transposer(soundtouch::TransposerBase::newInstance());
+    transposer->setChannels(1);
+    transposer->setRate(ratio);
+
+    soundtouch::FIFOSampleBuffer src(1);
+    soundtouch::FIFOSampleBuffer dest(1);
+    src.putSamples(input.data(), (unsigned int)input.size());
+    transposer->transpose(dest, src);
+
+    output.resize(dest.numSamples());
+    dest.receiveSamples(output.data(), (unsigned int)output.size());
+}
+
+struct Method {
+    std::string name;
+    bool soundtouch;
+    ResamplerQuality quality;
+};
+
+} // namespace
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    리샘플러 벤치마크" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    const int length = SAMPLE_RATE * 10;  // 10초
+
+    // pitch up 입력: 통과 대역 3개 + 새 Nyquist를 넘는 17kHz
+    const std::vector<Tone> upTones = {
+        { 440.0, 0.4 }, { 2000.0, 0.2 }, { 5000.0, 0.1 }, { 17000.0, 0.1 }
+    };
+    // pitch down 입력: 고역까지 포함 (보간 오차 확인)
+    const std::vector<Tone> downTones = {
+        { 440.0, 0.4 }, { 2000.0, 0.2 }, { 5000.0, 0.1 }, { 10000.0, 0.1 }
+    };
+
+    struct Scenario {
+        std::string name;
+        double ratio;
+        std::vector<float> input;
+        std::vector<float> ideal;
+    };
+    std::vector<Scenario> scenarios;
+    scenarios.push_back({ "pitch up (ratio 1.5)", 1.5, generateTones(upTones, length),
+                          idealOutput(upTones, 1.5, (int)(length / 1.5)) });
+    scenarios.push_back({ "pitch down (ratio 0.8)", 0.8, generateTones(downTones, length),
+                          idealOutput(downTones, 0.8, (int)(length / 0.8)) });
+
+    const std::vector<Method> methods = {
+        { "linear", false, ResamplerQuality::LINEAR },
+        { "cubic", false, ResamplerQuality::CUBIC },
+        { "sinc-16", false, ResamplerQuality::SINC_16 },
+        { "sinc-64", false, ResamplerQuality::SINC_64 },
+        { "soundtouch-shannon", true, ResamplerQuality::LINEAR },
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (const Scenario& scenario : scenarios) {
+        std::cout << "[" << scenario.name << "]" << std::endl;
+        std::cout << std::left << std::setw(22) << "  방식"
+                  << std::right << std::setw(14) << "ns/sample"
+                  << std::setw(12) << "SNR(dB)" << std::endl;
+
+        for (const Method& method : methods) {
+            Resampler resampler;
+            resampler.setQuality(method.quality);
+            std::vector<float> output;
+
+            // 테이블 생성/캐시 워밍업 (측정에서 제외)
+            if (method.soundtouch) {
+                processShannon(scenario.input, scenario.ratio, output);
+            } else {
+                resampler.process(scenario.input.data(), (int)scenario.input.size(),
+                                  (float)scenario.ratio, output);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int iter = 0; iter < ITERATIONS; ++iter) {
+                if (method.soundtouch) {
+                    processShannon(scenario.input, scenario.ratio, output);
+                } else {
+                    resampler.process(scenario.input.data(), (int)scenario.input.size(),
+                                      (float)scenario.ratio, output);
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            double totalNs = std::chrono::duration<double, std::nano>(end - start).count();
+            double nsPerSample = totalNs / ITERATIONS / std::max<size_t>(1, output.size());
+
+            std::cout << std::left << std::setw(22) << ("  " + method.name)
+                      << std::right << std::setw(14) << nsPerSample
+                      << std::setw(12) << measureSNR(output, scenario.ideal) << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * 스트리밍 파일 처리 벤치마크 / 실행 도구
+ *
+ * 인자 없이 실행하면 10분짜리 스테레오 PCM16 WAV를 청크 단위로 생성한 뒤
+ * 스테이지 목록 몇 가지를 StreamingPipeline으로 처리하고
+ * realtime factor와 최대 메모리 사용량(peak RSS)을 출력
+ * (입력 길이와 상관없이 메모리가 일정해야 함: 목표 32 MB 미만)
+ *
+ * 측정 항목:
+ *   - RTF: 처리 시간 / 오디오 길이 (1보다 작으면 실시간보다 빠름)
+ *   - read / process / write: 스레드별 작업 시간 (처리와 겹치므로 합이 전체보다 클 수 있음)
+ *   - buffers: 청크 / 스테이지 사이 버퍼 메모리
+ *   - peak RSS: 프로세스 최대 상주 메모리 (getrusage)
+ *
+ * 사용법:
+ *   ./bench_streaming_pipeline                                  (생성한 입력으로 벤치마크)
+ *   ./bench_streaming_pipeline input.wav output.wav "pitch:3;tempo:1.2" [chunkFrames]
+ */
+
+#include "src/audio/WavFile.h"
+#include "src/effects/StreamingPipeline.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int SAMPLE_RATE = 44100;
+const int CHANNELS = 2;
+const int DURATION_SECONDS = 600;
+const size_t MEMORY_LIMIT_BYTES = 32u * 1024 * 1024;
+
+double peakRssMegabytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;   // Linux: KB 단위
+}
+
+// 음성과 비슷한 신호 (주파수가 천천히 변하는 배음 + 음절 단위 진폭 변화)를 청크 단위로 기록
+bool generateInput(const std::string& path) {
+    WavWriter writer;
+    if (!writer.open(path, SAMPLE_RATE, CHANNELS, WavSampleFormat::PCM16)) {
+        return false;
+    }
+
+    const int block = 8192;
+    std::vector<float> interleaved((size_t)block * CHANNELS);
+    const long long total = (long long)DURATION_SECONDS * SAMPLE_RATE;
+    double phase = 0.0;
+    for (long long start = 0; start < total; start += block) {
+        int frames = (int)std::min<long long>(block, total - start);
+        for (int i = 0; i < frames; ++i) {
+            double t = (double)(start + i) / SAMPLE_RATE;
+            double f = 160.0 * (1.0 + 0.15 * std::sin(2.0 * M_PI * 0.7 * t));
+            phase += 2.0 * M_PI * f / SAMPLE_RATE;
+            float envelope = 0.6f + 0.4f * (float)std::sin(2.0 * M_PI * 3.0 * t);
+            float voice = envelope * (0.5f * (float)std::sin(phase) + 0.2f * (float)std::sin(2.0 * phase) +
+                                      0.1f * (float)std::sin(3.0 * phase));
+            interleaved[(size_t)i * CHANNELS] = voice;
+            interleaved[(size_t)i * CHANNELS + 1] = 0.8f * voice;
+        }
+        if (!writer.writeFrames(interleaved.data(), frames)) {
+            return false;
+        }
+    }
+    return writer.close();
+}
+
+bool runSpec(const std::string& inputPath, const std::string& outputPath, const std::string& spec,
+             int chunkFrames, StreamingPipelineReport& report) {
+    StreamingPipeline pipeline;
+    if (!pipeline.parse(spec)) {
+        return false;
+    }
+    pipeline.setChunkFrames(chunkFrames);
+    return pipeline.processFile(inputPath, outputPath, &report);
+}
+
+void printReport(const std::string& spec, const StreamingPipelineReport& report) {
+    std::cout << std::left << std::setw(40) << ("  " + spec)
+              << std::right << std::setprecision(4) << std::setw(8) << report.realtimeFactor
+              << std::setprecision(2) << std::setw(9) << report.readSeconds
+              << std::setw(9) << report.processSeconds
+              << std::setw(9) << report.writeSeconds
+              << std::setw(10) << report.bufferBytes / (1024.0 * 1024.0)
+              << std::setw(10) << peakRssMegabytes() << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // 파일 하나 처리 (실행 도구)
+    if (argc >= 4) {
+        int chunkFrames = argc >= 5 ? std::atoi(argv[4]) : 16384;
+        StreamingPipelineReport report;
+        if (!runSpec(argv[1], argv[2], argv[3], chunkFrames, report)) {
+            return 1;
+        }
+        std::cout << "peak RSS: " << peakRssMegabytes() << " MB" << std::endl;
+        return 0;
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    스트리밍 파일 처리 벤치마크" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    const std::string inputPath = "bench_streaming_input.wav";
+    const std::string outputPath = "bench_streaming_output.wav";
+
+    std::cout << "입력 생성: " << DURATION_SECONDS / 60 << "분, " << SAMPLE_RATE << " Hz, "
+              << CHANNELS << "채널 PCM16" << std::endl;
+    if (!generateInput(inputPath)) {
+        std::cerr << "입력 생성 실패" << std::endl;
+        return 1;
+    }
+    std::cout << "생성 후 peak RSS: " << std::fixed << std::setprecision(2) << peakRssMegabytes()
+              << " MB" << std::endl << std::endl;
+
+    const char* specs[] = {
+        "gain:0.8",
+        "tempo:1.25",
+        "pitch:4,2",
+        "pitch:3,2;tempo:1.2;gain:0.9",
+        "pitch:-3;filter:4,0.4,0.5",
+        "pitch:5;tempo:0.9;rate:24000",
+    };
+
+    // 처리 로그 억제 (측정 결과만 출력)
+    std::ostringstream discard;
+    std::streambuf* original = std::cout.rdbuf();
+
+    std::cout << std::left << std::setw(40) << "  spec"
+              << std::right << std::setw(8) << "RTF" << std::setw(9) << "read s"
+              << std::setw(9) << "proc s" << std::setw(9) << "write s"
+              << std::setw(10) << "buf MB" << std::setw(10) << "RSS MB" << std::endl;
+
+    bool ok = true;
+    for (const char* spec : specs) {
+        StreamingPipelineReport report;
+        std::cout.rdbuf(discard.rdbuf());
+        bool processed = runSpec(inputPath, outputPath, spec, 16384, report);
+        std::cout.rdbuf(original);
+        discard.str("");
+        if (!processed) {
+            std::cerr << "처리 실패: " << spec << std::endl;
+            ok = false;
+            continue;
+        }
+        printReport(spec, report);
+    }
+
+    double peak = peakRssMegabytes();
+    std::cout << std::endl;
+    std::cout << "peak RSS " << peak << " MB (목표 " << MEMORY_LIMIT_BYTES / (1024 * 1024) << " MB 미만): "
+              << (peak < MEMORY_LIMIT_BYTES / (1024.0 * 1024.0) ? "OK" : "초과") << std::endl;
+
+    std::remove(inputPath.c_str());
+    std::remove(outputPath.c_str());
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/**
+ * PerformanceChecker 구간당 오버헤드 벤치마크
+ *
+ * WSOLA 세그먼트마다 startFunction / endFunction을 켜 둔 채로 운영할 수 있는지 확인
+ * (벽시계 상한은 부하 / sanitizer 빌드에서 흔들리므로 ctest가 아닌 여기서 검사)
+ *
+ * 측정 항목 (구간당 ns, 반복 5회 중앙값):
+ *   1. 시계 읽기 2회 (구간마다 시작 / 끝에서 steady_clock을 읽으므로 줄일 수 없는 하한)
+ *   2. 트레이스 모드 (단일 스레드)
+ *   3. 트레이스 모드 + 메모리 집계
+ *   4. 트레이스 모드 (4 스레드 동시 기록, 스레드당)
+ *   5. 계층 API (호출마다 문자열 / 컨텍스트 생성, 같은 위치 호출은 노드 하나로 합침)
+ *
+ * 상한은 트레이스 모드에서 시계 읽기를 뺀 측정기 자체 비용에 적용
+ * (시계 비용은 환경마다 다름: vDSO면 약 20 ns, 가상 머신 / 컨테이너에서는 40 ns 이상)
+ *
+ * 사용법:
+ *   ./bench_trace_overhead
+ *   ./bench_trace_overhead --budget-ns=50   (측정기 자체 비용이 상한을 넘으면 종료 코드 1)
+ */
+
+#include "src/performance/PerformanceChecker.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int ITERATIONS = 5;
+const int SCOPES = 1000000;
+const int THREADS = 4;
+
+// 구간 scopes개 기록 시간 (구간당 ns)
+double measureScopes(PerformanceChecker& checker, int scopes) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scopes; ++i) {
+        checker.startFunction("scope");
+        checker.endFunction();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / scopes;
+}
+
+// 구간 하나에서 읽는 만큼 (시작 / 끝 2회) 시계만 읽는 시간
+double measureClockReads(int scopes) {
+    int64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scopes; ++i) {
+        sink += std::chrono::steady_clock::now().time_since_epoch().count();
+        sink -= std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+    auto end = std::chrono::steady_clock::now();
+    volatile int64_t keep = sink;   // 최적화로 루프가 사라지지 않도록
+    (void)keep;
+    return std::chrono::duration<double, std::nano>(end - start).count() / scopes;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+double measureClock() {
+    std::vector<double> times;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        times.push_back(measureClockReads(SCOPES));
+    }
+    return median(times);
+}
+
+double measureTrace(bool memoryTracking) {
+    std::vector<double> times;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        PerformanceChecker checker;
+        checker.setTraceMode(true, 1 << 12);
+        checker.setMemoryTracking(memoryTracking);
+        checker.startFeature("overhead");
+        measureScopes(checker, 1000);   // 레이블 캐시 / 통계 준비
+        times.push_back(measureScopes(checker, SCOPES));
+        checker.endFeature();
+    }
+    return median(times);
+}
+
+double measureTraceThreads() {
+    std::vector<double> times;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        PerformanceChecker checker;
+        checker.setTraceMode(true, 1 << 12);
+        std::vector<double> perThread(THREADS);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&checker, &perThread, t]() {
+                measureScopes(checker, 1000);
+                perThread[t] = measureScopes(checker, SCOPES / THREADS);
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        times.push_back(*std::max_element(perThread.begin(), perThread.end()));
+    }
+    return median(times);
+}
+
+double measureHierarchical() {
+    std::vector<double> times;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        PerformanceChecker checker;
+        checker.startFeature("overhead");
+        checker.startFunction("root");
+        times.push_back(measureScopes(checker, SCOPES / 10));
+        checker.endFunction();
+        checker.endFeature();
+    }
+    return median(times);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double budgetNs = 50.0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--budget-ns=", 0) == 0) {
+            budgetNs = std::stod(arg.substr(12));
+        } else {
+            std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "    PerformanceChecker 구간당 오버헤드" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    double clock = measureClock();
+    double trace = measureTrace(false);
+    double traceMemory = measureTrace(true);
+    double traceThreads = measureTraceThreads();
+    double hierarchical = measureHierarchical();
+
+    // (레이블이 한글이라 setw로 맞추지 않고 숫자를 앞에 출력)
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::setw(10) << clock << " ns  시계 읽기 2회 (하한)" << std::endl;
+    std::cout << std::setw(10) << trace << " ns  트레이스 모드" << std::endl;
+    std::cout << std::setw(10) << traceMemory << " ns  트레이스 모드 + 메모리 집계" << std::endl;
+    std::cout << std::setw(10) << traceThreads << " ns  트레이스 모드 (4 스레드, 스레드당)" << std::endl;
+    std::cout << std::setw(10) << hierarchical << " ns  계층 API" << std::endl;
+    std::cout << std::endl;
+
+    double overhead = std::max(0.0, trace - clock);
+    bool ok = overhead < budgetNs;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << "트레이스 모드 구간당 시계 읽기 외 " << overhead << " ns ("
+              << budgetNs << " ns 미만)" << std::endl;
+    return ok ? 0 : 1;
+}
@@ -19,10 +19,21 @@ CPP_FILES=(
     "src/analysis/PitchAnalyzer.cpp"
     "src/effects/VoiceFilter.cpp"
     "src/effects/AudioReverser.cpp"
+    "src/effects/EffectChain.cpp"
+    "src/effects/ProcessingSession.cpp"
+    "src/effects/StreamingChain.cpp"
+    "src/effects/StreamingVoiceFilter.cpp"
+    "src/effects/RealtimeProcessor.cpp"
     "src/performance/PerformanceChecker.cpp"
+    "src/performance/TaskPool.cpp"
     # 직접 구현한 DSP 알고리즘
     "src/dsp/SimplePitchShifter.cpp"
+    "src/dsp/Resampler.cpp"
+    "src/dsp/SampleRateConverter.cpp"
+    "src/dsp/VariablePitchRenderer.cpp"
     "src/dsp/SimpleTimeStretcher.cpp"
+    "src/dsp/StreamingTimeStretcher.cpp"
+    "src/dsp/StreamingPitchShifter.cpp"
     # SoundTouch 라이브러리 (핵심 파일만)
     "src/external/soundtouch/source/SoundTouch/SoundTouch.cpp"
     "src/external/soundtouch/source/SoundTouch/FIFOSampleBuffer.cpp"
@@ -43,25 +54,31 @@ CPP_FILES=(
 echo "Creating dist/ directory..."
 mkdir -p dist
 
+# 공통 컴파일 옵션
+COMMON_FLAGS=(
+  -s WASM=1
+  -s ALLOW_MEMORY_GROWTH=1
+  -s EXPORTED_FUNCTIONS='["_malloc", "_free", "_realtime_create", "_realtime_destroy", "_realtime_configure", "_realtime_set_profile", "_realtime_set_search_policy", "_realtime_set_crossfade", "_realtime_input", "_realtime_output", "_realtime_render", "_realtime_latency", "_realtime_dropouts"]'
+  -s EXPORTED_RUNTIME_METHODS='["ccall", "cwrap", "HEAPF32"]'
+  -s MODULARIZE=1
+  -s EXPORT_ES6=0
+  -s SINGLE_FILE=0
+  --bind
+  -O3
+  -I./src
+  -I./src/external/soundtouch/include
+  -I./src/external/soundtouch/source
+  -I./src/external/kissfft
+)
+
 # WASM 빌드 (dist/로 출력)
-echo "Building WASM..."
+# 단일 스레드 빌드: GitHub Pages처럼 COOP/COEP 헤더를 줄 수 없는 호스트에서 사용
+echo "Building WASM (single-threaded)..."
 em++ "${CPP_FILES[@]}" \
   -o dist/main.js \
-  -s WASM=1 \
-  -s ALLOW_MEMORY_GROWTH=1 \
-  -s EXPORTED_FUNCTIONS='["_malloc", "_free"]' \
-  -s EXPORTED_RUNTIME_METHODS='["ccall", "cwrap", "HEAPF32"]' \
-  -s MODULARIZE=1 \
+  "${COMMON_FLAGS[@]}" \
   -s EXPORT_NAME='Module' \
-  -s EXPORT_ES6=0 \
-  -s ENVIRONMENT='web' \
-  -s SINGLE_FILE=0 \
-  --bind \
-  -O3 \
-  -I./src \
-  -I./src/external/soundtouch/include \
-  -I./src/external/soundtouch/source \
-  -I./src/external/kissfft
+  -s ENVIRONMENT='web'
 
 if [ $? -ne 0 ]; then
     echo ""
@@ -69,6 +86,37 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
+# 멀티스레드 빌드: crossOriginIsolated 페이지에서만 로드됨 (build.sh 참고)
+echo "Building WASM (pthreads)..."
+em++ "${CPP_FILES[@]}" \
+  -o dist/main-mt.js \
+  "${COMMON_FLAGS[@]}" \
+  -pthread \
+  -s PTHREAD_POOL_SIZE=7 \
+  -s EXPORT_NAME='ModuleMT' \
+  -s ENVIRONMENT='web,worker'
+
+if [ $? -ne 0 ]; then
+    echo ""
+    echo "✗ WASM pthreads build failed!"
+    exit 1
+fi
+
+# AudioWorklet 빌드: ES6 모듈, worklet 환경 (build.sh 참고)
+echo "Building WASM (AudioWorklet)..."
+em++ "${CPP_FILES[@]}" \
+  -o dist/main-worklet.mjs \
+  "${COMMON_FLAGS[@]}" \
+  -s EXPORT_ES6=1 \
+  -s EXPORT_NAME='createRealtimeModule' \
+  -s ENVIRONMENT='worklet'
+
+if [ $? -ne 0 ]; then
+    echo ""
+    echo "✗ WASM AudioWorklet build failed!"
+    exit 1
+fi
+
 echo ""
 echo "✓ WASM build completed!"
 echo ""
@@ -103,6 +151,9 @@ cp dist/main.js dist/cpp/
 cp dist/main.wasm dist/cpp/
 cp dist/main.js dist/app/
 cp dist/main.wasm dist/app/
+cp dist/main-mt.js dist/main-mt.wasm dist/app/
+cp dist/main-mt.worker.js dist/app/ 2>/dev/null || true
+cp dist/main-worklet.mjs dist/main-worklet.wasm dist/app/
 
 echo "✓ Static files copied!"
 echo ""
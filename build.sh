@@ -27,10 +27,21 @@ CPP_FILES=(
     "src/analysis/PitchAnalyzer.cpp"
     "src/effects/VoiceFilter.cpp"
     "src/effects/AudioReverser.cpp"
+    "src/effects/EffectChain.cpp"
+    "src/effects/ProcessingSession.cpp"
+    "src/effects/StreamingChain.cpp"
+    "src/effects/StreamingVoiceFilter.cpp"
+    "src/effects/RealtimeProcessor.cpp"
     "src/performance/PerformanceChecker.cpp"
+    "src/performance/TaskPool.cpp"
     # 직접 구현한 DSP 알고리즘
     "src/dsp/SimplePitchShifter.cpp"
+    "src/dsp/Resampler.cpp"
+    "src/dsp/SampleRateConverter.cpp"
+    "src/dsp/VariablePitchRenderer.cpp"
     "src/dsp/SimpleTimeStretcher.cpp"
+    "src/dsp/StreamingTimeStretcher.cpp"
+    "src/dsp/StreamingPitchShifter.cpp"
     # SoundTouch 라이브러리 (핵심 파일만)
     "src/external/soundtouch/source/SoundTouch/SoundTouch.cpp"
     "src/external/soundtouch/source/SoundTouch/FIFOSampleBuffer.cpp"
@@ -47,37 +58,84 @@ CPP_FILES=(
     "src/external/kissfft/kiss_fft.c"
 )
 
-# 컴파일 (SIMD 및 최적화 옵션 추가)
+# 공통 컴파일 옵션 (SIMD 및 최적화 옵션 추가)
+COMMON_FLAGS=(
+  -s WASM=1
+  -s ALLOW_MEMORY_GROWTH=1
+  -s EXPORTED_FUNCTIONS='["_malloc", "_free", "_realtime_create", "_realtime_destroy", "_realtime_configure", "_realtime_set_profile", "_realtime_set_search_policy", "_realtime_set_crossfade", "_realtime_input", "_realtime_output", "_realtime_render", "_realtime_latency", "_realtime_dropouts"]'
+  -s EXPORTED_RUNTIME_METHODS='["ccall", "cwrap", "HEAPF32"]'
+  -s MODULARIZE=1
+  -s EXPORT_ES6=0
+  -s SINGLE_FILE=0
+  --bind
+  -O3
+  -msimd128
+  -ffast-math
+  -I./src
+  -I./src/external/soundtouch/include
+  -I./src/external/soundtouch/source
+  -I./src/external/kissfft
+)
+
+# 1. 단일 스레드 빌드 (cross-origin isolation이 없는 호스트용 기본 빌드)
+echo "[1/3] 단일 스레드 빌드 (main.js)"
 em++ "${CPP_FILES[@]}" \
   -o web/app/main.js \
-  -s WASM=1 \
-  -s ALLOW_MEMORY_GROWTH=1 \
-  -s EXPORTED_FUNCTIONS='["_malloc", "_free"]' \
-  -s EXPORTED_RUNTIME_METHODS='["ccall", "cwrap", "HEAPF32"]' \
-  -s MODULARIZE=1 \
+  "${COMMON_FLAGS[@]}" \
   -s EXPORT_NAME='Module' \
-  -s EXPORT_ES6=0 \
-  -s ENVIRONMENT='web' \
-  -s SINGLE_FILE=0 \
-  --bind \
-  -O3 \
-  -msimd128 \
-  -ffast-math \
-  -I./src \
-  -I./src/external/soundtouch/include \
-  -I./src/external/soundtouch/source \
-  -I./src/external/kissfft
+  -s ENVIRONMENT='web'
+
+if [ $? -ne 0 ]; then
+    echo ""
+    echo "✗ 빌드 실패!"
+    exit 1
+fi
+
+# 2. 멀티스레드 빌드 (SharedArrayBuffer 필요: COOP/COEP 헤더로 crossOriginIsolated인 페이지에서만 사용)
+#    - TaskPool이 분석 프레임 / 채널 / 리샘플 구간을 작업자 스레드에 나눠 실행
+#    - PTHREAD_POOL_SIZE: TaskPool 최대 작업자 수(MAX_THREADS - 1)만큼 미리 생성
+#      (처리 중에 작업자 생성을 기다리지 않도록)
+#    - PROXY_TO_PTHREAD는 main()을 작업자로 옮기는 옵션이라 main()이 없는 embind 모듈에는 사용하지 않음
+#    - embind 호출은 parallelFor가 끝날 때까지 호출한 스레드를 막으므로 앱은 이 빌드를
+#      전용 Worker(js/WasmProcessingWorker.js)에서 불러와 호출 (메인 스레드 / UI는 막히지 않음)
+echo "[2/3] 멀티스레드 빌드 (main-mt.js)"
+em++ "${CPP_FILES[@]}" \
+  -o web/app/main-mt.js \
+  "${COMMON_FLAGS[@]}" \
+  -pthread \
+  -s PTHREAD_POOL_SIZE=7 \
+  -s EXPORT_NAME='ModuleMT' \
+  -s ENVIRONMENT='web,worker'
+
+if [ $? -ne 0 ]; then
+    echo ""
+    echo "✗ 빌드 실패!"
+    exit 1
+fi
+
+# 3. AudioWorklet 빌드 (AudioWorkletGlobalScope에서 realtime_* C API 사용)
+#    - worklet은 module script로 불러오므로 ES6 모듈 (js/RealtimeWorkletProcessor.js가 import)
+#    - worklet 안에는 fetch가 없으므로 wasm은 메인 스레드가 읽어 processorOptions.wasmBinary로 전달
+echo "[3/3] AudioWorklet 빌드 (main-worklet.mjs)"
+em++ "${CPP_FILES[@]}" \
+  -o web/app/main-worklet.mjs \
+  "${COMMON_FLAGS[@]}" \
+  -s EXPORT_ES6=1 \
+  -s EXPORT_NAME='createRealtimeModule' \
+  -s ENVIRONMENT='worklet'
 
 if [ $? -eq 0 ]; then
     echo ""
     echo "✓ 빌드 완료!"
     echo ""
     echo "생성된 파일:"
-    echo "  - web/app/main.js"
-    echo "  - web/app/main.wasm"
+    echo "  - web/app/main.js, web/app/main.wasm (단일 스레드)"
+    echo "  - web/app/main-mt.js, web/app/main-mt.wasm, web/app/main-mt.worker.js (멀티스레드)"
+    echo "  - web/app/main-worklet.mjs, web/app/main-worklet.wasm (AudioWorklet)"
     echo ""
     echo "웹 서버 실행:"
-    echo "  ./runserver.sh"
+    echo "  ./runserver.sh          (단일 스레드 빌드 사용)"
+    echo "  ./serve-isolated.sh     (COOP/COEP 헤더 -> 멀티스레드 빌드 사용)"
     echo ""
 else
     echo ""
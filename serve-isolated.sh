@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# cross-origin isolated 웹 서버 (멀티스레드 WASM 빌드 테스트용)
+# SharedArrayBuffer를 쓰려면 페이지가 다음 헤더로 제공되어야 함:
+#   Cross-Origin-Opener-Policy: same-origin
+#   Cross-Origin-Embedder-Policy: credentialless  (CDN 스크립트(d3)를 CORP 헤더 없이 로드하기 위해)
+# 헤더가 없으면 앱은 단일 스레드 빌드(main.js)를 사용
+# 사용법: ./serve-isolated.sh [port]
+
+PORT="${1:-8088}"
+
+echo "cross-origin isolated 웹 서버를 시작합니다..."
+echo "  - 메인 앱: http://localhost:${PORT}/web/"
+echo ""
+echo "종료하려면 Ctrl+C를 누르세요"
+echo ""
+
+python3 - "$PORT" <<'PYEOF'
+import sys
+from http.server import SimpleHTTPRequestHandler, ThreadingHTTPServer
+
+class IsolatedHandler(SimpleHTTPRequestHandler):
+    def end_headers(self):
+        self.send_header("Cross-Origin-Opener-Policy", "same-origin")
+        self.send_header("Cross-Origin-Embedder-Policy", "credentialless")
+        super().end_headers()
+
+ThreadingHTTPServer(("", int(sys.argv[1])), IsolatedHandler).serve_forever()
+PYEOF
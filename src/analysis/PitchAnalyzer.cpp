@@ -1,4 +1,6 @@
 #include "PitchAnalyzer.h"
+#include "../audio/ChannelLayout.h"
+#include "../performance/TaskPool.h"
 #include <algorithm>
 
 using namespace std;
@@ -13,23 +15,47 @@ PitchAnalyzer::~PitchAnalyzer() {
 vector<PitchPoint> PitchAnalyzer::analyze(const AudioBuffer& buffer, float frameSize) {
     vector<PitchPoint> pitchPoints;
 
-    const auto& data = buffer.getData();
+    // 다채널 / planar는 채널 평균(mid)으로 분석 (모노 interleaved는 복사 없이 그대로)
+    vector<float> mid;
+    int channels = max(1, buffer.getChannels());
+    if (buffer.isPlanar()) {
+        vector<const float*> planes = buffer.getChannelPointers();
+        if (!planes.empty() && buffer.getFrameCount() > 0) {
+            ChannelLayout::mixToMid(planes.data(), channels, (int)buffer.getFrameCount(), mid);
+        }
+    } else if (channels > 1) {
+        ChannelLayout::mixInterleavedToMid(buffer.getData().data(), (int)buffer.getFrameCount(), channels, mid);
+    }
+    const auto& data = (buffer.isPlanar() || channels > 1) ? mid : buffer.getData();
     int sampleRate = buffer.getSampleRate();
     int frameLength = static_cast<int>(frameSize * sampleRate);
     int hopSize = frameLength / 2; // 50% overlap
 
-    // 예상 포인트 개수만큼 메모리 미리 확보
-    size_t estimatedPoints = (data.size() - frameLength) / hopSize + 1;
-    pitchPoints.reserve(estimatedPoints);
+    // 프레임 수 (i + frameLength < data.size()인 시작 위치 개수)
+    int frameCount = 0;
+    if (hopSize > 0 && data.size() > static_cast<size_t>(frameLength)) {
+        frameCount = static_cast<int>((data.size() - frameLength - 1) / hopSize) + 1;
+    }
 
-    for (size_t i = 0; i + frameLength < data.size(); i += hopSize) {
-        vector<float> frame(data.begin() + i, data.begin() + i + frameLength);
+    // 프레임끼리 독립이므로 병렬로 추출한 뒤 순서대로 모음 (스레드 수와 상관없이 같은 결과)
+    vector<PitchResult> results(frameCount);
+    TaskPool::getInstance().parallelFor(frameCount, PARALLEL_GRAIN, [&](int begin, int end) {
+        vector<float> frame(frameLength);
+        for (int f = begin; f < end; ++f) {
+            size_t i = static_cast<size_t>(f) * hopSize;
+            std::copy(data.begin() + i, data.begin() + i + frameLength, frame.begin());
+            results[f] = extractPitch(frame, sampleRate, minFreq_, maxFreq_);
+        }
+    });
 
-        PitchResult result = extractPitch(frame, sampleRate, minFreq_, maxFreq_);
+    // 예상 포인트 개수만큼 메모리 미리 확보
+    pitchPoints.reserve(frameCount);
 
+    for (int f = 0; f < frameCount; ++f) {
+        const PitchResult& result = results[f];
         if (result.frequency > 0.0f) {
             PitchPoint point;
-            point.time = static_cast<float>(i) / sampleRate;
+            point.time = static_cast<float>(static_cast<size_t>(f) * hopSize) / sampleRate;
             point.frequency = result.frequency;
             point.confidence = result.confidence;  // 실제 계산된 신뢰도 사용
             pitchPoints.push_back(point);
@@ -44,13 +70,23 @@ vector<PitchPoint> PitchAnalyzer::analyzeFrames(const vector<FrameData>& frames,
     vector<PitchPoint> pitchPoints;
     pitchPoints.reserve(frames.size()); // 최대 프레임 개수만큼 확보
 
-    for (const auto& frame : frames) {
-        // VAD 체크: 음성 구간만 분석
-        if (!frame.isVoice) {
-            continue;
+    // 프레임별 추출은 병렬로, 결과는 순서대로 모음
+    vector<PitchResult> results(frames.size());
+    TaskPool::getInstance().parallelFor((int)frames.size(), PARALLEL_GRAIN, [&](int begin, int end) {
+        for (int f = begin; f < end; ++f) {
+            // VAD 체크: 음성 구간만 분석
+            if (!frames[f].isVoice) {
+                results[f].frequency = 0.0f;
+                results[f].confidence = 0.0f;
+                continue;
+            }
+            results[f] = extractPitch(frames[f].samples, sampleRate, minFreq_, maxFreq_);
         }
+    });
 
-        PitchResult result = extractPitch(frame.samples, sampleRate, minFreq_, maxFreq_);
+    for (size_t f = 0; f < frames.size(); ++f) {
+        const auto& frame = frames[f];
+        const PitchResult& result = results[f];
 
         if (result.frequency > 0.0f) {
             PitchPoint point;
@@ -39,6 +39,9 @@ private:
     float minFreq_;
     float maxFreq_;
 
+    // 병렬 처리 구간의 최소 프레임 수
+    static const int PARALLEL_GRAIN = 32;
+
     // Autocorrelation 계산
     std::vector<float> calculateAutocorrelation(const std::vector<float>& signal);
 
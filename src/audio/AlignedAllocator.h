@@ -0,0 +1,57 @@
+/**
+ * AlignedAllocator.h
+ *
+ * 정렬된 메모리 할당자 (std::vector용)
+ * SIMD 커널이 정렬된 load/store를 쓸 수 있도록 시작 주소를 Alignment 바이트 경계에 맞춤
+ * (AudioBuffer의 planar 저장소: 64바이트 = 캐시 라인, AVX-512 / 32바이트 AVX / 16바이트 SSE·WASM SIMD 모두 만족)
+ * 할당 / 해제는 MemoryTracker에 기록
+ */
+
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include "../performance/MemoryTracker.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+template <typename T, std::size_t Alignment>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment는 2의 거듭제곱이어야 함");
+    static_assert(Alignment >= alignof(T), "Alignment는 타입 정렬 이상이어야 함");
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept {}
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t count) {
+        T* ptr = static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        MemoryTracker::recordAllocation(count * sizeof(T));
+        return ptr;
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        MemoryTracker::recordRelease(count * sizeof(T));
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+// 64바이트 정렬 float 배열
+using AlignedFloatVector = std::vector<float, AlignedAllocator<float, 64>>;
+
+#endif // ALIGNED_ALLOCATOR_H
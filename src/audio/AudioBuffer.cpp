@@ -1,26 +1,49 @@
 #include "AudioBuffer.h"
+#include "ChannelLayout.h"
+#include <algorithm>
+#include <iostream>
 
 AudioBuffer::AudioBuffer()
-    : sampleRate_(44100), channels_(1) {
+    : sampleRate_(44100), channels_(1),
+      planar_(false), planarFrames_(0), planarStride_(0), alignment_(0) {
 }
 
 AudioBuffer::AudioBuffer(int sampleRate, int channels)
-    : sampleRate_(sampleRate), channels_(channels) {
+    : sampleRate_(sampleRate), channels_(channels),
+      planar_(false), planarFrames_(0), planarStride_(0), alignment_(0) {
 }
 
 AudioBuffer::~AudioBuffer() {
+    syncMemory();
+}
+
+void AudioBuffer::syncMemory() {
+    memory_.update(capacityBytes(data_) + capacityBytes(pitchCurve_));
 }
 
 void AudioBuffer::setData(const std::vector<float>& data) {
+    // interleaved 모드로 전환
+    planarData_.clear();
+    planar_ = false;
+    planarFrames_ = 0;
     data_ = data;
+    syncMemory();
 }
 
 void AudioBuffer::appendData(const std::vector<float>& data) {
+    if (planar_) {
+        convertToInterleaved();
+    }
     data_.insert(data_.end(), data.begin(), data.end());
+    syncMemory();
 }
 
 void AudioBuffer::clear() {
     data_.clear();
+    planarData_.clear();
+    planar_ = false;
+    planarFrames_ = 0;
+    syncMemory();
 }
 
 const std::vector<float>& AudioBuffer::getData() const {
@@ -40,12 +63,22 @@ int AudioBuffer::getChannels() const {
 }
 
 size_t AudioBuffer::getLength() const {
+    if (planar_) {
+        return planarFrames_ * channels_;
+    }
     return data_.size();
 }
 
+size_t AudioBuffer::getFrameCount() const {
+    if (planar_) {
+        return planarFrames_;
+    }
+    return channels_ > 0 ? data_.size() / channels_ : 0;
+}
+
 float AudioBuffer::getDuration() const {
     if (sampleRate_ == 0 || channels_ == 0) return 0.0f;
-    return static_cast<float>(data_.size()) / (sampleRate_ * channels_);
+    return static_cast<float>(getLength()) / (sampleRate_ * channels_);
 }
 
 void AudioBuffer::setSampleRate(int rate) {
@@ -53,12 +86,150 @@ void AudioBuffer::setSampleRate(int rate) {
 }
 
 void AudioBuffer::setChannels(int channels) {
+    if (planar_ && channels != channels_) {
+        // plane 수가 바뀌므로 interleaved로 되돌린 뒤 변경
+        convertToInterleaved();
+    }
+    channels_ = channels;
+}
+
+// Planar 저장 모드
+bool AudioBuffer::isPlanar() const {
+    return planar_;
+}
+
+size_t AudioBuffer::validAlignment(size_t alignment) {
+    if (alignment != 16 && alignment != 32 && alignment != 64) {
+        std::cerr << "[AudioBuffer] 지원하지 않는 정렬: " << alignment << " (32 사용)" << std::endl;
+        return 32;
+    }
+    return alignment;
+}
+
+size_t AudioBuffer::alignedStride(size_t frames, size_t alignment) {
+    const size_t floatsPerBlock = alignment / sizeof(float);
+    return (frames + floatsPerBlock - 1) / floatsPerBlock * floatsPerBlock;
+}
+
+void AudioBuffer::allocatePlanar(int channels, size_t frames, size_t alignment) {
+    alignment_ = validAlignment(alignment);
+    planarFrames_ = frames;
+    planarStride_ = alignedStride(frames, alignment_);
+    // 저장소 시작은 64바이트 정렬, stride가 alignment 배수이므로 모든 plane이 정렬됨
+    planarData_.assign(planarStride_ * std::max(0, channels), 0.0f);
+    planar_ = true;
+}
+
+void AudioBuffer::convertToPlanar(size_t alignment) {
+    if (planar_) {
+        if (validAlignment(alignment) == alignment_) {
+            return;
+        }
+        // 정렬만 바꾸는 경우: interleaved를 거쳐 다시 배치
+        convertToInterleaved();
+    }
+
+    const int channels = std::max(1, channels_);
+    const size_t frames = data_.size() / channels;
+    allocatePlanar(channels, frames, alignment);
+
+    std::vector<float*> planes(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c] = planarData_.data() + c * planarStride_;
+    }
+    ChannelLayout::deinterleave(data_.data(), (int)frames, channels, planes.data());
+
+    // interleaved 저장소 해제 (두 배 메모리 사용 방지)
+    std::vector<float>().swap(data_);
+    syncMemory();
+}
+
+void AudioBuffer::convertToInterleaved() {
+    if (!planar_) {
+        return;
+    }
+
+    const int channels = std::max(1, channels_);
+    data_.resize(planarFrames_ * channels);
+    std::vector<const float*> planes = getChannelPointers();
+    ChannelLayout::interleave(planes.data(), channels, (int)planarFrames_, data_.data());
+
+    AlignedFloatVector().swap(planarData_);
+    planar_ = false;
+    planarFrames_ = 0;
+    planarStride_ = 0;
+    syncMemory();
+}
+
+void AudioBuffer::setPlanarData(const float* const* planes, int channels, size_t frames, size_t alignment) {
     channels_ = channels;
+    std::vector<float>().swap(data_);
+    syncMemory();
+    allocatePlanar(channels, frames, alignment);
+    for (int c = 0; c < channels; ++c) {
+        std::copy(planes[c], planes[c] + frames, planarData_.begin() + c * planarStride_);
+    }
+}
+
+void AudioBuffer::setPlanarData(const std::vector<std::vector<float>>& planes, size_t alignment) {
+    const int channels = (int)planes.size();
+    size_t frames = planes.empty() ? 0 : planes[0].size();
+    std::vector<const float*> pointers(channels);
+    for (int c = 0; c < channels; ++c) {
+        frames = std::min(frames, planes[c].size());
+        pointers[c] = planes[c].data();
+    }
+    setPlanarData(pointers.data(), channels, frames, alignment);
+}
+
+size_t AudioBuffer::getAlignment() const {
+    return planar_ ? alignment_ : 0;
+}
+
+size_t AudioBuffer::getChannelStride() const {
+    return planar_ ? planarStride_ : 0;
+}
+
+float* AudioBuffer::getChannelData(int channel) {
+    if (!planar_ || channel < 0 || channel >= channels_) {
+        return nullptr;
+    }
+    return planarData_.data() + channel * planarStride_;
+}
+
+const float* AudioBuffer::getChannelData(int channel) const {
+    if (!planar_ || channel < 0 || channel >= channels_) {
+        return nullptr;
+    }
+    return planarData_.data() + channel * planarStride_;
+}
+
+ChannelView AudioBuffer::getChannel(int channel) {
+    float* data = getChannelData(channel);
+    return ChannelView{data, data ? planarFrames_ : 0};
+}
+
+ConstChannelView AudioBuffer::getChannel(int channel) const {
+    const float* data = getChannelData(channel);
+    return ConstChannelView{data, data ? planarFrames_ : 0};
+}
+
+std::vector<const float*> AudioBuffer::getChannelPointers() const {
+    std::vector<const float*> pointers;
+    if (!planar_) {
+        return pointers;
+    }
+    pointers.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        pointers[c] = planarData_.data() + c * planarStride_;
+    }
+    return pointers;
 }
 
 // Pitch curve 메타데이터 관리
 void AudioBuffer::setPitchCurve(const std::vector<float>& curve) {
     pitchCurve_ = curve;
+    syncMemory();
 }
 
 const std::vector<float>& AudioBuffer::getPitchCurve() const {
@@ -71,4 +242,5 @@ bool AudioBuffer::hasPitchCurve() const {
 
 void AudioBuffer::clearPitchCurve() {
     pitchCurve_.clear();
+    syncMemory();
 }
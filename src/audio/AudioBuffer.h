@@ -1,9 +1,27 @@
 #ifndef AUDIOBUFFER_H
 #define AUDIOBUFFER_H
 
+#include "AlignedAllocator.h"
+#include "../performance/MemoryTracker.h"
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 
+// 채널 하나의 연속 샘플 view (planar 저장소, 소유하지 않음)
+template <typename T>
+struct BasicChannelView {
+    T* data;
+    size_t length;
+
+    T& operator[](size_t index) const { return data[index]; }
+    T* begin() const { return data; }
+    T* end() const { return data + length; }
+    size_t size() const { return length; }
+};
+
+using ChannelView = BasicChannelView<float>;
+using ConstChannelView = BasicChannelView<const float>;
+
 class AudioBuffer {
 public:
     AudioBuffer();
@@ -15,16 +33,42 @@ public:
     void appendData(const std::vector<float>& data);
     void clear();
 
-    // 오디오 데이터 가져오기
+    // 오디오 데이터 가져오기 (interleaved, planar 모드에서는 비어 있음)
     const std::vector<float>& getData() const;
     std::vector<float>& getData();
 
     // 메타데이터
     int getSampleRate() const;
     int getChannels() const;
-    size_t getLength() const; // 샘플 수
+    size_t getLength() const; // 샘플 수 (모든 채널 합계)
+    size_t getFrameCount() const; // 채널당 샘플 수
     float getDuration() const; // 초 단위
 
+    /**
+     * Planar (SoA) 저장 모드
+     * - 채널마다 연속 배열 (plane), 각 plane 시작 주소는 alignment 바이트 경계
+     * - plane 간격(stride)은 alignment 단위로 올림, 남는 부분은 0 (SIMD 커널이 끝에서 넘쳐 읽어도 안전)
+     * - planar 모드에서는 getData()가 비어 있음 (입출력 경계에서 convertToInterleaved)
+     * @param alignment 16, 32, 64 바이트 (기본 32 = AVX)
+     */
+    bool isPlanar() const;
+    void convertToPlanar(size_t alignment = 32);
+    void convertToInterleaved();
+    void setPlanarData(const float* const* planes, int channels, size_t frames, size_t alignment = 32);
+    void setPlanarData(const std::vector<std::vector<float>>& planes, size_t alignment = 32);
+
+    size_t getAlignment() const;      // planar 모드 정렬 (바이트)
+    size_t getChannelStride() const;  // plane 간 간격 (샘플)
+
+    // 채널별 접근 (planar 모드 전용, 아니면 nullptr / 빈 view)
+    float* getChannelData(int channel);
+    const float* getChannelData(int channel) const;
+    ChannelView getChannel(int channel);
+    ConstChannelView getChannel(int channel) const;
+
+    // 채널 포인터 배열 (DSP의 planar API에 그대로 전달)
+    std::vector<const float*> getChannelPointers() const;
+
     void setSampleRate(int rate);
     void setChannels(int channels);
 
@@ -35,10 +79,27 @@ public:
     void clearPitchCurve();
 
 private:
-    std::vector<float> data_;
+    std::vector<float> data_;        // interleaved 저장소
     int sampleRate_;
     int channels_;
+
+    // planar 저장소 (planar_ == true일 때만 사용)
+    AlignedFloatVector planarData_;
+    bool planar_;
+    size_t planarFrames_;
+    size_t planarStride_;
+    size_t alignment_;
+
+    // plane 하나의 간격 계산 (frames를 alignment 단위로 올림)
+    static size_t alignedStride(size_t frames, size_t alignment);
+    static size_t validAlignment(size_t alignment);
+    void allocatePlanar(int channels, size_t frames, size_t alignment);
     std::vector<float> pitchCurve_;  // 각 샘플의 semitones 값 (variable pitch shift용)
+
+    // data_ / pitchCurve_ 용량을 MemoryTracker에 반영 (planar 저장소는 AlignedAllocator가 직접 기록)
+    // getData()로 밖에서 키운 용량은 다음 변경 / 소멸 때 반영
+    MemoryAccount memory_;
+    void syncMemory();
 };
 
 #endif // AUDIOBUFFER_H
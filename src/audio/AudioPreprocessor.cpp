@@ -16,6 +16,13 @@ std::vector<FrameData> AudioPreprocessor::process(
     float hopSize,
     float vadThreshold
 ) {
+    // planar는 interleaved 사본으로 분할 (프레임 samples는 interleaved 형식)
+    if (buffer.isPlanar()) {
+        AudioBuffer interleaved = buffer;
+        interleaved.convertToInterleaved();
+        return process(interleaved, frameSize, hopSize, vadThreshold);
+    }
+
     std::vector<FrameData> frames;
 
     const auto& data = buffer.getData();
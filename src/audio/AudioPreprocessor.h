@@ -14,7 +14,7 @@ struct FrameData {
 
     // Pitch/Duration 정보 (Variable processing용)
     float pitchSemitones;        // 이 프레임의 pitch shift 양 (semitones)
-    float durationRatio;         // 이 프레임의 duration ratio (1.0 = 원본)
+    float durationRatio;         // 이 프레임의 duration ratio = tempo (1.0 = 원본, 2.0 = 2배 빠르게 = 길이 1/2)
     float originalPitchHz;       // 원본 pitch (Hz, 검출된 값, 0 = 무성음)
 
     // 메타데이터 (사용자 피드백 및 디버깅용)
@@ -46,7 +46,7 @@ public:
     /**
      * 오디오 버퍼를 전처리하여 프레임 데이터로 변환
      *
-     * @param buffer 원본 오디오 버퍼
+     * @param buffer 원본 오디오 버퍼 (다채널이면 프레임 samples는 interleaved, planar 입력도 interleaved로 분할)
      * @param frameSize 프레임 크기 (초 단위, 기본 20ms)
      * @param hopSize 프레임 간 이동 거리 (초 단위, 기본 10ms = 50% overlap)
      * @param vadThreshold VAD 임계값 (기본 0.02)
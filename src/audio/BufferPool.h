@@ -2,11 +2,15 @@
  * BufferPool.h
  *
  * 메모리 풀링: 반복 사용되는 버퍼를 재활용하여 할당/해제 오버헤드 감소
+ *
+ * MemoryTracker 집계: 새로 만든 버퍼는 할당으로 기록하고, 풀에 돌아오지 못하고 버려질 때 해제로 기록
+ * (acquire한 버퍼는 release로 돌려줘야 live 집계가 맞음)
  */
 
 #ifndef BUFFER_POOL_H
 #define BUFFER_POOL_H
 
+#include "../performance/MemoryTracker.h"
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -38,6 +42,7 @@ public:
         std::vector<float> buffer;
         buffer.reserve(size * 1.5); // 여유 공간 확보
         buffer.resize(size);
+        MemoryTracker::recordAllocation(capacityBytes(buffer));
         return buffer;
     }
 
@@ -50,6 +55,8 @@ public:
         // 풀 크기 제한 (최대 10개)
         if (pool_.size() < 10) {
             pool_.push_back(std::move(buffer));
+        } else {
+            MemoryTracker::recordRelease(capacityBytes(buffer));
         }
     }
 
@@ -58,6 +65,9 @@ public:
      */
     void clear() {
         std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& buffer : pool_) {
+            MemoryTracker::recordRelease(capacityBytes(buffer));
+        }
         pool_.clear();
     }
 
@@ -0,0 +1,157 @@
+/**
+ * ChannelLayout.h
+ *
+ * 다채널 샘플 배치 변환 (interleaved <-> planar)
+ * - interleaved: L R L R ... (WAV / Web Audio 입출력 형식)
+ * - planar: 채널마다 연속 배열 (DSP 커널이 채널 하나씩 연속 메모리로 처리)
+ *
+ * DSP는 planar로 처리하고, 입출력 경계에서만 한 번씩 변환
+ */
+
+#ifndef CHANNEL_LAYOUT_H
+#define CHANNEL_LAYOUT_H
+
+#include <vector>
+
+namespace ChannelLayout {
+
+/**
+ * interleaved -> planar (포인터 버전, 출력 plane은 frames 이상 확보되어 있어야 함)
+ * @param frames 채널당 샘플 수
+ * @param planes 채널별 출력 포인터 (channels개)
+ */
+inline void deinterleave(const float* interleaved, int frames, int channels, float* const* planes) {
+    if (channels == 2) {
+        // 스테레오: 가장 흔한 경우 (분기 없는 루프)
+        float* left = planes[0];
+        float* right = planes[1];
+        for (int i = 0; i < frames; ++i) {
+            left[i] = interleaved[2 * i];
+            right[i] = interleaved[2 * i + 1];
+        }
+        return;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        float* plane = planes[c];
+        const float* src = interleaved + c;
+        for (int i = 0; i < frames; ++i) {
+            plane[i] = src[i * channels];
+        }
+    }
+}
+
+/**
+ * planar -> interleaved (포인터 버전, 출력은 frames * channels 이상 확보되어 있어야 함)
+ */
+inline void interleave(const float* const* planes, int channels, int frames, float* interleaved) {
+    if (channels == 2) {
+        const float* left = planes[0];
+        const float* right = planes[1];
+        for (int i = 0; i < frames; ++i) {
+            interleaved[2 * i] = left[i];
+            interleaved[2 * i + 1] = right[i];
+        }
+        return;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        const float* plane = planes[c];
+        float* dst = interleaved + c;
+        for (int i = 0; i < frames; ++i) {
+            dst[i * channels] = plane[i];
+        }
+    }
+}
+
+/**
+ * interleaved -> planar
+ * @param frames 채널당 샘플 수
+ * @param planes 채널별 출력 (channels개, 각 frames 길이로 resize됨, 용량 유지)
+ * 용량이 충분하면 메모리 할당 없음 (실시간 처리 경로에서 사용)
+ */
+inline void deinterleave(const float* interleaved, int frames, int channels,
+                         std::vector<std::vector<float>>& planes) {
+    planes.resize(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c].resize(frames);
+    }
+    if (channels == 2) {
+        float* pointers[2] = {planes[0].data(), planes[1].data()};
+        deinterleave(interleaved, frames, channels, pointers);
+        return;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        float* plane = planes[c].data();
+        const float* src = interleaved + c;
+        for (int i = 0; i < frames; ++i) {
+            plane[i] = src[i * channels];
+        }
+    }
+}
+
+/**
+ * planar -> interleaved
+ * @param frames 채널당 샘플 수 (각 plane은 frames 이상이어야 함)
+ * @param interleaved 출력 (frames * channels 길이로 resize됨)
+ * 용량이 충분하면 메모리 할당 없음
+ */
+inline void interleave(const std::vector<std::vector<float>>& planes, int frames,
+                       std::vector<float>& interleaved) {
+    const int channels = (int)planes.size();
+    interleaved.resize((size_t)frames * channels);
+    if (channels == 2) {
+        const float* pointers[2] = {planes[0].data(), planes[1].data()};
+        interleave(pointers, channels, frames, interleaved.data());
+        return;
+    }
+
+    for (int c = 0; c < channels; ++c) {
+        const float* plane = planes[c].data();
+        float* dst = interleaved.data() + c;
+        for (int i = 0; i < frames; ++i) {
+            dst[i * channels] = plane[i];
+        }
+    }
+}
+
+/**
+ * 채널 평균 (mid 신호) 계산
+ * @param mid 출력 (frames 길이로 resize됨)
+ */
+inline void mixToMid(const float* const* planes, int channels, int frames, std::vector<float>& mid) {
+    mid.assign(planes[0], planes[0] + frames);
+    for (int c = 1; c < channels; ++c) {
+        const float* plane = planes[c];
+        for (int i = 0; i < frames; ++i) {
+            mid[i] += plane[i];
+        }
+    }
+
+    const float scale = 1.0f / channels;
+    for (int i = 0; i < frames; ++i) {
+        mid[i] *= scale;
+    }
+}
+
+/**
+ * interleaved 채널 평균 (mid 신호) 계산
+ * @param mid 출력 (frames 길이로 resize됨)
+ */
+inline void mixInterleavedToMid(const float* interleaved, int frames, int channels, std::vector<float>& mid) {
+    mid.resize(frames);
+    const float scale = 1.0f / channels;
+    for (int i = 0; i < frames; ++i) {
+        const float* frame = interleaved + (size_t)i * channels;
+        float sum = 0.0f;
+        for (int c = 0; c < channels; ++c) {
+            sum += frame[c];
+        }
+        mid[i] = sum * scale;
+    }
+}
+
+} // namespace ChannelLayout
+
+#endif // CHANNEL_LAYOUT_H
@@ -0,0 +1,38 @@
+/**
+ * SampleOps.h
+ *
+ * 여러 처리기가 공유하는 샘플 단위 연산
+ */
+
+#ifndef SAMPLE_OPS_H
+#define SAMPLE_OPS_H
+
+#include <algorithm>
+#include <vector>
+
+namespace SampleOps {
+
+/**
+ * gain + [-1, 1] 클램프 (in-place)
+ */
+inline void applyGainClamped(std::vector<float>& data, float gain) {
+    size_t i = 0;
+    const size_t size = data.size();
+    const size_t simdSize = size - (size % 4);
+
+    // Loop Unrolling: 4-way (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
+    for (; i < simdSize; i += 4) {
+        data[i] = std::max(-1.0f, std::min(1.0f, data[i] * gain));
+        data[i+1] = std::max(-1.0f, std::min(1.0f, data[i+1] * gain));
+        data[i+2] = std::max(-1.0f, std::min(1.0f, data[i+2] * gain));
+        data[i+3] = std::max(-1.0f, std::min(1.0f, data[i+3] * gain));
+    }
+
+    for (; i < size; ++i) {
+        data[i] = std::max(-1.0f, std::min(1.0f, data[i] * gain));
+    }
+}
+
+} // namespace SampleOps
+
+#endif // SAMPLE_OPS_H
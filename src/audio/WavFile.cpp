@@ -0,0 +1,651 @@
+/**
+ * WavFile.cpp
+ *
+ * 네이티브 전용 WAV 입출력 (mmap 읽기 / 블록 쓰기)
+ *
+ * 읽기:
+ * 1. 파일 전체를 읽기 전용으로 mmap (MADV_SEQUENTIAL: 순차 처리 시 OS가 미리 읽음)
+ * 2. RIFF / RF64 청크를 순회하며 fmt, data 위치만 기록 (LIST 등 다른 청크는 건너뜀)
+ *    RF64는 ds64 청크의 64비트 크기를 사용
+ * 3. readFrames()가 요청한 구간만 float로 변환 (전체 파일을 float로 올리지 않음)
+ *
+ * 쓰기:
+ * 1. 헤더 뒤에 28바이트 JUNK 청크를 예약 (RF64로 전환할 때 ds64로 덮어씀)
+ * 2. 샘플은 blockBytes 크기의 버퍼에서 변환 후 한 번에 fwrite
+ * 3. close()에서 크기 필드 확정: 4GB 이하는 RIFF, 초과하면 RF64 + ds64
+ *
+ * 샘플 바이트는 little-endian (x86 / ARM / WASM 호스트와 같음)
+ */
+
+#include "WavFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define WAV_FILE_USE_MMAP 1
+#endif
+
+namespace {
+
+const uint16_t WAVE_FORMAT_PCM = 0x0001;
+const uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+const uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+const uint32_t SIZE_PLACEHOLDER = 0xFFFFFFFFu;  // RF64: 실제 크기는 ds64 청크에
+const uint32_t DS64_SIZE = 28;
+
+uint16_t readU16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t readU64(const uint8_t* p) {
+    return (uint64_t)readU32(p) | ((uint64_t)readU32(p + 4) << 32);
+}
+
+void writeU16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+void writeU32(uint8_t* p, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+void writeU64(uint8_t* p, uint64_t value) {
+    writeU32(p, (uint32_t)value);
+    writeU32(p + 4, (uint32_t)(value >> 32));
+}
+
+bool chunkIs(const uint8_t* p, const char* id) {
+    return std::memcmp(p, id, 4) == 0;
+}
+
+// 샘플 하나 변환 (raw -> float)
+inline float decodePCM16(const uint8_t* p) {
+    int16_t value;
+    std::memcpy(&value, p, 2);
+    return value * (1.0f / 32768.0f);
+}
+
+inline float decodePCM24(const uint8_t* p) {
+    // 상위 바이트 부호 확장
+    int32_t value = (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) >> 8;
+    return value * (1.0f / 8388608.0f);
+}
+
+inline float decodeFloat32(const uint8_t* p) {
+    float value;
+    std::memcpy(&value, p, 4);
+    return value;
+}
+
+} // namespace
+
+// ============================================================================
+// WavReader
+// ============================================================================
+
+WavReader::WavReader()
+    : fd_(-1), mapped_(nullptr), mappedSize_(0), data_(nullptr), dataSize_(0),
+      sampleRate_(0), channels_(0), bytesPerSample_(0), format_(WavSampleFormat::PCM16), rf64_(false) {
+}
+
+WavReader::~WavReader() {
+    close();
+}
+
+bool WavReader::open(const std::string& path) {
+    close();
+
+#if defined(WAV_FILE_USE_MMAP)
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        std::cerr << "[WavReader] 파일을 열 수 없음: " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd_, &info) != 0 || info.st_size < 12) {
+        std::cerr << "[WavReader] 유효하지 않은 WAV 파일 (크기): " << path << std::endl;
+        close();
+        return false;
+    }
+
+    mappedSize_ = (size_t)info.st_size;
+    void* mapped = mmap(nullptr, mappedSize_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "[WavReader] mmap 실패: " << path << std::endl;
+        mappedSize_ = 0;
+        close();
+        return false;
+    }
+    mapped_ = static_cast<const uint8_t*>(mapped);
+
+    // 처리는 대부분 앞에서부터 순차적으로 진행됨
+    madvise(mapped, mappedSize_, MADV_SEQUENTIAL);
+
+    if (!parse()) {
+        std::cerr << "[WavReader] 지원하지 않거나 손상된 WAV 파일: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    std::cout << "[WavReader] 열기 완료 - " << sampleRate_ << " Hz, " << channels_ << "채널, "
+              << bytesPerSample_ * 8 << "비트" << (format_ == WavSampleFormat::FLOAT32 ? " float" : " PCM")
+              << (rf64_ ? " (RF64)" : "") << ", " << getFrameCount() << " 프레임" << std::endl;
+    return true;
+#else
+    std::cerr << "[WavReader] 이 플랫폼에서는 mmap을 지원하지 않음: " << path << std::endl;
+    return false;
+#endif
+}
+
+void WavReader::close() {
+#if defined(WAV_FILE_USE_MMAP)
+    if (mapped_) {
+        munmap(const_cast<uint8_t*>(mapped_), mappedSize_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+    fd_ = -1;
+    mapped_ = nullptr;
+    mappedSize_ = 0;
+    data_ = nullptr;
+    dataSize_ = 0;
+    sampleRate_ = 0;
+    channels_ = 0;
+    bytesPerSample_ = 0;
+    rf64_ = false;
+}
+
+bool WavReader::isOpen() const {
+    return data_ != nullptr;
+}
+
+bool WavReader::parse() {
+    const uint8_t* end = mapped_ + mappedSize_;
+
+    if (!(chunkIs(mapped_, "RIFF") || chunkIs(mapped_, "RF64") || chunkIs(mapped_, "BW64")) ||
+        !chunkIs(mapped_ + 8, "WAVE")) {
+        return false;
+    }
+    rf64_ = !chunkIs(mapped_, "RIFF");
+
+    uint64_t ds64DataSize = 0;
+    bool hasFormat = false;
+    const uint8_t* pos = mapped_ + 12;
+
+    // 청크 순회 (id 4바이트 + 크기 4바이트 + 데이터, 홀수 크기는 1바이트 패딩)
+    while (end - pos >= 8) {
+        uint64_t size = readU32(pos + 4);
+        const uint8_t* body = pos + 8;
+        uint64_t available = (uint64_t)(end - body);
+
+        if (chunkIs(pos, "ds64")) {
+            if (size < 24 || available < 24) {
+                return false;
+            }
+            ds64DataSize = readU64(body + 8);
+        } else if (chunkIs(pos, "fmt ")) {
+            if (!parseFormat(body, std::min(size, available))) {
+                return false;
+            }
+            hasFormat = true;
+        } else if (chunkIs(pos, "data")) {
+            if (rf64_ && size == SIZE_PLACEHOLDER) {
+                size = ds64DataSize;
+            }
+            data_ = body;
+            // 기록 중 중단된 파일: 실제 남은 크기까지만 사용
+            dataSize_ = std::min(size, available);
+            if (hasFormat) {
+                break;
+            }
+        }
+
+        if (size + (size & 1) >= available) {
+            break;
+        }
+        pos = body + size + (size & 1);
+    }
+
+    return hasFormat && data_ != nullptr;
+}
+
+bool WavReader::parseFormat(const uint8_t* chunk, uint64_t size) {
+    if (size < 16) {
+        return false;
+    }
+
+    uint16_t formatTag = readU16(chunk);
+    channels_ = readU16(chunk + 2);
+    sampleRate_ = (int)readU32(chunk + 4);
+    int bitsPerSample = readU16(chunk + 14);
+
+    // WAVE_FORMAT_EXTENSIBLE: 실제 형식은 SubFormat GUID의 앞 2바이트
+    if (formatTag == WAVE_FORMAT_EXTENSIBLE) {
+        if (size < 40) {
+            return false;
+        }
+        formatTag = readU16(chunk + 24);
+    }
+
+    if (formatTag == WAVE_FORMAT_PCM && bitsPerSample == 16) {
+        format_ = WavSampleFormat::PCM16;
+    } else if (formatTag == WAVE_FORMAT_PCM && bitsPerSample == 24) {
+        format_ = WavSampleFormat::PCM24;
+    } else if (formatTag == WAVE_FORMAT_IEEE_FLOAT && bitsPerSample == 32) {
+        format_ = WavSampleFormat::FLOAT32;
+    } else {
+        std::cerr << "[WavReader] 지원하지 않는 형식: tag " << formatTag
+                  << ", " << bitsPerSample << "비트" << std::endl;
+        return false;
+    }
+
+    bytesPerSample_ = bitsPerSample / 8;
+    return channels_ > 0 && sampleRate_ > 0;
+}
+
+int WavReader::getSampleRate() const {
+    return sampleRate_;
+}
+
+int WavReader::getChannels() const {
+    return channels_;
+}
+
+WavSampleFormat WavReader::getFormat() const {
+    return format_;
+}
+
+int WavReader::getBytesPerSample() const {
+    return bytesPerSample_;
+}
+
+uint64_t WavReader::getFrameCount() const {
+    if (!isOpen()) {
+        return 0;
+    }
+    return dataSize_ / ((uint64_t)bytesPerSample_ * channels_);
+}
+
+float WavReader::getDuration() const {
+    return sampleRate_ > 0 ? (float)((double)getFrameCount() / sampleRate_) : 0.0f;
+}
+
+bool WavReader::isRF64() const {
+    return rf64_;
+}
+
+void WavReader::releaseFrames(uint64_t endFrame) {
+#if defined(WAV_FILE_USE_MMAP)
+    if (!isOpen()) {
+        return;
+    }
+
+    // 페이지 단위로 내림 (마지막 페이지는 아직 읽을 수 있으므로 남김)
+    const uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uint64_t endByte = std::min<uint64_t>(endFrame, getFrameCount()) * channels_ * bytesPerSample_;
+    uintptr_t begin = (uintptr_t)mapped_;
+    uintptr_t end = ((uintptr_t)(data_ + endByte)) / pageSize * pageSize;
+    if (end > begin) {
+        madvise(const_cast<uint8_t*>(mapped_), end - begin, MADV_DONTNEED);
+    }
+#else
+    (void)endFrame;
+#endif
+}
+
+const uint8_t* WavReader::getRawData() const {
+    return data_;
+}
+
+uint64_t WavReader::getRawDataSize() const {
+    return dataSize_;
+}
+
+size_t WavReader::readFrames(uint64_t startFrame, size_t frameCount, float* output) const {
+    uint64_t totalFrames = getFrameCount();
+    if (startFrame >= totalFrames) {
+        return 0;
+    }
+    frameCount = (size_t)std::min<uint64_t>(frameCount, totalFrames - startFrame);
+
+    const size_t count = frameCount * channels_;
+    const uint8_t* src = data_ + startFrame * channels_ * bytesPerSample_;
+
+    switch (format_) {
+        case WavSampleFormat::PCM16: {
+            size_t i = 0;
+            const size_t simdSize = count - (count % 4);
+
+            // Loop Unrolling: 4-way (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
+            for (; i < simdSize; i += 4) {
+                output[i] = decodePCM16(src + 2 * i);
+                output[i+1] = decodePCM16(src + 2 * (i + 1));
+                output[i+2] = decodePCM16(src + 2 * (i + 2));
+                output[i+3] = decodePCM16(src + 2 * (i + 3));
+            }
+            for (; i < count; ++i) {
+                output[i] = decodePCM16(src + 2 * i);
+            }
+            break;
+        }
+        case WavSampleFormat::PCM24:
+            for (size_t i = 0; i < count; ++i) {
+                output[i] = decodePCM24(src + 3 * i);
+            }
+            break;
+        case WavSampleFormat::FLOAT32:
+            std::memcpy(output, src, count * sizeof(float));
+            break;
+    }
+
+    return frameCount;
+}
+
+size_t WavReader::readFramesPlanar(uint64_t startFrame, size_t frameCount, float* const* planes) const {
+    uint64_t totalFrames = getFrameCount();
+    if (startFrame >= totalFrames) {
+        return 0;
+    }
+    frameCount = (size_t)std::min<uint64_t>(frameCount, totalFrames - startFrame);
+
+    const size_t frameBytes = (size_t)channels_ * bytesPerSample_;
+    const uint8_t* src = data_ + startFrame * frameBytes;
+
+    for (int c = 0; c < channels_; ++c) {
+        float* plane = planes[c];
+        const uint8_t* channelSrc = src + c * bytesPerSample_;
+        switch (format_) {
+            case WavSampleFormat::PCM16:
+                for (size_t i = 0; i < frameCount; ++i) {
+                    plane[i] = decodePCM16(channelSrc + i * frameBytes);
+                }
+                break;
+            case WavSampleFormat::PCM24:
+                for (size_t i = 0; i < frameCount; ++i) {
+                    plane[i] = decodePCM24(channelSrc + i * frameBytes);
+                }
+                break;
+            case WavSampleFormat::FLOAT32:
+                for (size_t i = 0; i < frameCount; ++i) {
+                    plane[i] = decodeFloat32(channelSrc + i * frameBytes);
+                }
+                break;
+        }
+    }
+
+    return frameCount;
+}
+
+float WavReader::getSample(uint64_t frame, int channel) const {
+    if (frame >= getFrameCount() || channel < 0 || channel >= channels_) {
+        return 0.0f;
+    }
+
+    const uint8_t* p = data_ + (frame * channels_ + channel) * bytesPerSample_;
+    switch (format_) {
+        case WavSampleFormat::PCM16: return decodePCM16(p);
+        case WavSampleFormat::PCM24: return decodePCM24(p);
+        case WavSampleFormat::FLOAT32: return decodeFloat32(p);
+    }
+    return 0.0f;
+}
+
+// ============================================================================
+// WavWriter
+// ============================================================================
+
+WavWriter::WavWriter()
+    : file_(nullptr), sampleRate_(0), channels_(0), bytesPerSample_(0), format_(WavSampleFormat::PCM16),
+      forceRF64_(false), failed_(false), framesWritten_(0), dataOffset_(0), junkOffset_(0),
+      blockUsed_(0), blockCapacity_(0) {
+}
+
+WavWriter::~WavWriter() {
+    close();
+}
+
+bool WavWriter::open(const std::string& path, int sampleRate, int channels, WavSampleFormat format,
+                     size_t blockBytes, bool forceRF64) {
+    close();
+
+    if (sampleRate <= 0 || channels <= 0) {
+        std::cerr << "[WavWriter] 잘못된 형식: " << sampleRate << " Hz, " << channels << "채널" << std::endl;
+        return false;
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        std::cerr << "[WavWriter] 파일을 만들 수 없음: " << path << std::endl;
+        return false;
+    }
+
+    sampleRate_ = sampleRate;
+    channels_ = channels;
+    format_ = format;
+    bytesPerSample_ = (format == WavSampleFormat::PCM16) ? 2 : (format == WavSampleFormat::PCM24 ? 3 : 4);
+    forceRF64_ = forceRF64;
+    failed_ = false;
+    framesWritten_ = 0;
+
+    // 블록은 프레임 단위로 나눠지도록 (최소 1프레임)
+    const size_t frameBytes = (size_t)channels_ * bytesPerSample_;
+    blockCapacity_ = std::max(frameBytes, blockBytes / frameBytes * frameBytes);
+    block_.resize(blockCapacity_);
+    blockUsed_ = 0;
+
+    if (!writeHeader()) {
+        std::cerr << "[WavWriter] 헤더 기록 실패: " << path << std::endl;
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool WavWriter::writeHeader() {
+    // RIFF(12) + JUNK/ds64(8 + 28) + fmt(8 + 16/18) + data(8)
+    const bool isFloat = format_ == WavSampleFormat::FLOAT32;
+    const uint32_t fmtSize = isFloat ? 18 : 16;
+    std::vector<uint8_t> header(12 + 8 + DS64_SIZE + 8 + fmtSize + 8, 0);
+    uint8_t* p = header.data();
+
+    std::memcpy(p, "RIFF", 4);
+    std::memcpy(p + 8, "WAVE", 4);
+    p += 12;
+
+    // RF64 전환용 예약 공간 (RIFF로 닫으면 JUNK 그대로 남음, 일반 reader는 건너뜀)
+    junkOffset_ = 12;
+    std::memcpy(p, "JUNK", 4);
+    writeU32(p + 4, DS64_SIZE);
+    p += 8 + DS64_SIZE;
+
+    std::memcpy(p, "fmt ", 4);
+    writeU32(p + 4, fmtSize);
+    writeU16(p + 8, isFloat ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM);
+    writeU16(p + 10, (uint16_t)channels_);
+    writeU32(p + 12, (uint32_t)sampleRate_);
+    writeU32(p + 16, (uint32_t)(sampleRate_ * channels_ * bytesPerSample_));
+    writeU16(p + 20, (uint16_t)(channels_ * bytesPerSample_));
+    writeU16(p + 22, (uint16_t)(bytesPerSample_ * 8));
+    p += 8 + fmtSize;  // float: cbSize = 0 (이미 0)
+
+    std::memcpy(p, "data", 4);
+    p += 8;
+
+    dataOffset_ = header.size();
+    return std::fwrite(header.data(), 1, header.size(), file_) == header.size();
+}
+
+void WavWriter::encodeSample(float sample, uint8_t* out) const {
+    switch (format_) {
+        case WavSampleFormat::PCM16: {
+            float clamped = std::max(-1.0f, std::min(1.0f, sample));
+            int16_t value = (int16_t)std::lrint(clamped * 32767.0f);
+            std::memcpy(out, &value, 2);
+            break;
+        }
+        case WavSampleFormat::PCM24: {
+            float clamped = std::max(-1.0f, std::min(1.0f, sample));
+            int32_t value = (int32_t)std::lrint(clamped * 8388607.0f);
+            out[0] = (uint8_t)value;
+            out[1] = (uint8_t)(value >> 8);
+            out[2] = (uint8_t)(value >> 16);
+            break;
+        }
+        case WavSampleFormat::FLOAT32:
+            std::memcpy(out, &sample, 4);
+            break;
+    }
+}
+
+bool WavWriter::writeFrames(const float* input, size_t frameCount) {
+    if (!file_ || failed_) {
+        return false;
+    }
+
+    const size_t frameBytes = (size_t)channels_ * bytesPerSample_;
+    size_t frame = 0;
+    while (frame < frameCount) {
+        size_t blockFrames = std::min(frameCount - frame, (blockCapacity_ - blockUsed_) / frameBytes);
+        const float* src = input + frame * channels_;
+        uint8_t* dst = block_.data() + blockUsed_;
+        const size_t count = blockFrames * channels_;
+
+        if (format_ == WavSampleFormat::FLOAT32) {
+            std::memcpy(dst, src, count * sizeof(float));
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                encodeSample(src[i], dst + i * bytesPerSample_);
+            }
+        }
+
+        blockUsed_ += blockFrames * frameBytes;
+        frame += blockFrames;
+        if (blockUsed_ == blockCapacity_ && !flushBlock()) {
+            return false;
+        }
+    }
+
+    framesWritten_ += frameCount;
+    return true;
+}
+
+bool WavWriter::writeFramesPlanar(const float* const* planes, size_t frameCount) {
+    if (!file_ || failed_) {
+        return false;
+    }
+
+    const size_t frameBytes = (size_t)channels_ * bytesPerSample_;
+    size_t frame = 0;
+    while (frame < frameCount) {
+        size_t blockFrames = std::min(frameCount - frame, (blockCapacity_ - blockUsed_) / frameBytes);
+        uint8_t* dst = block_.data() + blockUsed_;
+
+        for (int c = 0; c < channels_; ++c) {
+            const float* src = planes[c] + frame;
+            uint8_t* channelDst = dst + c * bytesPerSample_;
+            for (size_t i = 0; i < blockFrames; ++i) {
+                encodeSample(src[i], channelDst + i * frameBytes);
+            }
+        }
+
+        blockUsed_ += blockFrames * frameBytes;
+        frame += blockFrames;
+        if (blockUsed_ == blockCapacity_ && !flushBlock()) {
+            return false;
+        }
+    }
+
+    framesWritten_ += frameCount;
+    return true;
+}
+
+bool WavWriter::flushBlock() {
+    if (blockUsed_ == 0) {
+        return true;
+    }
+    if (std::fwrite(block_.data(), 1, blockUsed_, file_) != blockUsed_) {
+        std::cerr << "[WavWriter] 기록 실패 (디스크 공간 확인)" << std::endl;
+        failed_ = true;
+        return false;
+    }
+    blockUsed_ = 0;
+    return true;
+}
+
+bool WavWriter::close() {
+    if (!file_) {
+        return false;
+    }
+
+    bool ok = flushBlock();
+
+    const uint64_t dataBytes = framesWritten_ * channels_ * bytesPerSample_;
+    if (ok && (dataBytes & 1)) {
+        // 홀수 크기 청크 패딩
+        ok = std::fputc(0, file_) != EOF;
+    }
+
+    const uint64_t riffSize = dataOffset_ + dataBytes + (dataBytes & 1) - 8;
+    const bool rf64 = forceRF64_ || riffSize > 0xFFFFFFFFull;
+
+    if (ok) {
+        uint8_t riff[8];
+        std::memcpy(riff, rf64 ? "RF64" : "RIFF", 4);
+        writeU32(riff + 4, rf64 ? SIZE_PLACEHOLDER : (uint32_t)riffSize);
+        ok = std::fseek(file_, 0, SEEK_SET) == 0 && std::fwrite(riff, 1, 8, file_) == 8;
+    }
+
+    if (ok && rf64) {
+        // 예약한 JUNK 청크를 ds64로 교체
+        uint8_t ds64[8 + DS64_SIZE] = {0};
+        std::memcpy(ds64, "ds64", 4);
+        writeU32(ds64 + 4, DS64_SIZE);
+        writeU64(ds64 + 8, riffSize);
+        writeU64(ds64 + 16, dataBytes);
+        writeU64(ds64 + 24, framesWritten_);
+        writeU32(ds64 + 32, 0);  // table length
+        ok = std::fseek(file_, (long)junkOffset_, SEEK_SET) == 0 &&
+             std::fwrite(ds64, 1, sizeof(ds64), file_) == sizeof(ds64);
+    }
+
+    if (ok) {
+        uint8_t size[4];
+        writeU32(size, rf64 ? SIZE_PLACEHOLDER : (uint32_t)dataBytes);
+        ok = std::fseek(file_, (long)(dataOffset_ - 4), SEEK_SET) == 0 && std::fwrite(size, 1, 4, file_) == 4;
+    }
+
+    ok = (std::fclose(file_) == 0) && ok;
+    file_ = nullptr;
+    block_.clear();
+    block_.shrink_to_fit();
+
+    if (!ok) {
+        std::cerr << "[WavWriter] 파일 마무리 실패" << std::endl;
+    }
+    return ok;
+}
+
+bool WavWriter::isOpen() const {
+    return file_ != nullptr;
+}
+
+uint64_t WavWriter::getFramesWritten() const {
+    return framesWritten_;
+}
@@ -0,0 +1,157 @@
+/**
+ * WavFile.h
+ *
+ * 네이티브 전용 WAV 입출력 (WASM 빌드에는 포함하지 않음)
+ * - WavReader: 파일을 mmap하고 RIFF / RF64 청크를 파싱, 샘플은 요청한 구간만 float로 변환
+ *   (2GB 파일도 전체를 float로 올리지 않음, 페이지는 OS가 필요할 때 읽음)
+ * - WavWriter: float 샘플을 블록 버퍼에서 PCM / float로 변환해 큰 단위로 기록,
+ *   데이터가 4GB를 넘으면 닫을 때 RF64로 전환
+ *
+ * 지원 형식: PCM16, PCM24, float32 (WAVE_FORMAT_EXTENSIBLE 포함), 채널 수 제한 없음
+ */
+
+#ifndef WAV_FILE_H
+#define WAV_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+enum class WavSampleFormat {
+    PCM16,
+    PCM24,
+    FLOAT32
+};
+
+class WavReader {
+public:
+    WavReader();
+    ~WavReader();
+
+    WavReader(const WavReader&) = delete;
+    WavReader& operator=(const WavReader&) = delete;
+
+    /**
+     * 파일 열기 (mmap + 헤더 파싱, 샘플은 변환하지 않음)
+     * @return 성공 여부 (실패 사유는 std::cerr)
+     */
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+
+    int getSampleRate() const;
+    int getChannels() const;
+    WavSampleFormat getFormat() const;
+    int getBytesPerSample() const;
+    uint64_t getFrameCount() const;
+    float getDuration() const;
+    bool isRF64() const;
+
+    /**
+     * 구간 변환 (interleaved float)
+     * @param startFrame 시작 프레임
+     * @param frameCount 읽을 프레임 수
+     * @param output frameCount * channels 이상 확보된 버퍼
+     * @return 실제로 읽은 프레임 수 (파일 끝에서 줄어듦)
+     */
+    size_t readFrames(uint64_t startFrame, size_t frameCount, float* output) const;
+
+    /**
+     * 구간 변환 (planar: 채널마다 별도 배열)
+     * @param planes 채널별 출력 포인터 (channels개, 각 frameCount 이상)
+     */
+    size_t readFramesPlanar(uint64_t startFrame, size_t frameCount, float* const* planes) const;
+
+    /**
+     * 샘플 하나 변환 (임의 접근용)
+     */
+    float getSample(uint64_t frame, int channel) const;
+
+    /**
+     * endFrame 이전 구간의 페이지를 OS에 반환 (순차 처리에서 이미 읽은 구간)
+     * 이후 다시 읽으면 파일에서 다시 읽힘 (데이터는 그대로)
+     */
+    void releaseFrames(uint64_t endFrame);
+
+    /**
+     * 원본 샘플 데이터 (mmap된 data 청크, 변환 전 바이트)
+     */
+    const uint8_t* getRawData() const;
+    uint64_t getRawDataSize() const;
+
+private:
+    int fd_;
+    const uint8_t* mapped_;
+    size_t mappedSize_;
+
+    const uint8_t* data_;     // data 청크 시작 (mapped_ 내부)
+    uint64_t dataSize_;       // data 청크 바이트 수 (파일 끝에서 잘린 경우 실제 크기)
+    int sampleRate_;
+    int channels_;
+    int bytesPerSample_;
+    WavSampleFormat format_;
+    bool rf64_;
+
+    bool parse();
+    bool parseFormat(const uint8_t* chunk, uint64_t size);
+};
+
+class WavWriter {
+public:
+    WavWriter();
+    ~WavWriter();
+
+    WavWriter(const WavWriter&) = delete;
+    WavWriter& operator=(const WavWriter&) = delete;
+
+    /**
+     * 파일 생성 (헤더를 쓰고 데이터는 블록 단위로 기록)
+     * @param blockBytes 변환 버퍼 크기 (이만큼 모이면 한 번에 기록)
+     * @param forceRF64 처음부터 RF64로 작성 (크기와 무관하게)
+     */
+    bool open(const std::string& path, int sampleRate, int channels, WavSampleFormat format,
+              size_t blockBytes = 4 * 1024 * 1024, bool forceRF64 = false);
+
+    /**
+     * 프레임 기록 (interleaved float, [-1, 1] 밖은 PCM 변환 시 클램프)
+     */
+    bool writeFrames(const float* input, size_t frameCount);
+
+    /**
+     * 프레임 기록 (planar)
+     */
+    bool writeFramesPlanar(const float* const* planes, size_t frameCount);
+
+    /**
+     * 남은 블록을 기록하고 헤더 크기 필드 확정 (4GB 초과 시 RF64)
+     */
+    bool close();
+    bool isOpen() const;
+
+    uint64_t getFramesWritten() const;
+
+private:
+    FILE* file_;
+    int sampleRate_;
+    int channels_;
+    int bytesPerSample_;
+    WavSampleFormat format_;
+    bool forceRF64_;
+    bool failed_;
+
+    uint64_t framesWritten_;
+    uint64_t dataOffset_;        // data 청크 데이터 시작 위치
+    uint64_t junkOffset_;        // RF64 전환용 예약 청크 위치
+
+    std::vector<uint8_t> block_; // 변환 버퍼
+    size_t blockUsed_;
+    size_t blockCapacity_;
+
+    bool writeHeader();
+    bool flushBlock();
+    void encodeSample(float sample, uint8_t* out) const;
+};
+
+#endif // WAV_FILE_H
@@ -0,0 +1,556 @@
+/**
+ * Resampler.cpp
+ *
+ * 리샘플러
+ *
+ * 품질 단계:
+ * - LINEAR: 두 샘플 사이 선형 보간 (기존 SimplePitchShifter 방식과 동일한 결과)
+ * - CUBIC: 4점 Catmull-Rom 보간 (선형보다 고역 손실이 적음, 안티앨리어싱은 없음)
+ * - SINC_16 / SINC_64: 폴리페이즈 Kaiser windowed-sinc
+ *
+ * 폴리페이즈 windowed-sinc:
+ * 1. 한 샘플 구간을 phases개 위상으로 나누고, 위상마다 taps개의 계수를 미리 계산
+ *    h(d) = fc * sinc(fc * d) * kaiser(d / (taps / 2))
+ * 2. 피치를 올릴 때(ratio > 1)는 차단 주파수 fc를 1 / ratio로 낮춰 앨리어싱 방지
+ * 3. 테이블은 (taps, phases, beta, fc) 조합마다 한 번만 만들고 캐시
+ * 4. 출력 샘플 = 입력 taps개와 (두 인접 위상 계수를 선형 보간한 값)의 내적
+ *    내적은 WASM SIMD / SSE가 있으면 4개씩 벡터 연산, 없으면 4-way 언롤
+ */
+
+#include "Resampler.h"
+#include "../audio/ChannelLayout.h"
+#include "../performance/TaskPool.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define RESAMPLER_USE_SSE 1
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+// 0차 수정 베셀 함수 (Kaiser 창 계산용, 급수 전개)
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    double halfX = x * 0.5;
+    for (int k = 1; k < 50; ++k) {
+        term *= (halfX / k) * (halfX / k);
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+/**
+ * 계수 보간 + 내적
+ * sum(x[k] * (c[k] + f * dc[k])), taps는 4의 배수
+ */
+inline float dotInterpolated(const float* x, const float* c, const float* dc, float f, int taps) {
+#if defined(__wasm_simd128__)
+    v128_t acc = wasm_f32x4_splat(0.0f);
+    v128_t vf = wasm_f32x4_splat(f);
+    for (int k = 0; k < taps; k += 4) {
+        v128_t coeff = wasm_f32x4_add(wasm_v128_load(c + k),
+                                      wasm_f32x4_mul(vf, wasm_v128_load(dc + k)));
+        acc = wasm_f32x4_add(acc, wasm_f32x4_mul(wasm_v128_load(x + k), coeff));
+    }
+    return wasm_f32x4_extract_lane(acc, 0) + wasm_f32x4_extract_lane(acc, 1) +
+           wasm_f32x4_extract_lane(acc, 2) + wasm_f32x4_extract_lane(acc, 3);
+#elif defined(RESAMPLER_USE_SSE)
+    __m128 acc = _mm_setzero_ps();
+    __m128 vf = _mm_set1_ps(f);
+    for (int k = 0; k < taps; k += 4) {
+        __m128 coeff = _mm_add_ps(_mm_loadu_ps(c + k), _mm_mul_ps(vf, _mm_loadu_ps(dc + k)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(x + k), coeff));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#else
+    // Loop Unrolling: 4-way (독립 누산기 4개로 의존성 체인 분리 + 컴파일러 자동 벡터화 유도)
+    float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    for (int k = 0; k < taps; k += 4) {
+        acc0 += x[k] * (c[k] + f * dc[k]);
+        acc1 += x[k+1] * (c[k+1] + f * dc[k+1]);
+        acc2 += x[k+2] * (c[k+2] + f * dc[k+2]);
+        acc3 += x[k+3] * (c[k+3] + f * dc[k+3]);
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+#endif
+}
+
+inline float applyOutputGain(float sample, float gain) {
+    return std::max(-1.0f, std::min(1.0f, sample * gain));
+}
+
+} // namespace
+
+Resampler::Resampler()
+    : quality_(ResamplerQuality::LINEAR), taps_(16), phases_(128),
+      kaiserBeta_(6.0f), rolloff_(0.90f) {
+}
+
+void Resampler::setQuality(ResamplerQuality quality) {
+    quality_ = quality;
+
+    // 단계별 기본 sinc 파라미터
+    // SINC_16: 저지대역 약 -60dB, 전이대역이 넓어 rolloff를 낮게
+    // SINC_64: 저지대역 약 -90dB, 전이대역이 좁아 Nyquist 가까이까지 통과
+    if (quality == ResamplerQuality::SINC_16) {
+        setSincParameters(16, 128, 6.0f, 0.90f);
+    } else if (quality == ResamplerQuality::SINC_64) {
+        setSincParameters(64, 256, 9.0f, 0.97f);
+    }
+}
+
+ResamplerQuality Resampler::getQuality() const {
+    return quality_;
+}
+
+void Resampler::setSincParameters(int taps, int phases, float kaiserBeta, float rolloff) {
+    // 4의 배수로 올림 (SIMD 내적 루프에 나머지 처리가 없도록)
+    taps_ = std::max(4, (taps + 3) / 4 * 4);
+    phases_ = std::max(1, phases);
+    kaiserBeta_ = std::max(0.0f, kaiserBeta);
+    rolloff_ = std::max(0.5f, std::min(1.0f, rolloff));
+}
+
+int Resampler::getHalfLength() const {
+    switch (quality_) {
+        case ResamplerQuality::LINEAR:
+            return 1;
+        case ResamplerQuality::CUBIC:
+            return 2;
+        default:
+            return taps_ / 2;
+    }
+}
+
+void Resampler::process(const float* input, int inputLength, float ratio,
+                        std::vector<float>& output, float outputGain) {
+    if (ratio <= 0.0f) {
+        std::cerr << "[Resampler] 잘못된 비율: " << ratio << std::endl;
+        output.assign(input, input + inputLength);
+        return;
+    }
+
+    // 출력 길이 계산
+    // ratio > 1.0: 더 짧아짐 (빠르게 재생)
+    // ratio < 1.0: 더 길어짐 (느리게 재생)
+    int outputLength = (int)(inputLength / ratio);
+
+    output.resize(outputLength);
+    if (inputLength == 0) {
+        return;
+    }
+
+    // 출력 샘플 i의 위치는 i * ratio로만 정해지므로 출력 구간을 나눠 병렬 처리해도 결과가 같음
+    // (sinc 테이블은 캐시를 갱신하므로 구간을 나누기 전에 한 번만 가져옴)
+    const SincTable* table = nullptr;
+    if (quality_ == ResamplerQuality::SINC_16 || quality_ == ResamplerQuality::SINC_64) {
+        table = &getTable(ratio);
+    }
+    float* outputData = output.data();
+    TaskPool::getInstance().parallelFor(outputLength, PARALLEL_GRAIN, [&](int begin, int end) {
+        switch (quality_) {
+            case ResamplerQuality::LINEAR:
+                processLinear(input, inputLength, ratio, outputData, begin, end, outputGain);
+                break;
+            case ResamplerQuality::CUBIC:
+                processCubic(input, inputLength, 0.0, ratio, outputData, begin, end, outputGain);
+                break;
+            case ResamplerQuality::SINC_16:
+            case ResamplerQuality::SINC_64:
+                processSinc(*table, input, inputLength, 0.0, ratio, outputData, begin, end, outputGain);
+                break;
+        }
+    });
+}
+
+void Resampler::processPlanar(const float* const* inputs, int channels, int inputLength, float ratio,
+                              std::vector<std::vector<float>>& outputs, float outputGain) {
+    outputs.resize(std::max(0, channels));
+    // 위치 계산은 입력 길이 / 비율에만 의존하므로 채널마다 같은 위치에서 보간됨
+    for (int c = 0; c < channels; ++c) {
+        process(inputs[c], inputLength, ratio, outputs[c], outputGain);
+    }
+}
+
+void Resampler::processInterleaved(const float* input, int inputFrames, int channels, float ratio,
+                                   std::vector<float>& output, float outputGain) {
+    if (channels <= 0) {
+        output.clear();
+        return;
+    }
+    if (channels == 1) {
+        process(input, inputFrames, ratio, output, outputGain);
+        return;
+    }
+
+    ChannelLayout::deinterleave(input, inputFrames, channels, planarInput_);
+
+    std::vector<const float*> planes(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c] = planarInput_[c].data();
+    }
+    processPlanar(planes.data(), channels, inputFrames, ratio, planarOutput_, outputGain);
+
+    ChannelLayout::interleave(planarOutput_, (int)planarOutput_[0].size(), output);
+    syncScratchMemory();
+}
+
+float Resampler::interpolateAt(const float* input, int inputLength, double position, float ratio) {
+    if (inputLength <= 0) {
+        return 0.0f;
+    }
+    if (position < 0.0) {
+        position = 0.0;
+    }
+
+    int index = (int)position;
+    float fraction = (float)(position - index);
+
+    switch (quality_) {
+        case ResamplerQuality::LINEAR:
+            if (index >= inputLength - 1) {
+                return input[inputLength - 1];
+            }
+            return linearInterpolate(input[index], input[index + 1], fraction);
+        case ResamplerQuality::CUBIC:
+            return cubicInterpolate(input, inputLength, index, fraction);
+        default:
+            return sincInterpolate(getTable(ratio), input, inputLength, index, fraction);
+    }
+}
+
+void Resampler::interpolateBlock(const float* input, int inputLength, double startPosition,
+                                 double step, float* output, int count) {
+    if (inputLength <= 0 || count <= 0) {
+        return;
+    }
+
+    switch (quality_) {
+        case ResamplerQuality::LINEAR:
+            for (int i = 0; i < count; ++i) {
+                output[i] = interpolateAt(input, inputLength, startPosition + i * step, (float)step);
+            }
+            break;
+        case ResamplerQuality::CUBIC:
+            processCubic(input, inputLength, startPosition, step, output, 0, count, 1.0f);
+            break;
+        case ResamplerQuality::SINC_16:
+        case ResamplerQuality::SINC_64:
+            processSinc(getTable((float)step), input, inputLength, startPosition, step,
+                        output, 0, count, 1.0f);
+            break;
+    }
+}
+
+int Resampler::getTaps() const {
+    return taps_;
+}
+
+int Resampler::getPhases() const {
+    return phases_;
+}
+
+float Resampler::getKaiserBeta() const {
+    return kaiserBeta_;
+}
+
+float Resampler::getRolloff() const {
+    return rolloff_;
+}
+
+const Resampler::SincTable& Resampler::getTable(float ratio) {
+    // 피치를 올릴 때(다운샘플)는 차단 주파수를 낮춰 앨리어싱 방지
+    float cutoff = rolloff_ * std::min(1.0f, 1.0f / ratio);
+    // 비율이 조금씩 달라도 같은 테이블을 쓰도록 양자화
+    cutoff = std::round(cutoff * 10000.0f) / 10000.0f;
+
+    for (size_t i = 0; i < tableCache_.size(); ++i) {
+        const SincTable& table = tableCache_[i];
+        if (table.taps == taps_ && table.phases == phases_ &&
+            table.kaiserBeta == kaiserBeta_ && table.cutoff == cutoff) {
+            // 최근 사용으로 이동
+            if (i + 1 != tableCache_.size()) {
+                SincTable found = std::move(tableCache_[i]);
+                tableCache_.erase(tableCache_.begin() + i);
+                tableCache_.push_back(std::move(found));
+            }
+            return tableCache_.back();
+        }
+    }
+
+    if (tableCache_.size() >= MAX_CACHED_TABLES) {
+        tableCache_.erase(tableCache_.begin());
+    }
+
+    SincTable table;
+    table.taps = taps_;
+    table.phases = phases_;
+    table.kaiserBeta = kaiserBeta_;
+    table.cutoff = cutoff;
+    buildTable(table);
+    tableCache_.push_back(std::move(table));
+    syncScratchMemory();
+    return tableCache_.back();
+}
+
+void Resampler::syncScratchMemory() {
+    size_t bytes = capacityBytes(planarInput_) + capacityBytes(planarOutput_);
+    for (const SincTable& table : tableCache_) {
+        bytes += capacityBytes(table.coeffs) + capacityBytes(table.deltas);
+    }
+    scratchMemory_.update(bytes);
+}
+
+void Resampler::buildTable(SincTable& table) {
+    const int taps = table.taps;
+    const int half = taps / 2;
+    const int rows = table.phases + 1;
+    const double i0Beta = besselI0(table.kaiserBeta);
+
+    table.coeffs.assign((size_t)rows * taps, 0.0f);
+    table.deltas.assign((size_t)table.phases * taps, 0.0f);
+
+    std::vector<double> row(taps);
+    for (int p = 0; p < rows; ++p) {
+        double fraction = (double)p / table.phases;
+        double sum = 0.0;
+
+        for (int k = 0; k < taps; ++k) {
+            // 입력 샘플 (index - half + 1 + k)와 출력 위치 (index + fraction) 사이 거리
+            double d = (k - half + 1) - fraction;
+            double x = table.cutoff * d;
+            double sinc = (std::abs(x) < 1e-9) ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+
+            double w = d / half;
+            double kaiser = (std::abs(w) >= 1.0)
+                ? 0.0
+                : besselI0(table.kaiserBeta * std::sqrt(1.0 - w * w)) / i0Beta;
+
+            row[k] = table.cutoff * sinc * kaiser;
+            sum += row[k];
+        }
+
+        // DC gain 1로 정규화 (위상마다 음량이 달라지는 것 방지)
+        for (int k = 0; k < taps; ++k) {
+            table.coeffs[(size_t)p * taps + k] = (float)(row[k] / sum);
+        }
+    }
+
+    for (int p = 0; p < table.phases; ++p) {
+        for (int k = 0; k < taps; ++k) {
+            table.deltas[(size_t)p * taps + k] =
+                table.coeffs[(size_t)(p + 1) * taps + k] - table.coeffs[(size_t)p * taps + k];
+        }
+    }
+
+    std::cout << "[Resampler] sinc 테이블 생성 - taps: " << taps << ", phases: " << table.phases
+              << ", cutoff: " << table.cutoff << std::endl;
+}
+
+void Resampler::processLinear(const float* inputData, int inputLength, float ratio,
+                              float* outputData, int begin, int end, float outputGain) {
+    const bool applyGain = (outputGain != 1.0f);
+
+    // Loop Unrolling: 4개씩 묶어서 처리 (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
+    int i = begin;
+    int simdSize = end - 3;
+
+    for (; i < simdSize; i += 4) {
+        // 4개의 출력 샘플을 한 번에 계산
+        float inputPos0 = i * ratio;
+        float inputPos1 = (i + 1) * ratio;
+        float inputPos2 = (i + 2) * ratio;
+        float inputPos3 = (i + 3) * ratio;
+
+        int index0 = (int)inputPos0;
+        int index1 = (int)inputPos1;
+        int index2 = (int)inputPos2;
+        int index3 = (int)inputPos3;
+
+        float frac0 = inputPos0 - index0;
+        float frac1 = inputPos1 - index1;
+        float frac2 = inputPos2 - index2;
+        float frac3 = inputPos3 - index3;
+
+        // 범위 체크 및 보간
+        if (index0 < inputLength - 1) {
+            outputData[i] = inputData[index0] * (1.0f - frac0) + inputData[index0 + 1] * frac0;
+        } else {
+            outputData[i] = inputData[inputLength - 1];
+        }
+
+        if (index1 < inputLength - 1) {
+            outputData[i + 1] = inputData[index1] * (1.0f - frac1) + inputData[index1 + 1] * frac1;
+        } else {
+            outputData[i + 1] = inputData[inputLength - 1];
+        }
+
+        if (index2 < inputLength - 1) {
+            outputData[i + 2] = inputData[index2] * (1.0f - frac2) + inputData[index2 + 1] * frac2;
+        } else {
+            outputData[i + 2] = inputData[inputLength - 1];
+        }
+
+        if (index3 < inputLength - 1) {
+            outputData[i + 3] = inputData[index3] * (1.0f - frac3) + inputData[index3 + 1] * frac3;
+        } else {
+            outputData[i + 3] = inputData[inputLength - 1];
+        }
+
+        // 출력 gain 융합 (EffectChain의 gain/clamp 스테이지, 별도 패스 없음)
+        if (applyGain) {
+            outputData[i] = applyOutputGain(outputData[i], outputGain);
+            outputData[i + 1] = applyOutputGain(outputData[i + 1], outputGain);
+            outputData[i + 2] = applyOutputGain(outputData[i + 2], outputGain);
+            outputData[i + 3] = applyOutputGain(outputData[i + 3], outputGain);
+        }
+    }
+
+    // 나머지 처리
+    for (; i < end; i++) {
+        float inputPos = i * ratio;
+        int index = (int)inputPos;
+        float fraction = inputPos - index;
+
+        if (index >= inputLength - 1) {
+            outputData[i] = inputData[inputLength - 1];
+        } else {
+            outputData[i] = linearInterpolate(inputData[index], inputData[index + 1], fraction);
+        }
+
+        if (applyGain) {
+            outputData[i] = applyOutputGain(outputData[i], outputGain);
+        }
+    }
+}
+
+void Resampler::processCubic(const float* input, int inputLength, double startPosition, double step,
+                             float* output, int begin, int end, float outputGain) {
+    const bool applyGain = (outputGain != 1.0f);
+
+    for (int i = begin; i < end; ++i) {
+        // 긴 버퍼에서 위치 오차가 쌓이지 않도록 double로 계산
+        double inputPos = std::max(0.0, startPosition + (double)i * step);
+        int index = (int)inputPos;
+        float fraction = (float)(inputPos - index);
+
+        float sample;
+        if (index >= 1 && index + 2 < inputLength) {
+            // 범위 체크가 필요 없는 구간
+            const float* x = input + index - 1;
+            float c0 = x[1];
+            float c1 = 0.5f * (x[2] - x[0]);
+            float c2 = x[0] - 2.5f * x[1] + 2.0f * x[2] - 0.5f * x[3];
+            float c3 = 0.5f * (x[3] - x[0]) + 1.5f * (x[1] - x[2]);
+            sample = ((c3 * fraction + c2) * fraction + c1) * fraction + c0;
+        } else {
+            sample = cubicInterpolate(input, inputLength, index, fraction);
+        }
+
+        output[i] = applyGain ? applyOutputGain(sample, outputGain) : sample;
+    }
+}
+
+void Resampler::processSinc(const SincTable& table, const float* input, int inputLength,
+                            double startPosition, double step,
+                            float* output, int begin, int end, float outputGain) {
+    const int taps = table.taps;
+    const int half = taps / 2;
+    const float phases = (float)table.phases;
+    const bool applyGain = (outputGain != 1.0f);
+
+    for (int i = begin; i < end; ++i) {
+        double inputPos = std::max(0.0, startPosition + (double)i * step);
+        int index = (int)inputPos;
+        float fraction = (float)(inputPos - index);
+        int start = index - half + 1;
+
+        float sample;
+        if (start >= 0 && start + taps <= inputLength) {
+            // 범위 체크가 필요 없는 구간: 위상 보간 + SIMD 내적
+            float phasePos = fraction * phases;
+            int phase = (int)phasePos;
+            if (phase >= table.phases) {
+                phase = table.phases - 1;
+            }
+            float phaseFrac = phasePos - phase;
+
+            sample = dotInterpolated(input + start,
+                                     &table.coeffs[(size_t)phase * taps],
+                                     &table.deltas[(size_t)phase * taps],
+                                     phaseFrac, taps);
+        } else {
+            // 양 끝 (half 샘플): 범위 밖은 끝 샘플로 채움
+            sample = sincInterpolate(table, input, inputLength, index, fraction);
+        }
+
+        output[i] = applyGain ? applyOutputGain(sample, outputGain) : sample;
+    }
+}
+
+float Resampler::linearInterpolate(float sample1, float sample2, float fraction) {
+    // 선형 보간 (Linear Interpolation)
+    //
+    // 두 점 사이의 직선상에 있는 값을 계산
+    // 공식: result = sample1 * (1 - fraction) + sample2 * fraction
+    //
+    // 예시:
+    // sample1 = 1.0, sample2 = 3.0, fraction = 0.5
+    // result = 1.0 * 0.5 + 3.0 * 0.5 = 2.0 (정확히 중간값)
+    //
+    // sample1 = 1.0, sample2 = 3.0, fraction = 0.25
+    // result = 1.0 * 0.75 + 3.0 * 0.25 = 1.5 (1에 가까움)
+
+    return sample1 * (1.0f - fraction) + sample2 * fraction;
+}
+
+float Resampler::cubicInterpolate(const float* input, int inputLength, int index, float fraction) {
+    // 4점 Catmull-Rom (범위 밖 샘플은 끝 샘플로 대체)
+    auto at = [&](int n) {
+        return input[std::max(0, std::min(inputLength - 1, n))];
+    };
+    float x0 = at(index - 1);
+    float x1 = at(index);
+    float x2 = at(index + 1);
+    float x3 = at(index + 2);
+
+    float c0 = x1;
+    float c1 = 0.5f * (x2 - x0);
+    float c2 = x0 - 2.5f * x1 + 2.0f * x2 - 0.5f * x3;
+    float c3 = 0.5f * (x3 - x0) + 1.5f * (x1 - x2);
+    return ((c3 * fraction + c2) * fraction + c1) * fraction + c0;
+}
+
+float Resampler::sincInterpolate(const SincTable& table, const float* input, int inputLength,
+                                 int index, float fraction) {
+    const int taps = table.taps;
+    const int start = index - taps / 2 + 1;
+
+    float phasePos = fraction * table.phases;
+    int phase = std::min((int)phasePos, table.phases - 1);
+    float phaseFrac = phasePos - phase;
+    const float* c = &table.coeffs[(size_t)phase * taps];
+    const float* dc = &table.deltas[(size_t)phase * taps];
+
+    float sum = 0.0f;
+    for (int k = 0; k < taps; ++k) {
+        int n = std::max(0, std::min(inputLength - 1, start + k));
+        sum += input[n] * (c[k] + phaseFrac * dc[k]);
+    }
+    return sum;
+}
@@ -0,0 +1,140 @@
+/**
+ * Resampler.h
+ *
+ * 리샘플러 (선형 / 3차 / 폴리페이즈 windowed-sinc)
+ * SimplePitchShifter의 리샘플링 단계와 샘플레이트 변환에서 공통으로 사용
+ */
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include "../performance/MemoryTracker.h"
+#include <cstddef>
+#include <vector>
+
+// 품질 단계 (숫자가 클수록 고품질/느림)
+enum class ResamplerQuality {
+    LINEAR = 0,   // 선형 보간 (기존 방식, 안티앨리어싱 없음)
+    CUBIC = 1,    // 4점 Catmull-Rom 보간
+    SINC_16 = 2,  // 16탭 Kaiser windowed-sinc (안티앨리어싱)
+    SINC_64 = 3   // 64탭 Kaiser windowed-sinc (고품질)
+};
+
+class Resampler {
+public:
+    Resampler();
+
+    void setQuality(ResamplerQuality quality);
+    ResamplerQuality getQuality() const;
+
+    /**
+     * sinc 계열 파라미터 직접 설정 (setQuality 이후 호출하면 기본값을 덮어씀)
+     * @param taps 필터 길이 (4의 배수로 올림)
+     * @param phases 한 샘플 사이의 위상 수 (위상 사이는 선형 보간)
+     * @param kaiserBeta Kaiser 창 beta (클수록 저지대역 감쇠 증가, 전이대역 넓어짐)
+     * @param rolloff 차단 주파수 비율 (Nyquist 대비, 0.5 ~ 1.0)
+     */
+    void setSincParameters(int taps, int phases, float kaiserBeta, float rolloff);
+
+    /**
+     * 리샘플링
+     * @param input 입력 샘플
+     * @param inputLength 입력 샘플 수
+     * @param ratio 입력 샘플 간격 (> 1.0: 짧아짐/피치 올림, < 1.0: 길어짐/피치 내림)
+     * @param output 출력 버퍼 (inputLength / ratio 길이로 resize됨)
+     * @param outputGain 출력 gain (1.0이 아니면 [-1, 1] 클램프, 출력 루프에 융합)
+     */
+    void process(const float* input, int inputLength, float ratio,
+                 std::vector<float>& output, float outputGain = 1.0f);
+
+    /**
+     * 다채널 리샘플링 (planar: 채널마다 별도 배열)
+     * 모든 채널이 같은 위치 / 계수 테이블을 사용 (채널 간 위상 일치)
+     * @param inputs 채널별 입력 포인터 (channels개)
+     * @param outputs 채널별 출력 버퍼 (channels개, 용량 유지)
+     */
+    void processPlanar(const float* const* inputs, int channels, int inputLength, float ratio,
+                       std::vector<std::vector<float>>& outputs, float outputGain = 1.0f);
+
+    /**
+     * 다채널 리샘플링 (interleaved: L R L R ...)
+     * @param inputFrames 채널당 샘플 수
+     * @param output interleaved 출력 (출력 프레임 수 * channels)
+     */
+    void processInterleaved(const float* input, int inputFrames, int channels, float ratio,
+                            std::vector<float>& output, float outputGain = 1.0f);
+
+    /**
+     * 입력 샘플 위치 하나를 보간 (스트리밍 처리용, 범위 체크 포함)
+     * @param position 입력 샘플 위치 (소수)
+     * @param ratio 리샘플 비율 (sinc 계열의 차단 주파수 결정)
+     */
+    float interpolateAt(const float* input, int inputLength, double position, float ratio);
+
+    /**
+     * 위치를 지정한 블록 보간 (스트리밍 처리용)
+     * output[i] = input(startPosition + i * step), 범위 밖은 끝 샘플로 채움
+     * @param step 출력 샘플당 입력 위치 증가량 (sinc 계열의 차단 주파수 결정)
+     */
+    void interpolateBlock(const float* input, int inputLength, double startPosition,
+                          double step, float* output, int count);
+
+    // 현재 설정에서 필요한 좌/우 입력 샘플 수 (스트리밍 처리의 history 크기)
+    int getHalfLength() const;
+
+    // 현재 sinc 파라미터 (setQuality의 기본값 확인 / 비율에 따른 조정용)
+    int getTaps() const;
+    int getPhases() const;
+    float getKaiserBeta() const;
+    float getRolloff() const;
+
+private:
+    // 위상별 계수 테이블 (차단 주파수마다 하나, 캐시됨)
+    struct SincTable {
+        int taps;
+        int phases;
+        float kaiserBeta;
+        float cutoff;
+        std::vector<float> coeffs;  // (phases + 1) x taps
+        std::vector<float> deltas;  // phases x taps (다음 위상과의 차이, 위상 보간용)
+    };
+
+    ResamplerQuality quality_;
+    int taps_;
+    int phases_;
+    float kaiserBeta_;
+    float rolloff_;
+
+    std::vector<SincTable> tableCache_;  // 최근 사용 순서 (뒤쪽이 최신)
+
+    // interleaved 처리용 planar 버퍼 (호출 간 재사용)
+    std::vector<std::vector<float>> planarInput_;
+    std::vector<std::vector<float>> planarOutput_;
+    static const size_t MAX_CACHED_TABLES = 8;
+
+    // 계수 테이블 / planar 버퍼 용량 (MemoryTracker)
+    MemoryAccount scratchMemory_;
+    void syncScratchMemory();
+
+    // 병렬 처리 구간의 최소 출력 샘플 수 (작은 버퍼는 스레드를 깨우는 비용이 더 큼)
+    static const int PARALLEL_GRAIN = 16384;
+
+    const SincTable& getTable(float ratio);
+    void buildTable(SincTable& table);
+
+    // 출력 [begin, end) 구간 보간 (output[i] = input(startPosition + i * step))
+    void processLinear(const float* input, int inputLength, float ratio,
+                       float* output, int begin, int end, float outputGain);
+    void processCubic(const float* input, int inputLength, double startPosition, double step,
+                      float* output, int begin, int end, float outputGain);
+    void processSinc(const SincTable& table, const float* input, int inputLength,
+                     double startPosition, double step,
+                     float* output, int begin, int end, float outputGain);
+
+    float linearInterpolate(float sample1, float sample2, float fraction);
+    float cubicInterpolate(const float* input, int inputLength, int index, float fraction);
+    float sincInterpolate(const SincTable& table, const float* input, int inputLength,
+                          int index, float fraction);
+};
+
+#endif // RESAMPLER_H
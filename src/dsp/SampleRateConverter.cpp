@@ -0,0 +1,161 @@
+/**
+ * SampleRateConverter.cpp
+ *
+ * 스트리밍 샘플레이트 변환기
+ *
+ * 동작:
+ * 1. 출력 샘플 n의 입력 위치 = n * inputRate / outputRate (정수 연산으로 누적 오차 없음)
+ * 2. 위치 주변 입력이 모두 도착한 출력만 생성 (오른쪽 halfLength 샘플이 필요)
+ * 3. 다음 출력에 필요한 왼쪽 문맥만 남기고 지난 입력은 폐기
+ * 4. flush에서 남은 출력을 끝 샘플로 채워서 생성
+ *
+ * 블록 크기와 상관없이 convert() 한 번과 같은 결과를 냄
+ */
+
+#include "SampleRateConverter.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+SampleRateConverter::SampleRateConverter()
+    : quality_(ResamplerQuality::SINC_16), inputRate_(44100), outputRate_(44100),
+      historyStart_(0), totalInput_(0), producedOutput_(0) {
+    configureResampler();
+}
+
+void SampleRateConverter::setRates(int inputRate, int outputRate) {
+    if (inputRate <= 0 || outputRate <= 0) {
+        std::cerr << "[SampleRateConverter] 잘못된 샘플레이트: "
+                  << inputRate << " -> " << outputRate << std::endl;
+        return;
+    }
+
+    inputRate_ = inputRate;
+    outputRate_ = outputRate;
+    configureResampler();
+    reset();
+}
+
+int SampleRateConverter::getInputRate() const {
+    return inputRate_;
+}
+
+int SampleRateConverter::getOutputRate() const {
+    return outputRate_;
+}
+
+void SampleRateConverter::setQuality(ResamplerQuality quality) {
+    quality_ = quality;
+    configureResampler();
+    reset();
+}
+
+ResamplerQuality SampleRateConverter::getQuality() const {
+    return quality_;
+}
+
+void SampleRateConverter::reset() {
+    history_.clear();
+    historyStart_ = 0;
+    totalInput_ = 0;
+    producedOutput_ = 0;
+}
+
+void SampleRateConverter::configureResampler() {
+    resampler_.setQuality(quality_);
+
+    // 다운샘플: 차단 주파수가 1 / 비율로 낮아지므로 필터 길이를 비율만큼 늘려
+    // 같은 전이대역 폭 / 저지대역 감쇠를 유지
+    bool isSinc = quality_ == ResamplerQuality::SINC_16 || quality_ == ResamplerQuality::SINC_64;
+    if (isSinc && inputRate_ > outputRate_) {
+        double scale = (double)inputRate_ / outputRate_;
+        int taps = (int)std::ceil(resampler_.getTaps() * scale);
+        resampler_.setSincParameters(taps, resampler_.getPhases(),
+                                     resampler_.getKaiserBeta(), resampler_.getRolloff());
+    }
+}
+
+int SampleRateConverter::getLatency() const {
+    if (inputRate_ == outputRate_) {
+        return 0;
+    }
+    return resampler_.getHalfLength();
+}
+
+void SampleRateConverter::process(const float* input, int length, std::vector<float>& output) {
+    if (length <= 0) {
+        return;
+    }
+
+    // 같은 샘플레이트면 그대로 통과
+    if (inputRate_ == outputRate_) {
+        output.insert(output.end(), input, input + length);
+        totalInput_ += length;
+        producedOutput_ += length;
+        return;
+    }
+
+    history_.insert(history_.end(), input, input + length);
+    totalInput_ += length;
+    produce(false, output);
+}
+
+void SampleRateConverter::flush(std::vector<float>& output) {
+    if (inputRate_ != outputRate_) {
+        produce(true, output);
+    }
+    reset();
+}
+
+void SampleRateConverter::convert(const float* input, int length, std::vector<float>& output) {
+    reset();
+    output.clear();
+    output.reserve((size_t)((long long)length * outputRate_ / inputRate_) + 1);
+    process(input, length, output);
+    flush(output);
+}
+
+void SampleRateConverter::produce(bool atEnd, std::vector<float>& output) {
+    const int historySize = (int)history_.size();
+    if (historySize == 0) {
+        return;
+    }
+
+    const int half = resampler_.getHalfLength();
+    const long long inRate = inputRate_;
+    const long long outRate = outputRate_;
+
+    // 이번에 만들 수 있는 출력 수
+    long long targetTotal;
+    if (atEnd) {
+        targetTotal = totalInput_ * outRate / inRate;
+    } else {
+        // 출력 위치 p는 입력 floor(p) + half 까지 필요: p < totalInput_ - half
+        long long limit = totalInput_ - half;
+        targetTotal = (limit > 0) ? (limit * outRate + inRate - 1) / inRate : 0;
+    }
+
+    long long count = targetTotal - producedOutput_;
+    if (count <= 0) {
+        return;
+    }
+
+    // history_ 기준 시작 위치 (정수 연산 후 한 번만 나눔)
+    double startPosition = (double)(producedOutput_ * inRate - historyStart_ * outRate) / outRate;
+    double step = (double)inRate / outRate;
+
+    size_t offset = output.size();
+    output.resize(offset + (size_t)count);
+    resampler_.interpolateBlock(history_.data(), historySize, startPosition, step,
+                                output.data() + offset, (int)count);
+    producedOutput_ += count;
+
+    // 다음 출력의 왼쪽 문맥 (half - 1 샘플)만 남기고 폐기
+    long long nextIndex = producedOutput_ * inRate / outRate;
+    long long keepFrom = nextIndex - half + 1;
+    if (keepFrom > historyStart_) {
+        long long drop = std::min<long long>(keepFrom - historyStart_, historySize);
+        history_.erase(history_.begin(), history_.begin() + drop);
+        historyStart_ += drop;
+    }
+}
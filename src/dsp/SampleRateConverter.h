@@ -0,0 +1,81 @@
+/**
+ * SampleRateConverter.h
+ *
+ * 스트리밍 샘플레이트 변환기 (Resampler 기반)
+ * 입력을 블록 단위로 넣으면 변환된 샘플을 바로 내보내고,
+ * 보간에 필요한 입력 샘플만 내부에 보관
+ */
+
+#ifndef SAMPLE_RATE_CONVERTER_H
+#define SAMPLE_RATE_CONVERTER_H
+
+#include "Resampler.h"
+#include <vector>
+
+class SampleRateConverter {
+public:
+    SampleRateConverter();
+
+    /**
+     * 입력/출력 샘플레이트 설정 (내부 상태 초기화)
+     */
+    void setRates(int inputRate, int outputRate);
+    int getInputRate() const;
+    int getOutputRate() const;
+
+    /**
+     * 보간 품질 (기본: SINC_16)
+     * 다운샘플 시 sinc 필터 길이는 비율만큼 늘려 안티앨리어싱 성능을 유지
+     */
+    void setQuality(ResamplerQuality quality);
+    ResamplerQuality getQuality() const;
+
+    /**
+     * 스트림 상태 초기화 (보관 중인 입력 폐기)
+     */
+    void reset();
+
+    /**
+     * 입력 블록 처리
+     * @param output 변환된 샘플을 뒤에 추가 (clear하지 않음)
+     */
+    void process(const float* input, int length, std::vector<float>& output);
+
+    /**
+     * 스트림 끝: 남은 입력을 모두 변환 (끝 샘플로 채움)
+     * 전체 출력 길이 = 전체 입력 길이 * outputRate / inputRate
+     */
+    void flush(std::vector<float>& output);
+
+    /**
+     * 한 번에 변환 (reset + process + flush)
+     * @param output 결과 버퍼 (덮어씀)
+     */
+    void convert(const float* input, int length, std::vector<float>& output);
+
+    /**
+     * 출력되지 않고 보관되는 입력 샘플 수 (스트리밍 지연)
+     */
+    int getLatency() const;
+
+private:
+    Resampler resampler_;
+    ResamplerQuality quality_;
+    int inputRate_;
+    int outputRate_;
+
+    std::vector<float> history_;   // 아직 필요한 입력 샘플 (왼쪽 문맥 포함)
+    long long historyStart_;       // history_[0]의 절대 입력 인덱스
+    long long totalInput_;         // 지금까지 받은 입력 샘플 수
+    long long producedOutput_;     // 지금까지 내보낸 출력 샘플 수
+
+    void configureResampler();
+
+    /**
+     * 출력 생성
+     * @param atEnd true면 입력 끝까지 (범위 밖은 끝 샘플로 채움)
+     */
+    void produce(bool atEnd, std::vector<float>& output);
+};
+
+#endif // SAMPLE_RATE_CONVERTER_H
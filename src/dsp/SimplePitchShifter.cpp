@@ -13,20 +13,125 @@
  */
 
 #include "SimplePitchShifter.h"
+#include "../audio/ChannelLayout.h"
+#include "../audio/SampleOps.h"
 #include <cmath>
+#include <algorithm>
 #include <iostream>
 
 SimplePitchShifter::SimplePitchShifter() {
     // 생성자
 }
 
+void SimplePitchShifter::setResamplerQuality(ResamplerQuality quality) {
+    resampler_.setQuality(quality);
+}
+
+ResamplerQuality SimplePitchShifter::getResamplerQuality() const {
+    return resampler_.getQuality();
+}
+
+void SimplePitchShifter::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    timeStretcher.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& SimplePitchShifter::getSearchPolicy() const {
+    return timeStretcher.getSearchPolicy();
+}
+
+void SimplePitchShifter::setCrossfadeShape(CrossfadeShape shape) {
+    timeStretcher.setCrossfadeShape(shape);
+}
+
+CrossfadeShape SimplePitchShifter::getCrossfadeShape() const {
+    return timeStretcher.getCrossfadeShape();
+}
+
+ResamplerQuality SimplePitchShifter::qualityFromAlgorithm(const std::string& algorithm) {
+    if (algorithm == "simple-cubic") return ResamplerQuality::CUBIC;
+    if (algorithm == "simple-sinc16") return ResamplerQuality::SINC_16;
+    if (algorithm == "simple-sinc64") return ResamplerQuality::SINC_64;
+    return ResamplerQuality::LINEAR;
+}
+
 AudioBuffer SimplePitchShifter::process(const AudioBuffer& input, float semitones, PerformanceChecker* perfChecker) {
     // 변화가 거의 없으면 원본 반환
     if (std::abs(semitones) < 0.01f) {
         return input;
     }
 
-    std::cout << "[SimplePitchShifter] 처리 시작 - 반음: " << semitones << std::endl;
+    return processWithTempo(input, semitones, 1.0f, perfChecker);
+}
+
+AudioBuffer SimplePitchShifter::processWithTempo(const AudioBuffer& input, float semitones, float tempo,
+                                                 PerformanceChecker* perfChecker) {
+    // 변화가 거의 없으면 원본 반환
+    if (std::abs(semitones) < 0.01f && std::abs(tempo - 1.0f) < 0.01f) {
+        return input;
+    }
+
+    // planar AudioBuffer: 정렬된 plane을 그대로 처리하고 같은 정렬의 planar로 반환
+    if (input.isPlanar()) {
+        std::vector<const float*> planes = input.getChannelPointers();
+        std::vector<std::vector<float>> outputs;
+        processWithTempoPlanar(planes.data(), input.getChannels(), (int)input.getFrameCount(),
+                               input.getSampleRate(), semitones, tempo, outputs, 1.0f, perfChecker);
+
+        AudioBuffer result(input.getSampleRate(), input.getChannels());
+        result.setPlanarData(outputs, input.getAlignment());
+        return result;
+    }
+
+    std::vector<float> outputData;
+    int channels = std::max(1, input.getChannels());
+    if (channels > 1) {
+        // 다채널 AudioBuffer는 interleaved로 저장됨
+        processWithTempoInterleaved(input.getData().data(), (int)input.getLength() / channels, channels,
+                                    input.getSampleRate(), semitones, tempo, outputData, 1.0f, perfChecker);
+    } else {
+        processWithTempo(input.getData().data(), (int)input.getLength(), input.getSampleRate(),
+                         semitones, tempo, outputData, 1.0f, perfChecker);
+    }
+
+    AudioBuffer result(input.getSampleRate(), channels);
+    result.setData(std::move(outputData)); // move semantics
+    return result;
+}
+
+void SimplePitchShifter::process(const float* input, int inputLength, int sampleRate, float semitones,
+                                 std::vector<float>& output, float outputGain,
+                                 PerformanceChecker* perfChecker) {
+    processWithTempo(input, inputLength, sampleRate, semitones, 1.0f, output, outputGain, perfChecker);
+}
+
+void SimplePitchShifter::processWithTempo(const float* input, int inputLength, int sampleRate,
+                                          float semitones, float tempo,
+                                          std::vector<float>& output, float outputGain,
+                                          PerformanceChecker* perfChecker) {
+    if (tempo <= 0) {
+        std::cerr << "[SimplePitchShifter] 잘못된 속도 비율: " << tempo << std::endl;
+        tempo = 1.0f;
+    }
+
+    bool hasPitch = std::abs(semitones) >= 0.01f;
+
+    // 피치 변화가 없으면: 원본 복사 또는 time stretch만 (gain만 적용)
+    if (!hasPitch) {
+        if (std::abs(tempo - 1.0f) < 0.01f) {
+            output.assign(input, input + inputLength);
+        } else {
+            if (perfChecker) perfChecker->startFunction("timeStretcher.process");
+            timeStretcher.process(input, inputLength, sampleRate, tempo, output, perfChecker);
+            if (perfChecker) perfChecker->endFunction();
+        }
+        if (outputGain != 1.0f) {
+            SampleOps::applyGainClamped(output, outputGain);
+        }
+        return;
+    }
+
+    std::cout << "[SimplePitchShifter] 처리 시작 - 반음: " << semitones
+              << ", 속도: " << tempo << std::endl;
 
     // Step 1: 반음을 비율로 변환
     if (perfChecker) perfChecker->startFunction("semitonesToRatio");
@@ -38,9 +143,11 @@ AudioBuffer SimplePitchShifter::process(const AudioBuffer& input, float semitone
     // Step 2: Time Stretch 적용
     // 피치를 높이려면: 먼저 느리게 (1/pitchRatio)
     // 피치를 낮추려면: 먼저 빠르게 (1/pitchRatio)
-    float stretchRatio = 1.0f / pitchRatio;
+    // 속도 변경까지 같은 패스에서 처리: tempo / pitchRatio
+    // (출력 길이 = inputLength / stretchRatio / pitchRatio = inputLength / tempo)
+    float stretchRatio = tempo / pitchRatio;
     if (perfChecker) perfChecker->startFunction("timeStretcher.process");
-    AudioBuffer stretched = timeStretcher.process(input, stretchRatio, perfChecker);
+    timeStretcher.process(input, inputLength, sampleRate, stretchRatio, stretchBuffer_, perfChecker);
     if (perfChecker) perfChecker->endFunction();
 
     std::cout << "[SimplePitchShifter] Time stretch 완료 - 비율: " << stretchRatio << std::endl;
@@ -48,120 +155,110 @@ AudioBuffer SimplePitchShifter::process(const AudioBuffer& input, float semitone
     // Step 3: Resampling으로 원래 길이로 복원
     // 이 과정에서 피치만 변경됨
     if (perfChecker) perfChecker->startFunction("resample");
-    AudioBuffer result = resample(stretched, pitchRatio);
+    resample(stretchBuffer_.data(), (int)stretchBuffer_.size(), pitchRatio, output, outputGain);
     if (perfChecker) perfChecker->endFunction();
 
     std::cout << "[SimplePitchShifter] 리샘플링 완료 - 최종 길이: "
-              << result.getLength() << " 샘플" << std::endl;
-
-    return result;
-}
-
-float SimplePitchShifter::semitonesToRatio(float semitones) {
-    // 반음을 주파수 비율로 변환
-    // 공식: ratio = 2^(semitones/12)
-    //
-    // 예시:
-    // +12 반음 (한 옥타브 위) = 2^(12/12) = 2.0 (주파수 2배)
-    // +7 반음 (완전5도 위) = 2^(7/12) = 1.498 (약 1.5배)
-    // -12 반음 (한 옥타브 아래) = 2^(-12/12) = 0.5 (주파수 절반)
-
-    return std::pow(2.0f, semitones / 12.0f);
+              << output.size() << " 샘플" << std::endl;
+    syncScratchMemory();
 }
 
-AudioBuffer SimplePitchShifter::resample(const AudioBuffer& input, float ratio) {
-    const std::vector<float>& inputData = input.getData();
-    int inputLength = inputData.size();
-    int sampleRate = input.getSampleRate();
+void SimplePitchShifter::processWithTempoPlanar(const float* const* inputs, int channels, int inputLength,
+                                                int sampleRate, float semitones, float tempo,
+                                                std::vector<std::vector<float>>& outputs, float outputGain,
+                                                PerformanceChecker* perfChecker) {
+    outputs.resize(std::max(0, channels));
+    if (channels <= 0) {
+        return;
+    }
+    if (tempo <= 0) {
+        std::cerr << "[SimplePitchShifter] 잘못된 속도 비율: " << tempo << std::endl;
+        tempo = 1.0f;
+    }
 
-    // 출력 길이 계산
-    // ratio > 1.0: 더 짧아짐 (빠르게 재생)
-    // ratio < 1.0: 더 길어짐 (느리게 재생)
-    int outputLength = (int)(inputLength / ratio);
+    bool hasPitch = std::abs(semitones) >= 0.01f;
+    float pitchRatio = hasPitch ? semitonesToRatio(semitones) : 1.0f;
 
-    std::vector<float> outputData(outputLength);
+    // Step 1: 모든 채널을 같은 세그먼트 위치로 time stretch (mid 신호에서 1회 탐색)
+    // 피치 변화가 없으면 결과를 바로 출력으로 사용
+    std::vector<std::vector<float>>& stretched = hasPitch ? stretchPlanar_ : outputs;
+    if (perfChecker) perfChecker->startFunction("timeStretcher.processPlanar");
+    timeStretcher.processPlanar(inputs, channels, inputLength, sampleRate, tempo / pitchRatio,
+                                stretched, perfChecker);
+    if (perfChecker) perfChecker->endFunction();
 
-    std::cout << "[SimplePitchShifter] 리샘플링 - 입력: " << inputLength
-              << " -> 출력: " << outputLength << " 샘플" << std::endl;
-
-    // Loop Unrolling: 4개씩 묶어서 처리 (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
-    int i = 0;
-    int simdSize = outputLength - 3;
-
-    for (; i < simdSize; i += 4) {
-        // 4개의 출력 샘플을 한 번에 계산
-        float inputPos0 = i * ratio;
-        float inputPos1 = (i + 1) * ratio;
-        float inputPos2 = (i + 2) * ratio;
-        float inputPos3 = (i + 3) * ratio;
-
-        int index0 = (int)inputPos0;
-        int index1 = (int)inputPos1;
-        int index2 = (int)inputPos2;
-        int index3 = (int)inputPos3;
-
-        float frac0 = inputPos0 - index0;
-        float frac1 = inputPos1 - index1;
-        float frac2 = inputPos2 - index2;
-        float frac3 = inputPos3 - index3;
-
-        // 범위 체크 및 보간
-        if (index0 < inputLength - 1) {
-            outputData[i] = inputData[index0] * (1.0f - frac0) + inputData[index0 + 1] * frac0;
-        } else {
-            outputData[i] = inputData[inputLength - 1];
+    if (!hasPitch) {
+        if (outputGain != 1.0f) {
+            for (auto& channel : outputs) {
+                SampleOps::applyGainClamped(channel, outputGain);
+            }
         }
+        return;
+    }
 
-        if (index1 < inputLength - 1) {
-            outputData[i + 1] = inputData[index1] * (1.0f - frac1) + inputData[index1 + 1] * frac1;
-        } else {
-            outputData[i + 1] = inputData[inputLength - 1];
-        }
+    // Step 2: 채널별 리샘플링 (모든 채널이 같은 위치 / 계수 테이블 사용)
+    std::vector<const float*> planes(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c] = stretchPlanar_[c].data();
+    }
+    if (perfChecker) perfChecker->startFunction("resample");
+    resampler_.processPlanar(planes.data(), channels, (int)stretchPlanar_[0].size(), pitchRatio,
+                             outputs, outputGain);
+    if (perfChecker) perfChecker->endFunction();
 
-        if (index2 < inputLength - 1) {
-            outputData[i + 2] = inputData[index2] * (1.0f - frac2) + inputData[index2 + 1] * frac2;
-        } else {
-            outputData[i + 2] = inputData[inputLength - 1];
-        }
+    std::cout << "[SimplePitchShifter] 다채널 처리 완료 - 채널: " << channels
+              << ", 채널당 길이: " << outputs[0].size() << " 샘플" << std::endl;
+    syncScratchMemory();
+}
 
-        if (index3 < inputLength - 1) {
-            outputData[i + 3] = inputData[index3] * (1.0f - frac3) + inputData[index3 + 1] * frac3;
-        } else {
-            outputData[i + 3] = inputData[inputLength - 1];
-        }
+void SimplePitchShifter::processWithTempoInterleaved(const float* input, int inputFrames, int channels,
+                                                     int sampleRate, float semitones, float tempo,
+                                                     std::vector<float>& output, float outputGain,
+                                                     PerformanceChecker* perfChecker) {
+    if (channels <= 0) {
+        output.clear();
+        return;
+    }
+    if (channels == 1) {
+        processWithTempo(input, inputFrames, sampleRate, semitones, tempo, output, outputGain, perfChecker);
+        return;
     }
 
-    // 나머지 처리
-    for (; i < outputLength; i++) {
-        float inputPos = i * ratio;
-        int index = (int)inputPos;
-        float fraction = inputPos - index;
+    ChannelLayout::deinterleave(input, inputFrames, channels, planarInput_);
 
-        if (index >= inputLength - 1) {
-            outputData[i] = inputData[inputLength - 1];
-        } else {
-            outputData[i] = linearInterpolate(inputData[index], inputData[index + 1], fraction);
-        }
+    std::vector<const float*> planes(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c] = planarInput_[c].data();
     }
+    processWithTempoPlanar(planes.data(), channels, inputFrames, sampleRate, semitones, tempo,
+                           planarOutput_, outputGain, perfChecker);
 
-    // 결과 AudioBuffer 생성
-    AudioBuffer output(sampleRate, 1);
-    output.setData(std::move(outputData)); // move semantics
-    return output;
+    ChannelLayout::interleave(planarOutput_, (int)planarOutput_[0].size(), output);
+    syncScratchMemory();
 }
 
-float SimplePitchShifter::linearInterpolate(float sample1, float sample2, float fraction) {
-    // 선형 보간 (Linear Interpolation)
-    //
-    // 두 점 사이의 직선상에 있는 값을 계산
-    // 공식: result = sample1 * (1 - fraction) + sample2 * fraction
+void SimplePitchShifter::syncScratchMemory() {
+    scratchMemory_.update(capacityBytes(stretchBuffer_) + capacityBytes(stretchPlanar_) +
+                          capacityBytes(planarInput_) + capacityBytes(planarOutput_));
+}
+
+float SimplePitchShifter::semitonesToRatio(float semitones) {
+    // 반음을 주파수 비율로 변환
+    // 공식: ratio = 2^(semitones/12)
     //
     // 예시:
-    // sample1 = 1.0, sample2 = 3.0, fraction = 0.5
-    // result = 1.0 * 0.5 + 3.0 * 0.5 = 2.0 (정확히 중간값)
-    //
-    // sample1 = 1.0, sample2 = 3.0, fraction = 0.25
-    // result = 1.0 * 0.75 + 3.0 * 0.25 = 1.5 (1에 가까움)
+    // +12 반음 (한 옥타브 위) = 2^(12/12) = 2.0 (주파수 2배)
+    // +7 반음 (완전5도 위) = 2^(7/12) = 1.498 (약 1.5배)
+    // -12 반음 (한 옥타브 아래) = 2^(-12/12) = 0.5 (주파수 절반)
+
+    return std::pow(2.0f, semitones / 12.0f);
+}
+
+void SimplePitchShifter::resample(const float* inputData, int inputLength, float ratio,
+                                  std::vector<float>& outputData, float outputGain) {
+    std::cout << "[SimplePitchShifter] 리샘플링 - 입력: " << inputLength
+              << " -> 출력: " << (int)(inputLength / ratio) << " 샘플" << std::endl;
 
-    return sample1 * (1.0f - fraction) + sample2 * fraction;
+    // 보간 방식은 resampler_ 품질 설정에 따름 (기본: 선형)
+    resampler_.process(inputData, inputLength, ratio, outputData, outputGain);
 }
@@ -10,11 +10,38 @@
 #include "../audio/AudioBuffer.h"
 #include "../performance/PerformanceChecker.h"
 #include "SimpleTimeStretcher.h"
+#include "Resampler.h"
+#include <string>
 
 class SimplePitchShifter {
 public:
     SimplePitchShifter();
 
+    /**
+     * 리샘플링 단계의 보간 품질 (기본: LINEAR)
+     * SINC 계열은 피치를 올릴 때 생기는 앨리어싱을 제거
+     */
+    void setResamplerQuality(ResamplerQuality quality);
+    ResamplerQuality getResamplerQuality() const;
+
+    /**
+     * 바인딩의 algorithm 문자열에서 리샘플링 품질 선택
+     * "simple" (선형, 기본), "simple-cubic", "simple-sinc16", "simple-sinc64"
+     */
+    static ResamplerQuality qualityFromAlgorithm(const std::string& algorithm);
+
+    /**
+     * WSOLA 단계의 겹침 위치 탐색 정책 (SimpleTimeStretcher::setSearchPolicy)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * WSOLA 단계의 크로스페이드 모양 (SimpleTimeStretcher::setCrossfadeShape)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
     /**
      * 오디오의 피치를 변경 (길이는 유지)
      * @param input 입력 오디오
@@ -24,8 +51,78 @@ public:
      */
     AudioBuffer process(const AudioBuffer& input, float semitones, PerformanceChecker* perfChecker = nullptr);
 
+    /**
+     * 출력 버퍼를 직접 받는 버전 (버퍼 재사용용, EffectChain 등)
+     * 중간 stretch 버퍼는 멤버로 유지되어 반복 호출 시 재할당이 없음
+     * @param input 입력 샘플 포인터
+     * @param inputLength 입력 샘플 수
+     * @param sampleRate 샘플레이트
+     * @param semitones 반음 단위
+     * @param output 출력 버퍼 (처리 결과 길이로 resize됨)
+     * @param outputGain 리샘플링 루프에 융합되는 출력 gain (1.0 = 없음, 그 외에는 [-1, 1] 클램프)
+     * @param perfChecker 성능 측정 (optional)
+     */
+    void process(const float* input, int inputLength, int sampleRate, float semitones,
+                 std::vector<float>& output, float outputGain = 1.0f,
+                 PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 피치와 속도를 한 번에 변경 (WSOLA 1회 + 리샘플링 1회)
+     *
+     * process(semitones) 후 SimpleTimeStretcher::process(tempo)를 하는 대신
+     * stretch(tempo / pitchRatio) + resample(pitchRatio)로 같은 결과를 계산
+     * (WSOLA 2회 + 리샘플 1회, 전체 크기 버퍼 3개 -> WSOLA 1회 + 리샘플 1회, 버퍼 2개)
+     *
+     * @param input 입력 오디오
+     * @param semitones 반음 단위 (-12 ~ +12)
+     * @param tempo 속도 비율 (SimpleTimeStretcher와 동일, 2.0 = 2배 빠르게)
+     * @param perfChecker 성능 측정 (optional)
+     * @return 피치와 속도가 변경된 오디오
+     */
+    AudioBuffer processWithTempo(const AudioBuffer& input, float semitones, float tempo,
+                                 PerformanceChecker* perfChecker = nullptr);
+
+    void processWithTempo(const float* input, int inputLength, int sampleRate,
+                          float semitones, float tempo,
+                          std::vector<float>& output, float outputGain = 1.0f,
+                          PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 다채널 처리 (planar: 채널마다 별도 배열)
+     * WSOLA 위치는 mid 신호에서 한 번만 탐색해 모든 채널에 적용하고,
+     * 리샘플링도 모든 채널이 같은 위치를 사용 (채널 간 위상 / 길이 일치)
+     * @param inputs 채널별 입력 포인터 (channels개)
+     * @param inputLength 채널당 샘플 수
+     * @param outputs 채널별 출력 버퍼 (channels개, 용량 유지)
+     */
+    void processWithTempoPlanar(const float* const* inputs, int channels, int inputLength, int sampleRate,
+                                float semitones, float tempo,
+                                std::vector<std::vector<float>>& outputs, float outputGain = 1.0f,
+                                PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 다채널 처리 (interleaved: L R L R ...)
+     * @param inputFrames 채널당 샘플 수
+     * @param output interleaved 출력 (출력 프레임 수 * channels)
+     */
+    void processWithTempoInterleaved(const float* input, int inputFrames, int channels, int sampleRate,
+                                     float semitones, float tempo,
+                                     std::vector<float>& output, float outputGain = 1.0f,
+                                     PerformanceChecker* perfChecker = nullptr);
+
 private:
     SimpleTimeStretcher timeStretcher;
+    std::vector<float> stretchBuffer_;  // time stretch 중간 결과 (재사용)
+
+    // 다채널 처리용 (호출 간 재사용)
+    std::vector<std::vector<float>> stretchPlanar_;  // 채널별 time stretch 중간 결과
+    std::vector<std::vector<float>> planarInput_;    // interleaved 입력의 planar 변환
+    std::vector<std::vector<float>> planarOutput_;   // planar 출력 (interleave 전)
+    Resampler resampler_;
+
+    // 위 재사용 버퍼들의 용량 (MemoryTracker)
+    MemoryAccount scratchMemory_;
+    void syncScratchMemory();
 
     /**
      * 반음을 비율로 변환
@@ -35,12 +132,8 @@ private:
     /**
      * 리샘플링
      */
-    AudioBuffer resample(const AudioBuffer& input, float ratio);
-
-    /**
-     * 선형 보간
-     */
-    float linearInterpolate(float sample1, float sample2, float fraction);
+    void resample(const float* input, int inputLength, float ratio,
+                  std::vector<float>& output, float outputGain);
 };
 
 #endif // SIMPLE_PITCH_SHIFTER_H
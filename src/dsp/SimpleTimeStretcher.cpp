@@ -12,6 +12,8 @@
 
 #include "SimpleTimeStretcher.h"
 #include "../audio/BufferPool.h"
+#include "../audio/ChannelLayout.h"
+#include "../performance/TaskPool.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -20,11 +22,191 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-SimpleTimeStretcher::SimpleTimeStretcher() {
+namespace {
+
+// 계층적 탐색 파라미터
+const int HIERARCHICAL_DECIMATION = 4;   // 4샘플 평균 -> 1샘플
+const int HIERARCHICAL_CANDIDATES = 3;   // 전체 해상도로 확인할 후보 수
+
+// 고정 파라미터 (음악에 적합한 값들)
+const int DEFAULT_SEQUENCE_MS = 40;
+const int DEFAULT_SEEK_WINDOW_MS = 15;
+const int DEFAULT_OVERLAP_MS = 8;
+
+// 자동 파라미터: 비율 0.5 ~ 2.0 사이에서 선형 보간 (SoundTouch TDStretch::calcSeqParameters와 같은 값)
+const double AUTO_RATIO_LOW = 0.5;
+const double AUTO_RATIO_HIGH = 2.0;
+const double AUTO_SEQUENCE_AT_LOW = 90.0;
+const double AUTO_SEQUENCE_AT_HIGH = 40.0;
+const double AUTO_SEEK_AT_LOW = 20.0;
+const double AUTO_SEEK_AT_HIGH = 15.0;
+
+// 피치 곡선 사용 조건
+const float CONTOUR_MIN_CONFIDENCE = 0.5f;   // 이보다 낮은 점은 무성음으로 취급
+const float CONTOUR_MAX_GAP = 0.05f;         // 가장 가까운 점이 이보다 멀면 (초) 비율 기반 탐색 범위 사용
+const int CONTOUR_MIN_SEEK_MS = 2;
+
+double interpolateByRatio(float ratio, double atLow, double atHigh) {
+    double t = (std::min(std::max((double)ratio, AUTO_RATIO_LOW), AUTO_RATIO_HIGH) - AUTO_RATIO_LOW)
+             / (AUTO_RATIO_HIGH - AUTO_RATIO_LOW);
+    return atLow + (atHigh - atLow) * t;
+}
+
+} // namespace
+
+SimpleTimeStretcher::SimpleTimeStretcher()
+    : searchMode_(OverlapSearchMode::STANDARD), parameterMode_(StretchParameterMode::FIXED),
+      crossfadeShape_(CrossfadeShape::LINEAR), blockStart_(std::chrono::steady_clock::now()),
+      budgetFallbacks_(0), contourOverlapMs_(0), tableShape_(CrossfadeShape::LINEAR) {
     // 기본 파라미터 설정 (음악에 적합한 값들)
-    sequenceMs = 40;      // 각 조각을 40ms로 설정
-    seekWindowMs = 15;    // 15ms 범위 내에서 최적 위치 탐색
-    overlapMs = 8;        // 8ms 동안 겹쳐서 합치기
+    sequenceMs = DEFAULT_SEQUENCE_MS;        // 각 조각을 40ms로 설정
+    seekWindowMs = DEFAULT_SEEK_WINDOW_MS;   // 15ms 범위 내에서 최적 위치 탐색
+    overlapMs = DEFAULT_OVERLAP_MS;          // 8ms 동안 겹쳐서 합치기
+}
+
+void SimpleTimeStretcher::setParameterMode(StretchParameterMode mode) {
+    parameterMode_ = mode;
+}
+
+StretchParameterMode SimpleTimeStretcher::getParameterMode() const {
+    return parameterMode_;
+}
+
+void SimpleTimeStretcher::setPitchContour(const std::vector<PitchPoint>& contour) {
+    pitchContour_.clear();
+    std::vector<float> periodsMs;
+    for (const PitchPoint& point : contour) {
+        if (point.frequency > 0.0f && point.confidence >= CONTOUR_MIN_CONFIDENCE) {
+            pitchContour_.push_back(point);
+            periodsMs.push_back(1000.0f / point.frequency);
+        }
+    }
+
+    contourOverlapMs_ = 0;
+    if (!periodsMs.empty()) {
+        std::nth_element(periodsMs.begin(), periodsMs.begin() + periodsMs.size() / 2, periodsMs.end());
+        contourOverlapMs_ = (int)std::ceil(periodsMs[periodsMs.size() / 2]);
+    }
+}
+
+int SimpleTimeStretcher::getSequenceMs() const {
+    return sequenceMs;
+}
+
+int SimpleTimeStretcher::getSeekWindowMs() const {
+    return seekWindowMs;
+}
+
+int SimpleTimeStretcher::getOverlapMs() const {
+    return overlapMs;
+}
+
+void SimpleTimeStretcher::updateParameters(float ratio) {
+    if (parameterMode_ == StretchParameterMode::FIXED) {
+        sequenceMs = DEFAULT_SEQUENCE_MS;
+        seekWindowMs = DEFAULT_SEEK_WINDOW_MS;
+        overlapMs = DEFAULT_OVERLAP_MS;
+        return;
+    }
+
+    // 느릴수록 긴 조각 (같은 조각이 반복되는 횟수 감소 -> 반향 감소)
+    sequenceMs = (int)(interpolateByRatio(ratio, AUTO_SEQUENCE_AT_LOW, AUTO_SEQUENCE_AT_HIGH) + 0.5);
+    seekWindowMs = (int)(interpolateByRatio(ratio, AUTO_SEEK_AT_LOW, AUTO_SEEK_AT_HIGH) + 0.5);
+
+    // 크로스페이드는 기본 주기 하나 이상 (낮은 목소리에서 주기보다 짧은 페이드는 이음새가 들림)
+    overlapMs = std::min(std::max(DEFAULT_OVERLAP_MS, contourOverlapMs_), sequenceMs / 3);
+
+    std::cout << "[SimpleTimeStretcher] 자동 파라미터 - sequence " << sequenceMs << " ms, seek "
+              << seekWindowMs << " ms, overlap " << overlapMs << " ms"
+              << (pitchContour_.empty() ? "" : " (피치 곡선 사용)") << std::endl;
+}
+
+int SimpleTimeStretcher::localSeekSamples(int inputPos, int sampleRate, int maxSeekSamples,
+                                          size_t& cursor) const {
+    if (parameterMode_ != StretchParameterMode::AUTO || pitchContour_.empty()) {
+        return maxSeekSamples;
+    }
+
+    // 입력 위치 이후의 첫 점까지 전진 (앞뒤 점 중 가까운 쪽 사용)
+    const float time = (float)inputPos / sampleRate;
+    while (cursor < pitchContour_.size() && pitchContour_[cursor].time < time) {
+        cursor++;
+    }
+    const PitchPoint* nearest = nullptr;
+    if (cursor < pitchContour_.size()) {
+        nearest = &pitchContour_[cursor];
+    }
+    if (cursor > 0 && (!nearest || time - pitchContour_[cursor - 1].time < nearest->time - time)) {
+        nearest = &pitchContour_[cursor - 1];
+    }
+    if (!nearest || std::abs(nearest->time - time) > CONTOUR_MAX_GAP) {
+        return maxSeekSamples;   // 무성음 / 무음 구간
+    }
+
+    // 주기 하나만큼 앞뒤로 탐색하면 같은 위상의 위치가 최소 2개 포함됨
+    const int periodSamples = (int)std::ceil(sampleRate / nearest->frequency);
+    const int minSeekSamples = CONTOUR_MIN_SEEK_MS * sampleRate / 1000;
+    return std::min(maxSeekSamples, std::max(minSeekSamples, periodSamples));
+}
+
+void SimpleTimeStretcher::setSearchMode(OverlapSearchMode mode) {
+    searchMode_ = mode;
+}
+
+OverlapSearchMode SimpleTimeStretcher::getSearchMode() const {
+    return searchMode_;
+}
+
+void SimpleTimeStretcher::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    searchPolicy_ = policy;
+    if (policy.coarseStep < 1) {
+        std::cerr << "[SimpleTimeStretcher] 잘못된 탐색 간격: " << policy.coarseStep << std::endl;
+        searchPolicy_.coarseStep = 1;
+    }
+    if (policy.maxCandidates < 0) {
+        std::cerr << "[SimpleTimeStretcher] 잘못된 후보 수 상한: " << policy.maxCandidates << std::endl;
+        searchPolicy_.maxCandidates = 0;
+    }
+    if (policy.blockBudgetMs < 0.0f) {
+        std::cerr << "[SimpleTimeStretcher] 잘못된 시간 예산: " << policy.blockBudgetMs << std::endl;
+        searchPolicy_.blockBudgetMs = 0.0f;
+    }
+}
+
+const OverlapSearchPolicy& SimpleTimeStretcher::getSearchPolicy() const {
+    return searchPolicy_;
+}
+
+int SimpleTimeStretcher::getBudgetFallbackCount() const {
+    return budgetFallbacks_;
+}
+
+void SimpleTimeStretcher::setCrossfadeShape(CrossfadeShape shape) {
+    crossfadeShape_ = shape;
+}
+
+CrossfadeShape SimpleTimeStretcher::getCrossfadeShape() const {
+    return crossfadeShape_;
+}
+
+void SimpleTimeStretcher::beginSearchBlock() {
+    budgetFallbacks_ = 0;
+    if (searchPolicy_.blockBudgetMs > 0.0f) {
+        blockStart_ = std::chrono::steady_clock::now();
+    }
+}
+
+bool SimpleTimeStretcher::searchBudgetExceeded() {
+    if (searchPolicy_.blockBudgetMs <= 0.0f) {
+        return false;
+    }
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - blockStart_).count();
+    if (elapsedMs <= searchPolicy_.blockBudgetMs) {
+        return false;
+    }
+    budgetFallbacks_++;
+    return true;
 }
 
 AudioBuffer SimpleTimeStretcher::process(const AudioBuffer& input, float ratio, PerformanceChecker* perfChecker) {
@@ -39,41 +221,105 @@ AudioBuffer SimpleTimeStretcher::process(const AudioBuffer& input, float ratio,
         return input;
     }
 
+    // planar AudioBuffer: 정렬된 plane을 그대로 처리하고 같은 정렬의 planar로 반환
+    if (input.isPlanar()) {
+        std::vector<const float*> planes = input.getChannelPointers();
+        std::vector<std::vector<float>> outputs;
+        processPlanar(planes.data(), input.getChannels(), (int)input.getFrameCount(),
+                      input.getSampleRate(), ratio, outputs, perfChecker);
+
+        AudioBuffer output(input.getSampleRate(), input.getChannels());
+        output.setPlanarData(outputs, input.getAlignment());
+        return output;
+    }
+
     const std::vector<float>& inputData = input.getData();
     int sampleRate = input.getSampleRate();
     int inputLength = inputData.size();
 
+    // 출력 버퍼 크기 예측 (메모리 풀 사용)
+    // BufferPool.acquire() 가 이미 resize(estimatedOutputLength) 수행
+    int sequenceSamples = (sequenceMs * sampleRate) / 1000;
+    int estimatedOutputLength = (int)(inputLength / ratio) + sequenceSamples;
+    auto outputData = BufferPool::getInstance().acquire(estimatedOutputLength);
+
+    // 다채널 AudioBuffer는 interleaved로 저장됨
+    int channels = std::max(1, input.getChannels());
+    if (channels > 1) {
+        processInterleaved(inputData.data(), inputLength / channels, channels, sampleRate, ratio,
+                           outputData, perfChecker);
+    } else {
+        process(inputData.data(), inputLength, sampleRate, ratio, outputData, perfChecker);
+    }
+
+    AudioBuffer output(sampleRate, channels);
+    output.setData(outputData);   // setData는 복사하므로 작업 버퍼는 풀에 돌려줌
+    BufferPool::getInstance().release(std::move(outputData));
+    return output;
+}
+
+void SimpleTimeStretcher::process(const float* inputData, int inputLength, int sampleRate, float ratio,
+                                  std::vector<float>& outputData, PerformanceChecker* perfChecker) {
+    // 잘못된 비율이거나 1.0에 가까우면 원본 복사
+    if (ratio <= 0 || std::abs(ratio - 1.0f) < 0.01f) {
+        if (ratio <= 0) {
+            std::cerr << "[SimpleTimeStretcher] 잘못된 비율: " << ratio << std::endl;
+        }
+        outputData.assign(inputData, inputData + inputLength);
+        return;
+    }
+
+    stretch(inputData, inputLength, sampleRate, ratio, outputData, nullptr, perfChecker);
+}
+
+void SimpleTimeStretcher::stretch(const float* inputData, int inputLength, int sampleRate, float ratio,
+                                  std::vector<float>& outputData, std::vector<int>* segmentPositions,
+                                  PerformanceChecker* perfChecker) {
+    updateParameters(ratio);
+    beginSearchBlock();
+
     // 밀리초를 샘플 수로 변환
     int sequenceSamples = (sequenceMs * sampleRate) / 1000;
     int seekWindowSamples = (seekWindowMs * sampleRate) / 1000;
     int overlapSamples = (overlapMs * sampleRate) / 1000;
+    prepareCrossfade(overlapSamples);
 
-    // 출력 버퍼 크기 예측 (메모리 풀 사용)
-    // BufferPool.acquire() 가 이미 resize(estimatedOutputLength) 수행
+    if (segmentPositions) segmentPositions->clear();
+
+    // 출력 버퍼 크기 예측 (용량이 충분하면 재할당 없음)
     int estimatedOutputLength = (int)(inputLength / ratio) + sequenceSamples;
-    auto outputData = BufferPool::getInstance().acquire(estimatedOutputLength);
+    outputData.resize(estimatedOutputLength);
 
     int inputPos = 0;
     int writePos = 0;
     bool isFirstSegment = true;
 
+    // 세그먼트마다 출력은 (sequence - overlap)만큼 늘어나므로
+    // 입력도 같은 길이 * ratio 만큼 전진해야 출력 길이가 inputLength / ratio가 됨
+    // (정수 절삭 오차가 누적되지 않도록 double로 누적)
+    const double inputHop = (double)(sequenceSamples - overlapSamples) * ratio;
+    double nominalInputPos = 0.0;
+
     std::cout << "[SimpleTimeStretcher] 처리 시작 - 비율: " << ratio
               << ", 입력 길이: " << inputLength << " 샘플" << std::endl;
 
     // refSegment를 루프 밖에서 한 번만 생성 (재사용)
     std::vector<float> refSegment(overlapSamples);
+    size_t contourCursor = 0;
 
     // 조각별로 처리
     // sampleRate 수 => segement 수 만큼 반복 횟수 줄이기
     while (inputPos < inputLength - sequenceSamples) {
         if (isFirstSegment) {
             // 첫 조각: 단순 복사
-            appendSegment(outputData, writePos, inputData, inputPos, sequenceSamples);
+            if (segmentPositions) segmentPositions->push_back(inputPos);
+            appendSegment(outputData, writePos, inputData, inputLength, inputPos, sequenceSamples);
             isFirstSegment = false;
         } else {
             // 검색 범위 계산
-            int searchStart = std::max(0, inputPos - seekWindowSamples);
-            int searchEnd = std::min(inputLength - overlapSamples, inputPos + seekWindowSamples);
+            int seekSamples = localSeekSamples(inputPos, sampleRate, seekWindowSamples, contourCursor);
+            int searchStart = std::max(0, inputPos - seekSamples);
+            int searchEnd = std::min(inputLength - overlapSamples, inputPos + seekSamples);
 
             // 참조 세그먼트 업데이트 (출력의 마지막 오버랩 부분)
             int refStart = writePos - overlapSamples;
@@ -83,30 +329,33 @@ AudioBuffer SimpleTimeStretcher::process(const AudioBuffer& input, float ratio,
 
             // 최적 위치 찾기
             if (perfChecker) perfChecker->startFunction("findBestOverlapPosition");
-            int bestPos = findBestOverlapPosition(inputData, searchStart,
-                                                  searchEnd - searchStart,
-                                                  refSegment, overlapSamples);
+            int bestPos = searchOverlapPosition(inputData, inputLength, searchStart,
+                                                searchEnd - searchStart,
+                                                refSegment.data(), overlapSamples);
             if (perfChecker) perfChecker->endFunction();
+            if (segmentPositions) segmentPositions->push_back(bestPos);
 
             // 오버랩 영역 크로스페이드
             if (perfChecker) perfChecker->startFunction("overlapAndAdd");
             overlapAndAdd(outputData, writePos - overlapSamples,
-                         inputData, bestPos, overlapSamples, 1.0f);
+                         inputData, inputLength, bestPos, overlapSamples);
             if (perfChecker) perfChecker->endFunction();
 
             // 나머지 부분 추가
             int remainingLength = sequenceSamples - overlapSamples;
-            appendSegment(outputData, writePos, inputData, bestPos + overlapSamples, remainingLength);
+            appendSegment(outputData, writePos, inputData, inputLength, bestPos + overlapSamples, remainingLength);
         }
 
         // 다음 입력 위치로 이동
-        inputPos += static_cast<int>(sequenceSamples * ratio);
+        nominalInputPos += inputHop;
+        inputPos = static_cast<int>(nominalInputPos);
     }
 
     // 남은 샘플 추가
+    if (segmentPositions) segmentPositions->push_back(inputPos);
     int remainingSamples = inputLength - inputPos;
     if (remainingSamples > 0) {
-        appendSegment(outputData, writePos, inputData, inputPos, remainingSamples);
+        appendSegment(outputData, writePos, inputData, inputLength, inputPos, remainingSamples);
     }
 
     // 실제 사용한 크기로 최종 조정
@@ -114,10 +363,118 @@ AudioBuffer SimpleTimeStretcher::process(const AudioBuffer& input, float ratio,
 
     std::cout << "[SimpleTimeStretcher] 처리 완료 - 출력 길이: "
               << writePos << " 샘플" << std::endl;
+    syncScratchMemory();
+}
 
-    AudioBuffer output(sampleRate, 1);
-    output.setData(std::move(outputData)); // move semantics
-    return output;
+void SimpleTimeStretcher::processPlanar(const float* const* inputs, int channels, int inputLength,
+                                        int sampleRate, float ratio,
+                                        std::vector<std::vector<float>>& outputs,
+                                        PerformanceChecker* perfChecker) {
+    outputs.resize(std::max(0, channels));
+    if (channels <= 0) {
+        return;
+    }
+
+    // 잘못된 비율이거나 1.0에 가까우면 원본 복사
+    if (ratio <= 0 || std::abs(ratio - 1.0f) < 0.01f) {
+        if (ratio <= 0) {
+            std::cerr << "[SimpleTimeStretcher] 잘못된 비율: " << ratio << std::endl;
+        }
+        for (int c = 0; c < channels; ++c) {
+            outputs[c].assign(inputs[c], inputs[c] + inputLength);
+        }
+        return;
+    }
+
+    if (channels == 1) {
+        stretch(inputs[0], inputLength, sampleRate, ratio, outputs[0], nullptr, perfChecker);
+        return;
+    }
+
+    // Step 1: mid 신호에서 세그먼트 위치 탐색 (탐색 비용은 채널 수와 무관하게 1회)
+    if (perfChecker) perfChecker->startFunction("mixToMid");
+    ChannelLayout::mixToMid(inputs, channels, inputLength, midSignal_);
+    if (perfChecker) perfChecker->endFunction();
+
+    stretch(midSignal_.data(), inputLength, sampleRate, ratio, midOutput_, &segmentPositions_, perfChecker);
+
+    // Step 2: 같은 위치로 채널별 출력 생성 (복사 + 크로스페이드만)
+    // 크로스페이드 테이블은 stretch에서 이미 준비됨 (채널 스레드는 읽기만)
+    // 채널마다 다른 출력 버퍼를 쓰므로 채널 단위로 병렬 처리
+    // (채널별 구간은 스레드별 기록이 되는 트레이스 모드에서만 측정, 계층 API는 한 스레드 전용)
+    if (perfChecker) perfChecker->startFunction("renderSegments");
+    PerformanceChecker* channelChecker = perfChecker && perfChecker->isTraceMode() ? perfChecker : nullptr;
+    TaskPool::getInstance().parallelFor(channels, 1, [&](int begin, int end) {
+        for (int c = begin; c < end; ++c) {
+            if (channelChecker) channelChecker->startFunction("renderChannel");
+            renderSegments(inputs[c], inputLength, sampleRate, segmentPositions_, outputs[c]);
+            if (channelChecker) channelChecker->endFunction();
+        }
+    });
+    if (perfChecker) perfChecker->endFunction();
+    syncScratchMemory();
+}
+
+void SimpleTimeStretcher::processInterleaved(const float* input, int inputFrames, int channels,
+                                             int sampleRate, float ratio, std::vector<float>& output,
+                                             PerformanceChecker* perfChecker) {
+    if (channels <= 0) {
+        output.clear();
+        return;
+    }
+    if (channels == 1) {
+        process(input, inputFrames, sampleRate, ratio, output, perfChecker);
+        return;
+    }
+
+    ChannelLayout::deinterleave(input, inputFrames, channels, planarInput_);
+
+    std::vector<const float*> planes(channels);
+    for (int c = 0; c < channels; ++c) {
+        planes[c] = planarInput_[c].data();
+    }
+    processPlanar(planes.data(), channels, inputFrames, sampleRate, ratio, planarOutput_, perfChecker);
+
+    ChannelLayout::interleave(planarOutput_, (int)planarOutput_[0].size(), output);
+    syncScratchMemory();
+}
+
+void SimpleTimeStretcher::syncScratchMemory() {
+    scratchMemory_.update(capacityBytes(fadeInTable_) + capacityBytes(fadeOutTable_) +
+                          capacityBytes(decimatedRef_) + capacityBytes(decimatedInput_) +
+                          capacityBytes(coarseScores_) + capacityBytes(midSignal_) +
+                          capacityBytes(midOutput_) + capacityBytes(segmentPositions_) +
+                          capacityBytes(planarInput_) + capacityBytes(planarOutput_));
+}
+
+void SimpleTimeStretcher::renderSegments(const float* input, int inputLength, int sampleRate,
+                                         const std::vector<int>& segmentPositions,
+                                         std::vector<float>& output) {
+    const int sequenceSamples = (sequenceMs * sampleRate) / 1000;
+    const int overlapSamples = (overlapMs * sampleRate) / 1000;
+    const int segmentCount = (int)segmentPositions.size() - 1;
+
+    output.resize(midOutput_.size());
+    int writePos = 0;
+
+    for (int k = 0; k < segmentCount; ++k) {
+        int pos = segmentPositions[k];
+        if (k == 0) {
+            appendSegment(output, writePos, input, inputLength, pos, sequenceSamples);
+        } else {
+            overlapAndAdd(output, writePos - overlapSamples, input, inputLength, pos, overlapSamples);
+            appendSegment(output, writePos, input, inputLength, pos + overlapSamples,
+                          sequenceSamples - overlapSamples);
+        }
+    }
+
+    int tailPos = segmentPositions.empty() ? 0 : segmentPositions.back();
+    int remainingSamples = inputLength - tailPos;
+    if (remainingSamples > 0) {
+        appendSegment(output, writePos, input, inputLength, tailPos, remainingSamples);
+    }
+
+    output.resize(writePos);
 }
 
 float SimpleTimeStretcher::calculateCorrelation(const float* buf1, const float* buf2, int size) {
@@ -165,35 +522,45 @@ float SimpleTimeStretcher::calculateCorrelation(const float* buf1, const float*
 }
 
 int SimpleTimeStretcher::findBestOverlapPosition(
-    const std::vector<float>& input,
+    const float* input,
+    int inputLength,
     int searchStart,
     int searchLength,
-    const std::vector<float>& refSegment,
+    const float* refSegment,
     int overlapLength)
 {
-    float bestCorr = -1.0f;
-    int bestPos = searchStart;
-
-    // Early exit threshold: 충분히 좋은 상관관계면 조기 종료
-    const float GOOD_ENOUGH_THRESHOLD = 0.95f;
-
-    // Phase 1: Coarse search (2샘플씩 건너뛰며 빠르게 탐색)
-    int coarseStep = 2;
+    // 후보 위치: searchStart + [0, candidateCount)
+    const int candidateCount = searchLength - overlapLength;
+    const int maxCandidates = searchPolicy_.maxCandidates;
+    int evaluated = 0;
+
+    // Early exit threshold: 충분히 좋은 상관관계면 조기 종료 (1 이상이면 끝까지 탐색)
+    const float goodEnoughThreshold = searchPolicy_.goodEnoughThreshold;
+    const bool earlyExit = goodEnoughThreshold < 1.0f;
+
+    // Phase 1: Coarse search (coarseStep 샘플씩 건너뛰며 빠르게 탐색)
+    // 후보 수 상한이 있으면 절반 안에서 범위 전체를 덮도록 간격을 넓힘
+    int coarseStep = searchPolicy_.coarseStep;
+    if (maxCandidates > 0) {
+        int coarseBudget = std::max(1, maxCandidates / 2);
+        coarseStep = std::max(coarseStep, (candidateCount + coarseBudget - 1) / coarseBudget);
+    }
     int coarseBestPos = searchStart;
     float coarseBestCorr = -1.0f;
 
-    for (int offset = 0; offset < searchLength - overlapLength; offset += coarseStep) {
+    for (int offset = 0; offset < candidateCount; offset += coarseStep) {
         int currentPos = searchStart + offset;
 
-        if (currentPos + overlapLength > (int)input.size()) {
+        if (currentPos + overlapLength > inputLength) {
             break;
         }
 
         float corr = calculateCorrelation(
-            refSegment.data(),
+            refSegment,
             &input[currentPos],
             overlapLength
         );
+        evaluated++;
 
         if (corr > coarseBestCorr) {
             coarseBestCorr = corr;
@@ -201,32 +568,211 @@ int SimpleTimeStretcher::findBestOverlapPosition(
         }
 
         // Early exit: 충분히 좋으면 바로 종료
-        if (corr > GOOD_ENOUGH_THRESHOLD) {
+        if (earlyExit && corr > goodEnoughThreshold) {
             return currentPos;
         }
     }
 
-    // Phase 2: Fine search (coarse 최적 위치 주변을 정밀 탐색)
-    int fineSearchStart = std::max(searchStart, coarseBestPos - coarseStep);
-    int fineSearchEnd = std::min(searchStart + searchLength - overlapLength,
-                                  coarseBestPos + coarseStep + 1);
+    // Phase 2: Fine search (coarse 최적 위치 주변 ±(coarseStep - 1)을 가까운 위치부터 정밀 탐색)
+    // 그 밖의 위치는 coarse 단계에서 이미 확인함
+    const int fineSearchEnd = std::min(searchStart + candidateCount, inputLength - overlapLength + 1);
+    int bestPos = coarseBestPos;
+    float bestCorr = coarseBestCorr;
+
+    for (int distance = 1; distance < coarseStep; distance++) {
+        const int positions[2] = { coarseBestPos - distance, coarseBestPos + distance };
+        for (int currentPos : positions) {
+            if (currentPos < searchStart || currentPos >= fineSearchEnd) {
+                continue;
+            }
+            if (maxCandidates > 0 && evaluated >= maxCandidates) {
+                return bestPos;
+            }
 
-    bestPos = coarseBestPos;
-    bestCorr = coarseBestCorr;
+            float corr = calculateCorrelation(
+                refSegment,
+                &input[currentPos],
+                overlapLength
+            );
+            evaluated++;
 
-    for (int currentPos = fineSearchStart; currentPos < fineSearchEnd; currentPos++) {
-        if (currentPos + overlapLength > (int)input.size()) {
-            break;
+            if (corr > bestCorr) {
+                bestCorr = corr;
+                bestPos = currentPos;
+            }
         }
+    }
 
-        float corr = calculateCorrelation(
-            refSegment.data(),
-            &input[currentPos],
-            overlapLength
-        );
+    return bestPos;
+}
 
-        if (corr > bestCorr) {
-            bestCorr = corr;
+int SimpleTimeStretcher::searchOverlapPosition(
+    const float* input,
+    int inputLength,
+    int searchStart,
+    int searchLength,
+    const float* refSegment,
+    int overlapLength)
+{
+    if (searchBudgetExceeded()) {
+        int lastCandidate = searchStart + std::max(0, searchLength - overlapLength - 1);
+        return std::min(searchStart + searchLength / 2, lastCandidate);
+    }
+    if (searchMode_ == OverlapSearchMode::HIERARCHICAL) {
+        return findBestOverlapPositionHierarchical(input, inputLength, searchStart, searchLength,
+                                                   refSegment, overlapLength);
+    }
+    return findBestOverlapPosition(input, inputLength, searchStart, searchLength, refSegment, overlapLength);
+}
+
+int SimpleTimeStretcher::findBestOverlapPositionHierarchical(
+    const float* input,
+    int inputLength,
+    int searchStart,
+    int searchLength,
+    const float* refSegment,
+    int overlapLength)
+{
+    const int D = HIERARCHICAL_DECIMATION;
+    // 후보 위치: [searchStart, searchEnd) (findBestOverlapPosition과 같은 범위)
+    const int searchEnd = std::min(searchStart + searchLength - overlapLength, inputLength - overlapLength + 1);
+    const int decimatedOverlap = overlapLength / D;
+    if (searchEnd <= searchStart || decimatedOverlap < 4) {
+        return findBestOverlapPosition(input, inputLength, searchStart, searchLength, refSegment, overlapLength);
+    }
+
+    // 1. 4샘플 평균으로 decimation (박스 필터 = 간단한 저역 통과)
+    decimatedRef_.resize(decimatedOverlap);
+    for (int j = 0; j < decimatedOverlap; ++j) {
+        const float* src = refSegment + j * D;
+        decimatedRef_[j] = 0.25f * (src[0] + src[1] + src[2] + src[3]);
+    }
+
+    const int coarseCount = (searchEnd - searchStart + D - 1) / D;
+    const int decimatedLength = std::min(coarseCount + decimatedOverlap,
+                                         (inputLength - searchStart) / D);
+    decimatedInput_.resize(decimatedLength);
+    for (int j = 0; j < decimatedLength; ++j) {
+        const float* src = input + searchStart + j * D;
+        decimatedInput_[j] = 0.25f * (src[0] + src[1] + src[2] + src[3]);
+    }
+
+    // 2. decimation된 신호에서 4샘플 간격 상관관계
+    coarseScores_.assign(coarseCount, -2.0f);
+    for (int k = 0; k < coarseCount && k + decimatedOverlap <= decimatedLength; ++k) {
+        coarseScores_[k] = calculateCorrelation(decimatedRef_.data(), &decimatedInput_[k], decimatedOverlap);
+    }
+
+    // 3. 극대점 중 상위 후보 (후보 수가 작으므로 삽입 정렬)
+    int candidates[HIERARCHICAL_CANDIDATES];
+    int candidateCount = 0;
+    for (int k = 0; k < coarseCount; ++k) {
+        float score = coarseScores_[k];
+        bool peak = (k == 0 || score >= coarseScores_[k - 1]) &&
+                    (k == coarseCount - 1 || score >= coarseScores_[k + 1]);
+        if (!peak || score <= -2.0f) {
+            continue;
+        }
+        int slot = candidateCount < HIERARCHICAL_CANDIDATES ? candidateCount++ : HIERARCHICAL_CANDIDATES;
+        while (slot > 0 && coarseScores_[candidates[slot - 1]] < score) {
+            if (slot < HIERARCHICAL_CANDIDATES) candidates[slot] = candidates[slot - 1];
+            slot--;
+        }
+        if (slot < HIERARCHICAL_CANDIDATES) candidates[slot] = k;
+    }
+    if (candidateCount == 0) {
+        return findBestOverlapPosition(input, inputLength, searchStart, searchLength, refSegment, overlapLength);
+    }
+
+    // 4. 후보 주변 ±(D - 1) 샘플을 전체 해상도로 확인 (좋은 후보 / 중심에 가까운 위치부터, 상한에 도달하면 중단)
+    const int maxCandidates = searchPolicy_.maxCandidates;
+    int evaluated = 0;
+    int bestPos = searchStart + candidates[0] * D;
+    float bestCorr = -2.0f;
+    for (int c = 0; c < candidateCount; ++c) {
+        int center = searchStart + candidates[c] * D;
+        for (int k = 0; k < 2 * D - 1; ++k) {
+            // 0, -1, +1, -2, +2, ...
+            int currentPos = center + ((k & 1) ? -(k + 1) / 2 : k / 2);
+            if (currentPos < searchStart || currentPos >= searchEnd) {
+                continue;
+            }
+            if (maxCandidates > 0 && evaluated >= maxCandidates) {
+                return bestPos;
+            }
+            float corr = calculateCorrelation(refSegment, &input[currentPos], overlapLength);
+            evaluated++;
+            if (corr > bestCorr) {
+                bestCorr = corr;
+                bestPos = currentPos;
+            }
+        }
+    }
+
+    return bestPos;
+}
+
+float SimpleTimeStretcher::calculateAmdf(const float* buf1, const float* buf2, int size, int stride) {
+    float sum = 0.0f;
+    int count = 0;
+
+    // Loop Unrolling: 4-way (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
+    int i = 0;
+    const int unrolled = size - 4 * stride + 1;
+    for (; i < unrolled; i += 4 * stride) {
+        sum += std::abs(buf1[i] - buf2[i]);
+        sum += std::abs(buf1[i + stride] - buf2[i + stride]);
+        sum += std::abs(buf1[i + 2 * stride] - buf2[i + 2 * stride]);
+        sum += std::abs(buf1[i + 3 * stride] - buf2[i + 3 * stride]);
+        count += 4;
+    }
+
+    // 나머지 처리
+    for (; i < size; i += stride) {
+        sum += std::abs(buf1[i] - buf2[i]);
+        count++;
+    }
+
+    return count > 0 ? sum / count : 0.0f;
+}
+
+int SimpleTimeStretcher::findBestOverlapPositionAmdf(
+    const float* input,
+    int inputLength,
+    int searchStart,
+    int searchLength,
+    const float* refSegment,
+    int overlapLength)
+{
+    const int DECIMATION = 2;
+    const int searchEnd = std::min(searchStart + searchLength - overlapLength, inputLength - overlapLength + 1);
+    if (searchEnd <= searchStart) {
+        return searchStart;
+    }
+
+    // Phase 1: decimation된 위치 / 샘플로 대략 탐색
+    int coarseBestPos = searchStart;
+    float coarseBestAmdf = -1.0f;
+    for (int currentPos = searchStart; currentPos < searchEnd; currentPos += DECIMATION) {
+        float amdf = calculateAmdf(refSegment, &input[currentPos], overlapLength, DECIMATION);
+        if (coarseBestAmdf < 0.0f || amdf < coarseBestAmdf) {
+            coarseBestAmdf = amdf;
+            coarseBestPos = currentPos;
+        }
+    }
+
+    // Phase 2: 대략 위치 주변 ±1 샘플을 전체 해상도로
+    int bestPos = coarseBestPos;
+    float bestAmdf = calculateAmdf(refSegment, &input[coarseBestPos], overlapLength, 1);
+    const int fineStart = std::max(searchStart, coarseBestPos - DECIMATION + 1);
+    const int fineEnd = std::min(searchEnd, coarseBestPos + DECIMATION);
+    for (int currentPos = fineStart; currentPos < fineEnd; currentPos++) {
+        if (currentPos == coarseBestPos) {
+            continue;
+        }
+        float amdf = calculateAmdf(refSegment, &input[currentPos], overlapLength, 1);
+        if (amdf < bestAmdf) {
+            bestAmdf = amdf;
             bestPos = currentPos;
         }
     }
@@ -234,28 +780,60 @@ int SimpleTimeStretcher::findBestOverlapPosition(
     return bestPos;
 }
 
+void SimpleTimeStretcher::prepareCrossfade(int length) {
+    if ((int)fadeInTable_.size() == length && tableShape_ == crossfadeShape_) {
+        return;
+    }
+
+    fadeInTable_.resize(std::max(0, length));
+    fadeOutTable_.resize(std::max(0, length));
+    tableShape_ = crossfadeShape_;
+    for (int i = 0; i < length; i++) {
+        float ratio = (float)i / length;
+        switch (crossfadeShape_) {
+            case CrossfadeShape::EQUAL_POWER:
+                // sin^2 + cos^2 = 1: 상관관계가 없는 두 신호를 섞어도 파워 유지
+                fadeInTable_[i] = (float)std::sin(0.5 * M_PI * ratio);
+                fadeOutTable_[i] = (float)std::cos(0.5 * M_PI * ratio);
+                break;
+            case CrossfadeShape::HANN: {
+                float s = (float)std::sin(0.5 * M_PI * ratio);
+                fadeInTable_[i] = s * s;
+                fadeOutTable_[i] = 1.0f - fadeInTable_[i];
+                break;
+            }
+            case CrossfadeShape::LINEAR:
+            default:
+                fadeInTable_[i] = ratio;
+                fadeOutTable_[i] = 1.0f - ratio;
+                break;
+        }
+    }
+}
+
 void SimpleTimeStretcher::overlapAndAdd(
     std::vector<float>& output,
     int outputPos,
-    const std::vector<float>& input,
+    const float* input,
+    int inputLength,
     int inputPos,
-    int length,
-    float fadeIn)
+    int length)
 {
-    // Crossfade: 부드러운 전환
-    for (int i = 0; i < length; i++) {
-        if (outputPos + i >= (int)output.size()) {
-            break;
-        }
-        if (inputPos + i >= (int)input.size()) {
-            break;
-        }
+    prepareCrossfade(length);
 
-        float ratio = (float)i / length;
-        float oldSample = output[outputPos + i];
-        float newSample = input[inputPos + i];
+    // 출력 / 입력 끝에서 잘리는 길이는 루프 밖에서 한 번만 계산
+    const int count = std::min(length, std::min((int)output.size() - outputPos, inputLength - inputPos));
+    if (count <= 0) {
+        return;
+    }
 
-        output[outputPos + i] = oldSample * (1.0f - ratio) + newSample * ratio;
+    // Crossfade: 부드러운 전환 (분기 없는 루프 -> 컴파일러 자동 벡터화)
+    float* mixed = output.data() + outputPos;
+    const float* incoming = input + inputPos;
+    const float* fadeInGain = fadeInTable_.data();
+    const float* fadeOutGain = fadeOutTable_.data();
+    for (int i = 0; i < count; i++) {
+        mixed[i] = mixed[i] * fadeOutGain[i] + incoming[i] * fadeInGain[i];
     }
 }
 
@@ -269,13 +847,14 @@ void SimpleTimeStretcher::ensureCapacity(std::vector<float>& buffer, int writePo
 void SimpleTimeStretcher::appendSegment(
     std::vector<float>& output,
     int& writePos,
-    const std::vector<float>& input,
+    const float* input,
+    int inputLength,
     int inputPos,
     int length)
 {
     ensureCapacity(output, writePos, length);
 
-    int copyLength = std::min(length, (int)input.size() - inputPos);
+    int copyLength = std::min(length, inputLength - inputPos);
     for (int i = 0; i < copyLength; i++) {
         output[writePos++] = input[inputPos + i];
     }
@@ -8,14 +8,104 @@
 #ifndef SIMPLE_TIME_STRETCHER_H
 #define SIMPLE_TIME_STRETCHER_H
 
+#include "../analysis/PitchAnalyzer.h"
 #include "../audio/AudioBuffer.h"
 #include "../performance/PerformanceChecker.h"
+#include <chrono>
 #include <vector>
 
+/**
+ * 최적 겹침 위치 탐색 방식 (속도 / 품질 단계)
+ */
+enum class OverlapSearchMode {
+    STANDARD,       // 전체 해상도 상관관계를 coarseStep(기본 2샘플) 간격으로 계산 후 주변 정밀 탐색 (기본)
+    HIERARCHICAL    // 4배 decimation(저역 통과) 상관관계로 후보를 고른 뒤 상위 후보 주변만 전체 해상도로 확인
+};
+
+/**
+ * sequence / seek / overlap 길이 결정 방식
+ */
+enum class StretchParameterMode {
+    FIXED,   // 40 / 15 / 8 ms 고정 (기본)
+    AUTO     // 속도 비율로 sequence / seek 결정 (SoundTouch TDStretch::calcSeqParameters와 같은 범위)
+             // + 피치 곡선이 있으면 세그먼트마다 seek = 그 위치의 기본 주기, overlap >= 중앙 주기
+};
+
+/**
+ * 세그먼트 이음새 크로스페이드 모양
+ */
+enum class CrossfadeShape {
+    LINEAR,        // fadeIn = t, fadeOut = 1 - t (기본, 상관관계가 높은 이음새에서 진폭 유지)
+    EQUAL_POWER,   // fadeIn = sin(pi t / 2), fadeOut = cos(pi t / 2) (상관관계가 낮은 이음새에서 파워 유지, 음량 꺼짐 없음)
+                   // 상관관계가 높은 이음새(순음)는 중앙에서 최대 +3 dB 부풂
+    HANN           // fadeIn = sin^2(pi t / 2), fadeOut = 1 - fadeIn (양 끝 기울기 0, 부드러운 시작 / 끝)
+};
+
+/**
+ * 겹침 위치 탐색 정책 (품질 <-> CPU 조절, 기본값 = 기존 동작)
+ * 저사양 기기: coarseStep / maxCandidates를 키우거나 줄여 세그먼트당 비용을 제한
+ * 실시간 스트리밍: blockBudgetMs로 블록 하나의 처리 시간 상한을 강제
+ */
+struct OverlapSearchPolicy {
+    float goodEnoughThreshold;   // STANDARD: 상관관계가 이보다 크면 바로 사용 (1 이상이면 조기 종료 없음)
+    int coarseStep;              // STANDARD: 대략 탐색 간격 (샘플, 1 = 전체 탐색)
+    int maxCandidates;           // 세그먼트당 전체 해상도 유사도 계산 상한 (0 = 제한 없음)
+                                 // STANDARD는 절반을 대략 탐색(간격을 넓혀 범위 전체를 덮음), 나머지를 주변 정밀 탐색에 사용
+    float blockBudgetMs;         // 블록(process 호출 한 번)의 시간 예산 (0 = 제한 없음)
+                                 // 넘으면 그 블록의 남은 세그먼트는 탐색 없이 명목 위치 사용
+
+    OverlapSearchPolicy()
+        : goodEnoughThreshold(0.95f), coarseStep(2), maxCandidates(0), blockBudgetMs(0.0f) {}
+};
+
 class SimpleTimeStretcher {
 public:
     SimpleTimeStretcher();
 
+    /**
+     * 겹침 위치 탐색 방식 (기본: STANDARD)
+     */
+    void setSearchMode(OverlapSearchMode mode);
+    OverlapSearchMode getSearchMode() const;
+
+    /**
+     * 탐색 정책 (잘못된 값은 가까운 유효 값으로 고침)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * 마지막 블록에서 시간 예산 초과로 탐색을 건너뛴 세그먼트 수
+     */
+    int getBudgetFallbackCount() const;
+
+    /**
+     * 크로스페이드 모양 (기본: LINEAR)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 파라미터 결정 방식 (기본: FIXED)
+     * AUTO: 느리게(ratio 0.5) 90ms / 20ms ~ 빠르게(ratio 2.0) 40ms / 15ms, overlap 8ms
+     */
+    void setParameterMode(StretchParameterMode mode);
+    StretchParameterMode getParameterMode() const;
+
+    /**
+     * AUTO 모드에서 사용할 입력의 피치 곡선 (PitchAnalyzer::analyze 결과, 시간순)
+     * 유성음 구간은 탐색 범위를 기본 주기 하나로 줄임 (높은 목소리일수록 탐색 비용 감소)
+     * 빈 목록이면 속도 비율만 사용
+     */
+    void setPitchContour(const std::vector<PitchPoint>& contour);
+
+    /**
+     * 마지막 처리에 사용한 파라미터 (밀리초)
+     */
+    int getSequenceMs() const;
+    int getSeekWindowMs() const;
+    int getOverlapMs() const;
+
     /**
      * 오디오의 재생 속도를 변경 (피치는 유지)
      * @param input 입력 오디오
@@ -25,11 +115,74 @@ public:
      */
     AudioBuffer process(const AudioBuffer& input, float ratio, PerformanceChecker* perfChecker = nullptr);
 
+    /**
+     * 출력 버퍼를 직접 받는 버전 (버퍼 재사용용, EffectChain 등)
+     * output의 용량(capacity)은 유지되므로 반복 호출 시 재할당이 없음
+     * @param input 입력 샘플 포인터
+     * @param inputLength 입력 샘플 수
+     * @param sampleRate 샘플레이트
+     * @param ratio 속도 비율
+     * @param output 출력 버퍼 (처리 결과 길이로 resize됨)
+     * @param perfChecker 성능 측정 (optional)
+     */
+    void process(const float* input, int inputLength, int sampleRate, float ratio,
+                 std::vector<float>& output, PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 다채널 처리 (planar: 채널마다 별도 배열)
+     * 최적 겹침 위치는 mid 신호(채널 평균)에서 한 번만 탐색하고 모든 채널에 같은 위치를 적용
+     * (채널마다 따로 탐색하면 세그먼트 경계가 채널마다 달라져 채널 간 위상이 어긋남)
+     * @param inputs 채널별 입력 포인터 (channels개)
+     * @param channels 채널 수
+     * @param inputLength 채널당 샘플 수
+     * @param outputs 채널별 출력 버퍼 (channels개, 용량 유지)
+     */
+    void processPlanar(const float* const* inputs, int channels, int inputLength, int sampleRate,
+                       float ratio, std::vector<std::vector<float>>& outputs,
+                       PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 다채널 처리 (interleaved: L R L R ...)
+     * @param inputFrames 채널당 샘플 수
+     * @param output interleaved 출력 (출력 프레임 수 * channels)
+     */
+    void processInterleaved(const float* input, int inputFrames, int channels, int sampleRate,
+                            float ratio, std::vector<float>& output,
+                            PerformanceChecker* perfChecker = nullptr);
+
 private:
+    // 가변 비율 렌더러 / 스트리밍 처리기가 세그먼트 탐색 / 크로스페이드를 그대로 재사용
+    friend class VariablePitchRenderer;
+    friend class StreamingTimeStretcher;
+
     // 파라미터들
     int sequenceMs;      // 한 조각의 길이 (밀리초)
     int seekWindowMs;    // 최적 위치를 찾을 검색 범위 (밀리초)
     int overlapMs;       // 조각들이 겹치는 길이 (밀리초)
+    OverlapSearchMode searchMode_;
+    StretchParameterMode parameterMode_;
+    OverlapSearchPolicy searchPolicy_;
+    CrossfadeShape crossfadeShape_;
+
+    // 블록 시간 예산 (beginSearchBlock에서 시작)
+    std::chrono::steady_clock::time_point blockStart_;
+    int budgetFallbacks_;
+
+    // AUTO 모드 피치 곡선 (신뢰도가 낮은 점은 제외하고 저장)
+    std::vector<PitchPoint> pitchContour_;
+    int contourOverlapMs_;   // 유성음 중앙 주기 (올림, ms), 곡선이 없으면 0
+
+    /**
+     * 처리 시작 시 파라미터 결정 (FIXED: 기본값, AUTO: 비율 / 피치 곡선으로 계산)
+     */
+    void updateParameters(float ratio);
+
+    /**
+     * 입력 위치의 탐색 범위 (샘플 수)
+     * AUTO + 피치 곡선: 가까운 유성음 점의 기본 주기 (최소 2ms, 최대 maxSeekSamples)
+     * @param cursor 피치 곡선 탐색 위치 (입력 위치가 증가하므로 호출 간 유지)
+     */
+    int localSeekSamples(int inputPos, int sampleRate, int maxSeekSamples, size_t& cursor) const;
 
     /**
      * 두 오디오 조각의 유사도 계산 (상관관계)
@@ -39,21 +192,83 @@ private:
     /**
      * 검색 범위 내에서 가장 유사한 위치 찾기
      */
-    int findBestOverlapPosition(const std::vector<float>& input,
+    int findBestOverlapPosition(const float* input,
+                                int inputLength,
                                 int searchStart,
                                 int searchLength,
-                                const std::vector<float>& refSegment,
+                                const float* refSegment,
                                 int overlapLength);
 
+    /**
+     * 계층적 탐색 (OverlapSearchMode::HIERARCHICAL)
+     * 1. refSegment / 탐색 구간을 4샘플 평균(저역 통과 + 4배 decimation)으로 줄여 4샘플 간격 상관관계 계산
+     * 2. 상관관계 극대점 중 상위 HIERARCHICAL_CANDIDATES개만 골라 주변 ±3 샘플을 전체 해상도로 확인
+     *    (좋은 후보 / 중심부터 확인, maxCandidates에 도달하면 중단)
+     * 인자 의미는 findBestOverlapPosition과 동일
+     */
+    int findBestOverlapPositionHierarchical(const float* input,
+                                            int inputLength,
+                                            int searchStart,
+                                            int searchLength,
+                                            const float* refSegment,
+                                            int overlapLength);
+
+    /**
+     * 블록 시작 (시간 예산 / 예산 초과 횟수 초기화)
+     * stretch, 스트리밍 process / flush 등 블록 단위 처리의 시작에서 호출
+     */
+    void beginSearchBlock();
+
+    /**
+     * 블록 시간 예산을 넘었는지 (넘었으면 예산 초과 횟수 증가, 호출한 쪽은 탐색을 건너뜀)
+     */
+    bool searchBudgetExceeded();
+
+    /**
+     * 설정된 탐색 방식으로 최적 위치 찾기
+     * 시간 예산을 넘으면 탐색 범위 중앙 (범위가 잘리지 않았으면 명목 위치)
+     */
+    int searchOverlapPosition(const float* input,
+                              int inputLength,
+                              int searchStart,
+                              int searchLength,
+                              const float* refSegment,
+                              int overlapLength);
+
+    /**
+     * 두 조각의 평균 절대 차이 (AMDF, 작을수록 비슷함)
+     * 곱셈 / 정규화(sqrt)가 없어 상관관계보다 싸고, stride 간격 샘플만 비교
+     */
+    float calculateAmdf(const float* buf1, const float* buf2, int size, int stride);
+
+    /**
+     * 저지연용 최적 위치 탐색 (AMDF)
+     * 2배 decimation(위치 / 샘플 모두 2칸씩)으로 대략 위치를 찾고 주변 ±1 샘플만 전체 해상도로 확인
+     * 인자 의미는 findBestOverlapPosition과 동일
+     */
+    int findBestOverlapPositionAmdf(const float* input,
+                                    int inputLength,
+                                    int searchStart,
+                                    int searchLength,
+                                    const float* refSegment,
+                                    int overlapLength);
+
+    /**
+     * 크로스페이드 테이블 준비 (overlap 길이 / 모양이 바뀔 때만 다시 계산)
+     * 다채널 처리는 채널별 병렬 렌더링 전에 호출해 테이블을 읽기 전용으로 공유
+     */
+    void prepareCrossfade(int length);
+
     /**
      * 두 조각을 겹쳐서 부드럽게 합치기
+     * 길이 확인은 루프 밖에서 한 번, 루프는 테이블 곱셈만 (분기 없음, 자동 벡터화)
      */
     void overlapAndAdd(std::vector<float>& output,
                       int outputPos,
-                      const std::vector<float>& input,
+                      const float* input,
+                      int inputLength,
                       int inputPos,
-                      int length,
-                      float fadeIn);
+                      int length);
 
     /**
      * 버퍼 용량 확보 (헬퍼 함수)
@@ -64,7 +279,43 @@ private:
      * 세그먼트 복사 (헬퍼 함수)
      */
     void appendSegment(std::vector<float>& output, int& writePos,
-                      const std::vector<float>& input, int inputPos, int length);
+                      const float* input, int inputLength, int inputPos, int length);
+
+    /**
+     * WSOLA 본체: 탐색 신호로 세그먼트 위치를 결정하며 출력 생성
+     * @param segmentPositions nullptr가 아니면 세그먼트별 입력 위치를 기록
+     *        ([0..n-1] 세그먼트 시작 위치, 마지막 = 남은 샘플의 시작 위치)
+     */
+    void stretch(const float* input, int inputLength, int sampleRate, float ratio,
+                 std::vector<float>& output, std::vector<int>* segmentPositions,
+                 PerformanceChecker* perfChecker);
+
+    /**
+     * 기록된 세그먼트 위치로 다른 채널 출력 생성 (탐색 없이 복사 + 크로스페이드만)
+     */
+    void renderSegments(const float* input, int inputLength, int sampleRate,
+                        const std::vector<int>& segmentPositions, std::vector<float>& output);
+
+    // 크로스페이드 테이블 (overlap 길이 / 모양별로 한 번 계산)
+    std::vector<float> fadeInTable_;
+    std::vector<float> fadeOutTable_;
+    CrossfadeShape tableShape_;
+
+    // 계층적 탐색용 (호출 간 재사용)
+    std::vector<float> decimatedRef_;
+    std::vector<float> decimatedInput_;
+    std::vector<float> coarseScores_;
+
+    // 다채널 처리용 (호출 간 재사용)
+    std::vector<float> midSignal_;           // 탐색용 mid 신호 (채널 평균)
+    std::vector<float> midOutput_;           // mid 신호의 WSOLA 출력 (참조 세그먼트)
+    std::vector<int> segmentPositions_;      // 모든 채널에 적용할 세그먼트 위치
+    std::vector<std::vector<float>> planarInput_;   // interleaved 입력의 planar 변환
+    std::vector<std::vector<float>> planarOutput_;  // planar 출력 (interleave 전)
+
+    // 위 재사용 버퍼들의 용량 (MemoryTracker)
+    MemoryAccount scratchMemory_;
+    void syncScratchMemory();
 };
 
 #endif // SIMPLE_TIME_STRETCHER_H
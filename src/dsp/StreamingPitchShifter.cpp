@@ -0,0 +1,173 @@
+/**
+ * StreamingPitchShifter.cpp
+ *
+ * 스트리밍 피치 / 속도 변경
+ *
+ * 동작:
+ * 1. StreamingTimeStretcher가 tempo / pitchRatio 비율로 확정된 출력을 내보냄
+ * 2. 출력 샘플 n의 리샘플 위치 = n * pitchRatio (SimplePitchShifter의 리샘플링과 같은 위치)
+ * 3. 위치 주변 입력이 모두 도착한 출력만 생성 (오른쪽 halfLength 샘플이 필요)
+ * 4. 다음 출력에 필요한 왼쪽 문맥만 남기고 지난 입력은 폐기 (SampleRateConverter와 같은 방식)
+ */
+
+#include "StreamingPitchShifter.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+StreamingPitchShifter::StreamingPitchShifter()
+    : channels_(1), hasPitch_(false), pitchRatio_(1.0),
+      historyStart_(0), totalStretched_(0), producedOutput_(0) {
+}
+
+void StreamingPitchShifter::setResamplerQuality(ResamplerQuality quality) {
+    resampler_.setQuality(quality);
+}
+
+ResamplerQuality StreamingPitchShifter::getResamplerQuality() const {
+    return resampler_.getQuality();
+}
+
+void StreamingPitchShifter::setProfile(StretchProfile profile) {
+    stretcher_.setProfile(profile);
+}
+
+StretchProfile StreamingPitchShifter::getProfile() const {
+    return stretcher_.getProfile();
+}
+
+void StreamingPitchShifter::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    stretcher_.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& StreamingPitchShifter::getSearchPolicy() const {
+    return stretcher_.getSearchPolicy();
+}
+
+void StreamingPitchShifter::setCrossfadeShape(CrossfadeShape shape) {
+    stretcher_.setCrossfadeShape(shape);
+}
+
+CrossfadeShape StreamingPitchShifter::getCrossfadeShape() const {
+    return stretcher_.getCrossfadeShape();
+}
+
+void StreamingPitchShifter::setup(int sampleRate, int channels, float semitones, float tempo) {
+    if (tempo <= 0) {
+        std::cerr << "[StreamingPitchShifter] 잘못된 속도 비율: " << tempo << std::endl;
+        tempo = 1.0f;
+    }
+
+    channels_ = std::max(1, channels);
+    hasPitch_ = std::abs(semitones) >= 0.01f;
+
+    // SimplePitchShifter::processWithTempo와 같은 비율 계산 (float)
+    float pitchRatio = hasPitch_ ? std::pow(2.0f, semitones / 12.0f) : 1.0f;
+    pitchRatio_ = pitchRatio;
+    stretcher_.setup(sampleRate, channels_, tempo / pitchRatio);
+
+    reset();
+}
+
+void StreamingPitchShifter::reset() {
+    stretcher_.reset();
+    stretched_.resize(channels_);
+    history_.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        stretched_[c].clear();
+        history_[c].clear();
+    }
+    historyStart_ = 0;
+    totalStretched_ = 0;
+    producedOutput_ = 0;
+}
+
+int StreamingPitchShifter::getLatency() const {
+    int latency = stretcher_.getLatency();
+    if (hasPitch_) {
+        latency += (int)std::ceil(resampler_.getHalfLength() * pitchRatio_);
+    }
+    return latency;
+}
+
+void StreamingPitchShifter::process(const float* const* inputs, int frames,
+                                    std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+
+    // 피치 변화가 없으면 time stretch 결과를 바로 출력
+    if (!hasPitch_) {
+        stretcher_.process(inputs, frames, outputs);
+        return;
+    }
+
+    for (auto& channel : stretched_) {
+        channel.clear();
+    }
+    stretcher_.process(inputs, frames, stretched_);
+    resampleAvailable(false, outputs);
+}
+
+void StreamingPitchShifter::flush(std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+
+    if (!hasPitch_) {
+        stretcher_.flush(outputs);
+        reset();
+        return;
+    }
+
+    for (auto& channel : stretched_) {
+        channel.clear();
+    }
+    stretcher_.flush(stretched_);
+    resampleAvailable(true, outputs);
+    reset();
+}
+
+void StreamingPitchShifter::resampleAvailable(bool atEnd, std::vector<std::vector<float>>& outputs) {
+    const int added = (int)stretched_[0].size();
+    for (int c = 0; c < channels_; ++c) {
+        history_[c].insert(history_[c].end(), stretched_[c].begin(), stretched_[c].end());
+    }
+    totalStretched_ += added;
+
+    const int historySize = (int)history_[0].size();
+    if (historySize == 0) {
+        return;
+    }
+
+    const int half = resampler_.getHalfLength();
+    const double step = pitchRatio_;
+
+    // 전체 출력 길이 = 입력 길이 / 비율 (Resampler::process와 동일)
+    long long targetTotal = (long long)(totalStretched_ / step);
+    if (!atEnd) {
+        // 출력 위치 p는 입력 floor(p) + half 까지 필요: p < totalStretched_ - half
+        long long limit = totalStretched_ - half;
+        long long available = (limit > 0) ? (long long)std::ceil(limit / step) : 0;
+        targetTotal = std::min(targetTotal, available);
+    }
+
+    long long count = targetTotal - producedOutput_;
+    if (count > 0) {
+        double startPosition = producedOutput_ * step - historyStart_;
+        for (int c = 0; c < channels_; ++c) {
+            size_t offset = outputs[c].size();
+            outputs[c].resize(offset + (size_t)count);
+            resampler_.interpolateBlock(history_[c].data(), historySize, startPosition, step,
+                                        outputs[c].data() + offset, (int)count);
+        }
+        producedOutput_ += count;
+    }
+
+    // 다음 출력의 왼쪽 문맥 (half - 1 샘플)만 남기고 폐기
+    long long nextIndex = (long long)(producedOutput_ * step);
+    long long keepFrom = nextIndex - half + 1;
+    if (keepFrom > historyStart_) {
+        long long drop = std::min<long long>(keepFrom - historyStart_, historySize);
+        for (int c = 0; c < channels_; ++c) {
+            history_[c].erase(history_[c].begin(), history_[c].begin() + drop);
+        }
+        historyStart_ += drop;
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * StreamingPitchShifter.h
+ *
+ * 스트리밍 피치 / 속도 변경 (SimplePitchShifter::processWithTempo의 블록 단위 버전)
+ * StreamingTimeStretcher(tempo / pitchRatio) -> 스트리밍 리샘플링(pitchRatio)
+ *
+ * 리샘플 위치는 double로 누적 (긴 파일에서도 위치 오차가 쌓이지 않음)
+ */
+
+#ifndef STREAMING_PITCH_SHIFTER_H
+#define STREAMING_PITCH_SHIFTER_H
+
+#include "StreamingTimeStretcher.h"
+#include "Resampler.h"
+#include <vector>
+
+class StreamingPitchShifter {
+public:
+    StreamingPitchShifter();
+
+    /**
+     * 리샘플링 보간 품질 (기본: LINEAR, SimplePitchShifter와 동일)
+     */
+    void setResamplerQuality(ResamplerQuality quality);
+    ResamplerQuality getResamplerQuality() const;
+
+    /**
+     * WSOLA 프로파일 (기본: DEFAULT, 다음 setup부터 적용)
+     * LOW_LATENCY: 실시간 모니터링용 (StreamingTimeStretcher 참고)
+     */
+    void setProfile(StretchProfile profile);
+    StretchProfile getProfile() const;
+
+    /**
+     * 겹침 위치 탐색 정책 (StreamingTimeStretcher::setSearchPolicy, 바로 적용)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * 크로스페이드 모양 (StreamingTimeStretcher::setCrossfadeShape, 바로 적용)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 스트림 설정 (내부 상태 초기화)
+     * @param semitones 반음 단위 (0 근처면 time stretch만)
+     * @param tempo 속도 비율 (2.0 = 2배 빠르게)
+     */
+    void setup(int sampleRate, int channels, float semitones, float tempo);
+
+    void reset();
+
+    /**
+     * 입력 블록 처리 (planar)
+     * @param outputs 채널별 출력, 확정된 샘플을 뒤에 추가 (clear하지 않음)
+     */
+    void process(const float* const* inputs, int frames, std::vector<std::vector<float>>& outputs);
+
+    /**
+     * 스트림 끝: 남은 출력을 모두 생성
+     * 전체 출력 길이 = time stretch 출력 길이 / pitchRatio
+     */
+    void flush(std::vector<std::vector<float>>& outputs);
+
+    /**
+     * 스트리밍 지연 (입력 샘플 기준 대략값)
+     */
+    int getLatency() const;
+
+private:
+    StreamingTimeStretcher stretcher_;
+    Resampler resampler_;
+
+    int channels_;
+    bool hasPitch_;
+    double pitchRatio_;
+
+    // 리샘플링 입력 (time stretch 출력, [0]의 절대 위치 = historyStart_)
+    std::vector<std::vector<float>> stretched_;
+    std::vector<std::vector<float>> history_;
+    long long historyStart_;
+    long long totalStretched_;
+    long long producedOutput_;
+
+    /**
+     * time stretch 출력을 history에 쌓고 만들 수 있는 만큼 리샘플링
+     */
+    void resampleAvailable(bool atEnd, std::vector<std::vector<float>>& outputs);
+};
+
+#endif // STREAMING_PITCH_SHIFTER_H
@@ -0,0 +1,322 @@
+/**
+ * StreamingTimeStretcher.cpp
+ *
+ * 스트리밍 WSOLA
+ *
+ * 동작:
+ * 1. 세그먼트 위치 inputPos의 탐색 범위 [inputPos - seek, inputPos + seek]와
+ *    세그먼트 길이만큼 입력이 모이면 세그먼트 하나를 처리 (SimpleTimeStretcher::stretch와 같은 루프)
+ * 2. 출력은 마지막 overlap 구간만 남기고 내보냄 (그 앞은 이후 세그먼트가 건드리지 않음)
+ * 3. 다음 탐색 시작 위치(inputPos - seek) 이전 입력은 폐기
+ * 4. flush에서 입력 끝 조건으로 남은 세그먼트와 꼬리 샘플 처리
+ *
+ * 다채널은 SimpleTimeStretcher::processPlanar와 같이 mid 신호에서 한 번만 탐색하고
+ * 같은 위치를 모든 채널에 적용
+ *
+ * 저지연 프로파일은 탐색 범위가 [inputPos - seek, inputPos)라서 inputPos + 세그먼트 길이까지만 있으면 처리
+ */
+
+#include "StreamingTimeStretcher.h"
+#include "../audio/ChannelLayout.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+// 저지연 프로파일 파라미터 (밀리초)
+const int LOW_LATENCY_SEQUENCE_MS = 10;
+const int LOW_LATENCY_SEEK_WINDOW_MS = 10;   // 과거 방향이라 지연에 영향 없음 (100 Hz 음성의 한 주기)
+const int LOW_LATENCY_OVERLAP_MS = 3;
+
+} // namespace
+
+StreamingTimeStretcher::StreamingTimeStretcher()
+    : profile_(StretchProfile::DEFAULT), sampleRate_(44100), channels_(1), ratio_(1.0f), passthrough_(true),
+      sequenceSamples_(0), seekWindowSamples_(0), overlapSamples_(0), inputHop_(0.0),
+      inputStart_(0), totalInput_(0), writePos_(0),
+      inputPos_(0), nominalInputPos_(0.0), firstSegment_(true) {
+    setup(44100, 1, 1.0f);
+}
+
+void StreamingTimeStretcher::setup(int sampleRate, int channels, float ratio) {
+    if (sampleRate <= 0) {
+        std::cerr << "[StreamingTimeStretcher] 잘못된 샘플레이트: " << sampleRate << std::endl;
+        return;
+    }
+    if (ratio <= 0) {
+        std::cerr << "[StreamingTimeStretcher] 잘못된 비율: " << ratio << std::endl;
+    }
+
+    sampleRate_ = sampleRate;
+    channels_ = std::max(1, channels);
+    ratio_ = ratio;
+    passthrough_ = ratio <= 0 || std::abs(ratio - 1.0f) < 0.01f;
+
+    if (profile_ == StretchProfile::LOW_LATENCY) {
+        sequenceSamples_ = (LOW_LATENCY_SEQUENCE_MS * sampleRate) / 1000;
+        seekWindowSamples_ = (LOW_LATENCY_SEEK_WINDOW_MS * sampleRate) / 1000;
+        overlapSamples_ = (LOW_LATENCY_OVERLAP_MS * sampleRate) / 1000;
+    } else {
+        // SimpleTimeStretcher::stretch와 같은 파라미터
+        sequenceSamples_ = (kernel_.sequenceMs * sampleRate) / 1000;
+        seekWindowSamples_ = (kernel_.seekWindowMs * sampleRate) / 1000;
+        overlapSamples_ = (kernel_.overlapMs * sampleRate) / 1000;
+    }
+    inputHop_ = (double)(sequenceSamples_ - overlapSamples_) * ratio;
+
+    refSegment_.resize(overlapSamples_);
+    kernel_.prepareCrossfade(overlapSamples_);   // 처리 중에는 테이블을 다시 만들지 않음
+    reset();
+}
+
+void StreamingTimeStretcher::setProfile(StretchProfile profile) {
+    profile_ = profile;
+}
+
+StretchProfile StreamingTimeStretcher::getProfile() const {
+    return profile_;
+}
+
+void StreamingTimeStretcher::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    kernel_.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& StreamingTimeStretcher::getSearchPolicy() const {
+    return kernel_.getSearchPolicy();
+}
+
+int StreamingTimeStretcher::getBudgetFallbackCount() const {
+    return kernel_.getBudgetFallbackCount();
+}
+
+void StreamingTimeStretcher::setCrossfadeShape(CrossfadeShape shape) {
+    kernel_.setCrossfadeShape(shape);
+    kernel_.prepareCrossfade(overlapSamples_);
+}
+
+CrossfadeShape StreamingTimeStretcher::getCrossfadeShape() const {
+    return kernel_.getCrossfadeShape();
+}
+
+int StreamingTimeStretcher::getSampleRate() const {
+    return sampleRate_;
+}
+
+int StreamingTimeStretcher::getChannels() const {
+    return channels_;
+}
+
+float StreamingTimeStretcher::getRatio() const {
+    return ratio_;
+}
+
+void StreamingTimeStretcher::reset() {
+    inputs_.resize(channels_);
+    pending_.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        inputs_[c].clear();
+        pending_[c].clear();
+    }
+    mid_.clear();
+    midPending_.clear();
+
+    inputStart_ = 0;
+    totalInput_ = 0;
+    writePos_ = 0;
+    inputPos_ = 0;
+    nominalInputPos_ = 0.0;
+    firstSegment_ = true;
+}
+
+int StreamingTimeStretcher::getLatency() const {
+    if (passthrough_) {
+        return 0;
+    }
+    // 저지연: 앞쪽 탐색 범위를 기다리지 않음
+    return profile_ == StretchProfile::LOW_LATENCY ? sequenceSamples_ : sequenceSamples_ + seekWindowSamples_;
+}
+
+void StreamingTimeStretcher::process(const float* const* inputs, int frames,
+                                     std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+    if (frames <= 0) {
+        return;
+    }
+
+    if (passthrough_) {
+        for (int c = 0; c < channels_; ++c) {
+            outputs[c].insert(outputs[c].end(), inputs[c], inputs[c] + frames);
+        }
+        totalInput_ += frames;
+        return;
+    }
+
+    for (int c = 0; c < channels_; ++c) {
+        inputs_[c].insert(inputs_[c].end(), inputs[c], inputs[c] + frames);
+    }
+    if (channels_ > 1) {
+        ChannelLayout::mixToMid(inputs, channels_, frames, midScratch_);
+        mid_.insert(mid_.end(), midScratch_.begin(), midScratch_.end());
+    }
+    totalInput_ += frames;
+
+    kernel_.beginSearchBlock();
+    produce(false);
+    emit(writePos_ - overlapSamples_, outputs);
+    discardInput();
+}
+
+void StreamingTimeStretcher::flush(std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+    if (!passthrough_) {
+        kernel_.beginSearchBlock();
+        produce(true);
+        emit(writePos_, outputs);
+    }
+    reset();
+}
+
+const float* StreamingTimeStretcher::searchInput() const {
+    return channels_ > 1 ? mid_.data() : inputs_[0].data();
+}
+
+std::vector<float>& StreamingTimeStretcher::searchOutput() {
+    return channels_ > 1 ? midPending_ : pending_[0];
+}
+
+void StreamingTimeStretcher::produce(bool atEnd) {
+    const bool causal = profile_ == StretchProfile::LOW_LATENCY;
+    const long long lookahead = causal ? 0 : seekWindowSamples_;
+
+    while (true) {
+        // 스트림 중간: 탐색 범위 끝 + 세그먼트 길이까지 입력이 있어야
+        // 전체 입력으로 처리할 때와 같은 탐색 범위 / 복사 길이가 보장됨
+        bool ready = atEnd ? inputPos_ < totalInput_ - sequenceSamples_
+                           : inputPos_ + lookahead + sequenceSamples_ < totalInput_;
+        if (!ready) {
+            break;
+        }
+
+        if (firstSegment_) {
+            // 첫 조각: 단순 복사
+            renderSegment(inputPos_, true);
+            firstSegment_ = false;
+        } else {
+            // 탐색 후보: [searchStart, searchEnd - overlap) (저지연은 inputPos 이전만)
+            long long searchStart = std::max(0LL, inputPos_ - seekWindowSamples_);
+            long long searchEnd = causal ? inputPos_ + overlapSamples_
+                                         : std::min(totalInput_ - overlapSamples_, inputPos_ + seekWindowSamples_);
+
+            // 참조 세그먼트 (출력의 마지막 오버랩 부분)
+            const std::vector<float>& output = searchOutput();
+            int refStart = writePos_ - overlapSamples_;
+            for (int i = 0; i < overlapSamples_; i++) {
+                refSegment_[i] = output[refStart + i];
+            }
+
+            int localLength = (int)(totalInput_ - inputStart_);
+            int bestPos;
+            if (!causal) {
+                bestPos = kernel_.searchOverlapPosition(searchInput(), localLength,
+                                                        (int)(searchStart - inputStart_),
+                                                        (int)(searchEnd - searchStart),
+                                                        refSegment_.data(), overlapSamples_);
+            } else if (kernel_.searchBudgetExceeded()) {
+                bestPos = (int)(inputPos_ - inputStart_);   // 시간 예산 초과: 명목 위치
+            } else {
+                bestPos = kernel_.findBestOverlapPositionAmdf(searchInput(), localLength,
+                                                              (int)(searchStart - inputStart_),
+                                                              (int)(searchEnd - searchStart),
+                                                              refSegment_.data(), overlapSamples_);
+            }
+            renderSegment(inputStart_ + bestPos, false);
+        }
+
+        // 다음 입력 위치로 이동
+        nominalInputPos_ += inputHop_;
+        inputPos_ = static_cast<long long>(nominalInputPos_);
+    }
+
+    if (!atEnd) {
+        return;
+    }
+
+    // 남은 샘플 추가
+    int remainingSamples = (int)(totalInput_ - inputPos_);
+    if (remainingSamples > 0) {
+        int localLength = (int)(totalInput_ - inputStart_);
+        int local = (int)(inputPos_ - inputStart_);
+        int writePos = writePos_;
+        for (int c = 0; c < channels_; ++c) {
+            writePos = writePos_;
+            kernel_.appendSegment(pending_[c], writePos, inputs_[c].data(), localLength, local, remainingSamples);
+        }
+        if (channels_ > 1) {
+            int midWritePos = writePos_;
+            kernel_.appendSegment(midPending_, midWritePos, mid_.data(), localLength, local, remainingSamples);
+        }
+        writePos_ = writePos;
+    }
+}
+
+void StreamingTimeStretcher::renderSegment(long long position, bool first) {
+    const int localLength = (int)(totalInput_ - inputStart_);
+    const int local = (int)(position - inputStart_);
+
+    // 채널 + mid 트랙에 같은 연산 (쓰기 위치도 트랙마다 같음)
+    auto render = [&](std::vector<float>& output, const float* input) {
+        int writePos = writePos_;
+        if (first) {
+            kernel_.appendSegment(output, writePos, input, localLength, local, sequenceSamples_);
+        } else {
+            // 오버랩 영역 크로스페이드 + 나머지 부분 추가
+            kernel_.overlapAndAdd(output, writePos - overlapSamples_, input, localLength, local,
+                                  overlapSamples_);
+            kernel_.appendSegment(output, writePos, input, localLength, local + overlapSamples_,
+                                  sequenceSamples_ - overlapSamples_);
+        }
+        return writePos;
+    };
+
+    int writePos = writePos_;
+    for (int c = 0; c < channels_; ++c) {
+        writePos = render(pending_[c], inputs_[c].data());
+    }
+    if (channels_ > 1) {
+        render(midPending_, mid_.data());
+    }
+    writePos_ = writePos;
+}
+
+void StreamingTimeStretcher::emit(int count, std::vector<std::vector<float>>& outputs) {
+    if (count <= 0) {
+        return;
+    }
+
+    for (int c = 0; c < channels_; ++c) {
+        outputs[c].insert(outputs[c].end(), pending_[c].begin(), pending_[c].begin() + count);
+        pending_[c].erase(pending_[c].begin(), pending_[c].begin() + count);
+    }
+    if (channels_ > 1) {
+        midPending_.erase(midPending_.begin(), midPending_.begin() + count);
+    }
+    writePos_ -= count;
+}
+
+void StreamingTimeStretcher::discardInput() {
+    // 이후 세그먼트는 inputPos - seek 이후만 읽음
+    long long keepFrom = std::max(0LL, inputPos_ - seekWindowSamples_);
+    long long drop = std::min(keepFrom - inputStart_, totalInput_ - inputStart_);
+    if (drop <= 0) {
+        return;
+    }
+
+    for (int c = 0; c < channels_; ++c) {
+        inputs_[c].erase(inputs_[c].begin(), inputs_[c].begin() + drop);
+    }
+    if (channels_ > 1) {
+        mid_.erase(mid_.begin(), mid_.begin() + drop);
+    }
+    inputStart_ += drop;
+}
@@ -0,0 +1,146 @@
+/**
+ * StreamingTimeStretcher.h
+ *
+ * 스트리밍 WSOLA (SimpleTimeStretcher의 블록 단위 버전)
+ * 입력을 블록 단위로 넣으면 확정된 출력만 바로 내보내고,
+ * 다음 세그먼트 탐색에 필요한 입력 / 아직 크로스페이드될 출력만 내부에 보관
+ *
+ * 블록 크기와 상관없이 SimpleTimeStretcher::process / processPlanar 한 번과 같은 결과를 냄
+ * (같은 세그먼트 위치, 같은 크로스페이드 커널 사용)
+ *
+ * 저지연 프로파일 (실시간 모니터링용, SimpleTimeStretcher와 결과가 다름):
+ * - 짧은 세그먼트 (sequence 10 ms / overlap 3 ms)
+ * - 인과적 탐색: 현재 위치 이전 10 ms만 탐색 (기본은 ±15 ms라 앞쪽 15 ms를 더 기다려야 함)
+ * - 유사도: 2배 decimation AMDF (상관관계 대신 평균 절대 차이)
+ */
+
+#ifndef STREAMING_TIME_STRETCHER_H
+#define STREAMING_TIME_STRETCHER_H
+
+#include "SimpleTimeStretcher.h"
+#include <vector>
+
+/**
+ * WSOLA 파라미터 프로파일
+ */
+enum class StretchProfile {
+    DEFAULT,        // SimpleTimeStretcher와 같음: sequence 40 ms, seek ±15 ms, overlap 8 ms (지연 약 55 ms)
+    LOW_LATENCY     // sequence 10 ms, seek 과거 10 ms, overlap 3 ms, AMDF (지연 약 10 ms)
+};
+
+class StreamingTimeStretcher {
+public:
+    StreamingTimeStretcher();
+
+    /**
+     * 프로파일 설정 (다음 setup부터 적용, 기본: DEFAULT)
+     */
+    void setProfile(StretchProfile profile);
+    StretchProfile getProfile() const;
+
+    /**
+     * 겹침 위치 탐색 정책 (SimpleTimeStretcher::setSearchPolicy, 바로 적용)
+     * blockBudgetMs는 process / flush 호출 하나의 시간 예산
+     * 저지연 프로파일(AMDF 탐색)에는 시간 예산만 적용
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * 마지막 process / flush에서 시간 예산 초과로 탐색을 건너뛴 세그먼트 수
+     */
+    int getBudgetFallbackCount() const;
+
+    /**
+     * 세그먼트 이음새 크로스페이드 모양 (SimpleTimeStretcher::setCrossfadeShape, 바로 적용)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 스트림 설정 (내부 상태 초기화)
+     * @param ratio 속도 비율 (SimpleTimeStretcher와 동일, 1.0 근처면 그대로 통과)
+     */
+    void setup(int sampleRate, int channels, float ratio);
+
+    int getSampleRate() const;
+    int getChannels() const;
+    float getRatio() const;
+
+    /**
+     * 스트림 상태 초기화 (설정은 유지)
+     */
+    void reset();
+
+    /**
+     * 입력 블록 처리 (planar)
+     * @param inputs 채널별 입력 포인터 (channels개)
+     * @param frames 채널당 샘플 수
+     * @param outputs 채널별 출력, 확정된 샘플을 뒤에 추가 (clear하지 않음)
+     */
+    void process(const float* const* inputs, int frames, std::vector<std::vector<float>>& outputs);
+
+    /**
+     * 스트림 끝: 남은 세그먼트와 꼬리 샘플을 모두 출력
+     */
+    void flush(std::vector<std::vector<float>>& outputs);
+
+    /**
+     * 세그먼트를 만들기 전에 모아야 하는 입력 샘플 수 (스트리밍 지연의 상한)
+     */
+    int getLatency() const;
+
+private:
+    SimpleTimeStretcher kernel_;   // 세그먼트 탐색 / 크로스페이드 커널 재사용
+
+    StretchProfile profile_;
+    int sampleRate_;
+    int channels_;
+    float ratio_;
+    bool passthrough_;             // 비율이 1.0 근처 (또는 잘못된 값): 그대로 통과
+
+    int sequenceSamples_;
+    int seekWindowSamples_;
+    int overlapSamples_;
+    double inputHop_;
+
+    // 입력 (채널별 + 탐색용 mid 신호, [0]의 절대 위치 = inputStart_)
+    std::vector<std::vector<float>> inputs_;
+    std::vector<float> mid_;
+    long long inputStart_;
+    long long totalInput_;
+
+    // 아직 내보내지 않은 출력 (마지막 overlap 구간은 다음 세그먼트가 크로스페이드)
+    std::vector<std::vector<float>> pending_;
+    std::vector<float> midPending_;
+    int writePos_;
+
+    // 세그먼트 진행 상태 (SimpleTimeStretcher::stretch의 루프 변수)
+    long long inputPos_;
+    double nominalInputPos_;
+    bool firstSegment_;
+    std::vector<float> refSegment_;
+    std::vector<float> midScratch_;
+
+    /**
+     * 만들 수 있는 세그먼트를 모두 처리
+     * @param atEnd true면 입력 끝까지 (남은 샘플 포함)
+     */
+    void produce(bool atEnd);
+
+    /**
+     * 세그먼트 하나를 모든 트랙(채널 + mid)에 적용
+     */
+    void renderSegment(long long position, bool first);
+
+    /**
+     * 확정된 출력 내보내기 + 필요 없는 입력 폐기
+     */
+    void emit(int count, std::vector<std::vector<float>>& outputs);
+    void discardInput();
+
+    const float* searchInput() const;
+    std::vector<float>& searchOutput();
+};
+
+#endif // STREAMING_TIME_STRETCHER_H
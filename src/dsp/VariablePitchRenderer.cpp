@@ -0,0 +1,279 @@
+/**
+ * VariablePitchRenderer.cpp
+ *
+ * 가변 pitch / duration 렌더링 (WSOLA + 리샘플링, 한 번의 패스)
+ *
+ * SimplePitchShifter::processWithTempo와 같은 원리를 세그먼트 단위로 적용:
+ * 1. 세그먼트의 입력 위치에서 곡선 값을 읽어 pitchRatio, tempo(= durationRatio) 계산
+ * 2. WSOLA 입력 hop = (sequence - overlap) * tempo / pitchRatio  (세그먼트마다 다름)
+ * 3. 추가된 샘플마다 원본 입력 위치의 pitchRatio를 pitchTrack_에 기록
+ * 4. 크로스페이드로 더 이상 바뀌지 않는 구간까지 바로 리샘플링
+ *    (읽기 위치를 pitchTrack_ 값만큼씩 전진 -> 구간별 피치 변화)
+ *
+ * durationRatio는 applyUniformTimeStretch / processWithTempo와 같은 tempo 비율 (1.5 = 1.5배 빠르게 = 짧게)
+ * 출력 길이 = 구간별 (입력 길이 / durationRatio)의 합
+ */
+
+#include "VariablePitchRenderer.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+// 곡선 값 허용 범위 (극단값으로 hop이 0이 되거나 폭주하지 않도록)
+const float MAX_SEMITONES = 24.0f;
+const float MIN_DURATION_RATIO = 0.25f;
+const float MAX_DURATION_RATIO = 4.0f;
+
+} // namespace
+
+VariablePitchRenderer::VariablePitchRenderer() {
+    resampler_.setQuality(ResamplerQuality::CUBIC);
+}
+
+void VariablePitchRenderer::setResamplerQuality(ResamplerQuality quality) {
+    resampler_.setQuality(quality);
+}
+
+ResamplerQuality VariablePitchRenderer::getResamplerQuality() const {
+    return resampler_.getQuality();
+}
+
+void VariablePitchRenderer::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    stretcher_.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& VariablePitchRenderer::getSearchPolicy() const {
+    return stretcher_.getSearchPolicy();
+}
+
+void VariablePitchRenderer::setCrossfadeShape(CrossfadeShape shape) {
+    stretcher_.setCrossfadeShape(shape);
+}
+
+CrossfadeShape VariablePitchRenderer::getCrossfadeShape() const {
+    return stretcher_.getCrossfadeShape();
+}
+
+float VariablePitchRenderer::curveAt(const std::vector<float>& curve, int index, float defaultValue) {
+    if (curve.empty()) {
+        return defaultValue;
+    }
+    return curve[std::max(0, std::min((int)curve.size() - 1, index))];
+}
+
+void VariablePitchRenderer::render(const float* input, int inputLength, int sampleRate,
+                                   const std::vector<float>& pitchCurve,
+                                   const std::vector<float>& durationCurve,
+                                   std::vector<float>& output,
+                                   PerformanceChecker* perfChecker) {
+    output.clear();
+    if (inputLength <= 0) {
+        return;
+    }
+
+    // 변화가 없으면 원본 복사
+    bool hasPitch = std::any_of(pitchCurve.begin(), pitchCurve.end(),
+                                [](float st) { return std::abs(st) >= 0.01f; });
+    bool hasDuration = std::any_of(durationCurve.begin(), durationCurve.end(),
+                                   [](float ratio) { return std::abs(ratio - 1.0f) >= 0.01f; });
+    if (!hasPitch && !hasDuration) {
+        output.assign(input, input + inputLength);
+        return;
+    }
+
+    // 밀리초를 샘플 수로 변환 (SimpleTimeStretcher와 같은 파라미터)
+    const int sequenceSamples = (stretcher_.sequenceMs * sampleRate) / 1000;
+    const int seekWindowSamples = (stretcher_.seekWindowMs * sampleRate) / 1000;
+    const int overlapSamples = (stretcher_.overlapMs * sampleRate) / 1000;
+    const int halfLength = resampler_.getHalfLength();
+
+    std::cout << "[VariablePitchRenderer] 처리 시작 - 입력 길이: " << inputLength << " 샘플" << std::endl;
+
+    output.reserve(inputLength);
+    stretched_.resize(inputLength);
+    pitchTrack_.resize(inputLength);
+
+    std::vector<float> refSegment(overlapSamples);
+    stretcher_.beginSearchBlock();
+
+    int inputPos = 0;
+    int writePos = 0;
+    bool isFirstSegment = true;
+    double nominalInputPos = 0.0;
+    double readPosition = 0.0;
+
+    while (inputPos < inputLength - sequenceSamples) {
+        // Step 1: 이 세그먼트의 pitch / tempo
+        float semitones = std::max(-MAX_SEMITONES, std::min(MAX_SEMITONES, curveAt(pitchCurve, inputPos, 0.0f)));
+        float durationRatio = std::max(MIN_DURATION_RATIO,
+                                       std::min(MAX_DURATION_RATIO, curveAt(durationCurve, inputPos, 1.0f)));
+        float pitchRatio = std::pow(2.0f, semitones / 12.0f);
+        float stretchRatio = durationRatio / pitchRatio;
+
+        // Step 2: WSOLA 세그먼트 추가 (SimpleTimeStretcher와 동일한 탐색 / 크로스페이드)
+        int segmentWriteStart = writePos;
+        int segmentSourceStart = inputPos;
+        if (isFirstSegment) {
+            stretcher_.appendSegment(stretched_, writePos, input, inputLength, inputPos, sequenceSamples);
+            isFirstSegment = false;
+        } else {
+            int searchStart = std::max(0, inputPos - seekWindowSamples);
+            int searchEnd = std::min(inputLength - overlapSamples, inputPos + seekWindowSamples);
+
+            int refStart = writePos - overlapSamples;
+            for (int i = 0; i < overlapSamples; i++) {
+                refSegment[i] = stretched_[refStart + i];
+            }
+
+            if (perfChecker) perfChecker->startFunction("findBestOverlapPosition");
+            int bestPos = stretcher_.searchOverlapPosition(input, inputLength, searchStart,
+                                                           searchEnd - searchStart,
+                                                           refSegment.data(), overlapSamples);
+            if (perfChecker) perfChecker->endFunction();
+
+            stretcher_.overlapAndAdd(stretched_, writePos - overlapSamples,
+                                     input, inputLength, bestPos, overlapSamples);
+
+            segmentSourceStart = bestPos + overlapSamples;
+            stretcher_.appendSegment(stretched_, writePos, input, inputLength,
+                                     segmentSourceStart, sequenceSamples - overlapSamples);
+        }
+
+        // Step 3: 추가된 샘플의 리샘플 비율 (원본 입력 위치의 pitch 곡선)
+        if ((int)pitchTrack_.size() < writePos) {
+            pitchTrack_.resize(stretched_.size());
+        }
+        for (int i = segmentWriteStart; i < writePos; ++i) {
+            float st = curveAt(pitchCurve, segmentSourceStart + (i - segmentWriteStart), 0.0f);
+            pitchTrack_[i] = std::pow(2.0f, std::max(-MAX_SEMITONES, std::min(MAX_SEMITONES, st)) / 12.0f);
+        }
+
+        // Step 4: 다음 크로스페이드에 영향받지 않는 구간까지 리샘플링
+        if (perfChecker) perfChecker->startFunction("resample");
+        renderAvailable(readPosition, writePos - overlapSamples - halfLength - 1, writePos, output);
+        if (perfChecker) perfChecker->endFunction();
+
+        nominalInputPos += (double)(sequenceSamples - overlapSamples) * stretchRatio;
+        inputPos = static_cast<int>(nominalInputPos);
+    }
+
+    // 남은 샘플 추가 후 끝까지 리샘플링
+    int tailStart = writePos;
+    int remainingSamples = inputLength - inputPos;
+    if (remainingSamples > 0) {
+        stretcher_.appendSegment(stretched_, writePos, input, inputLength, inputPos, remainingSamples);
+    }
+    if ((int)pitchTrack_.size() < writePos) {
+        pitchTrack_.resize(stretched_.size());
+    }
+    for (int i = tailStart; i < writePos; ++i) {
+        float st = curveAt(pitchCurve, inputPos + (i - tailStart), 0.0f);
+        pitchTrack_[i] = std::pow(2.0f, std::max(-MAX_SEMITONES, std::min(MAX_SEMITONES, st)) / 12.0f);
+    }
+
+    if (perfChecker) perfChecker->startFunction("resample");
+    renderAvailable(readPosition, writePos, writePos, output);
+    if (perfChecker) perfChecker->endFunction();
+
+    std::cout << "[VariablePitchRenderer] 처리 완료 - 출력 길이: " << output.size() << " 샘플" << std::endl;
+}
+
+void VariablePitchRenderer::renderAvailable(double& readPosition, int limit, int stretchedLength,
+                                            std::vector<float>& output) {
+    while (readPosition < limit) {
+        float ratio = pitchTrack_[(int)readPosition];
+        // sinc 테이블 수가 늘어나지 않도록 차단 주파수용 비율은 0.05 단위로 올림
+        float tableRatio = std::ceil(ratio * 20.0f) / 20.0f;
+        output.push_back(resampler_.interpolateAt(stretched_.data(), stretchedLength,
+                                                  readPosition, tableRatio));
+        readPosition += ratio;
+    }
+}
+
+const float* VariablePitchRenderer::monoData(const AudioBuffer& input) {
+    if (input.getChannels() > 1) {
+        std::cerr << "[VariablePitchRenderer] 모노만 지원: 채널 " << input.getChannels() << std::endl;
+        return nullptr;
+    }
+    // 모노 planar는 plane 하나를 그대로 입력으로 사용
+    return input.isPlanar() ? input.getChannelData(0) : input.getData().data();
+}
+
+AudioBuffer VariablePitchRenderer::render(const AudioBuffer& input, PerformanceChecker* perfChecker) {
+    AudioBuffer result(input.getSampleRate(), 1);
+    const float* data = monoData(input);
+    if (!data) {
+        return result;
+    }
+
+    std::vector<float> outputData;
+    render(data, (int)input.getFrameCount(), input.getSampleRate(),
+           input.getPitchCurve(), std::vector<float>(), outputData, perfChecker);
+
+    result.setData(std::move(outputData)); // move semantics
+    return result;
+}
+
+AudioBuffer VariablePitchRenderer::render(const AudioBuffer& input, const std::vector<FrameData>& frames,
+                                          PerformanceChecker* perfChecker) {
+    AudioBuffer result(input.getSampleRate(), 1);
+    const float* data = monoData(input);
+    if (!data) {
+        return result;
+    }
+
+    const int length = (int)input.getFrameCount();
+    std::vector<float> pitchCurve;
+    std::vector<float> durationCurve;
+    int frameSamples = frames.empty() ? 0 : (int)frames.front().samples.size();
+    framesToCurves(frames, input.getSampleRate(), length, frameSamples, pitchCurve, durationCurve);
+
+    std::vector<float> outputData;
+    render(data, length, input.getSampleRate(), pitchCurve, durationCurve, outputData, perfChecker);
+
+    result.setData(std::move(outputData)); // move semantics
+    return result;
+}
+
+void VariablePitchRenderer::framesToCurves(const std::vector<FrameData>& frames, int sampleRate, int length,
+                                           int frameSamples, std::vector<float>& pitchCurve, std::vector<float>& durationCurve) {
+    pitchCurve.clear();
+    durationCurve.clear();
+    if (frames.empty() || length <= 0) {
+        return;
+    }
+
+    pitchCurve.resize(length);
+    durationCurve.resize(length);
+
+    // 프레임 중심 위치 (샘플)
+    const float halfFrame = std::max(0, frameSamples) * 0.5f;
+    auto centerOf = [&](const FrameData& frame) {
+        return frame.time * sampleRate + halfFrame;
+    };
+
+    size_t next = 0;
+    for (int i = 0; i < length; ++i) {
+        while (next < frames.size() && centerOf(frames[next]) <= i) {
+            next++;
+        }
+
+        if (next == 0) {
+            pitchCurve[i] = frames.front().pitchSemitones;
+            durationCurve[i] = frames.front().durationRatio;
+        } else if (next == frames.size()) {
+            pitchCurve[i] = frames.back().pitchSemitones;
+            durationCurve[i] = frames.back().durationRatio;
+        } else {
+            const FrameData& a = frames[next - 1];
+            const FrameData& b = frames[next];
+            float centerA = centerOf(a);
+            float span = std::max(1.0f, centerOf(b) - centerA);
+            float t = (i - centerA) / span;
+            pitchCurve[i] = a.pitchSemitones + (b.pitchSemitones - a.pitchSemitones) * t;
+            durationCurve[i] = a.durationRatio + (b.durationRatio - a.durationRatio) * t;
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * VariablePitchRenderer.h
+ *
+ * 시간에 따라 변하는 pitch / duration 렌더러
+ * AudioBuffer의 pitchCurve (샘플별 semitones) 또는 FrameData의 pitchSemitones / durationRatio를
+ * 한 번의 패스로 렌더링 (구간마다 균일 처리를 따로 호출하지 않음)
+ */
+
+#ifndef VARIABLE_PITCH_RENDERER_H
+#define VARIABLE_PITCH_RENDERER_H
+
+#include "../audio/AudioBuffer.h"
+#include "../audio/AudioPreprocessor.h"
+#include "../performance/PerformanceChecker.h"
+#include "SimpleTimeStretcher.h"
+#include "Resampler.h"
+#include <vector>
+
+class VariablePitchRenderer {
+public:
+    VariablePitchRenderer();
+
+    /**
+     * 리샘플링 보간 품질 (기본: CUBIC)
+     * SINC 계열은 비율을 0.05 단위로 올림한 차단 주파수 테이블을 사용
+     */
+    void setResamplerQuality(ResamplerQuality quality);
+    ResamplerQuality getResamplerQuality() const;
+
+    /**
+     * WSOLA 겹침 위치 탐색 정책 (SimpleTimeStretcher::setSearchPolicy, render 한 번 = 블록 하나)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * WSOLA 크로스페이드 모양 (SimpleTimeStretcher::setCrossfadeShape)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 샘플별 곡선으로 렌더링
+     * @param input 입력 샘플
+     * @param inputLength 입력 샘플 수
+     * @param sampleRate 샘플레이트
+     * @param pitchCurve 입력 샘플마다 semitones (비어 있으면 0, 짧으면 마지막 값 유지)
+     * @param durationCurve 입력 샘플마다 duration ratio = tempo (1.0 = 원본, 2.0 = 2배 빠르게 = 길이 1/2, 비어 있으면 1.0)
+     *                      (applyUniformTimeStretch의 durationRatio와 같은 의미, 출력 길이 = 입력 길이 / durationRatio)
+     * @param output 출력 버퍼 (덮어씀)
+     * @param perfChecker 성능 측정 (optional)
+     */
+    void render(const float* input, int inputLength, int sampleRate,
+                const std::vector<float>& pitchCurve,
+                const std::vector<float>& durationCurve,
+                std::vector<float>& output,
+                PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * AudioBuffer의 pitchCurve로 렌더링 (duration 변화 없음)
+     * 모노만 지원 (planar 모노 포함), 다채널이면 빈 버퍼 반환
+     */
+    AudioBuffer render(const AudioBuffer& input, PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 프레임별 pitchSemitones / durationRatio로 렌더링
+     * 프레임 길이는 첫 프레임의 samples 길이 (AudioPreprocessor 결과 그대로 사용)
+     * 모노만 지원 (planar 모노 포함), 다채널이면 빈 버퍼 반환
+     */
+    AudioBuffer render(const AudioBuffer& input, const std::vector<FrameData>& frames,
+                       PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * 프레임 값을 샘플별 곡선으로 변환
+     * 프레임 중심 사이는 선형 보간, 첫 프레임 이전 / 마지막 프레임 이후는 값 유지
+     * @param frameSamples 프레임 길이 (샘플, 프레임 중심 = time * sampleRate + frameSamples / 2)
+     *                     (FrameData::samples는 비어 있을 수 있으므로 길이를 따로 받음)
+     */
+    static void framesToCurves(const std::vector<FrameData>& frames, int sampleRate, int length, int frameSamples,
+                               std::vector<float>& pitchCurve, std::vector<float>& durationCurve);
+
+private:
+    SimpleTimeStretcher stretcher_;   // WSOLA 탐색 / 크로스페이드 재사용
+    Resampler resampler_;
+
+    // 중간 결과 (호출 간 재사용)
+    std::vector<float> stretched_;    // 가변 WSOLA 출력
+    std::vector<float> pitchTrack_;   // stretched_ 샘플마다 리샘플 비율 (= pitch ratio)
+
+    /**
+     * 리샘플링: readPosition부터 limit 이전까지 출력 생성 (가변 비율)
+     */
+    void renderAvailable(double& readPosition, int limit, int stretchedLength,
+                         std::vector<float>& output);
+
+    /**
+     * 모노 AudioBuffer의 샘플 포인터 (planar 모노는 plane 0, 다채널이면 오류 출력 후 nullptr)
+     */
+    static const float* monoData(const AudioBuffer& input);
+
+    /**
+     * 곡선 값 (범위 밖이면 마지막 값, 비어 있으면 기본값)
+     */
+    static float curveAt(const std::vector<float>& curve, int index, float defaultValue);
+};
+
+#endif // VARIABLE_PITCH_RENDERER_H
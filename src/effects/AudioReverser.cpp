@@ -8,13 +8,36 @@ AudioReverser::~AudioReverser() {
 }
 
 AudioBuffer AudioReverser::reverse(const AudioBuffer& input) {
-    // 최적화: reverse iterator로 직접 생성 (복사 1회로 감소)
+    AudioBuffer result(input.getSampleRate(), input.getChannels());
+
+    // planar: plane마다 뒤집어 같은 정렬의 planar로 반환
+    if (input.isPlanar()) {
+        std::vector<std::vector<float>> planes(input.getChannels());
+        for (int c = 0; c < input.getChannels(); ++c) {
+            ConstChannelView channel = input.getChannel(c);
+            planes[c].assign(std::reverse_iterator<const float*>(channel.end()),
+                             std::reverse_iterator<const float*>(channel.begin()));
+        }
+        result.setPlanarData(planes, input.getAlignment());
+        return result;
+    }
+
     const std::vector<float>& inputData = input.getData();
-    std::vector<float> data(inputData.rbegin(), inputData.rend());
+    int channels = std::max(1, input.getChannels());
+    if (channels == 1) {
+        // 최적화: reverse iterator로 직접 생성 (복사 1회로 감소)
+        result.setData(std::vector<float>(inputData.rbegin(), inputData.rend()));
+        return result;
+    }
 
-    // 결과 버퍼 생성
-    AudioBuffer result(input.getSampleRate(), input.getChannels());
+    // 다채널 interleaved: 프레임 순서만 뒤집음 (프레임 안의 채널 순서는 유지)
+    const size_t frames = inputData.size() / channels;
+    std::vector<float> data(frames * channels);
+    for (size_t i = 0; i < frames; ++i) {
+        std::copy(inputData.begin() + (frames - 1 - i) * channels,
+                  inputData.begin() + (frames - i) * channels,
+                  data.begin() + i * channels);
+    }
     result.setData(std::move(data)); // move semantics 사용
-
     return result;
 }
@@ -8,7 +8,7 @@ public:
     AudioReverser();
     ~AudioReverser();
 
-    // 오디오 역재생
+    // 오디오 역재생 (다채널은 프레임 단위, planar 입력은 planar로 반환)
     AudioBuffer reverse(const AudioBuffer& input);
 };
 
@@ -0,0 +1,388 @@
+/**
+ * EffectChain.cpp
+ *
+ * 효과 체인 실행기
+ *
+ * 기존 JS 흐름:
+ *   applyUniformPitchShift -> applyUniformTimeStretch -> applyVoiceFilter -> reverseAudio
+ *   (매 단계마다 WASM 경계를 넘고, 입력 복사 + 전체 크기 중간 버퍼를 새로 할당)
+ *
+ * EffectChain:
+ *   한 번의 호출로 모든 스테이지를 실행
+ *   - ping-pong 버퍼 2개만 사용 (filter/reverse/gain은 in-place)
+ *   - gain/clamp 같은 point-wise 스테이지는 앞 스테이지의 출력 루프에 융합
+ */
+
+#include "EffectChain.h"
+#include "../audio/SampleOps.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+// 문자열 앞뒤 공백 제거
+std::string trim(const std::string& str) {
+    size_t start = str.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) {
+        return "";
+    }
+    size_t end = str.find_last_not_of(" \t\r\n");
+    return str.substr(start, end - start + 1);
+}
+
+// 숫자 파싱 (실패 시 false)
+bool parseFloat(const std::string& str, float& value) {
+    std::string trimmed = trim(str);
+    if (trimmed.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtof(trimmed.c_str(), &end);
+    return end != nullptr && *end == '\0';
+}
+
+const int FILTER_TYPE_COUNT = static_cast<int>(FilterType::VOICE_CHANGER_FEMALE_TO_MALE) + 1;
+
+} // namespace
+
+EffectChain::EffectChain() : processingRate_(0) {
+}
+
+bool EffectChain::parse(const std::string& spec) {
+    std::vector<EffectStage> stages;
+    int processingRate = 0;
+
+    std::istringstream specStream(spec);
+    std::string token;
+    while (std::getline(specStream, token, ';')) {
+        token = trim(token);
+        if (token.empty()) {
+            continue;
+        }
+
+        // "이름:인자,인자" 분리
+        std::string name = token;
+        std::vector<float> args;
+        size_t colon = token.find(':');
+        if (colon != std::string::npos) {
+            name = trim(token.substr(0, colon));
+            std::istringstream argStream(token.substr(colon + 1));
+            std::string arg;
+            while (std::getline(argStream, arg, ',')) {
+                float value;
+                if (!parseFloat(arg, value)) {
+                    std::cerr << "[EffectChain] 잘못된 인자: '" << token << "'" << std::endl;
+                    return false;
+                }
+                args.push_back(value);
+            }
+        }
+
+        if (name == "rate" && args.size() == 1 && args[0] >= 0.0f) {
+            processingRate = static_cast<int>(args[0]);
+            continue;
+        }
+
+        EffectStage stage;
+        if (name == "pitch" && !args.empty() && args.size() <= 2) {
+            int quality = args.size() > 1 ? static_cast<int>(args[1]) : 0;
+            if (quality < 0 || quality > static_cast<int>(ResamplerQuality::SINC_64)) {
+                std::cerr << "[EffectChain] 알 수 없는 리샘플링 품질: " << quality << std::endl;
+                return false;
+            }
+            stage.type = EffectStageType::PITCH;
+            stage.param1 = args[0];
+            stage.param3 = static_cast<float>(quality);
+        } else if (name == "tempo" && args.size() == 1 && args[0] > 0.0f) {
+            stage.type = EffectStageType::TEMPO;
+            stage.param1 = args[0];
+        } else if (name == "filter" && !args.empty() && args.size() <= 3) {
+            int filterType = static_cast<int>(args[0]);
+            if (filterType < 0 || filterType >= FILTER_TYPE_COUNT) {
+                std::cerr << "[EffectChain] 알 수 없는 필터 타입: " << filterType << std::endl;
+                return false;
+            }
+            stage.type = EffectStageType::FILTER;
+            stage.param1 = static_cast<float>(filterType);
+            if (args.size() > 1) stage.param2 = args[1];
+            if (args.size() > 2) stage.param3 = args[2];
+        } else if (name == "reverse" && args.empty()) {
+            stage.type = EffectStageType::REVERSE;
+        } else if (name == "gain" && args.size() == 1 && args[0] >= 0.0f) {
+            stage.type = EffectStageType::GAIN;
+            stage.param1 = args[0];
+        } else {
+            std::cerr << "[EffectChain] 잘못된 스테이지: '" << token << "'" << std::endl;
+            return false;
+        }
+        stages.push_back(stage);
+    }
+
+    setStages(stages);
+    processingRate_ = processingRate;
+    return true;
+}
+
+void EffectChain::setStages(const std::vector<EffectStage>& stages) {
+    stages_ = stages;
+    plan();
+}
+
+const std::vector<EffectStage>& EffectChain::getStages() const {
+    return stages_;
+}
+
+const std::vector<EffectStage>& EffectChain::getPlannedStages() const {
+    return planned_;
+}
+
+void EffectChain::setProcessingRate(int rate) {
+    processingRate_ = std::max(0, rate);
+}
+
+int EffectChain::getProcessingRate() const {
+    return processingRate_;
+}
+
+void EffectChain::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    pitchShifter_.setSearchPolicy(policy);
+    timeStretcher_.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& EffectChain::getSearchPolicy() const {
+    return timeStretcher_.getSearchPolicy();
+}
+
+void EffectChain::setCrossfadeShape(CrossfadeShape shape) {
+    pitchShifter_.setCrossfadeShape(shape);
+    timeStretcher_.setCrossfadeShape(shape);
+}
+
+CrossfadeShape EffectChain::getCrossfadeShape() const {
+    return timeStretcher_.getCrossfadeShape();
+}
+
+void EffectChain::plan() {
+    planned_.clear();
+    planned_.reserve(stages_.size());
+
+    for (const EffectStage& source : stages_) {
+        EffectStage stage = source;
+        stage.postGain = 1.0f;
+
+        // no-op 스테이지 제거 (각 처리기의 "변화 없음" 기준과 동일)
+        if ((stage.type == EffectStageType::PITCH && std::abs(stage.param1) < 0.01f) ||
+            (stage.type == EffectStageType::TEMPO && std::abs(stage.param1 - 1.0f) < 0.01f) ||
+            (stage.type == EffectStageType::GAIN && stage.param1 == 1.0f)) {
+            continue;
+        }
+
+        EffectStage* last = planned_.empty() ? nullptr : &planned_.back();
+
+        if (stage.type == EffectStageType::GAIN) {
+            // gain/clamp는 앞 스테이지의 출력 루프에 융합
+            // (time stretch는 출력이 세그먼트 단위로 만들어지므로 융합 대상에서 제외)
+            // 앞 스테이지가 이미 클램프하면 (gain 융합됨 / filter 볼륨 보정) 융합 시 중간 클램프가 사라지므로
+            // gain >= 1일 때만 융합: clamp(clamp(x) * g) == clamp(x * g)
+            // (합친 gain이 1이 되면 커널이 클램프를 건너뛰므로 융합하지 않음)
+            bool clampsOutput = last && (last->postGain != 1.0f ||
+                                         last->type == EffectStageType::GAIN ||
+                                         last->type == EffectStageType::FILTER);
+            bool fusable = last && last->type != EffectStageType::TEMPO &&
+                           (!clampsOutput || (stage.param1 >= 1.0f && last->postGain * stage.param1 != 1.0f));
+            if (fusable) {
+                last->postGain *= stage.param1;
+            } else {
+                stage.postGain = stage.param1;
+                planned_.push_back(stage);
+            }
+            continue;
+        }
+
+        if (last && last->postGain == 1.0f &&
+            (stage.type == EffectStageType::PITCH || stage.type == EffectStageType::TEMPO) &&
+            (last->type == EffectStageType::PITCH_TEMPO ||
+             (last->type != stage.type &&
+              (last->type == EffectStageType::PITCH || last->type == EffectStageType::TEMPO)))) {
+            // pitch + tempo는 WSOLA 1회 + 리샘플 1회로 병합 (두 연산은 교환 가능)
+            if (last->type == EffectStageType::PITCH) {
+                last->param2 = 1.0f;
+            } else if (last->type == EffectStageType::TEMPO) {
+                last->param2 = last->param1;
+                last->param1 = 0.0f;
+                last->param3 = 0.0f;
+            }
+            last->type = EffectStageType::PITCH_TEMPO;
+            if (stage.type == EffectStageType::PITCH) {
+                last->param1 += stage.param1;
+                last->param3 = std::max(last->param3, stage.param3);
+            } else {
+                last->param2 *= stage.param1;
+            }
+            continue;
+        }
+
+        if (last && last->postGain == 1.0f && last->type == stage.type) {
+            // 인접한 같은 종류의 스테이지 병합 (WSOLA/리샘플링 패스 1회 절약)
+            if (stage.type == EffectStageType::PITCH) {
+                last->param1 += stage.param1;
+                last->param3 = std::max(last->param3, stage.param3);
+                if (std::abs(last->param1) < 0.01f) planned_.pop_back();
+                continue;
+            }
+            if (stage.type == EffectStageType::TEMPO) {
+                last->param1 *= stage.param1;
+                if (std::abs(last->param1 - 1.0f) < 0.01f) planned_.pop_back();
+                continue;
+            }
+            if (stage.type == EffectStageType::REVERSE) {
+                // 역재생 두 번은 원본과 같음
+                planned_.pop_back();
+                continue;
+            }
+        }
+
+        planned_.push_back(stage);
+    }
+}
+
+const std::vector<float>& EffectChain::process(const float* input, int length, int sampleRate,
+                                               PerformanceChecker* perfChecker) {
+    bool useProcessingRate = processingRate_ > 0 && processingRate_ < sampleRate && !planned_.empty();
+    if (!useProcessingRate) {
+        return buffers_[runStages(input, length, sampleRate, perfChecker)];
+    }
+
+    // 내부 샘플레이트로 변환 -> 스테이지 처리 -> 원래 샘플레이트로 복원
+    if (perfChecker) perfChecker->startFunction("EffectChain.rateDown");
+    if (downConverter_.getInputRate() != sampleRate || downConverter_.getOutputRate() != processingRate_) {
+        downConverter_.setRates(sampleRate, processingRate_);
+    }
+    downConverter_.convert(input, length, rateBuffer_);
+    if (perfChecker) perfChecker->endFunction();
+
+    int current = runStages(rateBuffer_.data(), (int)rateBuffer_.size(), processingRate_, perfChecker);
+    int next = (current == 0) ? 1 : 0;
+
+    if (perfChecker) perfChecker->startFunction("EffectChain.rateUp");
+    if (upConverter_.getInputRate() != processingRate_ || upConverter_.getOutputRate() != sampleRate) {
+        upConverter_.setRates(processingRate_, sampleRate);
+    }
+    upConverter_.convert(buffers_[current].data(), (int)buffers_[current].size(), buffers_[next]);
+    if (perfChecker) perfChecker->endFunction();
+
+    return buffers_[next];
+}
+
+int EffectChain::runStages(const float* input, int length, int sampleRate,
+                           PerformanceChecker* perfChecker) {
+    // current: 현재 결과가 들어있는 버퍼 인덱스 (-1 = 아직 입력 포인터를 그대로 읽는 중)
+    int current = -1;
+    const float* source = input;
+    int sourceLength = length;
+
+    for (const EffectStage& stage : planned_) {
+        // in-place 스테이지는 소유한 버퍼가 필요 (첫 스테이지일 때만 입력을 1회 복사)
+        bool inPlace = stage.type == EffectStageType::FILTER ||
+                       stage.type == EffectStageType::REVERSE ||
+                       stage.type == EffectStageType::GAIN;
+        if (inPlace && current < 0) {
+            buffers_[0].assign(input, input + length);
+            current = 0;
+        }
+        int next = (current == 0) ? 1 : 0;
+
+        switch (stage.type) {
+            case EffectStageType::PITCH:
+                if (perfChecker) perfChecker->startFunction("EffectChain.pitch");
+                pitchShifter_.setResamplerQuality(static_cast<ResamplerQuality>(static_cast<int>(stage.param3)));
+                pitchShifter_.process(source, sourceLength, sampleRate, stage.param1,
+                                      buffers_[next], stage.postGain, perfChecker);
+                if (perfChecker) perfChecker->endFunction();
+                current = next;
+                break;
+            case EffectStageType::PITCH_TEMPO:
+                if (perfChecker) perfChecker->startFunction("EffectChain.pitchTempo");
+                pitchShifter_.setResamplerQuality(static_cast<ResamplerQuality>(static_cast<int>(stage.param3)));
+                pitchShifter_.processWithTempo(source, sourceLength, sampleRate,
+                                               stage.param1, stage.param2,
+                                               buffers_[next], stage.postGain, perfChecker);
+                if (perfChecker) perfChecker->endFunction();
+                current = next;
+                break;
+            case EffectStageType::TEMPO:
+                if (perfChecker) perfChecker->startFunction("EffectChain.tempo");
+                timeStretcher_.process(source, sourceLength, sampleRate, stage.param1,
+                                       buffers_[next], perfChecker);
+                if (perfChecker) perfChecker->endFunction();
+                current = next;
+                break;
+            case EffectStageType::FILTER:
+                if (perfChecker) perfChecker->startFunction("EffectChain.filter");
+                voiceFilter_.applyFilterInPlace(buffers_[current], sampleRate,
+                                                static_cast<FilterType>(static_cast<int>(stage.param1)),
+                                                stage.param2, stage.param3, stage.postGain);
+                if (perfChecker) perfChecker->endFunction();
+                break;
+            case EffectStageType::REVERSE:
+                if (perfChecker) perfChecker->startFunction("EffectChain.reverse");
+                reverseWithGain(buffers_[current], stage.postGain);
+                if (perfChecker) perfChecker->endFunction();
+                break;
+            case EffectStageType::GAIN:
+                if (perfChecker) perfChecker->startFunction("EffectChain.gain");
+                SampleOps::applyGainClamped(buffers_[current], stage.postGain);
+                if (perfChecker) perfChecker->endFunction();
+                break;
+        }
+
+        source = buffers_[current].data();
+        sourceLength = static_cast<int>(buffers_[current].size());
+    }
+
+    // 스테이지가 없으면 입력 그대로
+    if (current < 0) {
+        buffers_[0].assign(input, input + length);
+        current = 0;
+    }
+
+    return current;
+}
+
+AudioBuffer EffectChain::process(const AudioBuffer& input, PerformanceChecker* perfChecker) {
+    AudioBuffer output(input.getSampleRate(), 1);
+    if (input.getChannels() > 1) {
+        std::cerr << "[EffectChain] 효과 체인은 모노만 지원: 채널 " << input.getChannels() << std::endl;
+        return output;
+    }
+
+    // 모노 planar는 plane 하나를 그대로 입력으로 사용
+    const float* data = input.isPlanar() ? input.getChannelData(0) : input.getData().data();
+    const std::vector<float>& result = process(data, (int)input.getFrameCount(), input.getSampleRate(),
+                                               perfChecker);
+    output.setData(result);
+    return output;
+}
+
+void EffectChain::reverseWithGain(std::vector<float>& data, float gain) {
+    if (gain == 1.0f) {
+        std::reverse(data.begin(), data.end());
+        return;
+    }
+
+    // 양 끝에서 교환하면서 gain/clamp 적용 (한 번의 패스)
+    size_t size = data.size();
+    for (size_t i = 0; i < size / 2; ++i) {
+        float front = data[i];
+        float back = data[size - 1 - i];
+        data[i] = std::max(-1.0f, std::min(1.0f, back * gain));
+        data[size - 1 - i] = std::max(-1.0f, std::min(1.0f, front * gain));
+    }
+    if (size % 2 == 1) {
+        size_t mid = size / 2;
+        data[mid] = std::max(-1.0f, std::min(1.0f, data[mid] * gain));
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * EffectChain.h
+ *
+ * 여러 효과(pitch, tempo, filter, reverse, gain)를 한 번의 호출로 처리하는 실행기
+ *
+ * - 직렬화된 스테이지 목록을 파싱 ("pitch:3;tempo:1.25;filter:4,0.5,0.5;reverse;gain:0.8")
+ * - 실행 계획 수립: no-op 제거, 인접 스테이지 병합, gain/clamp를 앞 스테이지 커널에 융합
+ *   (클램프 위치가 바뀌지 않을 때만: 결과는 효과별 단독 처리와 같음)
+ *   (인접한 pitch + tempo는 SimplePitchShifter::processWithTempo 한 번으로 처리)
+ * - 두 개의 버퍼를 번갈아 사용 (ping-pong), 호출 간에도 버퍼를 유지하여 재할당 없음
+ * - 내부 처리 샘플레이트 (선택): 입력을 낮은 샘플레이트로 변환해 모든 스테이지를 처리한 뒤 복원
+ */
+
+#ifndef EFFECT_CHAIN_H
+#define EFFECT_CHAIN_H
+
+#include "../audio/AudioBuffer.h"
+#include "../performance/PerformanceChecker.h"
+#include "../dsp/SimplePitchShifter.h"
+#include "../dsp/SimpleTimeStretcher.h"
+#include "../dsp/SampleRateConverter.h"
+#include "VoiceFilter.h"
+#include <string>
+#include <vector>
+
+enum class EffectStageType {
+    PITCH,    // param1: semitones, param3: ResamplerQuality
+    TEMPO,    // param1: 속도 비율 (applyUniformTimeStretch와 동일)
+    FILTER,   // param1: FilterType, param2/param3: 필터 파라미터
+    REVERSE,
+    GAIN,     // param1: 선형 gain (결과는 [-1, 1] 클램프)
+    PITCH_TEMPO // 실행 계획 전용: 인접한 pitch + tempo 병합 (param1: semitones, param2: 속도 비율, param3: ResamplerQuality)
+};
+
+struct EffectStage {
+    EffectStageType type;
+    float param1;
+    float param2;
+    float param3;
+    float postGain;   // 실행 계획 결과: 이 스테이지 커널에 융합된 gain (1.0 = 없음)
+
+    EffectStage()
+        : type(EffectStageType::GAIN), param1(1.0f), param2(0.5f), param3(0.5f), postGain(1.0f) {}
+};
+
+class EffectChain {
+public:
+    EffectChain();
+
+    /**
+     * 직렬화된 스테이지 목록 파싱
+     * 형식: "이름[:값,값,...]"을 ';'로 구분
+     *   pitch:<semitones>[,<quality>]  (quality: 0 선형, 1 cubic, 2 sinc-16, 3 sinc-64)
+     *   tempo:<ratio>
+     *   filter:<type>[,<param1>[,<param2>]]
+     *   reverse
+     *   gain:<linear gain>
+     *   rate:<Hz>  (스테이지가 아닌 설정: 내부 처리 샘플레이트, 0 = 사용 안 함)
+     * @return 파싱 성공 여부 (실패 시 기존 스테이지 유지)
+     */
+    bool parse(const std::string& spec);
+
+    void setStages(const std::vector<EffectStage>& stages);
+    const std::vector<EffectStage>& getStages() const;
+
+    // 실행 계획 (병합/융합 이후 실제로 실행되는 스테이지들)
+    const std::vector<EffectStage>& getPlannedStages() const;
+
+    /**
+     * 내부 처리 샘플레이트 (0 = 입력 샘플레이트 그대로)
+     * 입력 샘플레이트보다 낮을 때만 적용: 입력 -> rate 변환 -> 스테이지 처리 -> 입력 샘플레이트로 복원
+     * (WSOLA 탐색/겹침 비용이 샘플레이트에 비례하므로 음성은 16k ~ 24k로도 충분)
+     */
+    void setProcessingRate(int rate);
+    int getProcessingRate() const;
+
+    /**
+     * pitch / tempo 스테이지의 겹침 위치 탐색 정책 (SimpleTimeStretcher::setSearchPolicy)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * pitch / tempo 스테이지의 크로스페이드 모양 (SimpleTimeStretcher::setCrossfadeShape)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 체인 실행
+     * @return 결과 버퍼 (다음 process() 호출 전까지 유효)
+     */
+    const std::vector<float>& process(const float* input, int length, int sampleRate,
+                                      PerformanceChecker* perfChecker = nullptr);
+
+    /**
+     * AudioBuffer 입력 (모노만 지원, planar 모노 포함)
+     * @return 처리 결과 (다채널 입력이면 오류 출력 후 빈 버퍼)
+     */
+    AudioBuffer process(const AudioBuffer& input, PerformanceChecker* perfChecker = nullptr);
+
+private:
+    std::vector<EffectStage> stages_;
+    std::vector<EffectStage> planned_;
+
+    // ping-pong 버퍼 (호출 간 재사용)
+    std::vector<float> buffers_[2];
+
+    // 내부 처리 샘플레이트
+    int processingRate_;
+    SampleRateConverter downConverter_;
+    SampleRateConverter upConverter_;
+    std::vector<float> rateBuffer_;   // 내부 샘플레이트로 변환된 입력
+
+    // 처리기들 (내부 scratch 버퍼 재사용)
+    SimplePitchShifter pitchShifter_;
+    SimpleTimeStretcher timeStretcher_;
+    VoiceFilter voiceFilter_;
+
+    /**
+     * 실행 계획 수립
+     */
+    void plan();
+
+    /**
+     * 실행 계획의 스테이지들을 순서대로 실행
+     * @return 결과가 들어있는 버퍼 인덱스
+     */
+    int runStages(const float* input, int length, int sampleRate, PerformanceChecker* perfChecker);
+
+    /**
+     * 역재생 + gain 융합 (in-place, 한 번의 패스)
+     */
+    void reverseWithGain(std::vector<float>& data, float gain);
+};
+
+#endif // EFFECT_CHAIN_H
@@ -0,0 +1,259 @@
+/**
+ * ProcessingSession.cpp
+ *
+ * 호출 간에 유지되는 처리 세션
+ *
+ * 기존 JS 흐름 (호출마다):
+ *   _malloc(입력) -> HEAPF32.set -> applyX (입력 복사 -> AudioBuffer -> 결과 AudioBuffer)
+ *   -> typed_memory_view(지역 버퍼, 함수 종료 시 해제됨) -> slice() -> _free
+ *
+ * ProcessingSession:
+ *   reserveInput()으로 받은 포인터에 직접 쓰고, 처리 후 getOutputPointer() 위치를 직접 읽음
+ *   - 입력은 세션 arena를 그대로 처리기에 전달 (추가 복사 없음)
+ *   - 출력 arena / 처리기 내부 버퍼는 용량을 유지하여 반복 호출 시 재할당 없음
+ */
+
+#include "ProcessingSession.h"
+#include <SoundTouch.h>
+#include <algorithm>
+#include <iostream>
+
+ProcessingSession::ProcessingSession()
+    : sampleRate_(44100), channels_(1), perfChecker_(nullptr), inputLength_(0),
+      resultData_(nullptr), resultLength_(0) {
+}
+
+void ProcessingSession::setSampleRate(int sampleRate) {
+    if (sampleRate <= 0) {
+        std::cerr << "[ProcessingSession] 잘못된 샘플레이트: " << sampleRate << std::endl;
+        return;
+    }
+    sampleRate_ = sampleRate;
+}
+
+int ProcessingSession::getSampleRate() const {
+    return sampleRate_;
+}
+
+void ProcessingSession::setChannels(int channels) {
+    if (channels <= 0) {
+        std::cerr << "[ProcessingSession] 잘못된 채널 수: " << channels << std::endl;
+        return;
+    }
+    channels_ = channels;
+}
+
+int ProcessingSession::getChannels() const {
+    return channels_;
+}
+
+uintptr_t ProcessingSession::reserveInput(int length) {
+    length = std::max(0, length);
+    if ((int)input_.size() < length) {
+        input_.resize(length);
+    }
+    inputLength_ = length;
+    return reinterpret_cast<uintptr_t>(input_.data());
+}
+
+uintptr_t ProcessingSession::getInputPointer() const {
+    return reinterpret_cast<uintptr_t>(input_.data());
+}
+
+int ProcessingSession::getInputLength() const {
+    return inputLength_;
+}
+
+int ProcessingSession::getInputCapacity() const {
+    return (int)input_.size();
+}
+
+void ProcessingSession::setInputLength(int length) {
+    inputLength_ = std::max(0, std::min(length, (int)input_.size()));
+}
+
+uintptr_t ProcessingSession::getOutputPointer() const {
+    return reinterpret_cast<uintptr_t>(resultData_);
+}
+
+int ProcessingSession::getOutputLength() const {
+    return resultLength_;
+}
+
+void ProcessingSession::commitOutput() {
+    // 결과가 없으면 (이미 commit했거나 처리 실패) 입력을 그대로 둠
+    if (resultLength_ == 0) {
+        return;
+    }
+
+    if (resultData_ == output_.data()) {
+        // 출력 arena와 입력 arena 교체 (복사 없음, 두 arena 모두 용량 유지)
+        std::swap(input_, output_);
+        inputLength_ = resultLength_;
+    } else {
+        // 체인 결과 버퍼 -> 입력 arena
+        if ((int)input_.size() < resultLength_) {
+            input_.resize(resultLength_);
+        }
+        std::copy(resultData_, resultData_ + resultLength_, input_.begin());
+        inputLength_ = resultLength_;
+    }
+    clearResult();
+}
+
+void ProcessingSession::setPerformanceChecker(PerformanceChecker* perfChecker) {
+    perfChecker_ = perfChecker;
+}
+
+void ProcessingSession::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    pitchShifter_.setSearchPolicy(policy);
+    timeStretcher_.setSearchPolicy(policy);
+    chain_.setSearchPolicy(policy);
+}
+
+OverlapSearchPolicy ProcessingSession::getSearchPolicy() const {
+    return timeStretcher_.getSearchPolicy();
+}
+
+void ProcessingSession::setCrossfadeShape(CrossfadeShape shape) {
+    pitchShifter_.setCrossfadeShape(shape);
+    timeStretcher_.setCrossfadeShape(shape);
+    chain_.setCrossfadeShape(shape);
+}
+
+CrossfadeShape ProcessingSession::getCrossfadeShape() const {
+    return timeStretcher_.getCrossfadeShape();
+}
+
+void ProcessingSession::setResultFromOutput() {
+    resultData_ = output_.data();
+    resultLength_ = (int)output_.size();
+}
+
+void ProcessingSession::clearResult() {
+    output_.clear();
+    resultData_ = output_.data();
+    resultLength_ = 0;
+}
+
+bool ProcessingSession::pitchShift(float semitones, const std::string& algorithm) {
+    if (algorithm == "soundtouch") {
+        processSoundTouch(semitones, 1.0f);
+    } else {
+        pitchShifter_.setResamplerQuality(SimplePitchShifter::qualityFromAlgorithm(algorithm));
+        pitchShifter_.processWithTempoInterleaved(input_.data(), inputLength_ / channels_, channels_,
+                                                  sampleRate_, semitones, 1.0f, output_, 1.0f, perfChecker_);
+    }
+    setResultFromOutput();
+    return true;
+}
+
+bool ProcessingSession::timeStretch(float ratio, const std::string& algorithm) {
+    if (ratio <= 0.0f) {
+        std::cerr << "[ProcessingSession] 잘못된 속도 비율: " << ratio << std::endl;
+        clearResult();
+        return false;
+    }
+
+    if (algorithm == "soundtouch") {
+        processSoundTouch(0.0f, ratio);
+    } else {
+        timeStretcher_.processInterleaved(input_.data(), inputLength_ / channels_, channels_,
+                                          sampleRate_, ratio, output_, perfChecker_);
+    }
+    setResultFromOutput();
+    return true;
+}
+
+bool ProcessingSession::pitchTempo(float semitones, float tempo, const std::string& algorithm) {
+    if (tempo <= 0.0f) {
+        std::cerr << "[ProcessingSession] 잘못된 속도 비율: " << tempo << std::endl;
+        clearResult();
+        return false;
+    }
+
+    if (algorithm == "soundtouch") {
+        processSoundTouch(semitones, tempo);
+    } else {
+        pitchShifter_.setResamplerQuality(SimplePitchShifter::qualityFromAlgorithm(algorithm));
+        pitchShifter_.processWithTempoInterleaved(input_.data(), inputLength_ / channels_, channels_,
+                                                  sampleRate_, semitones, tempo, output_, 1.0f, perfChecker_);
+    }
+    setResultFromOutput();
+    return true;
+}
+
+bool ProcessingSession::applyFilter(int filterType, float param1, float param2) {
+    if (filterType < 0 || filterType > static_cast<int>(FilterType::VOICE_CHANGER_FEMALE_TO_MALE)) {
+        std::cerr << "[ProcessingSession] 알 수 없는 필터 타입: " << filterType << std::endl;
+        clearResult();
+        return false;
+    }
+
+    output_.assign(input_.begin(), input_.begin() + inputLength_);
+    voiceFilter_.applyFilterInterleaved(output_, channels_, sampleRate_, static_cast<FilterType>(filterType),
+                                        param1, param2);
+    setResultFromOutput();
+    return true;
+}
+
+bool ProcessingSession::reverse() {
+    // reverse iterator로 출력 arena에 직접 복사 (1회 복사)
+    output_.resize(inputLength_);
+    if (channels_ == 1) {
+        std::reverse_copy(input_.begin(), input_.begin() + inputLength_, output_.begin());
+    } else {
+        // 다채널: 프레임 순서만 뒤집음 (프레임 안의 채널 순서는 유지)
+        const int frames = inputLength_ / channels_;
+        output_.resize((size_t)frames * channels_);
+        for (int i = 0; i < frames; ++i) {
+            std::copy(input_.begin() + (size_t)(frames - 1 - i) * channels_,
+                      input_.begin() + (size_t)(frames - i) * channels_,
+                      output_.begin() + (size_t)i * channels_);
+        }
+    }
+    setResultFromOutput();
+    return true;
+}
+
+bool ProcessingSession::applyChain(const std::string& spec) {
+    if (channels_ != 1) {
+        std::cerr << "[ProcessingSession] 효과 체인은 모노만 지원: 채널 " << channels_ << std::endl;
+        clearResult();
+        return false;
+    }
+    if (!chain_.parse(spec)) {
+        clearResult();
+        return false;
+    }
+
+    // 체인의 ping-pong 버퍼를 그대로 출력으로 노출 (다음 처리 전까지 유효)
+    const std::vector<float>& result = chain_.process(input_.data(), inputLength_, sampleRate_, perfChecker_);
+    resultData_ = result.data();
+    resultLength_ = (int)result.size();
+    return true;
+}
+
+void ProcessingSession::processSoundTouch(float semitones, float tempo) {
+    soundtouch::SoundTouch st;
+    st.setSampleRate(sampleRate_);
+    st.setChannels(channels_);
+    st.setPitchSemiTones(semitones);
+    st.setTempo(tempo);
+    st.setSetting(SETTING_USE_AA_FILTER, 1);
+    st.setSetting(SETTING_AA_FILTER_LENGTH, 64);
+    st.setSetting(SETTING_SEQUENCE_MS, 40);
+    st.setSetting(SETTING_SEEKWINDOW_MS, 15);
+    st.setSetting(SETTING_OVERLAP_MS, 8);
+
+    // SoundTouch는 프레임 단위 (interleaved 다채널 그대로 전달)
+    const int frames = inputLength_ / channels_;
+    st.putSamples(input_.data(), frames);
+    st.flush();
+
+    // 출력 arena에 직접 수신 (예상 출력 크기 + 여유 공간)
+    size_t expectedFrames = static_cast<size_t>(frames / tempo) + 8192;
+    output_.resize(expectedFrames * channels_);
+    int received = st.receiveSamples(output_.data(), (unsigned int)expectedFrames);
+    output_.resize((size_t)received * channels_);
+}
@@ -0,0 +1,129 @@
+/**
+ * ProcessingSession.h
+ *
+ * 호출 간에 유지되는 처리 세션
+ * - 입력 / 출력 arena를 세션이 소유 (WASM 힙, 필요할 때만 커짐)
+ * - JS는 입력 arena에 직접 쓰고, 출력 arena를 직접 읽음 (_malloc / _free / slice 불필요)
+ * - DSP 객체(pitch shifter, time stretcher, filter, effect chain)를 세션에 유지하여
+ *   내부 scratch 버퍼와 테이블을 재사용
+ *
+ * 포인터 유효 기간:
+ * - 입력 포인터: 다음 reserveInput() / commitOutput() 전까지
+ * - 출력 포인터: 다음 처리 호출 전까지
+ * (WASM 메모리가 커지면 JS의 HEAPF32 view가 새로 만들어지므로 view는 매번 다시 얻어야 함)
+ */
+
+#ifndef PROCESSING_SESSION_H
+#define PROCESSING_SESSION_H
+
+#include "../performance/PerformanceChecker.h"
+#include "../dsp/SimplePitchShifter.h"
+#include "../dsp/SimpleTimeStretcher.h"
+#include "EffectChain.h"
+#include "VoiceFilter.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ProcessingSession {
+public:
+    ProcessingSession();
+
+    void setSampleRate(int sampleRate);
+    int getSampleRate() const;
+
+    /**
+     * 채널 수 (기본 1)
+     * 2 이상이면 입력 / 출력 arena는 interleaved (L R L R ...), 길이는 전체 샘플 수
+     * 효과 체인(applyChain)은 모노만 지원
+     */
+    void setChannels(int channels);
+    int getChannels() const;
+
+    /**
+     * 입력 arena 확보 (용량이 부족할 때만 재할당)
+     * @param length 입력 샘플 수 (입력 길이로 설정됨)
+     * @return 입력 arena 포인터 (JS: HEAPF32.set(data, ptr >> 2))
+     */
+    uintptr_t reserveInput(int length);
+    uintptr_t getInputPointer() const;
+    int getInputLength() const;
+    int getInputCapacity() const;
+
+    /**
+     * 입력 길이만 변경 (용량 이내, 넘으면 용량으로 제한)
+     */
+    void setInputLength(int length);
+
+    /**
+     * 출력 (마지막 처리 결과)
+     * @return 출력 포인터 (다음 처리 호출 전까지 유효)
+     */
+    uintptr_t getOutputPointer() const;
+    int getOutputLength() const;
+
+    /**
+     * 출력을 입력 arena로 옮김 (편집을 이어서 적용할 때 JS 왕복 없이)
+     * 입력 포인터가 바뀔 수 있음
+     * 결과가 없으면 (이미 commit했거나 처리 실패) 아무것도 하지 않음
+     */
+    void commitOutput();
+
+    /**
+     * 처리 함수들 (입력 arena -> 출력)
+     * @return 성공 여부 (실패 시 출력은 비어 있음)
+     */
+    bool pitchShift(float semitones, const std::string& algorithm);
+    bool timeStretch(float ratio, const std::string& algorithm);
+    bool pitchTempo(float semitones, float tempo, const std::string& algorithm);
+    bool applyFilter(int filterType, float param1, float param2);
+    bool reverse();
+    bool applyChain(const std::string& spec);
+
+    /**
+     * 성능 측정 (nullptr = 측정 안 함, 세션은 소유하지 않음)
+     */
+    void setPerformanceChecker(PerformanceChecker* perfChecker);
+
+    /**
+     * pitch / tempo 처리의 겹침 위치 탐색 정책 (효과 체인 포함, SimpleTimeStretcher::setSearchPolicy)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    OverlapSearchPolicy getSearchPolicy() const;
+
+    /**
+     * pitch / tempo 처리의 크로스페이드 모양 (효과 체인 포함)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+private:
+    int sampleRate_;
+    int channels_;
+    PerformanceChecker* perfChecker_;
+
+    // arena (호출 간 유지, 용량은 줄이지 않음)
+    std::vector<float> input_;
+    int inputLength_;
+    std::vector<float> output_;
+
+    // 마지막 결과 (output_ 또는 chain_의 결과 버퍼를 가리킴)
+    const float* resultData_;
+    int resultLength_;
+
+    // 처리기들 (호출 간 유지)
+    SimplePitchShifter pitchShifter_;
+    SimpleTimeStretcher timeStretcher_;
+    VoiceFilter voiceFilter_;
+    EffectChain chain_;
+
+    /**
+     * SoundTouch로 처리 (비교용, 기존 applyUniform* 함수와 같은 설정)
+     */
+    void processSoundTouch(float semitones, float tempo);
+
+    void setResultFromOutput();
+    void clearResult();
+};
+
+#endif // PROCESSING_SESSION_H
@@ -0,0 +1,342 @@
+/**
+ * RealtimeProcessor.cpp
+ *
+ * render 한 번의 흐름:
+ *   입력 버퍼 -> StreamingChain::process -> 출력 FIFO에 추가 -> FIFO에서 frames개 꺼내 출력 버퍼
+ *
+ * 지연 측정 (warmUp):
+ * - 스테이지가 출력을 몰아서 내보내므로, 처리 중인 샘플 수(입력 누적 - 출력 누적)가 주기적으로 변함
+ * - 준비 구간에서 그 최댓값을 재고, 현재 값과의 차이만큼 FIFO에 0을 채워 두면
+ *   이후 같은 크기의 quantum에서는 FIFO가 비지 않음 (스테이지 출력 시점은 입력 내용과 무관하고 개수로만 정해짐)
+ */
+
+#include "RealtimeProcessor.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/emscripten.h>
+#define REALTIME_EXPORT EMSCRIPTEN_KEEPALIVE
+#else
+#define REALTIME_EXPORT
+#endif
+
+namespace {
+
+// 준비 처리 길이 (스테이지 내부 버퍼 확보 + 지연 측정, 각각)
+const int WARMUP_MS = 500;
+
+size_t nextPowerOfTwo(size_t value) {
+    size_t size = 1;
+    while (size < value) {
+        size <<= 1;
+    }
+    return size;
+}
+
+} // namespace
+
+RealtimeProcessor::RealtimeProcessor()
+    : ready_(false), sampleRate_(44100), channels_(1), maxFrames_(QUANTUM_FRAMES),
+      latency_(0), dropouts_(0), fifoMask_(0), fifoRead_(0), fifoSize_(0) {
+}
+
+bool RealtimeProcessor::setup(int sampleRate, int channels, int maxFrames) {
+    if (sampleRate <= 0 || channels < 1 || channels > MAX_CHANNELS || maxFrames <= 0) {
+        std::cerr << "[RealtimeProcessor] 잘못된 설정: " << sampleRate << " Hz, "
+                  << channels << "채널, " << maxFrames << " 프레임" << std::endl;
+        return false;
+    }
+
+    sampleRate_ = sampleRate;
+    channels_ = channels;
+    maxFrames_ = maxFrames;
+
+    inputs_.assign(channels_, std::vector<float>(maxFrames_, 0.0f));
+    outputs_.assign(channels_, std::vector<float>(maxFrames_, 0.0f));
+    inputPointers_.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        inputPointers_[c] = inputs_[c].data();
+    }
+    chainOutput_.resize(channels_);
+    fifo_.resize(channels_);
+
+    // 스테이지 없음 (passthrough)
+    ready_ = configure("");
+    return ready_;
+}
+
+bool RealtimeProcessor::configure(const std::string& spec) {
+    if (inputs_.empty()) {
+        std::cerr << "[RealtimeProcessor] setup이 필요함" << std::endl;
+        return false;
+    }
+
+    if (!chain_.parse(spec)) {
+        return false;
+    }
+    for (const EffectStage& stage : chain_.getPlannedStages()) {
+        float tempo = stage.type == EffectStageType::TEMPO ? stage.param1
+                    : stage.type == EffectStageType::PITCH_TEMPO ? stage.param2 : 1.0f;
+        if (stage.type == EffectStageType::REVERSE || tempo != 1.0f) {
+            std::cerr << "[RealtimeProcessor] 실시간 처리는 입력과 출력 길이가 같아야 함 "
+                      << "(tempo / reverse 사용 불가): '" << spec << "'" << std::endl;
+            // 파싱 성공한 목록으로 바뀌었으므로 이전 목록으로 되돌림
+            chain_.parse(spec_);
+            return false;
+        }
+    }
+    spec_ = spec;
+
+    chain_.begin(sampleRate_, channels_);
+    int fill = warmUp();
+
+    std::cout << "[RealtimeProcessor] 설정: '" << spec << "' - 지연 " << latency_ << " 샘플 ("
+              << (latency_ * 1000.0 / sampleRate_) << " ms)" << std::endl;
+
+    resetFifo(fill);
+    dropouts_ = 0;
+    return true;
+}
+
+bool RealtimeProcessor::setProfile(StretchProfile profile) {
+    chain_.setStretchProfile(profile);
+    return configure(spec_);
+}
+
+StretchProfile RealtimeProcessor::getProfile() const {
+    return chain_.getStretchProfile();
+}
+
+void RealtimeProcessor::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    chain_.setSearchPolicy(policy);
+}
+
+const OverlapSearchPolicy& RealtimeProcessor::getSearchPolicy() const {
+    return chain_.getSearchPolicy();
+}
+
+void RealtimeProcessor::setCrossfadeShape(CrossfadeShape shape) {
+    chain_.setCrossfadeShape(shape);
+}
+
+CrossfadeShape RealtimeProcessor::getCrossfadeShape() const {
+    return chain_.getCrossfadeShape();
+}
+
+int RealtimeProcessor::warmUp() {
+    for (auto& plane : inputs_) {
+        std::fill(plane.begin(), plane.end(), 0.0f);
+    }
+
+    const int quanta = std::max(8, (int)((long long)sampleRate_ * WARMUP_MS / 1000 / maxFrames_));
+    long long inFlight = 0;      // 입력 누적 - 출력 누적
+    long long maxInFlight = 0;
+    size_t maxOutput = 0;
+
+    // 1회차: 스테이지가 안정 상태에 도달 (내부 버퍼 확보)
+    // 2회차: 안정 상태에서 처리 중인 샘플 수의 최댓값 측정
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int q = 0; q < quanta; ++q) {
+            for (auto& plane : chainOutput_) {
+                plane.clear();
+            }
+            chain_.process(inputPointers_.data(), maxFrames_, chainOutput_);
+            inFlight += maxFrames_ - (long long)chainOutput_[0].size();
+            maxOutput = std::max(maxOutput, chainOutput_[0].size());
+            if (pass == 1) {
+                maxInFlight = std::max(maxInFlight, inFlight);
+            }
+        }
+    }
+
+    // 지연이 있는 스테이지면 quantum 하나 여유 (WSOLA 입력 간격의 소수점 누적으로 생기는 작은 차이)
+    const int margin = maxInFlight > 0 ? maxFrames_ : 0;
+    const int fill = (int)std::max(0LL, maxInFlight - inFlight) + margin;
+    latency_ = (int)std::max(0LL, inFlight) + fill;
+
+    // FIFO 최대 점유량: 지연 + quantum (push 후 pop 전)
+    const size_t capacity = nextPowerOfTwo((size_t)latency_ + (size_t)maxFrames_ * 2);
+    for (int c = 0; c < channels_; ++c) {
+        fifo_[c].assign(capacity, 0.0f);
+        chainOutput_[c].clear();
+        chainOutput_[c].reserve(std::max(capacity, maxOutput));
+    }
+    fifoMask_ = capacity - 1;
+    return fill;
+}
+
+void RealtimeProcessor::resetFifo(int latency) {
+    for (auto& ring : fifo_) {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+    }
+    fifoRead_ = 0;
+    fifoSize_ = (size_t)latency;   // 앞부분 latency개는 0 (지연)
+}
+
+float* RealtimeProcessor::getInputBuffer(int channel) {
+    if (channel < 0 || channel >= (int)inputs_.size()) {
+        return nullptr;
+    }
+    return inputs_[channel].data();
+}
+
+float* RealtimeProcessor::getOutputBuffer(int channel) {
+    if (channel < 0 || channel >= (int)outputs_.size()) {
+        return nullptr;
+    }
+    return outputs_[channel].data();
+}
+
+void RealtimeProcessor::render(int frames) {
+    if (!ready_) {
+        return;
+    }
+    frames = std::max(0, std::min(frames, maxFrames_));
+
+    for (auto& plane : chainOutput_) {
+        plane.clear();
+    }
+    chain_.process(inputPointers_.data(), frames, chainOutput_);
+    pushFifo();
+    popFifo(frames);
+}
+
+void RealtimeProcessor::pushFifo() {
+    const size_t count = chainOutput_[0].size();
+    const size_t capacity = fifoMask_ + 1;
+    size_t writable = std::min(count, capacity - fifoSize_);
+    if (writable < count) {
+        dropouts_++;   // 넘침: 뒤쪽 샘플 버림
+    }
+
+    const size_t writePos = (fifoRead_ + fifoSize_) & fifoMask_;
+    const size_t first = std::min(writable, capacity - writePos);
+    for (int c = 0; c < channels_; ++c) {
+        const float* source = chainOutput_[c].data();
+        float* ring = fifo_[c].data();
+        std::copy(source, source + first, ring + writePos);
+        std::copy(source + first, source + writable, ring);
+    }
+    fifoSize_ += writable;
+}
+
+void RealtimeProcessor::popFifo(int frames) {
+    const size_t count = (size_t)frames;
+    size_t readable = std::min(count, fifoSize_);
+    if (readable < count) {
+        dropouts_++;   // 부족: 나머지는 0
+    }
+
+    const size_t capacity = fifoMask_ + 1;
+    const size_t first = std::min(readable, capacity - fifoRead_);
+    for (int c = 0; c < channels_; ++c) {
+        const float* ring = fifo_[c].data();
+        float* output = outputs_[c].data();
+        std::copy(ring + fifoRead_, ring + fifoRead_ + first, output);
+        std::copy(ring, ring + (readable - first), output + first);
+        std::fill(output + readable, output + count, 0.0f);
+    }
+    fifoRead_ = (fifoRead_ + readable) & fifoMask_;
+    fifoSize_ -= readable;
+}
+
+int RealtimeProcessor::getLatency() const {
+    return latency_;
+}
+
+int RealtimeProcessor::getDropouts() const {
+    return dropouts_;
+}
+
+int RealtimeProcessor::getSampleRate() const {
+    return sampleRate_;
+}
+
+int RealtimeProcessor::getChannels() const {
+    return channels_;
+}
+
+int RealtimeProcessor::getMaxFrames() const {
+    return maxFrames_;
+}
+
+// ============================================================================
+// plain C 인터페이스
+// ============================================================================
+
+extern "C" {
+
+REALTIME_EXPORT RealtimeProcessor* realtime_create(int sampleRate, int channels, int maxFrames) {
+    RealtimeProcessor* processor = new RealtimeProcessor();
+    if (!processor->setup(sampleRate, channels, maxFrames)) {
+        delete processor;
+        return nullptr;
+    }
+    return processor;
+}
+
+REALTIME_EXPORT void realtime_destroy(RealtimeProcessor* processor) {
+    delete processor;
+}
+
+REALTIME_EXPORT int realtime_configure(RealtimeProcessor* processor, const char* spec) {
+    if (!processor || !spec) {
+        return 0;
+    }
+    return processor->configure(spec) ? 1 : 0;
+}
+
+REALTIME_EXPORT int realtime_set_profile(RealtimeProcessor* processor, int profile) {
+    if (!processor || profile < 0 || profile > static_cast<int>(StretchProfile::LOW_LATENCY)) {
+        return 0;
+    }
+    return processor->setProfile(static_cast<StretchProfile>(profile)) ? 1 : 0;
+}
+
+REALTIME_EXPORT int realtime_set_search_policy(RealtimeProcessor* processor, float goodEnoughThreshold,
+                                               int coarseStep, int maxCandidates, float blockBudgetMs) {
+    if (!processor || coarseStep < 1 || maxCandidates < 0 || blockBudgetMs < 0.0f) {
+        return 0;
+    }
+    OverlapSearchPolicy policy;
+    policy.goodEnoughThreshold = goodEnoughThreshold;
+    policy.coarseStep = coarseStep;
+    policy.maxCandidates = maxCandidates;
+    policy.blockBudgetMs = blockBudgetMs;
+    processor->setSearchPolicy(policy);
+    return 1;
+}
+
+REALTIME_EXPORT int realtime_set_crossfade(RealtimeProcessor* processor, int shape) {
+    if (!processor || shape < 0 || shape > static_cast<int>(CrossfadeShape::HANN)) {
+        return 0;
+    }
+    processor->setCrossfadeShape(static_cast<CrossfadeShape>(shape));
+    return 1;
+}
+
+REALTIME_EXPORT float* realtime_input(RealtimeProcessor* processor, int channel) {
+    return processor ? processor->getInputBuffer(channel) : nullptr;
+}
+
+REALTIME_EXPORT float* realtime_output(RealtimeProcessor* processor, int channel) {
+    return processor ? processor->getOutputBuffer(channel) : nullptr;
+}
+
+REALTIME_EXPORT void realtime_render(RealtimeProcessor* processor, int frames) {
+    if (processor) {
+        processor->render(frames);
+    }
+}
+
+REALTIME_EXPORT int realtime_latency(RealtimeProcessor* processor) {
+    return processor ? processor->getLatency() : 0;
+}
+
+REALTIME_EXPORT int realtime_dropouts(RealtimeProcessor* processor) {
+    return processor ? processor->getDropouts() : 0;
+}
+
+} // extern "C"
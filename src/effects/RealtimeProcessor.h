@@ -0,0 +1,150 @@
+/**
+ * RealtimeProcessor.h
+ *
+ * 실시간 처리기 (AudioWorklet의 render quantum 단위 처리)
+ * - 마이크 입력을 녹음 없이 바로 변조 (record-then-process 대신 live voice changing)
+ * - 입력 / 출력 버퍼를 setup에서 미리 할당하고, JS는 그 포인터(HEAPF32 오프셋)에 직접 읽고 씀
+ * - render 경로: 메모리 할당 없음, 잠금 없음, embind 없음 (plain C 함수 realtime_render)
+ *   (스테이지 내부 버퍼는 configure의 준비 처리(무음)에서 필요한 크기까지 미리 늘려 둠)
+ *
+ * 스테이지는 StreamingChain (pitch / filter / gain / rate)
+ * - 입력과 출력 속도가 같아야 하므로 tempo != 1 과 reverse는 거부
+ * - WSOLA / SoundTouch는 출력을 세그먼트 단위로 몰아서 내보내므로 출력 FIFO에
+ *   지연(latency)만큼 미리 0을 채워 두고 매 quantum마다 같은 양을 꺼냄
+ *
+ * 지연: 기본 프로파일은 WSOLA 탐색 범위 때문에 pitch 스테이지에서 약 58 ms,
+ * 저지연 프로파일(StretchProfile::LOW_LATENCY)은 약 13 ms (44.1 kHz, quantum 128, pitch:12 기준)
+ * 실제 값은 configure가 측정해 getLatency / realtime_latency로 알려줌 (UI 표시 / 지연 보정용)
+ *
+ * 사용 순서 (AudioWorkletProcessor):
+ *   realtime_create(sampleRate, channels, 128)
+ *   realtime_configure(handle, "pitch:4;filter:4,0.4,0.5")      (할당 있음, render 사이에서만)
+ *   process(): 입력 복사 -> realtime_render(handle, 128) -> 출력 복사
+ */
+
+#ifndef REALTIME_PROCESSOR_H
+#define REALTIME_PROCESSOR_H
+
+#include "StreamingChain.h"
+#include <string>
+#include <vector>
+
+class RealtimeProcessor {
+public:
+    static const int QUANTUM_FRAMES = 128;   // Web Audio render quantum
+    static const int MAX_CHANNELS = 2;
+
+    RealtimeProcessor();
+
+    /**
+     * 입출력 버퍼 할당 (스테이지는 passthrough로 초기화)
+     * @param maxFrames render 한 번의 최대 프레임 수
+     * @return 성공 여부
+     */
+    bool setup(int sampleRate, int channels, int maxFrames = QUANTUM_FRAMES);
+
+    /**
+     * 스테이지 목록 설정 (EffectChain::parse와 같은 형식)
+     * 스테이지 생성 + 준비 처리 + 지연 측정 (메모리 할당이 있으므로 render 사이에서만 호출)
+     * @return 성공 여부 (tempo != 1 / reverse가 있으면 실패, 기존 스테이지 유지)
+     */
+    bool configure(const std::string& spec);
+
+    /**
+     * pitch 스테이지의 WSOLA 프로파일 (현재 스테이지 목록으로 다시 configure)
+     * @return 성공 여부
+     */
+    bool setProfile(StretchProfile profile);
+    StretchProfile getProfile() const;
+
+    /**
+     * pitch 스테이지의 겹침 위치 탐색 정책 (바로 적용, 할당 없음)
+     * blockBudgetMs: quantum 하나에서 스테이지별 WSOLA 탐색에 쓸 시간 상한
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * pitch 스테이지의 크로스페이드 모양 (바로 적용, 할당 없음)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 채널별 입력 / 출력 버퍼 (maxFrames개, setup 이후 주소 고정)
+     */
+    float* getInputBuffer(int channel);
+    float* getOutputBuffer(int channel);
+
+    /**
+     * quantum 하나 처리: 입력 버퍼 frames개 -> 출력 버퍼 frames개
+     * 할당 / 잠금 없음
+     */
+    void render(int frames);
+
+    /**
+     * 입력 -> 출력 지연 (샘플 수)
+     */
+    int getLatency() const;
+
+    /**
+     * 출력 FIFO가 비거나 넘친 횟수 (정상이면 0)
+     */
+    int getDropouts() const;
+
+    int getSampleRate() const;
+    int getChannels() const;
+    int getMaxFrames() const;
+
+private:
+    StreamingChain chain_;
+    std::string spec_;           // 현재 스테이지 목록 (거부된 목록을 되돌릴 때 사용)
+    bool ready_;
+    int sampleRate_;
+    int channels_;
+    int maxFrames_;
+    int latency_;
+    int dropouts_;
+
+    std::vector<std::vector<float>> inputs_;
+    std::vector<std::vector<float>> outputs_;
+    std::vector<const float*> inputPointers_;
+    std::vector<std::vector<float>> chainOutput_;   // 스테이지 출력 (호출 간 재사용)
+
+    // 출력 FIFO (채널별 원형 버퍼, 크기는 2의 거듭제곱)
+    std::vector<std::vector<float>> fifo_;
+    size_t fifoMask_;
+    size_t fifoRead_;
+    size_t fifoSize_;
+
+    /**
+     * 무음으로 스테이지를 돌려 내부 버퍼를 키우고, 처리 중 쌓이는 최대 샘플 수를 측정
+     * @return FIFO에 미리 채울 0의 개수 (출력이 끊기지 않기 위한 여유)
+     */
+    int warmUp();
+
+    void resetFifo(int latency);
+    void pushFifo();
+    void popFifo(int frames);
+};
+
+/**
+ * AudioWorklet용 plain C 인터페이스 (WASM export, embind 없음)
+ * handle은 RealtimeProcessor 포인터, 버퍼 포인터는 JS에서 HEAPF32[ptr >> 2]로 접근
+ */
+extern "C" {
+RealtimeProcessor* realtime_create(int sampleRate, int channels, int maxFrames);
+void realtime_destroy(RealtimeProcessor* processor);
+int realtime_configure(RealtimeProcessor* processor, const char* spec);
+int realtime_set_profile(RealtimeProcessor* processor, int profile);   // 0 = DEFAULT, 1 = LOW_LATENCY
+int realtime_set_search_policy(RealtimeProcessor* processor, float goodEnoughThreshold, int coarseStep,
+                               int maxCandidates, float blockBudgetMs);
+int realtime_set_crossfade(RealtimeProcessor* processor, int shape);   // 0 = LINEAR, 1 = EQUAL_POWER, 2 = HANN
+float* realtime_input(RealtimeProcessor* processor, int channel);
+float* realtime_output(RealtimeProcessor* processor, int channel);
+void realtime_render(RealtimeProcessor* processor, int frames);
+int realtime_latency(RealtimeProcessor* processor);
+int realtime_dropouts(RealtimeProcessor* processor);
+}
+
+#endif // REALTIME_PROCESSOR_H
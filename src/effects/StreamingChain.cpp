@@ -0,0 +1,261 @@
+/**
+ * StreamingChain.cpp
+ *
+ * 블록 하나의 흐름:
+ *   입력 -> (rate 다운 변환) -> 스테이지 1 -> ... -> 스테이지 N -> (rate 업 변환) -> 출력 뒤에 추가
+ *
+ * 스테이지 출력 버퍼와 블록 버퍼를 swap으로 돌려 쓰므로 호출마다 새로 할당하지 않음
+ */
+
+#include "StreamingChain.h"
+#include "../audio/SampleOps.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+size_t planesBytes(const std::vector<std::vector<float>>& planes) {
+    size_t bytes = 0;
+    for (const auto& plane : planes) {
+        bytes += plane.capacity() * sizeof(float);
+    }
+    return bytes;
+}
+
+} // namespace
+
+StreamingChain::StreamingChain()
+    : stretchProfile_(StretchProfile::DEFAULT), crossfadeShape_(CrossfadeShape::LINEAR), sampleRate_(44100), channels_(1), processingRate_(0) {
+}
+
+StreamingChain::~StreamingChain() {
+}
+
+bool StreamingChain::parse(const std::string& spec) {
+    std::vector<EffectStage> previousStages = chain_.getStages();
+    int previousRate = chain_.getProcessingRate();
+
+    if (!chain_.parse(spec)) {
+        return false;
+    }
+
+    for (const EffectStage& stage : chain_.getPlannedStages()) {
+        if (stage.type == EffectStageType::REVERSE) {
+            std::cerr << "[StreamingChain] reverse는 스트리밍 처리할 수 없음 (입력 끝까지 필요)" << std::endl;
+            chain_.setStages(previousStages);
+            chain_.setProcessingRate(previousRate);
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<EffectStage> StreamingChain::getPlannedStages() const {
+    return chain_.getPlannedStages();
+}
+
+void StreamingChain::setStretchProfile(StretchProfile profile) {
+    stretchProfile_ = profile;
+}
+
+StretchProfile StreamingChain::getStretchProfile() const {
+    return stretchProfile_;
+}
+
+void StreamingChain::setSearchPolicy(const OverlapSearchPolicy& policy) {
+    searchPolicy_ = policy;
+    for (Stage& stage : stages_) {
+        if (stage.shifter) {
+            stage.shifter->setSearchPolicy(policy);
+        }
+    }
+}
+
+const OverlapSearchPolicy& StreamingChain::getSearchPolicy() const {
+    return searchPolicy_;
+}
+
+void StreamingChain::setCrossfadeShape(CrossfadeShape shape) {
+    crossfadeShape_ = shape;
+    for (Stage& stage : stages_) {
+        if (stage.shifter) {
+            stage.shifter->setCrossfadeShape(shape);
+        }
+    }
+}
+
+CrossfadeShape StreamingChain::getCrossfadeShape() const {
+    return crossfadeShape_;
+}
+
+void StreamingChain::begin(int sampleRate, int channels) {
+    sampleRate_ = sampleRate;
+    channels_ = std::max(1, channels);
+
+    // 내부 처리 샘플레이트 (EffectChain::process와 같은 조건)
+    int rate = chain_.getProcessingRate();
+    bool useProcessingRate = rate > 0 && rate < sampleRate && !chain_.getPlannedStages().empty();
+    processingRate_ = useProcessingRate ? rate : 0;
+    downConverters_.clear();
+    upConverters_.clear();
+    if (useProcessingRate) {
+        downConverters_.resize(channels_);
+        upConverters_.resize(channels_);
+        for (int c = 0; c < channels_; ++c) {
+            downConverters_[c].setRates(sampleRate, rate);
+            upConverters_[c].setRates(rate, sampleRate);
+        }
+    }
+    const int stageRate = useProcessingRate ? rate : sampleRate;
+
+    stages_.clear();
+    for (const EffectStage& config : chain_.getPlannedStages()) {
+        Stage stage;
+        stage.config = config;
+        switch (config.type) {
+            case EffectStageType::PITCH:
+            case EffectStageType::TEMPO:
+            case EffectStageType::PITCH_TEMPO: {
+                float semitones = config.type == EffectStageType::TEMPO ? 0.0f : config.param1;
+                float tempo = config.type == EffectStageType::PITCH ? 1.0f
+                            : config.type == EffectStageType::TEMPO ? config.param1 : config.param2;
+                stage.shifter.reset(new StreamingPitchShifter());
+                stage.shifter->setProfile(stretchProfile_);
+                stage.shifter->setSearchPolicy(searchPolicy_);
+                stage.shifter->setCrossfadeShape(crossfadeShape_);
+                if (config.type != EffectStageType::TEMPO) {
+                    stage.shifter->setResamplerQuality(static_cast<ResamplerQuality>(static_cast<int>(config.param3)));
+                }
+                stage.shifter->setup(stageRate, channels_, semitones, tempo);
+                break;
+            }
+            case EffectStageType::FILTER:
+                stage.filter.reset(new StreamingVoiceFilter());
+                stage.filter->setup(stageRate, channels_, static_cast<FilterType>(static_cast<int>(config.param1)),
+                                    config.param2, config.param3);
+                stage.filter->setPostGain(config.postGain);
+                break;
+            default:
+                break;
+        }
+        stages_.push_back(std::move(stage));
+    }
+
+    block_.resize(channels_);
+    for (auto& plane : block_) {
+        plane.clear();
+    }
+}
+
+void StreamingChain::process(const float* const* inputs, int frames,
+                                std::vector<std::vector<float>>& outputs,
+                                PerformanceChecker* perfChecker) {
+    for (int c = 0; c < channels_; ++c) {
+        block_[c].assign(inputs[c], inputs[c] + std::max(0, frames));
+    }
+
+    if (processingRate_ > 0) convertBlock(downConverters_, false);
+    runStages(false, perfChecker);
+    if (processingRate_ > 0) convertBlock(upConverters_, false);
+    appendBlock(outputs);
+}
+
+void StreamingChain::finish(std::vector<std::vector<float>>& outputs, PerformanceChecker* perfChecker) {
+    for (auto& plane : block_) {
+        plane.clear();
+    }
+
+    // 앞 스테이지에 남은 샘플을 뒤 스테이지에 넣은 다음 뒤 스테이지를 flush
+    if (processingRate_ > 0) convertBlock(downConverters_, true);
+    runStages(true, perfChecker);
+    if (processingRate_ > 0) convertBlock(upConverters_, true);
+    appendBlock(outputs);
+}
+
+const float* const* StreamingChain::blockPointers() {
+    pointers_.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        pointers_[c] = block_[c].data();
+    }
+    return pointers_.data();
+}
+
+void StreamingChain::runStages(bool atEnd, PerformanceChecker* perfChecker) {
+    for (Stage& stage : stages_) {
+        std::vector<std::vector<float>>& output = stage.output;
+        output.resize(channels_);
+        for (auto& plane : output) {
+            plane.clear();
+        }
+
+        const int frames = (int)block_[0].size();
+        const float* const* inputs = blockPointers();
+
+        switch (stage.config.type) {
+            case EffectStageType::PITCH:
+            case EffectStageType::TEMPO:
+            case EffectStageType::PITCH_TEMPO:
+                if (perfChecker) perfChecker->startFunction("StreamingChain.pitchTempo");
+                stage.shifter->process(inputs, frames, output);
+                if (atEnd) stage.shifter->flush(output);
+                if (stage.config.postGain != 1.0f) {
+                    for (auto& plane : output) {
+                        SampleOps::applyGainClamped(plane, stage.config.postGain);
+                    }
+                }
+                if (perfChecker) perfChecker->endFunction();
+                break;
+            case EffectStageType::FILTER:
+                if (perfChecker) perfChecker->startFunction("StreamingChain.filter");
+                stage.filter->process(inputs, frames, output);
+                if (atEnd) stage.filter->flush(output);
+                if (perfChecker) perfChecker->endFunction();
+                break;
+            case EffectStageType::GAIN:
+                if (perfChecker) perfChecker->startFunction("StreamingChain.gain");
+                for (int c = 0; c < channels_; ++c) {
+                    output[c].assign(block_[c].begin(), block_[c].end());
+                    SampleOps::applyGainClamped(output[c], stage.config.postGain);
+                }
+                if (perfChecker) perfChecker->endFunction();
+                break;
+            default:
+                // REVERSE는 parse에서 거부됨
+                for (int c = 0; c < channels_; ++c) {
+                    output[c].assign(block_[c].begin(), block_[c].end());
+                }
+                break;
+        }
+
+        // 스테이지 출력이 다음 스테이지 입력 (이전 블록 버퍼는 다음 호출의 출력으로 재사용)
+        block_.swap(output);
+    }
+}
+
+void StreamingChain::convertBlock(std::vector<SampleRateConverter>& converters, bool atEnd) {
+    for (int c = 0; c < channels_; ++c) {
+        rateScratch_.clear();
+        converters[c].process(block_[c].data(), (int)block_[c].size(), rateScratch_);
+        if (atEnd) converters[c].flush(rateScratch_);
+        block_[c].swap(rateScratch_);
+    }
+}
+
+void StreamingChain::appendBlock(std::vector<std::vector<float>>& outputs) const {
+    outputs.resize(channels_);
+    for (int c = 0; c < channels_; ++c) {
+        outputs[c].insert(outputs[c].end(), block_[c].begin(), block_[c].end());
+    }
+}
+
+int StreamingChain::getChannels() const {
+    return channels_;
+}
+
+size_t StreamingChain::getBufferBytes() const {
+    size_t bytes = planesBytes(block_);
+    for (const Stage& stage : stages_) {
+        bytes += planesBytes(stage.output);
+    }
+    return bytes;
+}
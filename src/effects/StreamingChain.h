@@ -0,0 +1,117 @@
+/**
+ * StreamingChain.h
+ *
+ * 스테이지 목록을 블록 단위로 실행하는 스트리밍 체인
+ * - 스테이지 목록은 EffectChain과 같은 형식 ("pitch:3;tempo:1.25;filter:4,0.5,0.5;gain:0.8;rate:24000")
+ *   (reverse는 끝까지 읽어야 하므로 스트리밍 불가)
+ * - 파일 처리(StreamingPipeline)와 실시간 처리(RealtimeProcessor)가 함께 사용
+ * - 파일 / 스레드를 쓰지 않으므로 WASM 빌드에도 포함
+ *
+ * 스테이지 사이 버퍼는 호출 간 재사용하므로, 블록 크기가 일정하면
+ * 처음 몇 블록 이후에는 메모리 할당이 일어나지 않음
+ */
+
+#ifndef STREAMING_CHAIN_H
+#define STREAMING_CHAIN_H
+
+#include "../dsp/SampleRateConverter.h"
+#include "../dsp/StreamingPitchShifter.h"
+#include "../performance/PerformanceChecker.h"
+#include "EffectChain.h"
+#include "StreamingVoiceFilter.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class StreamingChain {
+public:
+    StreamingChain();
+    ~StreamingChain();
+
+    /**
+     * 스테이지 목록 파싱 (EffectChain::parse와 같은 형식, 실행 계획도 같음)
+     * @return 성공 여부 (reverse가 있으면 실패, 기존 스테이지 유지)
+     */
+    bool parse(const std::string& spec);
+
+    /**
+     * 실행 계획 (EffectChain::getPlannedStages)
+     */
+    std::vector<EffectStage> getPlannedStages() const;
+
+    /**
+     * pitch / tempo 스테이지의 WSOLA 프로파일 (다음 begin부터 적용, 기본: DEFAULT)
+     */
+    void setStretchProfile(StretchProfile profile);
+    StretchProfile getStretchProfile() const;
+
+    /**
+     * pitch / tempo 스테이지의 겹침 위치 탐색 정책 (현재 스테이지에도 바로 적용, 할당 없음)
+     */
+    void setSearchPolicy(const OverlapSearchPolicy& policy);
+    const OverlapSearchPolicy& getSearchPolicy() const;
+
+    /**
+     * pitch / tempo 스테이지의 크로스페이드 모양 (현재 스테이지에도 바로 적용, 할당 없음)
+     */
+    void setCrossfadeShape(CrossfadeShape shape);
+    CrossfadeShape getCrossfadeShape() const;
+
+    /**
+     * 스트림 처리
+     * begin -> process (여러 번) -> finish
+     * @param outputs 채널별 출력, 확정된 샘플을 뒤에 추가 (clear하지 않음)
+     */
+    void begin(int sampleRate, int channels);
+    void process(const float* const* inputs, int frames, std::vector<std::vector<float>>& outputs,
+                 PerformanceChecker* perfChecker = nullptr);
+    void finish(std::vector<std::vector<float>>& outputs, PerformanceChecker* perfChecker = nullptr);
+
+    int getChannels() const;
+
+    /**
+     * 스테이지 사이 버퍼가 차지한 메모리 (capacity 기준, 스테이지 내부 상태 제외)
+     */
+    size_t getBufferBytes() const;
+
+private:
+    // 스트리밍 스테이지 (EffectChain 실행 계획의 스테이지 하나)
+    struct Stage {
+        EffectStage config;
+        std::unique_ptr<StreamingPitchShifter> shifter;   // PITCH / TEMPO / PITCH_TEMPO
+        std::unique_ptr<StreamingVoiceFilter> filter;     // FILTER
+        std::vector<std::vector<float>> output;           // 스테이지 출력 (호출 간 재사용)
+    };
+
+    EffectChain chain_;          // 파싱 / 실행 계획
+    std::vector<Stage> stages_;
+    StretchProfile stretchProfile_;
+    OverlapSearchPolicy searchPolicy_;
+    CrossfadeShape crossfadeShape_;
+    int sampleRate_;
+    int channels_;
+
+    // 내부 처리 샘플레이트 (rate: 설정, 채널마다 변환기 하나)
+    int processingRate_;
+    std::vector<SampleRateConverter> downConverters_;
+    std::vector<SampleRateConverter> upConverters_;
+    std::vector<float> rateScratch_;
+
+    std::vector<std::vector<float>> block_;       // 스테이지 사이를 흐르는 블록
+    std::vector<const float*> pointers_;
+
+    /**
+     * 블록을 모든 스테이지에 통과 (결과는 block_)
+     * @param atEnd true면 스테이지마다 flush
+     */
+    void runStages(bool atEnd, PerformanceChecker* perfChecker);
+
+    /**
+     * 블록 변환 (rate 변환기 / 출력 추가)
+     */
+    void convertBlock(std::vector<SampleRateConverter>& converters, bool atEnd);
+    void appendBlock(std::vector<std::vector<float>>& outputs) const;
+    const float* const* blockPointers();
+};
+
+#endif // STREAMING_CHAIN_H
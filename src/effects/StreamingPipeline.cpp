@@ -0,0 +1,256 @@
+/**
+ * StreamingPipeline.cpp
+ *
+ * 파일 -> 파일 스트리밍 처리
+ *
+ * 스레드 구성 (청크는 고정 개수를 돌려 쓰므로 메모리 상한이 정해짐):
+ *
+ *   읽기 스레드                처리 스레드 (호출 스레드)           쓰기 스레드
+ *   freeInput.pop()    ->     filledInput.pop()
+ *   mmap -> float 변환          스테이지 실행                       filledOutput.pop()
+ *   filledInput.push()        freeOutput.pop() -> 결과 채움       float -> PCM 변환 + 기록
+ *                             filledOutput.push()                freeOutput.push()
+ *                             freeInput.push()
+ *
+ * 입력 / 출력 청크를 2개씩 두어 (double buffering) 읽기 / 처리 / 쓰기가 동시에 진행됨
+ * 스트림 끝은 last 표시된 청크로 전달
+ */
+
+#include "StreamingPipeline.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+const int CHUNKS_PER_QUEUE = 2;   // double buffering
+const size_t WRITER_BLOCK_BYTES = 1024 * 1024;
+
+// 스레드 사이를 오가는 청크 (planar)
+struct Chunk {
+    std::vector<std::vector<float>> planes;
+    size_t frames;
+    bool last;    // 입력 끝 (입력 청크: frames == 0, 출력 청크: flush 결과)
+};
+
+// 청크 포인터 전달 큐 (청크 개수가 고정이므로 크기 제한 불필요)
+class ChunkQueue {
+public:
+    void push(Chunk* chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            chunks_.push_back(chunk);
+        }
+        ready_.notify_one();
+    }
+
+    Chunk* pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return !chunks_.empty(); });
+        Chunk* chunk = chunks_.front();
+        chunks_.pop_front();
+        return chunk;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<Chunk*> chunks_;
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t planesBytes(const std::vector<std::vector<float>>& planes) {
+    size_t bytes = 0;
+    for (const auto& plane : planes) {
+        bytes += plane.capacity() * sizeof(float);
+    }
+    return bytes;
+}
+
+} // namespace
+
+StreamingPipeline::StreamingPipeline()
+    : chunkFrames_(16384) {
+}
+
+StreamingPipeline::~StreamingPipeline() {
+}
+
+bool StreamingPipeline::parse(const std::string& spec) {
+    return chain_.parse(spec);
+}
+
+void StreamingPipeline::setChunkFrames(int frames) {
+    chunkFrames_ = std::max(256, frames);
+}
+
+int StreamingPipeline::getChunkFrames() const {
+    return chunkFrames_;
+}
+
+bool StreamingPipeline::processFile(const std::string& inputPath, const std::string& outputPath,
+                                    StreamingPipelineReport* report, PerformanceChecker* perfChecker) {
+    auto startTime = std::chrono::steady_clock::now();
+
+    WavReader reader;
+    if (!reader.open(inputPath)) {
+        return false;
+    }
+
+    const int channels = reader.getChannels();
+    const int sampleRate = reader.getSampleRate();
+    WavWriter writer;
+    if (!writer.open(outputPath, sampleRate, channels, reader.getFormat(), WRITER_BLOCK_BYTES)) {
+        return false;
+    }
+
+    chain_.begin(sampleRate, channels);
+
+    // 청크 풀 (입력 / 출력 각각 2개)
+    Chunk inputChunks[CHUNKS_PER_QUEUE];
+    Chunk outputChunks[CHUNKS_PER_QUEUE];
+    ChunkQueue freeInput, filledInput, freeOutput, filledOutput;
+    for (int i = 0; i < CHUNKS_PER_QUEUE; ++i) {
+        inputChunks[i].planes.assign(channels, std::vector<float>(chunkFrames_));
+        inputChunks[i].frames = 0;
+        inputChunks[i].last = false;
+        outputChunks[i].planes.resize(channels);
+        outputChunks[i].frames = 0;
+        outputChunks[i].last = false;
+        freeInput.push(&inputChunks[i]);
+        freeOutput.push(&outputChunks[i]);
+    }
+
+    double readSeconds = 0.0;
+    double writeSeconds = 0.0;
+    std::atomic<bool> writeFailed(false);
+
+    // 읽기 스레드: mmap된 입력을 청크 단위로 float 변환 (읽은 구간의 페이지는 반환)
+    std::thread readerThread([&]() {
+        uint64_t position = 0;
+        std::vector<float*> planes(channels);
+        while (true) {
+            Chunk* chunk = freeInput.pop();
+            auto start = std::chrono::steady_clock::now();
+            for (int c = 0; c < channels; ++c) {
+                planes[c] = chunk->planes[c].data();
+            }
+            chunk->frames = reader.readFramesPlanar(position, chunkFrames_, planes.data());
+            position += chunk->frames;
+            reader.releaseFrames(position);
+            readSeconds += secondsSince(start);
+
+            bool last = chunk->frames == 0;
+            chunk->last = last;
+            filledInput.push(chunk);
+            if (last) {
+                break;
+            }
+        }
+    });
+
+    // 쓰기 스레드: 결과 청크를 PCM / float로 변환해 블록 단위로 기록
+    std::thread writerThread([&]() {
+        std::vector<const float*> planes(channels);
+        while (true) {
+            Chunk* chunk = filledOutput.pop();
+            bool last = chunk->last;
+            auto start = std::chrono::steady_clock::now();
+            if (chunk->frames > 0 && !writeFailed) {
+                for (int c = 0; c < channels; ++c) {
+                    planes[c] = chunk->planes[c].data();
+                }
+                if (!writer.writeFramesPlanar(planes.data(), chunk->frames)) {
+                    writeFailed = true;
+                }
+            }
+            writeSeconds += secondsSince(start);
+            freeOutput.push(chunk);
+            if (last) {
+                break;
+            }
+        }
+    });
+
+    // 처리 (호출 스레드)
+    double processSeconds = 0.0;
+    uint64_t inputFrames = 0;
+    while (true) {
+        Chunk* input = filledInput.pop();
+        Chunk* output = freeOutput.pop();
+        for (auto& plane : output->planes) {
+            plane.clear();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        bool atEnd = input->last;
+        if (atEnd) {
+            chain_.finish(output->planes, perfChecker);
+        } else {
+            std::vector<const float*> planes(channels);
+            for (int c = 0; c < channels; ++c) {
+                planes[c] = input->planes[c].data();
+            }
+            chain_.process(planes.data(), (int)input->frames, output->planes, perfChecker);
+            inputFrames += input->frames;
+        }
+        processSeconds += secondsSince(start);
+
+        output->frames = output->planes[0].size();
+        output->last = atEnd;
+        freeInput.push(input);
+        filledOutput.push(output);
+
+        if (atEnd) {
+            break;
+        }
+    }
+
+    readerThread.join();
+    writerThread.join();
+
+    uint64_t outputFrames = writer.getFramesWritten();
+    bool ok = writer.close() && !writeFailed;
+
+    // 청크 / 스테이지 사이 버퍼 메모리
+    size_t bufferBytes = chain_.getBufferBytes();
+    for (int i = 0; i < CHUNKS_PER_QUEUE; ++i) {
+        bufferBytes += planesBytes(inputChunks[i].planes) + planesBytes(outputChunks[i].planes);
+    }
+
+    StreamingPipelineReport result;
+    result.inputFrames = inputFrames;
+    result.outputFrames = outputFrames;
+    result.sampleRate = sampleRate;
+    result.channels = channels;
+    result.chunkFrames = chunkFrames_;
+    result.audioSeconds = (double)inputFrames / sampleRate;
+    result.elapsedSeconds = secondsSince(startTime);
+    result.readSeconds = readSeconds;
+    result.processSeconds = processSeconds;
+    result.writeSeconds = writeSeconds;
+    result.realtimeFactor = result.audioSeconds > 0.0 ? result.elapsedSeconds / result.audioSeconds : 0.0;
+    result.bufferBytes = bufferBytes;
+
+    std::cout << "[StreamingPipeline] 처리 완료 - 입력 " << inputFrames << " 프레임 ("
+              << result.audioSeconds << "초) -> 출력 " << outputFrames << " 프레임, "
+              << result.elapsedSeconds << "초, realtime factor " << result.realtimeFactor
+              << " (읽기 " << readSeconds << "초 / 처리 " << processSeconds
+              << "초 / 쓰기 " << writeSeconds << "초)" << std::endl;
+
+    if (report) {
+        *report = result;
+    }
+    if (!ok) {
+        std::cerr << "[StreamingPipeline] 출력 기록 실패: " << outputPath << std::endl;
+    }
+    return ok;
+}
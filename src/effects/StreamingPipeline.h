@@ -0,0 +1,77 @@
+/**
+ * StreamingPipeline.h
+ *
+ * 파일 -> 파일 스트리밍 처리 (네이티브 전용, WASM 빌드에는 포함하지 않음)
+ * - 입력을 고정 크기 청크로 읽어 스트리밍 처리기(time stretch / pitch / filter)에 통과시키고
+ *   결과 청크를 바로 기록 -> 파일 길이와 상관없이 메모리 사용량이 일정
+ * - 읽기 스레드 / 처리 스레드(호출 스레드) / 쓰기 스레드가 청크 2개씩을 번갈아 사용 (double buffering)
+ *   -> 디스크 I/O가 처리와 겹침
+ * - 스테이지 실행은 StreamingChain (스테이지 목록 형식 / reverse 제한도 같음)
+ */
+
+#ifndef STREAMING_PIPELINE_H
+#define STREAMING_PIPELINE_H
+
+#include "../audio/WavFile.h"
+#include "../performance/PerformanceChecker.h"
+#include "StreamingChain.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * 처리 결과 (processFile)
+ */
+struct StreamingPipelineReport {
+    uint64_t inputFrames;
+    uint64_t outputFrames;
+    int sampleRate;
+    int channels;
+    int chunkFrames;
+
+    double audioSeconds;      // 입력 오디오 길이
+    double elapsedSeconds;    // 전체 처리 시간 (파일 열기 ~ 헤더 확정)
+    double readSeconds;       // 읽기 스레드가 변환에 쓴 시간
+    double processSeconds;    // 처리 스레드가 스테이지 실행에 쓴 시간
+    double writeSeconds;      // 쓰기 스레드가 변환 + 기록에 쓴 시간
+    double realtimeFactor;    // 처리 시간 / 오디오 길이 (1보다 작으면 실시간보다 빠름)
+    size_t bufferBytes;       // 청크 버퍼가 차지한 최대 메모리 (스테이지 내부 상태 제외)
+
+    StreamingPipelineReport()
+        : inputFrames(0), outputFrames(0), sampleRate(0), channels(0), chunkFrames(0),
+          audioSeconds(0.0), elapsedSeconds(0.0), readSeconds(0.0), processSeconds(0.0),
+          writeSeconds(0.0), realtimeFactor(0.0), bufferBytes(0) {}
+};
+
+class StreamingPipeline {
+public:
+    StreamingPipeline();
+    ~StreamingPipeline();
+
+    /**
+     * 스테이지 목록 파싱 (StreamingChain::parse)
+     * @return 성공 여부 (reverse가 있으면 실패)
+     */
+    bool parse(const std::string& spec);
+
+    /**
+     * 청크 크기 (채널당 샘플 수, 기본 16384)
+     */
+    void setChunkFrames(int frames);
+    int getChunkFrames() const;
+
+    /**
+     * 파일 처리 (출력 형식은 입력과 같음)
+     * @param report 처리 결과 (optional)
+     * @param perfChecker 스테이지별 성능 측정 (optional, 처리 스레드에서만 호출)
+     * @return 성공 여부 (실패 사유는 std::cerr)
+     */
+    bool processFile(const std::string& inputPath, const std::string& outputPath,
+                     StreamingPipelineReport* report = nullptr,
+                     PerformanceChecker* perfChecker = nullptr);
+
+private:
+    StreamingChain chain_;
+    int chunkFrames_;
+};
+
+#endif // STREAMING_PIPELINE_H
@@ -0,0 +1,451 @@
+/**
+ * StreamingVoiceFilter.cpp
+ *
+ * 스트리밍 음성 필터
+ *
+ * VoiceFilter의 커널은 버퍼 전체를 앞에서부터 한 번 훑는 인과(causal) 필터이므로
+ * 루프 사이에 유지되는 값만 상태로 옮기면 블록 단위로 같은 결과를 얻을 수 있음
+ * - LOW / HIGH / BAND PASS, AM_RADIO, DISTORTION: 1차 필터 이전 입력 / 출력
+ * - ECHO / REVERB: 딜레이 길이만큼의 출력 기록 (reverb는 딜레이 4개를 직렬로)
+ * - CHORUS / FLANGER: 딜레이 라인 + 쓰기 위치, LFO는 절대 샘플 위치로 계산
+ * - ROBOT: 절대 샘플 위치
+ * - 음성 변조: SoundTouch 스트림 (putSamples / receiveSamples) + 후처리 필터 상태
+ */
+
+#include "StreamingVoiceFilter.h"
+#include "../audio/ChannelLayout.h"
+#include "../audio/SampleOps.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <SoundTouch.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+StreamingVoiceFilter::StreamingVoiceFilter()
+    : sampleRate_(44100), channels_(1), type_(FilterType::LOW_PASS), param1_(0.5f), param2_(0.5f),
+      volumeCorrection_(true), postGain_(1.0f),
+      processedFrames_(0), originalStart_(0), noiseSeed_(12345),
+      inputEnergy_(0.0), outputEnergy_(0.0), inputSamples_(0), outputSamples_(0) {
+}
+
+StreamingVoiceFilter::~StreamingVoiceFilter() {
+}
+
+void StreamingVoiceFilter::setup(int sampleRate, int channels, FilterType type, float param1, float param2) {
+    if (sampleRate <= 0) {
+        std::cerr << "[StreamingVoiceFilter] 잘못된 샘플레이트: " << sampleRate << std::endl;
+        return;
+    }
+
+    sampleRate_ = sampleRate;
+    channels_ = std::max(1, channels);
+    type_ = type;
+    param1_ = param1;
+    param2_ = param2;
+    reset();
+}
+
+void StreamingVoiceFilter::setVolumeCorrection(bool enabled) {
+    volumeCorrection_ = enabled;
+}
+
+void StreamingVoiceFilter::setPostGain(float gain) {
+    postGain_ = gain;
+}
+
+bool StreamingVoiceFilter::isVoiceChanger() const {
+    return type_ == FilterType::VOICE_CHANGER_MALE_TO_FEMALE ||
+           type_ == FilterType::VOICE_CHANGER_FEMALE_TO_MALE;
+}
+
+void StreamingVoiceFilter::reset() {
+    states_.assign(channels_, ChannelState());
+    for (ChannelState& state : states_) {
+        configureChannel(state);
+    }
+
+    block_.resize(channels_);
+    processedFrames_ = 0;
+    originalStart_ = 0;
+    noiseSeed_ = 12345;
+    inputEnergy_ = 0.0;
+    outputEnergy_ = 0.0;
+    inputSamples_ = 0;
+    outputSamples_ = 0;
+
+    soundTouch_.reset();
+    if (isVoiceChanger()) {
+        // VoiceFilter::pitchShiftChannels와 같은 설정
+        // 남->여: +3 ~ +6 semitones, 여->남: -4 ~ -7 semitones
+        float semitones = (type_ == FilterType::VOICE_CHANGER_MALE_TO_FEMALE)
+                              ? 3.0f + param1_ * 3.0f
+                              : -4.0f - param1_ * 3.0f;
+        soundTouch_.reset(new soundtouch::SoundTouch());
+        soundTouch_->setSampleRate(sampleRate_);
+        soundTouch_->setChannels(channels_);
+        soundTouch_->setPitchSemiTones(semitones);
+        soundTouch_->setTempo(1.0f);
+        soundTouch_->setSetting(SETTING_USE_AA_FILTER, 1);
+        soundTouch_->setSetting(SETTING_AA_FILTER_LENGTH, 64);
+        soundTouch_->setSetting(SETTING_SEQUENCE_MS, 40);
+        soundTouch_->setSetting(SETTING_SEEKWINDOW_MS, 15);
+        soundTouch_->setSetting(SETTING_OVERLAP_MS, 8);
+    }
+}
+
+StreamingVoiceFilter::OnePole StreamingVoiceFilter::makeLowPass(float cutoff) const {
+    float rc = 1.0f / (2.0f * M_PI * cutoff);
+    float dt = 1.0f / sampleRate_;
+    OnePole filter = {dt / (rc + dt), 0.0f, 0.0f, false};
+    return filter;
+}
+
+StreamingVoiceFilter::OnePole StreamingVoiceFilter::makeHighPass(float cutoff) const {
+    float rc = 1.0f / (2.0f * M_PI * cutoff);
+    float dt = 1.0f / sampleRate_;
+    OnePole filter = {rc / (rc + dt), 0.0f, 0.0f, false};
+    return filter;
+}
+
+void StreamingVoiceFilter::configureChannel(ChannelState& state) {
+    // 사용하지 않는 필터는 alpha = 0 (호출되지 않음)
+    state.lowPass = OnePole{0.0f, 0.0f, 0.0f, false};
+    state.highPass = OnePole{0.0f, 0.0f, 0.0f, false};
+    state.prevOutput = 0.0f;
+    state.modDelay.index = 0;
+
+    // 파라미터 매핑은 VoiceFilter::applyChannelKernel / process* 와 동일
+    switch (type_) {
+        case FilterType::LOW_PASS:
+            state.lowPass = makeLowPass(120.0f + (400.0f - 120.0f) * std::clamp(param1_, 0.0f, 1.0f));
+            break;
+        case FilterType::HIGH_PASS:
+            state.highPass = makeHighPass(2500.0f + (6000.0f - 2500.0f) * std::clamp(param1_, 0.0f, 1.0f));
+            break;
+        case FilterType::BAND_PASS: {
+            float lowOffset = (std::clamp(param1_, 0.0f, 1.0f) - 0.5f) * 300.0f;
+            float highOffset = (std::clamp(param2_, 0.0f, 1.0f) - 0.5f) * 1600.0f;
+            float lowCutoff = std::max(80.0f, 300.0f + lowOffset);
+            float highCutoff = std::min(6000.0f, 3000.0f + highOffset);
+            if (highCutoff <= lowCutoff + 100.0f) {
+                highCutoff = lowCutoff + 100.0f;
+            }
+            state.highPass = makeHighPass(lowCutoff);
+            state.lowPass = makeLowPass(highCutoff);
+            break;
+        }
+        case FilterType::ECHO: {
+            float delay = param1_ * 0.5f + 0.1f;
+            float feedback = param2_ * 0.7f + 0.1f;
+            int delaySamples = static_cast<int>(delay * sampleRate_);
+            state.combs.push_back(Comb{delaySamples, feedback, std::vector<float>(delaySamples, 0.0f)});
+            break;
+        }
+        case FilterType::REVERB: {
+            const float delayFactors[] = {0.029f, 0.037f, 0.041f, 0.043f};
+            float feedbackGain = 0.3f * (1.0f - param2_);
+            for (float factor : delayFactors) {
+                int delay = static_cast<int>(factor * param1_ * sampleRate_);
+                state.combs.push_back(Comb{delay, feedbackGain, std::vector<float>(std::max(0, delay), 0.0f)});
+            }
+            break;
+        }
+        case FilterType::DISTORTION:
+            // tone 필터: 첫 샘플은 그대로, 이후 이전 출력 기준 1차 저역 통과
+            state.lowPass = makeLowPass(2000.0f + param2_ * 8000.0f);
+            break;
+        case FilterType::AM_RADIO:
+            state.highPass = makeHighPass(200.0f);
+            state.lowPass = makeLowPass(2000.0f + param2_ * 2000.0f);
+            break;
+        case FilterType::CHORUS: {
+            float maxDelay = 0.010f + param2_ * 0.020f;
+            state.modDelay.line.assign(static_cast<int>(maxDelay * sampleRate_) + 1, 0.0f);
+            break;
+        }
+        case FilterType::FLANGER: {
+            float maxDelay = 0.001f + param2_ * 0.011f;
+            state.modDelay.line.assign(static_cast<int>(maxDelay * sampleRate_) + 1, 0.0f);
+            break;
+        }
+        case FilterType::VOICE_CHANGER_MALE_TO_FEMALE:
+            if (param1_ > 0.5f) {
+                state.highPass = makeHighPass(1500.0f + param1_ * 1500.0f);
+            }
+            break;
+        case FilterType::VOICE_CHANGER_FEMALE_TO_MALE:
+            if (param1_ > 0.5f) {
+                state.lowPass = makeLowPass(600.0f - param1_ * 200.0f);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+float StreamingVoiceFilter::runLowPass(OnePole& filter, float sample) {
+    if (!filter.started) {
+        // 첫 샘플은 그대로 (VoiceFilter는 인덱스 1부터 필터링)
+        filter.started = true;
+        filter.prevOutput = sample;
+        return sample;
+    }
+    float output = filter.prevOutput + filter.alpha * (sample - filter.prevOutput);
+    filter.prevOutput = output;
+    return output;
+}
+
+float StreamingVoiceFilter::runHighPass(OnePole& filter, float sample) {
+    if (!filter.started) {
+        filter.started = true;
+        filter.prevInput = sample;
+        filter.prevOutput = sample;
+        return sample;
+    }
+    float output = filter.alpha * (filter.prevOutput + sample - filter.prevInput);
+    filter.prevOutput = output;
+    filter.prevInput = sample;
+    return output;
+}
+
+void StreamingVoiceFilter::process(const float* const* inputs, int frames,
+                                   std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+    if (frames <= 0) {
+        return;
+    }
+
+    // 원본 에너지 누적 (볼륨 보정용)
+    for (int c = 0; c < channels_; ++c) {
+        const float* input = inputs[c];
+        double sum = 0.0;
+        for (int i = 0; i < frames; ++i) {
+            sum += input[i] * input[i];
+        }
+        inputEnergy_ += sum;
+    }
+    inputSamples_ += (long long)frames * channels_;
+
+    if (isVoiceChanger()) {
+        if (channels_ == 1) {
+            soundTouch_->putSamples(inputs[0], frames);
+        } else {
+            interleaved_.resize((size_t)frames * channels_);
+            ChannelLayout::interleave(inputs, channels_, frames, interleaved_.data());
+            soundTouch_->putSamples(interleaved_.data(), frames);
+        }
+        if (type_ == FilterType::VOICE_CHANGER_FEMALE_TO_MALE) {
+            // 블렌드용 원본 보관 (SoundTouch 지연만큼)
+            for (int c = 0; c < channels_; ++c) {
+                states_[c].original.insert(states_[c].original.end(), inputs[c], inputs[c] + frames);
+            }
+        }
+        receiveVoiceChanger((int)soundTouch_->numSamples());
+    } else {
+        for (int c = 0; c < channels_; ++c) {
+            block_[c].assign(inputs[c], inputs[c] + frames);
+            processChannel(states_[c], block_[c].data(), frames, processedFrames_);
+        }
+        processedFrames_ += frames;
+    }
+
+    finishBlock(outputs);
+}
+
+void StreamingVoiceFilter::flush(std::vector<std::vector<float>>& outputs) {
+    outputs.resize(channels_);
+    if (isVoiceChanger()) {
+        soundTouch_->flush();
+        receiveVoiceChanger((int)soundTouch_->numSamples());
+        finishBlock(outputs);
+    }
+    reset();
+}
+
+void StreamingVoiceFilter::processChannel(ChannelState& state, float* data, int length, long long start) {
+    switch (type_) {
+        case FilterType::LOW_PASS:
+            for (int i = 0; i < length; ++i) {
+                data[i] = runLowPass(state.lowPass, data[i]);
+            }
+            break;
+        case FilterType::HIGH_PASS:
+            for (int i = 0; i < length; ++i) {
+                data[i] = runHighPass(state.highPass, data[i]);
+            }
+            break;
+        case FilterType::BAND_PASS:
+            for (int i = 0; i < length; ++i) {
+                data[i] = runLowPass(state.lowPass, runHighPass(state.highPass, data[i]));
+            }
+            break;
+        case FilterType::ROBOT: {
+            float modFreq = 30.0f; // Hz
+            for (int i = 0; i < length; ++i) {
+                float t = static_cast<float>(start + i) / sampleRate_;
+                float modulator = std::sin(2.0f * M_PI * modFreq * t);
+                data[i] *= (0.5f + 0.5f * modulator);
+            }
+            break;
+        }
+        case FilterType::ECHO:
+        case FilterType::REVERB:
+            // 딜레이를 직렬로 (VoiceFilter는 딜레이마다 전체 버퍼 패스)
+            for (Comb& comb : state.combs) {
+                for (int i = 0; i < length; ++i) {
+                    long long n = start + i;
+                    if (comb.delay == 0) {
+                        data[i] = std::max(-1.0f, std::min(1.0f, data[i] + data[i] * comb.gain));
+                        continue;
+                    }
+                    float& slot = comb.history[n % comb.delay];  // delay 샘플 전 출력
+                    if (n >= comb.delay) {
+                        data[i] += slot * comb.gain;
+                        data[i] = std::max(-1.0f, std::min(1.0f, data[i]));
+                    }
+                    slot = data[i];
+                }
+            }
+            break;
+        case FilterType::DISTORTION: {
+            float gain = 1.0f + param1_ * 9.0f;
+            for (int i = 0; i < length; ++i) {
+                data[i] = runLowPass(state.lowPass, std::tanh(data[i] * gain));
+            }
+            break;
+        }
+        case FilterType::AM_RADIO: {
+            float noiseAmount = param1_ * 0.15f;
+            for (int i = 0; i < length; ++i) {
+                float sample = runLowPass(state.lowPass, runHighPass(state.highPass, data[i]));
+                noiseSeed_ = noiseSeed_ * 1103515245 + 12345;
+                float noise = ((noiseSeed_ / 2147483648.0f) - 1.0f) * noiseAmount;
+                data[i] = std::max(-1.0f, std::min(1.0f, sample + noise));
+            }
+            break;
+        }
+        case FilterType::CHORUS:
+        case FilterType::FLANGER: {
+            const bool chorus = type_ == FilterType::CHORUS;
+            float modRate = chorus ? 0.1f + param1_ * 1.4f : 0.5f + param1_ * 7.5f;
+            float minDelay = chorus ? 0.010f : 0.001f;
+            float maxDelay = chorus ? minDelay + param2_ * 0.020f : minDelay + param2_ * 0.011f;
+            int maxDelaySamples = static_cast<int>(maxDelay * sampleRate_);
+            std::vector<float>& line = state.modDelay.line;
+            int& delayIndex = state.modDelay.index;
+
+            for (int i = 0; i < length; ++i) {
+                float t = static_cast<float>(start + i) / sampleRate_;
+                float lfo = std::sin(2.0f * M_PI * modRate * t);
+                float delayTime = minDelay + (maxDelay - minDelay) * (0.5f + 0.5f * lfo);
+                int delaySamples = static_cast<int>(delayTime * sampleRate_);
+
+                if (delaySamples > 0 && delaySamples <= maxDelaySamples) {
+                    int readIndex = (delayIndex - delaySamples + maxDelaySamples + 1) % (maxDelaySamples + 1);
+                    float delayedSample = line[readIndex];
+                    if (chorus) {
+                        data[i] = data[i] * 0.6f + delayedSample * 0.4f;
+                        line[delayIndex] = data[i];
+                    } else {
+                        data[i] = data[i] + delayedSample * 0.4f;
+                        data[i] = std::max(-1.0f, std::min(1.0f, data[i]));
+                        line[delayIndex] = data[i] * 0.6f;
+                    }
+                } else {
+                    line[delayIndex] = data[i];
+                }
+                delayIndex = (delayIndex + 1) % (maxDelaySamples + 1);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void StreamingVoiceFilter::receiveVoiceChanger(int maxFrames) {
+    for (auto& channel : block_) {
+        channel.clear();
+    }
+    if (maxFrames <= 0) {
+        return;
+    }
+
+    interleaved_.resize((size_t)maxFrames * channels_);
+    int received = (int)soundTouch_->receiveSamples(interleaved_.data(), maxFrames);
+    ChannelLayout::deinterleave(interleaved_.data(), received, channels_, block_);
+
+    for (int c = 0; c < channels_; ++c) {
+        ChannelState& state = states_[c];
+        std::vector<float>& data = block_[c];
+
+        if (type_ == FilterType::VOICE_CHANGER_MALE_TO_FEMALE) {
+            // 고역 통과 필터로 약간 밝게
+            if (param1_ > 0.5f) {
+                for (float& sample : data) {
+                    sample = runHighPass(state.highPass, sample);
+                }
+            }
+            continue;
+        }
+
+        // 여->남: 저역 통과 후 원본과 블렌드 (원본 길이까지만)
+        if (param1_ > 0.5f) {
+            for (float& sample : data) {
+                sample = runLowPass(state.lowPass, sample);
+            }
+        }
+        long long available = originalStart_ + (long long)state.original.size() - processedFrames_;
+        int blend = (int)std::max(0LL, std::min<long long>(received, available));
+        const float* original = state.original.data() + (processedFrames_ - originalStart_);
+        for (int i = 0; i < blend; ++i) {
+            data[i] = data[i] * 0.6f + original[i] * 0.4f;
+        }
+    }
+
+    processedFrames_ += received;
+
+    // 블렌드가 끝난 원본 폐기
+    if (type_ == FilterType::VOICE_CHANGER_FEMALE_TO_MALE) {
+        long long drop = std::min<long long>(processedFrames_ - originalStart_, (long long)states_[0].original.size());
+        if (drop > 0) {
+            for (ChannelState& state : states_) {
+                state.original.erase(state.original.begin(), state.original.begin() + drop);
+            }
+            originalStart_ += drop;
+        }
+    }
+}
+
+void StreamingVoiceFilter::finishBlock(std::vector<std::vector<float>>& outputs) {
+    for (const auto& channel : block_) {
+        double sum = 0.0;
+        for (float sample : channel) {
+            sum += sample * sample;
+        }
+        outputEnergy_ += sum;
+        outputSamples_ += (long long)channel.size();
+    }
+
+    // 볼륨 보정: 지금까지의 누적 RMS 비율 (VoiceFilter::correctionGain과 같은 제한)
+    float gain = 1.0f;
+    if (volumeCorrection_ && inputSamples_ > 0 && outputSamples_ > 0) {
+        float originalRMS = (float)std::sqrt(inputEnergy_ / inputSamples_);
+        float filteredRMS = (float)std::sqrt(outputEnergy_ / outputSamples_);
+        if (filteredRMS > 0.0001f && originalRMS > 0.0001f) {
+            gain = std::min(originalRMS / filteredRMS, 3.0f);
+        }
+    }
+    gain *= postGain_;
+
+    for (int c = 0; c < channels_; ++c) {
+        std::vector<float>& data = block_[c];
+        if (gain != 1.0f) {
+            SampleOps::applyGainClamped(data, gain);
+        }
+        outputs[c].insert(outputs[c].end(), data.begin(), data.end());
+    }
+}
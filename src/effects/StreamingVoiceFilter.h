@@ -0,0 +1,139 @@
+/**
+ * StreamingVoiceFilter.h
+ *
+ * 스트리밍 음성 필터 (VoiceFilter의 블록 단위 버전)
+ * 필터 상태(1차 필터 이전 값, 딜레이 라인, LFO 위상 = 절대 샘플 위치)를 블록 사이에 유지하므로
+ * 블록 크기와 상관없이 같은 결과를 냄
+ *
+ * VoiceFilter와 다른 점:
+ * - 볼륨 보정 gain은 지금까지 처리한 구간의 누적 RMS로 블록마다 계산
+ *   (전체 파일의 RMS를 미리 알 수 없으므로, 길어질수록 VoiceFilter의 gain에 수렴)
+ * - 파일 전체가 딜레이보다 짧을 때 딜레이 효과를 건너뛰는 예외 처리 없음
+ * - AM_RADIO 노이즈는 인스턴스마다 같은 seed에서 시작
+ */
+
+#ifndef STREAMING_VOICE_FILTER_H
+#define STREAMING_VOICE_FILTER_H
+
+#include "VoiceFilter.h"
+#include <memory>
+#include <vector>
+
+namespace soundtouch {
+class SoundTouch;
+}
+
+class StreamingVoiceFilter {
+public:
+    StreamingVoiceFilter();
+    ~StreamingVoiceFilter();
+
+    StreamingVoiceFilter(const StreamingVoiceFilter&) = delete;
+    StreamingVoiceFilter& operator=(const StreamingVoiceFilter&) = delete;
+
+    /**
+     * 스트림 설정 (내부 상태 초기화)
+     * 파라미터 의미는 VoiceFilter::applyFilter와 동일
+     */
+    void setup(int sampleRate, int channels, FilterType type, float param1 = 0.5f, float param2 = 0.5f);
+
+    /**
+     * 볼륨 보정 (기본: 사용) / 보정 뒤에 곱하는 추가 gain (EffectChain의 gain 스테이지)
+     */
+    void setVolumeCorrection(bool enabled);
+    void setPostGain(float gain);
+
+    void reset();
+
+    /**
+     * 입력 블록 처리 (planar)
+     * @param outputs 채널별 출력, 처리된 샘플을 뒤에 추가 (clear하지 않음)
+     *        음성 변조(SoundTouch)는 내부 지연만큼 늦게 나옴
+     */
+    void process(const float* const* inputs, int frames, std::vector<std::vector<float>>& outputs);
+
+    /**
+     * 스트림 끝: 내부에 남은 샘플 출력
+     */
+    void flush(std::vector<std::vector<float>>& outputs);
+
+private:
+    // 1차 필터 상태 (VoiceFilter::applySimpleLowPass / applySimpleHighPass와 같은 식)
+    struct OnePole {
+        float alpha;
+        float prevInput;
+        float prevOutput;
+        bool started;
+    };
+
+    // 피드백 딜레이 (echo / reverb의 딜레이 라인 하나)
+    struct Comb {
+        int delay;
+        float gain;
+        std::vector<float> history;   // 최근 delay개 출력 (원형 버퍼)
+    };
+
+    // 변조 딜레이 (chorus / flanger)
+    struct ModulatedDelay {
+        std::vector<float> line;
+        int index;
+    };
+
+    struct ChannelState {
+        OnePole lowPass;
+        OnePole highPass;
+        std::vector<Comb> combs;
+        ModulatedDelay modDelay;
+        float prevOutput;             // distortion tone 필터
+        std::vector<float> original;  // 음성 변조 블렌드용 원본 (아직 출력과 섞지 않은 구간)
+    };
+
+    int sampleRate_;
+    int channels_;
+    FilterType type_;
+    float param1_;
+    float param2_;
+    bool volumeCorrection_;
+    float postGain_;
+
+    std::vector<ChannelState> states_;
+    long long processedFrames_;   // 지금까지 커널을 거친 프레임 수 (LFO / 딜레이 위치)
+    long long originalStart_;     // original[0]의 절대 위치
+    unsigned int noiseSeed_;
+
+    // 누적 RMS (볼륨 보정)
+    double inputEnergy_;
+    double outputEnergy_;
+    long long inputSamples_;
+    long long outputSamples_;
+
+    // 음성 변조 (SoundTouch 스트림)
+    std::unique_ptr<soundtouch::SoundTouch> soundTouch_;
+    std::vector<float> interleaved_;
+    std::vector<std::vector<float>> block_;
+
+    bool isVoiceChanger() const;
+    void configureChannel(ChannelState& state);
+    OnePole makeLowPass(float cutoff) const;
+    OnePole makeHighPass(float cutoff) const;
+
+    /**
+     * 채널 하나에 커널 적용 (in-place, start = 블록 첫 샘플의 절대 위치)
+     */
+    void processChannel(ChannelState& state, float* data, int length, long long start);
+
+    /**
+     * SoundTouch 출력 받기 + 후처리 (음성 변조)
+     */
+    void receiveVoiceChanger(int maxFrames);
+
+    /**
+     * 볼륨 보정 + post gain 적용 후 출력에 추가
+     */
+    void finishBlock(std::vector<std::vector<float>>& outputs);
+
+    static float runLowPass(OnePole& filter, float sample);
+    static float runHighPass(OnePole& filter, float sample);
+};
+
+#endif // STREAMING_VOICE_FILTER_H
@@ -1,6 +1,10 @@
 #include "VoiceFilter.h"
+#include "../audio/ChannelLayout.h"
+#include "../audio/SampleOps.h"
+#include "../performance/TaskPool.h"
 #include <cmath>
 #include <algorithm>
+#include <atomic>
 #include <SoundTouch.h>
 
 VoiceFilter::VoiceFilter() {
@@ -10,10 +14,103 @@ VoiceFilter::~VoiceFilter() {
 }
 
 AudioBuffer VoiceFilter::applyFilter(const AudioBuffer& input, FilterType type, float param1, float param2) {
-    // 원본 RMS 계산 (볼륨 보정용)
-    float originalRMS = calculateRMS(input.getData());
-    
-    AudioBuffer result;
+    AudioBuffer result = input;
+    if (input.isPlanar()) {
+        loadChannels(input, planarScratch_);
+        applyFilterPlanar(planarScratch_, input.getSampleRate(), type, param1, param2);
+        storeChannels(planarScratch_, result);
+        return result;
+    }
+
+    // 다채널 AudioBuffer는 interleaved로 저장됨
+    applyFilterInterleaved(result.getData(), std::max(1, input.getChannels()), input.getSampleRate(),
+                           type, param1, param2);
+    return result;
+}
+
+void VoiceFilter::applyFilterInPlace(std::vector<float>& data, int sampleRate, FilterType type,
+                                     float param1, float param2, float postGain) {
+    // 채널 하나짜리 planar로 처리 (swap이므로 복사 없음)
+    monoPlane_.resize(1);
+    monoPlane_[0].swap(data);
+    applyFilterPlanar(monoPlane_, sampleRate, type, param1, param2, postGain);
+    data.swap(monoPlane_[0]);
+}
+
+void VoiceFilter::applyFilterPlanar(std::vector<std::vector<float>>& channels, int sampleRate, FilterType type,
+                                    float param1, float param2, float postGain) {
+    if (channels.empty()) {
+        return;
+    }
+
+    // 원본 RMS 계산 (볼륨 보정용, 전체 채널 기준으로 한 번만 계산해 채널 간 음량 균형 유지)
+    float originalRMS = calculateRMS(channels);
+
+    if (!applyKernel(channels, sampleRate, type, param1, param2)) {
+        return;
+    }
+
+    // 필터 적용 후 RMS 계산
+    float filteredRMS = calculateRMS(channels);
+
+    // 볼륨 보정: 원본 RMS에 맞춰 조정 (단, 클리핑 방지)
+    // postGain은 같은 루프에서 곱해짐 (별도 패스 없음)
+    float gain = correctionGain(originalRMS, filteredRMS) * postGain;
+    for (auto& channel : channels) {
+        applyGain(channel, gain);
+    }
+}
+
+void VoiceFilter::applyFilterInterleaved(std::vector<float>& data, int channels, int sampleRate, FilterType type,
+                                         float param1, float param2, float postGain) {
+    if (channels <= 1) {
+        applyFilterInPlace(data, sampleRate, type, param1, param2, postGain);
+        return;
+    }
+
+    int frames = (int)data.size() / channels;
+    ChannelLayout::deinterleave(data.data(), frames, channels, planarScratch_);
+    applyFilterPlanar(planarScratch_, sampleRate, type, param1, param2, postGain);
+    ChannelLayout::interleave(planarScratch_, frames, data);
+    syncScratchMemory();
+}
+
+bool VoiceFilter::applyKernel(std::vector<std::vector<float>>& channels, int sampleRate, FilterType type,
+                              float param1, float param2) {
+    switch (type) {
+        // 피치 변경 효과는 모든 채널을 한 번에 처리 (채널별로 따로 처리하면 세그먼트 경계가 어긋남)
+        case FilterType::VOICE_CHANGER_MALE_TO_FEMALE:
+            processVoiceChangerMaleToFemale(channels, param1, sampleRate);
+            return true;
+        case FilterType::VOICE_CHANGER_FEMALE_TO_MALE:
+            processVoiceChangerFemaleToMale(channels, param1, sampleRate);
+            return true;
+        default:
+            break;
+    }
+
+    // 나머지 효과는 채널마다 같은 커널 적용
+    // AM_RADIO는 노이즈 seed를 채널 순서대로 이어 쓰므로 순서대로 처리, 나머지는 채널 단위로 병렬 처리
+    if (type == FilterType::AM_RADIO) {
+        for (auto& data : channels) {
+            applyChannelKernel(data, sampleRate, type, param1, param2);
+        }
+        return true;
+    }
+
+    std::atomic<bool> known(true);
+    TaskPool::getInstance().parallelFor((int)channels.size(), 1, [&](int begin, int end) {
+        for (int c = begin; c < end; ++c) {
+            if (!applyChannelKernel(channels[c], sampleRate, type, param1, param2)) {
+                known = false;
+            }
+        }
+    });
+    return known;
+}
+
+bool VoiceFilter::applyChannelKernel(std::vector<float>& data, int sampleRate, FilterType type,
+                                     float param1, float param2) {
     switch (type) {
         case FilterType::LOW_PASS: {
             // 🐻 곰: 아주 낮은 저음 위주 (굵고 둔한 느낌)
@@ -21,7 +118,7 @@ AudioBuffer VoiceFilter::applyFilter(const AudioBuffer& input, FilterType type,
             float minCut = 120.0f;
             float maxCut = 400.0f;
             float cutoff = minCut + (maxCut - minCut) * std::clamp(param1, 0.0f, 1.0f);
-            result = applyLowPass(input, cutoff);
+            applySimpleLowPass(data, cutoff, sampleRate);
             break;
         }
         case FilterType::HIGH_PASS: {
@@ -30,7 +127,7 @@ AudioBuffer VoiceFilter::applyFilter(const AudioBuffer& input, FilterType type,
             float minCut = 2500.0f;
             float maxCut = 6000.0f;
             float cutoff = minCut + (maxCut - minCut) * std::clamp(param1, 0.0f, 1.0f);
-            result = applyHighPass(input, cutoff);
+            applySimpleHighPass(data, cutoff, sampleRate);
             break;
         }
         case FilterType::BAND_PASS: {
@@ -47,82 +144,112 @@ AudioBuffer VoiceFilter::applyFilter(const AudioBuffer& input, FilterType type,
             if (highCutoff <= lowCutoff + 100.0f) {
                 highCutoff = lowCutoff + 100.0f;
             }
-            result = applyBandPass(input, lowCutoff, highCutoff);
+            applySimpleHighPass(data, lowCutoff, sampleRate);
+            applySimpleLowPass(data, highCutoff, sampleRate);
             break;
         }
         case FilterType::ROBOT:
-            result = applyRobot(input);
+            processRobot(data, sampleRate);
             break;
         case FilterType::ECHO:
-            result = applyEcho(input, param1 * 0.5f + 0.1f, param2 * 0.7f + 0.1f);
+            processEcho(data, param1 * 0.5f + 0.1f, param2 * 0.7f + 0.1f, sampleRate);
             break;
         case FilterType::REVERB:
-            result = applyReverb(input, param1, param2);
+            processReverb(data, param1, param2, sampleRate);
             break;
         case FilterType::DISTORTION:
-            result = applyDistortion(input, param1, param2);
+            processDistortion(data, param1, param2, sampleRate);
             break;
         case FilterType::AM_RADIO:
-            result = applyAMRadio(input, param1, param2);
+            processAMRadio(data, param1, param2, sampleRate);
             break;
         case FilterType::CHORUS:
-            result = applyChorus(input, param1, param2);
+            processChorus(data, param1, param2, sampleRate);
             break;
         case FilterType::FLANGER:
-            result = applyFlanger(input, param1, param2);
-            break;
-        case FilterType::VOICE_CHANGER_MALE_TO_FEMALE:
-            result = applyVoiceChangerMaleToFemale(input, param1);
-            break;
-        case FilterType::VOICE_CHANGER_FEMALE_TO_MALE:
-            result = applyVoiceChangerFemaleToMale(input, param1);
+            processFlanger(data, param1, param2, sampleRate);
             break;
         default:
-            return input;
+            return false;
     }
-    
-    // 필터 적용 후 RMS 계산
-    float filteredRMS = calculateRMS(result.getData());
-    
-    // 볼륨 보정: 원본 RMS에 맞춰 조정 (단, 클리핑 방지)
+    return true;
+}
+
+float VoiceFilter::correctionGain(float originalRMS, float filteredRMS) {
+    float gain = 1.0f;
     if (filteredRMS > 0.0001f && originalRMS > 0.0001f) {
-        float gain = originalRMS / filteredRMS;
+        gain = originalRMS / filteredRMS;
         // 과도한 증폭 방지 (최대 3배)
         gain = std::min(gain, 3.0f);
-        
-        auto& data = result.getData();
-        size_t i = 0;
-        const size_t size = data.size();
-        const size_t simdSize = size - (size % 4);
-
-        // Loop Unrolling: 4-way (루프 오버헤드 감소 + 컴파일러 자동 벡터화 유도)
-        for (; i < simdSize; i += 4) {
-            data[i] = std::max(-1.0f, std::min(1.0f, data[i] * gain));
-            data[i+1] = std::max(-1.0f, std::min(1.0f, data[i+1] * gain));
-            data[i+2] = std::max(-1.0f, std::min(1.0f, data[i+2] * gain));
-            data[i+3] = std::max(-1.0f, std::min(1.0f, data[i+3] * gain));
-        }
+    }
+    return gain;
+}
+
+void VoiceFilter::applyGain(std::vector<float>& data, float gain) {
+    if (gain != 1.0f) {
+        SampleOps::applyGainClamped(data, gain);
+    }
+}
 
-        // Handle remaining samples
-        for (; i < size; ++i) {
-            data[i] = std::max(-1.0f, std::min(1.0f, data[i] * gain));
+void VoiceFilter::loadChannels(const AudioBuffer& buffer, std::vector<std::vector<float>>& planes) {
+    int channels = std::max(1, buffer.getChannels());
+    int frames = (int)buffer.getFrameCount();
+    if (buffer.isPlanar()) {
+        planes.resize(channels);
+        for (int c = 0; c < channels; ++c) {
+            ConstChannelView channel = buffer.getChannel(c);
+            planes[c].assign(channel.begin(), channel.end());
         }
+    } else {
+        ChannelLayout::deinterleave(buffer.getData().data(), frames, channels, planes);
     }
-    
-    return result;
+}
+
+void VoiceFilter::storeChannels(const std::vector<std::vector<float>>& planes, AudioBuffer& buffer) {
+    if (planes.empty()) {
+        return;
+    }
+    if (buffer.isPlanar()) {
+        buffer.setPlanarData(planes, buffer.getAlignment());
+    } else {
+        ChannelLayout::interleave(planes, (int)planes[0].size(), buffer.getData());
+    }
+    syncScratchMemory();
+}
+
+void VoiceFilter::syncScratchMemory() {
+    scratchMemory_.update(capacityBytes(planarScratch_) + capacityBytes(monoPlane_) +
+                          capacityBytes(interleavedScratch_));
+}
+
+template <typename Kernel>
+void VoiceFilter::processChannels(AudioBuffer& buffer, Kernel kernel) {
+    if (!buffer.isPlanar() && buffer.getChannels() <= 1) {
+        kernel(buffer.getData());
+        return;
+    }
+
+    // 다채널 (interleaved) 또는 planar: 채널별로 분리해 같은 커널 적용
+    loadChannels(buffer, planarScratch_);
+    for (auto& plane : planarScratch_) {
+        kernel(plane);
+    }
+    storeChannels(planarScratch_, buffer);
 }
 
 AudioBuffer VoiceFilter::applyLowPass(const AudioBuffer& input, float cutoff) {
     AudioBuffer output = input;
-    auto& data = output.getData();
-    applySimpleLowPass(data, cutoff, input.getSampleRate());
+    processChannels(output, [&](std::vector<float>& data) {
+        applySimpleLowPass(data, cutoff, input.getSampleRate());
+    });
     return output;
 }
 
 AudioBuffer VoiceFilter::applyHighPass(const AudioBuffer& input, float cutoff) {
     AudioBuffer output = input;
-    auto& data = output.getData();
-    applySimpleHighPass(data, cutoff, input.getSampleRate());
+    processChannels(output, [&](std::vector<float>& data) {
+        applySimpleHighPass(data, cutoff, input.getSampleRate());
+    });
     return output;
 }
 
@@ -132,29 +259,36 @@ AudioBuffer VoiceFilter::applyBandPass(const AudioBuffer& input, float lowCutoff
 }
 
 AudioBuffer VoiceFilter::applyRobot(const AudioBuffer& input) {
-    // 간단한 로봇 효과: 사인파 모듈레이션
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
+    processChannels(output, [&](std::vector<float>& data) {
+        processRobot(data, input.getSampleRate());
+    });
+    return output;
+}
 
+void VoiceFilter::processRobot(std::vector<float>& data, int sampleRate) {
+    // 간단한 로봇 효과: 사인파 모듈레이션
     float modFreq = 30.0f; // Hz
     for (size_t i = 0; i < data.size(); ++i) {
         float t = static_cast<float>(i) / sampleRate;
         float modulator = std::sin(2.0f * M_PI * modFreq * t);
         data[i] *= (0.5f + 0.5f * modulator);
     }
-
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyEcho(const AudioBuffer& input, float delay, float feedback) {
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
+    processChannels(output, [&](std::vector<float>& data) {
+        processEcho(data, delay, feedback, input.getSampleRate());
+    });
+    return output;
+}
+
+void VoiceFilter::processEcho(std::vector<float>& data, float delay, float feedback, int sampleRate) {
     int delaySamples = static_cast<int>(delay * sampleRate);
 
     if (delaySamples >= static_cast<int>(data.size())) {
-        return output;
+        return;
     }
 
     for (int i = delaySamples; i < static_cast<int>(data.size()); ++i) {
@@ -162,16 +296,18 @@ AudioBuffer VoiceFilter::applyEcho(const AudioBuffer& input, float delay, float
         // 클리핑 방지
         data[i] = std::max(-1.0f, std::min(1.0f, data[i]));
     }
-
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyReverb(const AudioBuffer& input, float roomSize, float damping) {
-    // 간단한 리버브: 여러 딜레이의 조합
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
+    processChannels(output, [&](std::vector<float>& data) {
+        processReverb(data, roomSize, damping, input.getSampleRate());
+    });
+    return output;
+}
 
+void VoiceFilter::processReverb(std::vector<float>& data, float roomSize, float damping, int sampleRate) {
+    // 간단한 리버브: 여러 딜레이의 조합
     // 여러 딜레이 라인
     std::vector<int> delays = {
         static_cast<int>(0.029f * roomSize * sampleRate),
@@ -190,8 +326,6 @@ AudioBuffer VoiceFilter::applyReverb(const AudioBuffer& input, float roomSize, f
             data[i] = std::max(-1.0f, std::min(1.0f, data[i]));
         }
     }
-
-    return output;
 }
 
 void VoiceFilter::applySimpleLowPass(std::vector<float>& data, float cutoff, int sampleRate) {
@@ -249,11 +383,31 @@ float VoiceFilter::calculateRMS(const std::vector<float>& data) {
     return std::sqrt(sum / size);
 }
 
+float VoiceFilter::calculateRMS(const std::vector<std::vector<float>>& channels) {
+    if (channels.size() == 1) {
+        return calculateRMS(channels[0]);
+    }
+
+    float sum = 0.0f;
+    size_t total = 0;
+    for (const auto& channel : channels) {
+        float rms = calculateRMS(channel);
+        sum += rms * rms * channel.size();
+        total += channel.size();
+    }
+    return total > 0 ? std::sqrt(sum / total) : 0.0f;
+}
+
 AudioBuffer VoiceFilter::applyDistortion(const AudioBuffer& input, float drive, float tone) {
-    // 🎸 기타 앰프 같은 왜곡 효과
     AudioBuffer output = input;
-    auto& data = output.getData();
-    
+    processChannels(output, [&](std::vector<float>& data) {
+        processDistortion(data, drive, tone, input.getSampleRate());
+    });
+    return output;
+}
+
+void VoiceFilter::processDistortion(std::vector<float>& data, float drive, float tone, int sampleRate) {
+    // 🎸 기타 앰프 같은 왜곡 효과
     // Drive: 0.0 ~ 1.0 -> 1.0 ~ 10.0 배 증폭
     float gain = 1.0f + drive * 9.0f;
     
@@ -270,30 +424,32 @@ AudioBuffer VoiceFilter::applyDistortion(const AudioBuffer& input, float drive,
         // Tone 조정 (고역 필터)
         if (i > 0) {
             float rc = 1.0f / (2.0f * M_PI * toneCutoff);
-            float dt = 1.0f / input.getSampleRate();
+            float dt = 1.0f / sampleRate;
             float alpha = dt / (rc + dt);
             sample = data[i - 1] + alpha * (sample - data[i - 1]);
         }
         
         data[i] = sample;
     }
-    
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyAMRadio(const AudioBuffer& input, float noiseLevel, float bandwidth) {
-    // 📻 AM 라디오 느낌: 노이즈 + 대역 제한
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
-    
+    processChannels(output, [&](std::vector<float>& data) {
+        processAMRadio(data, noiseLevel, bandwidth, input.getSampleRate());
+    });
+    return output;
+}
+
+void VoiceFilter::processAMRadio(std::vector<float>& data, float noiseLevel, float bandwidth, int sampleRate) {
+    // 📻 AM 라디오 느낌: 노이즈 + 대역 제한
     // 대역 제한: bandwidth 0.0 ~ 1.0 -> 2000Hz ~ 4000Hz
     float lowCut = 200.0f;
     float highCut = 2000.0f + bandwidth * 2000.0f;
     
     // Band pass 필터 적용
-    output = applyBandPass(output, lowCut, highCut);
-    data = output.getData();
+    applySimpleHighPass(data, lowCut, sampleRate);
+    applySimpleLowPass(data, highCut, sampleRate);
     
     // 노이즈 추가: noiseLevel 0.0 ~ 1.0 -> 0.0 ~ 0.15
     float noiseAmount = noiseLevel * 0.15f;
@@ -307,16 +463,18 @@ AudioBuffer VoiceFilter::applyAMRadio(const AudioBuffer& input, float noiseLevel
         data[i] += noise;
         data[i] = std::max(-1.0f, std::min(1.0f, data[i]));
     }
-    
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyChorus(const AudioBuffer& input, float rate, float depth) {
-    // 🎵 합창 효과: 여러 목소리가 함께 부르는 느낌 (부드럽고 넓은 느낌)
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
-    
+    processChannels(output, [&](std::vector<float>& data) {
+        processChorus(data, rate, depth, input.getSampleRate());
+    });
+    return output;
+}
+
+void VoiceFilter::processChorus(std::vector<float>& data, float rate, float depth, int sampleRate) {
+    // 🎵 합창 효과: 여러 목소리가 함께 부르는 느낌 (부드럽고 넓은 느낌)
     // Rate: 0.0 ~ 1.0 -> 0.1Hz ~ 1.5Hz (느린 변조)
     float modRate = 0.1f + rate * 1.4f;
     
@@ -351,16 +509,18 @@ AudioBuffer VoiceFilter::applyChorus(const AudioBuffer& input, float rate, float
             delayIndex = (delayIndex + 1) % (maxDelaySamples + 1);
         }
     }
-    
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyFlanger(const AudioBuffer& input, float rate, float depth) {
-    // 🌊 플랜저 효과: "우우우우" 날아다니는 느낌 (날카롭고 빠른 느낌)
     AudioBuffer output = input;
-    auto& data = output.getData();
-    int sampleRate = input.getSampleRate();
-    
+    processChannels(output, [&](std::vector<float>& data) {
+        processFlanger(data, rate, depth, input.getSampleRate());
+    });
+    return output;
+}
+
+void VoiceFilter::processFlanger(std::vector<float>& data, float rate, float depth, int sampleRate) {
+    // 🌊 플랜저 효과: "우우우우" 날아다니는 느낌 (날카롭고 빠른 느낌)
     // Rate: 0.0 ~ 1.0 -> 0.5Hz ~ 8.0Hz (빠른 변조)
     float modRate = 0.5f + rate * 7.5f;
     
@@ -397,105 +557,116 @@ AudioBuffer VoiceFilter::applyFlanger(const AudioBuffer& input, float rate, floa
             delayIndex = (delayIndex + 1) % (maxDelaySamples + 1);
         }
     }
-    
-    return output;
 }
 
 AudioBuffer VoiceFilter::applyVoiceChangerMaleToFemale(const AudioBuffer& input, float intensity) {
+    AudioBuffer output = input;
+    loadChannels(input, planarScratch_);
+    processVoiceChangerMaleToFemale(planarScratch_, intensity, input.getSampleRate());
+    storeChannels(planarScratch_, output);
+    return output;
+}
+
+void VoiceFilter::processVoiceChangerMaleToFemale(std::vector<std::vector<float>>& channels,
+                                                  float intensity, int sampleRate) {
     // 👨→👩 남자 목소리를 여자 목소리로 변환 (얇은 목소리만 나오도록)
     // intensity: 0.0 ~ 1.0 -> 피치 시프트 강도 (0 = 변화 없음, 1 = 최대 변환)
     
-    const auto& inputData = input.getData();
-    int sampleRate = input.getSampleRate();
-    
     // 피치 시프트: intensity에 따라 +3 ~ +6 semitones (남->여)
     float pitchShift = 3.0f + intensity * 3.0f; // +3 ~ +6 semitones
     
-    // SoundTouch 사용
-    soundtouch::SoundTouch st;
-    st.setSampleRate(sampleRate);
-    st.setChannels(1);
-    st.setPitchSemiTones(pitchShift);
-    st.setTempo(1.0f);  // 속도 유지
-    st.setSetting(SETTING_USE_AA_FILTER, 1);
-    st.setSetting(SETTING_AA_FILTER_LENGTH, 64);
-    st.setSetting(SETTING_SEQUENCE_MS, 40);
-    st.setSetting(SETTING_SEEKWINDOW_MS, 15);
-    st.setSetting(SETTING_OVERLAP_MS, 8);
-    
-    // Process
-    std::vector<float> samples(inputData.begin(), inputData.end());
-    st.putSamples(samples.data(), samples.size());
-    st.flush();
-    
-    // Retrieve output
-    std::vector<float> outputData;
-    outputData.resize(samples.size() * 2);  // 여유 공간
-    int received = st.receiveSamples(outputData.data(), outputData.size());
-    outputData.resize(received);
-    
-    AudioBuffer result(sampleRate, 1);
-    result.setData(outputData);
+    // SoundTouch 사용 (모든 채널을 한 인스턴스로)
+    std::vector<std::vector<float>> outputData;
+    pitchShiftChannels(channels, pitchShift, sampleRate, outputData);
     
     // 이중으로 들리지 않도록 블렌드 제거, 피치 시프트만 사용
     // 약간의 고역 강조로 더 자연스러운 여성 목소리 느낌 (블렌드 없이)
     if (intensity > 0.5f) {
         // 고역 통과 필터로 약간 밝게 (원본 블렌드 없이)
         float highCut = 1500.0f + intensity * 1500.0f;
-        result = applyHighPass(result, highCut);
+        for (auto& channel : outputData) {
+            applySimpleHighPass(channel, highCut, sampleRate);
+        }
     }
-    
-    return result;
+
+    channels.swap(outputData);
 }
 
 AudioBuffer VoiceFilter::applyVoiceChangerFemaleToMale(const AudioBuffer& input, float intensity) {
+    AudioBuffer output = input;
+    loadChannels(input, planarScratch_);
+    processVoiceChangerFemaleToMale(planarScratch_, intensity, input.getSampleRate());
+    storeChannels(planarScratch_, output);
+    return output;
+}
+
+void VoiceFilter::processVoiceChangerFemaleToMale(std::vector<std::vector<float>>& channels,
+                                                  float intensity, int sampleRate) {
     // 🎭 범인 목소리: 얇은 목소리와 낮은 목소리가 2중으로 들려서 수상해 보이게
     // intensity: 0.0 ~ 1.0 -> 피치 시프트 강도 (0 = 변화 없음, 1 = 최대 변환)
     
-    const auto& inputData = input.getData();
-    int sampleRate = input.getSampleRate();
-    
     // 피치 시프트: intensity에 따라 -4 ~ -7 semitones (더 낮게)
     float pitchShift = -4.0f - intensity * 3.0f; // -4 ~ -7 semitones
     
-    // SoundTouch 사용
+    // SoundTouch 사용 (모든 채널을 한 인스턴스로)
+    std::vector<std::vector<float>> outputData;
+    pitchShiftChannels(channels, pitchShift, sampleRate, outputData);
+    
+    for (size_t c = 0; c < outputData.size(); ++c) {
+        std::vector<float>& output = outputData[c];
+        const std::vector<float>& data = channels[c];
+
+        // 저역 통과 필터로 범인 목소리 느낌
+        if (intensity > 0.5f) {
+            float lowCut = 600.0f - intensity * 200.0f; // 400Hz ~ 600Hz
+            applySimpleLowPass(output, lowCut, sampleRate);
+        }
+        
+        // 이중으로 들리게 하기 위해 원본과 블렌드 (수상해 보이게)
+        for (size_t i = 0; i < std::min(output.size(), data.size()); ++i) {
+            // 낮은 목소리(변환된 것)와 얇은 목소리(원본)를 함께 믹스
+            output[i] = output[i] * 0.6f + data[i] * 0.4f;
+        }
+    }
+
+    channels.swap(outputData);
+}
+
+void VoiceFilter::pitchShiftChannels(const std::vector<std::vector<float>>& channels, float semitones,
+                                     int sampleRate, std::vector<std::vector<float>>& output) {
+    const int channelCount = (int)channels.size();
+    const int frames = channelCount > 0 ? (int)channels[0].size() : 0;
+
     soundtouch::SoundTouch st;
     st.setSampleRate(sampleRate);
-    st.setChannels(1);
-    st.setPitchSemiTones(pitchShift);
+    st.setChannels(channelCount);
+    st.setPitchSemiTones(semitones);
     st.setTempo(1.0f);  // 속도 유지
     st.setSetting(SETTING_USE_AA_FILTER, 1);
     st.setSetting(SETTING_AA_FILTER_LENGTH, 64);
     st.setSetting(SETTING_SEQUENCE_MS, 40);
     st.setSetting(SETTING_SEEKWINDOW_MS, 15);
     st.setSetting(SETTING_OVERLAP_MS, 8);
-    
-    // Process
-    std::vector<float> samples(inputData.begin(), inputData.end());
-    st.putSamples(samples.data(), samples.size());
+
+    // Process (모노는 입력 버퍼를 직접 전달, 다채널은 interleave 후 전달)
+    if (channelCount == 1) {
+        st.putSamples(channels[0].data(), frames);
+    } else {
+        ChannelLayout::interleave(channels, frames, interleavedScratch_);
+        st.putSamples(interleavedScratch_.data(), frames);
+    }
     st.flush();
-    
+
     // Retrieve output
-    std::vector<float> outputData;
-    outputData.resize(samples.size() * 2);  // 여유 공간
-    int received = st.receiveSamples(outputData.data(), outputData.size());
-    outputData.resize(received);
-    
-    AudioBuffer result(sampleRate, 1);
-    result.setData(outputData);
-    
-    // 저역 통과 필터로 범인 목소리 느낌
-    if (intensity > 0.5f) {
-        float lowCut = 600.0f - intensity * 200.0f; // 400Hz ~ 600Hz
-        result = applyLowPass(result, lowCut);
-    }
-    
-    // 이중으로 들리게 하기 위해 원본과 블렌드 (수상해 보이게)
-    auto& resultData = result.getData();
-    for (size_t i = 0; i < std::min(resultData.size(), inputData.size()); ++i) {
-        // 낮은 목소리(변환된 것)와 얇은 목소리(원본)를 함께 믹스
-        resultData[i] = resultData[i] * 0.6f + inputData[i] * 0.4f;
+    std::vector<float> received;
+    received.resize((size_t)frames * 2 * channelCount);  // 여유 공간
+    int receivedFrames = st.receiveSamples(received.data(), frames * 2);
+    received.resize((size_t)receivedFrames * channelCount);
+
+    if (channelCount == 1) {
+        output.resize(1);
+        output[0].swap(received);
+    } else {
+        ChannelLayout::deinterleave(received.data(), receivedFrames, channelCount, output);
     }
-    
-    return result;
 }
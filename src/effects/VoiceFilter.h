@@ -2,6 +2,7 @@
 #define VOICEFILTER_H
 
 #include "../audio/AudioBuffer.h"
+#include <vector>
 
 enum class FilterType {
     LOW_PASS,
@@ -26,6 +27,20 @@ public:
     // 음성 필터 적용
     AudioBuffer applyFilter(const AudioBuffer& input, FilterType type, float param1 = 0.5f, float param2 = 0.5f);
 
+    // 음성 필터 적용 (버퍼 직접 수정, 복사 없음)
+    // postGain: 볼륨 보정 루프에 융합되는 추가 gain (EffectChain의 gain/clamp 스테이지)
+    void applyFilterInPlace(std::vector<float>& data, int sampleRate, FilterType type,
+                            float param1 = 0.5f, float param2 = 0.5f, float postGain = 1.0f);
+
+    // 다채널 필터 적용 (planar: 채널마다 별도 배열)
+    // 채널마다 같은 커널을 적용하고, 볼륨 보정 gain은 전체 채널 RMS로 한 번만 계산 (채널 간 균형 유지)
+    void applyFilterPlanar(std::vector<std::vector<float>>& channels, int sampleRate, FilterType type,
+                           float param1 = 0.5f, float param2 = 0.5f, float postGain = 1.0f);
+
+    // 다채널 필터 적용 (interleaved: L R L R ..., channels == 1이면 applyFilterInPlace와 동일)
+    void applyFilterInterleaved(std::vector<float>& data, int channels, int sampleRate, FilterType type,
+                                float param1 = 0.5f, float param2 = 0.5f, float postGain = 1.0f);
+
     // 개별 효과
     AudioBuffer applyLowPass(const AudioBuffer& input, float cutoff);
     AudioBuffer applyHighPass(const AudioBuffer& input, float cutoff);
@@ -44,9 +59,52 @@ private:
     // 간단한 필터 구현
     void applySimpleLowPass(std::vector<float>& data, float cutoff, int sampleRate);
     void applySimpleHighPass(std::vector<float>& data, float cutoff, int sampleRate);
+
+    // 개별 효과 커널 (버퍼 직접 수정)
+    void processRobot(std::vector<float>& data, int sampleRate);
+    void processEcho(std::vector<float>& data, float delay, float feedback, int sampleRate);
+    void processReverb(std::vector<float>& data, float roomSize, float damping, int sampleRate);
+    void processDistortion(std::vector<float>& data, float drive, float tone, int sampleRate);
+    void processAMRadio(std::vector<float>& data, float noiseLevel, float bandwidth, int sampleRate);
+    void processChorus(std::vector<float>& data, float rate, float depth, int sampleRate);
+    void processFlanger(std::vector<float>& data, float rate, float depth, int sampleRate);
+    void processVoiceChangerMaleToFemale(std::vector<std::vector<float>>& channels, float intensity, int sampleRate);
+    void processVoiceChangerFemaleToMale(std::vector<std::vector<float>>& channels, float intensity, int sampleRate);
+
+    // SoundTouch 피치 변경 (모든 채널을 한 인스턴스로 처리해 채널 간 세그먼트 위치 일치)
+    void pitchShiftChannels(const std::vector<std::vector<float>>& channels, float semitones,
+                            int sampleRate, std::vector<std::vector<float>>& output);
+
+    // AudioBuffer (interleaved / planar) <-> 채널별 배열
+    void loadChannels(const AudioBuffer& buffer, std::vector<std::vector<float>>& planes);
+    void storeChannels(const std::vector<std::vector<float>>& planes, AudioBuffer& buffer);
+
+    // 다채널 / planar AudioBuffer의 채널마다 커널 적용
+    template <typename Kernel>
+    void processChannels(AudioBuffer& buffer, Kernel kernel);
     
+    // 필터 커널 적용 (알 수 없는 타입이면 false)
+    bool applyKernel(std::vector<std::vector<float>>& channels, int sampleRate, FilterType type,
+                     float param1, float param2);
+    bool applyChannelKernel(std::vector<float>& data, int sampleRate, FilterType type,
+                            float param1, float param2);
+
     // RMS 계산 (볼륨 보정용)
     float calculateRMS(const std::vector<float>& data);
+    float calculateRMS(const std::vector<std::vector<float>>& channels);
+
+    // 볼륨 보정 gain (최대 3배) / gain + 클램프 적용
+    float correctionGain(float originalRMS, float filteredRMS);
+    void applyGain(std::vector<float>& data, float gain);
+
+    // 다채널 처리용 버퍼 (호출 간 재사용)
+    std::vector<std::vector<float>> planarScratch_;   // interleaved 입력의 planar 변환
+    std::vector<std::vector<float>> monoPlane_;       // 모노 입력을 채널 하나짜리 planar로 처리
+    std::vector<float> interleavedScratch_;           // SoundTouch 입력 (다채널)
+
+    // 위 재사용 버퍼들의 용량 (MemoryTracker)
+    MemoryAccount scratchMemory_;
+    void syncScratchMemory();
 };
 
 #endif // VOICEFILTER_H
@@ -5,16 +5,22 @@
 #include "audio/AudioBuffer.h"
 #include "analysis/PitchAnalyzer.h"
 #include "effects/VoiceFilter.h"
-#include "effects/AudioReverser.h"
+#include "effects/EffectChain.h"
+#include "effects/ProcessingSession.h"
 #include "performance/PerformanceChecker.h"
+#include "performance/TaskPool.h"
 
 // 직접 구현한 DSP 알고리즘
 #include "dsp/SimplePitchShifter.h"
 #include "dsp/SimpleTimeStretcher.h"
+#include "dsp/SampleRateConverter.h"
+#include "dsp/VariablePitchRenderer.h"
 
 // 외부 라이브러리 (비교용으로 남겨둠)
 #include <SoundTouch.h>
 
+#include <algorithm>
+
 using namespace emscripten;
 
 // 초기화
@@ -22,6 +28,64 @@ void init() {
   // 필요 시 초기화 작업 수행
 }
 
+/**
+ * 작업 풀 스레드 수 (0 = 코어 수, 1 = 단일 스레드)
+ * 단일 스레드 빌드(main.js)에서는 무시되고 getThreadCount()는 항상 1
+ */
+void setThreadCount(int count) {
+  TaskPool::getInstance().setThreadCount(count);
+}
+
+int getThreadCount() {
+  return TaskPool::getInstance().getThreadCount();
+}
+
+bool isThreadedBuild() {
+  return TaskPool::isThreaded();
+}
+
+/**
+ * 아래 처리 함수들(simple 알고리즘)의 WSOLA 겹침 위치 탐색 정책
+ * 저사양 기기에서 품질 대신 CPU를 아낄 때 사용 (ProcessingSession은 세션별 setSearchPolicy)
+ */
+static OverlapSearchPolicy searchPolicy;
+
+void setSearchPolicy(const OverlapSearchPolicy& policy) {
+  searchPolicy = policy;   // 잘못된 값은 처리기가 적용할 때 보정
+}
+
+OverlapSearchPolicy getSearchPolicy() {
+  return searchPolicy;
+}
+
+/**
+ * 같은 처리 함수들의 WSOLA 크로스페이드 모양 (기본 LINEAR)
+ * EQUAL_POWER: 상관관계가 낮은 이음새(잡음, 자음)에서 음량이 꺼지지 않음
+ */
+static CrossfadeShape crossfadeShape = CrossfadeShape::LINEAR;
+
+void setCrossfadeShape(CrossfadeShape shape) {
+  crossfadeShape = shape;
+}
+
+CrossfadeShape getCrossfadeShape() {
+  return crossfadeShape;
+}
+
+// PitchPoint 목록을 JavaScript 배열로 변환
+val pitchPointsToArray(const std::vector<PitchPoint>& pitchPoints) {
+  val result = val::array();
+  for (const auto &point: pitchPoints) {
+    val obj = val::object();
+    obj.set("time", point.time);
+    obj.set("frequency", point.frequency);
+    obj.set("confidence", point.confidence);
+    result.call<void>("push", obj);
+  }
+
+  return result;
+}
+
 // Pitch 분석
 val analyzePitch(uintptr_t dataPtr, int length, int sampleRate) {
   float *data = reinterpret_cast<float *>(dataPtr);
@@ -34,16 +98,32 @@ val analyzePitch(uintptr_t dataPtr, int length, int sampleRate) {
   auto pitchPoints = analyzer.analyze(buffer);
 
   // JavaScript 배열로 변환
-  val result = val::array();
-  for (const auto &point: pitchPoints) {
-    val obj = val::object();
-    obj.set("time", point.time);
-    obj.set("frequency", point.frequency);
-    obj.set("confidence", point.confidence);
-    result.call<void>("push", obj);
+  return pitchPointsToArray(pitchPoints);
+}
+
+/**
+ * 내부 처리 샘플레이트에서 Pitch 분석
+ * 입력을 processingRate로 변환한 뒤 분석 (autocorrelation 비용이 프레임 길이의 제곱에 비례)
+ * 결과의 time은 초 단위라 입력 샘플레이트와 무관
+ *
+ * @param processingRate 분석 샘플레이트 (0 또는 sampleRate 이상이면 변환 없음)
+ */
+val analyzePitchAtRate(uintptr_t dataPtr, int length, int sampleRate, int processingRate) {
+  if (processingRate <= 0 || processingRate >= sampleRate) {
+    return analyzePitch(dataPtr, length, sampleRate);
   }
 
-  return result;
+  const float* data = reinterpret_cast<const float*>(dataPtr);
+  std::vector<float> samples;
+  SampleRateConverter converter;
+  converter.setRates(sampleRate, processingRate);
+  converter.convert(data, length, samples);
+
+  AudioBuffer buffer(processingRate, 1);
+  buffer.setData(std::move(samples));
+
+  PitchAnalyzer analyzer;
+  return pitchPointsToArray(analyzer.analyze(buffer));
 }
 
 /**
@@ -54,7 +134,7 @@ val analyzePitch(uintptr_t dataPtr, int length, int sampleRate) {
  * @param length 오디오 길이 (샘플 수)
  * @param sampleRate 샘플레이트
  * @param pitchSemitones Pitch shift 양 (semitones, -12 ~ +12)
- * @param algorithm 알고리즘 선택 ("simple" 또는 "soundtouch")
+ * @param algorithm 알고리즘 선택 ("simple", "simple-cubic", "simple-sinc16", "simple-sinc64" 또는 "soundtouch")
  * @param perfCheckerVal PerformanceChecker 객체 (optional)
  * @return 처리된 오디오 (Float32Array)
  */
@@ -66,15 +146,10 @@ emscripten::val applyUniformPitchShift(
     const std::string& algorithm,
     val perfCheckerVal = val::null()
 ) {
-  // 1. 오디오 데이터 변환
-  float* audioData = reinterpret_cast<float*>(dataPtr);
-  std::vector<float> samples(audioData, audioData + length);
-
-  // 2. AudioBuffer 생성
-  AudioBuffer buffer(sampleRate, 1);
-  buffer.setData(samples);
+  // 결과 버퍼는 호출 간에 유지 (반환된 view가 함수 종료 후에도 유효한 메모리를 가리키도록)
+  static std::vector<float> resultData;
 
-  AudioBuffer result(sampleRate, 1);
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
 
   // PerformanceChecker 가져오기 (옵션)
   PerformanceChecker* perfChecker = nullptr;
@@ -96,23 +171,23 @@ emscripten::val applyUniformPitchShift(
     st.setSetting(SETTING_OVERLAP_MS, 8);
 
     // Process
-    st.putSamples(samples.data(), samples.size());
+    st.putSamples(audioData, length);
     st.flush();
 
     // Retrieve output
-    std::vector<float> outputData;
-    outputData.resize(samples.size() * 2);  // 여유 공간
-    int received = st.receiveSamples(outputData.data(), outputData.size());
-    outputData.resize(received);
-    result.setData(outputData);
+    resultData.resize(length * 2);  // 여유 공간
+    int received = st.receiveSamples(resultData.data(), resultData.size());
+    resultData.resize(received);
   } else {
-    // 3. 직접 구현한 SimplePitchShifter 사용 (기본값)
-    SimplePitchShifter pitchShifter;
-    result = pitchShifter.process(buffer, pitchSemitones, perfChecker);
+    // 직접 구현한 SimplePitchShifter 사용 (기본값, 내부 버퍼 재사용)
+    static SimplePitchShifter pitchShifter;
+    pitchShifter.setResamplerQuality(SimplePitchShifter::qualityFromAlgorithm(algorithm));
+    pitchShifter.setSearchPolicy(searchPolicy);
+    pitchShifter.setCrossfadeShape(crossfadeShape);
+    pitchShifter.process(audioData, length, sampleRate, pitchSemitones, resultData, 1.0f, perfChecker);
   }
 
-  // 4. Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조)
-  const auto& resultData = result.getData();
+  // Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조, 다음 호출 전까지 유효)
   return val(typed_memory_view(resultData.size(), resultData.data()));
 }
 
@@ -123,7 +198,8 @@ emscripten::val applyUniformPitchShift(
  * @param dataPtr 오디오 데이터 포인터
  * @param length 오디오 길이 (샘플 수)
  * @param sampleRate 샘플레이트
- * @param durationRatio Time stretch 비율 (0.5 ~ 2.0, 1.0 = 변화 없음)
+ * @param durationRatio Time stretch 비율 = tempo (0.5 ~ 2.0, 1.0 = 변화 없음, 1.5 = 1.5배 빠르게, 출력 길이 = 입력 / durationRatio)
+ *                      모듈 전체가 같은 의미 (applyUniformPitchTempo / applyPitchCurve / applyFrameEdits)
  * @param algorithm 알고리즘 선택 ("simple" 또는 "soundtouch")
  * @param perfCheckerVal PerformanceChecker 객체 (optional)
  * @return 처리된 오디오 (Float32Array)
@@ -136,15 +212,10 @@ emscripten::val applyUniformTimeStretch(
     const std::string& algorithm,
     val perfCheckerVal = val::null()
 ) {
-  // 1. 오디오 데이터 변환
-  float* audioData = reinterpret_cast<float*>(dataPtr);
-  std::vector<float> samples(audioData, audioData + length);
+  // 결과 버퍼는 호출 간에 유지 (반환된 view가 함수 종료 후에도 유효한 메모리를 가리키도록)
+  static std::vector<float> resultData;
 
-  // 2. AudioBuffer 생성
-  AudioBuffer buffer(sampleRate, 1);
-  buffer.setData(samples);
-
-  AudioBuffer result(sampleRate, 1);
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
 
   // PerformanceChecker 가져오기 (옵션)
   PerformanceChecker* perfChecker = nullptr;
@@ -166,24 +237,201 @@ emscripten::val applyUniformTimeStretch(
     st.setSetting(SETTING_OVERLAP_MS, 8);
 
     // Process
-    st.putSamples(samples.data(), samples.size());
+    st.putSamples(audioData, length);
     st.flush();
 
     // Retrieve output - 예상 출력 크기 계산
-    size_t expectedSize = static_cast<size_t>(samples.size() / durationRatio) + 8192;
-    std::vector<float> outputData;
-    outputData.resize(expectedSize);
-    int received = st.receiveSamples(outputData.data(), outputData.size());
-    outputData.resize(received);
-    result.setData(outputData);
+    size_t expectedSize = static_cast<size_t>(length / durationRatio) + 8192;
+    resultData.resize(expectedSize);
+    int received = st.receiveSamples(resultData.data(), resultData.size());
+    resultData.resize(received);
   } else {
-    // 3. 직접 구현한 SimpleTimeStretcher 사용 (기본값)
-    SimpleTimeStretcher timeStretcher;
-    result = timeStretcher.process(buffer, durationRatio, perfChecker);
+    // 직접 구현한 SimpleTimeStretcher 사용 (기본값)
+    static SimpleTimeStretcher timeStretcher;
+    timeStretcher.setSearchPolicy(searchPolicy);
+    timeStretcher.setCrossfadeShape(crossfadeShape);
+    timeStretcher.process(audioData, length, sampleRate, durationRatio, resultData, perfChecker);
   }
 
-  // 4. Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조)
-  const auto& resultData = result.getData();
+  // Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조, 다음 호출 전까지 유효)
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+/**
+ * 전체 파일에 균일한 Pitch Shift + Time Stretch를 한 번에 적용
+ * applyUniformPitchShift -> applyUniformTimeStretch 두 번 호출과 같은 결과를
+ * WSOLA 1회 + 리샘플링 1회로 계산 (SimplePitchShifter::processWithTempo)
+ *
+ * @param dataPtr 오디오 데이터 포인터
+ * @param length 오디오 길이 (샘플 수)
+ * @param sampleRate 샘플레이트
+ * @param pitchSemitones Pitch shift 양 (semitones, -12 ~ +12)
+ * @param durationRatio Time stretch 비율 (applyUniformTimeStretch와 동일)
+ * @param perfCheckerVal PerformanceChecker 객체 (optional)
+ * @return 처리된 오디오 (Float32Array, 다음 applyUniformPitchTempo 호출 전까지 유효)
+ */
+emscripten::val applyUniformPitchTempo(
+    uintptr_t dataPtr,
+    int length,
+    int sampleRate,
+    float pitchSemitones,
+    float durationRatio,
+    val perfCheckerVal = val::null()
+) {
+  // 처리기와 결과 버퍼는 호출 간에 유지 (재할당 없음 + 반환된 view의 수명 보장)
+  static SimplePitchShifter pitchShifter;
+  static std::vector<float> resultData;
+
+  PerformanceChecker* perfChecker = nullptr;
+  if (!perfCheckerVal.isNull() && !perfCheckerVal.isUndefined()) {
+    perfChecker = &perfCheckerVal.as<PerformanceChecker&>();
+  }
+
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
+  pitchShifter.setSearchPolicy(searchPolicy);
+  pitchShifter.setCrossfadeShape(crossfadeShape);
+  pitchShifter.processWithTempo(audioData, length, sampleRate, pitchSemitones, durationRatio,
+                                resultData, 1.0f, perfChecker);
+
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+/**
+ * 다채널 (interleaved) Pitch Shift + Time Stretch
+ * WSOLA 겹침 위치를 mid 신호에서 한 번만 찾아 모든 채널에 적용 (채널별 모노 처리처럼 어긋나지 않음)
+ *
+ * @param dataPtr 오디오 데이터 포인터 (L R L R ...)
+ * @param frames 채널당 샘플 수
+ * @param channels 채널 수
+ * @param sampleRate 샘플레이트
+ * @param pitchSemitones Pitch shift 양 (0 = 속도만 변경)
+ * @param durationRatio Time stretch 비율 (1.0 = 피치만 변경)
+ * @param algorithm 리샘플링 품질 ("simple", "simple-cubic", "simple-sinc16", "simple-sinc64")
+ * @return 처리된 오디오 (interleaved Float32Array, 다음 호출 전까지 유효)
+ */
+emscripten::val applyUniformPitchTempoInterleaved(
+    uintptr_t dataPtr,
+    int frames,
+    int channels,
+    int sampleRate,
+    float pitchSemitones,
+    float durationRatio,
+    const std::string& algorithm,
+    val perfCheckerVal = val::null()
+) {
+  static SimplePitchShifter pitchShifter;
+  static std::vector<float> resultData;
+
+  PerformanceChecker* perfChecker = nullptr;
+  if (!perfCheckerVal.isNull() && !perfCheckerVal.isUndefined()) {
+    perfChecker = &perfCheckerVal.as<PerformanceChecker&>();
+  }
+
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
+  pitchShifter.setResamplerQuality(SimplePitchShifter::qualityFromAlgorithm(algorithm));
+  pitchShifter.setSearchPolicy(searchPolicy);
+  pitchShifter.setCrossfadeShape(crossfadeShape);
+  pitchShifter.processWithTempoInterleaved(audioData, frames, channels, sampleRate, pitchSemitones,
+                                           durationRatio, resultData, 1.0f, perfChecker);
+
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+/**
+ * 시간에 따라 변하는 pitch / duration 렌더링 (편집기의 구간별 편집을 한 번에 처리)
+ * 구간마다 균일 처리를 따로 호출하지 않고 WSOLA + 리샘플링 한 번의 패스로 렌더링
+ *
+ * @param dataPtr 오디오 데이터 포인터
+ * @param length 오디오 길이 (샘플 수)
+ * @param sampleRate 샘플레이트
+ * @param pitchCurvePtr 샘플별 semitones (Float32Array, length개, 0이면 pitch 변화 없음)
+ * @param durationCurvePtr 샘플별 duration ratio = tempo (Float32Array, length개, 0이면 길이 변화 없음)
+ *                         applyUniformTimeStretch와 같은 의미: 1.5 = 1.5배 빠르게, 출력 길이 = 구간별 (입력 / durationRatio)의 합
+ * @param perfCheckerVal PerformanceChecker 객체 (optional)
+ * @return 처리된 오디오 (Float32Array, 다음 렌더링 호출 전까지 유효)
+ */
+val applyPitchCurve(
+    uintptr_t dataPtr,
+    int length,
+    int sampleRate,
+    uintptr_t pitchCurvePtr,
+    uintptr_t durationCurvePtr,
+    val perfCheckerVal = val::null()
+) {
+  // 렌더러와 결과 버퍼는 호출 간에 유지 (재할당 없음 + 반환된 view의 수명 보장)
+  static VariablePitchRenderer renderer;
+  static std::vector<float> pitchCurve;
+  static std::vector<float> durationCurve;
+  static std::vector<float> resultData;
+
+  PerformanceChecker* perfChecker = nullptr;
+  if (!perfCheckerVal.isNull() && !perfCheckerVal.isUndefined()) {
+    perfChecker = &perfCheckerVal.as<PerformanceChecker&>();
+  }
+
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
+  const float* pitchData = reinterpret_cast<const float*>(pitchCurvePtr);
+  const float* durationData = reinterpret_cast<const float*>(durationCurvePtr);
+  pitchCurve.assign(pitchData, pitchData ? pitchData + length : pitchData);
+  durationCurve.assign(durationData, durationData ? durationData + length : durationData);
+
+  renderer.setSearchPolicy(searchPolicy);
+  renderer.setCrossfadeShape(crossfadeShape);
+  renderer.render(audioData, length, sampleRate, pitchCurve, durationCurve, resultData, perfChecker);
+
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+/**
+ * 프레임별 편집 값 렌더링 (FrameData의 time / pitchSemitones / durationRatio)
+ * 프레임 사이는 선형 보간한 곡선으로 applyPitchCurve와 같은 방식으로 렌더링
+ *
+ * @param timesPtr 프레임 시작 시간 (초, Float32Array, frameCount개)
+ * @param semitonesPtr 프레임별 semitones (Float32Array, frameCount개)
+ * @param durationRatiosPtr 프레임별 duration ratio = tempo (Float32Array, frameCount개, 0이면 1.0,
+ *                          applyUniformTimeStretch와 같은 의미: 1.5 = 1.5배 빠르게)
+ * @param frameCount 프레임 수
+ * @param frameSamples 프레임 길이 (샘플, 편집 값은 프레임 중심에 배치)
+ * @return 처리된 오디오 (Float32Array, 다음 렌더링 호출 전까지 유효)
+ */
+val applyFrameEdits(
+    uintptr_t dataPtr,
+    int length,
+    int sampleRate,
+    uintptr_t timesPtr,
+    uintptr_t semitonesPtr,
+    uintptr_t durationRatiosPtr,
+    int frameCount,
+    int frameSamples,
+    val perfCheckerVal = val::null()
+) {
+  static VariablePitchRenderer renderer;
+  static std::vector<float> pitchCurve;
+  static std::vector<float> durationCurve;
+  static std::vector<float> resultData;
+
+  PerformanceChecker* perfChecker = nullptr;
+  if (!perfCheckerVal.isNull() && !perfCheckerVal.isUndefined()) {
+    perfChecker = &perfCheckerVal.as<PerformanceChecker&>();
+  }
+
+  const float* times = reinterpret_cast<const float*>(timesPtr);
+  const float* semitones = reinterpret_cast<const float*>(semitonesPtr);
+  const float* durationRatios = reinterpret_cast<const float*>(durationRatiosPtr);
+
+  std::vector<FrameData> frames(std::max(0, frameCount));
+  for (int i = 0; i < frameCount; ++i) {
+    frames[i].time = times[i];
+    frames[i].pitchSemitones = semitones[i];
+    frames[i].durationRatio = durationRatios ? durationRatios[i] : 1.0f;
+  }
+  VariablePitchRenderer::framesToCurves(frames, sampleRate, length, frameSamples, pitchCurve, durationCurve);
+
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
+  renderer.setSearchPolicy(searchPolicy);
+  renderer.setCrossfadeShape(crossfadeShape);
+  renderer.render(audioData, length, sampleRate, pitchCurve, durationCurve, resultData, perfChecker);
+
   return val(typed_memory_view(resultData.size(), resultData.data()));
 }
 
@@ -194,17 +442,36 @@ val applyVoiceFilter(uintptr_t dataPtr,
                      int filterType,
                      float param1,
                      float param2) {
-  float *data = reinterpret_cast<float *>(dataPtr);
-  std::vector<float> samples(data, data + length);
+  // 결과 버퍼는 호출 간에 유지 (반환된 view가 함수 종료 후에도 유효한 메모리를 가리키도록)
+  static std::vector<float> resultData;
+  static VoiceFilter filter;
 
-  AudioBuffer buffer(sampleRate, 1);
-  buffer.setData(samples);
+  const float *data = reinterpret_cast<const float *>(dataPtr);
+  resultData.assign(data, data + length);
 
-  VoiceFilter filter;
   FilterType type = static_cast<FilterType>(filterType);
-  AudioBuffer result = filter.applyFilter(buffer, type, param1, param2);
+  filter.applyFilterInPlace(resultData, sampleRate, type, param1, param2);
+
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+// 다채널 (interleaved) 음성 필터 적용 (볼륨 보정은 전체 채널 기준)
+val applyVoiceFilterInterleaved(uintptr_t dataPtr,
+                                int frames,
+                                int channels,
+                                int sampleRate,
+                                int filterType,
+                                float param1,
+                                float param2) {
+  static std::vector<float> resultData;
+  static VoiceFilter filter;
+
+  const float *data = reinterpret_cast<const float *>(dataPtr);
+  resultData.assign(data, data + (size_t)frames * channels);
+
+  FilterType type = static_cast<FilterType>(filterType);
+  filter.applyFilterInterleaved(resultData, channels, sampleRate, type, param1, param2);
 
-  const auto &resultData = result.getData();
   return val(typed_memory_view(resultData.size(), resultData.data()));
 }
 
@@ -234,6 +501,8 @@ int applyUniformPitchShiftInPlace(
   buffer.setData(samples);
 
   SimplePitchShifter pitchShifter;
+  pitchShifter.setSearchPolicy(searchPolicy);
+  pitchShifter.setCrossfadeShape(crossfadeShape);
   AudioBuffer result = pitchShifter.process(buffer, pitchSemitones, nullptr);
 
   const auto& resultData = result.getData();
@@ -264,6 +533,8 @@ int applyUniformTimeStretchInPlace(
   buffer.setData(samples);
 
   SimpleTimeStretcher timeStretcher;
+  timeStretcher.setSearchPolicy(searchPolicy);
+  timeStretcher.setCrossfadeShape(crossfadeShape);
   AudioBuffer result = timeStretcher.process(buffer, durationRatio, nullptr);
 
   const auto& resultData = result.getData();
@@ -277,38 +548,153 @@ int applyUniformTimeStretchInPlace(
 
 // 오디오 역재생
 val reverseAudio(uintptr_t dataPtr, int length, int sampleRate) {
-  float *data = reinterpret_cast<float *>(dataPtr);
-  std::vector<float> samples(data, data + length);
+  // 결과 버퍼는 호출 간에 유지 (반환된 view가 함수 종료 후에도 유효한 메모리를 가리키도록)
+  static std::vector<float> resultData;
 
-  AudioBuffer buffer(sampleRate, 1);
-  buffer.setData(samples);
+  const float *data = reinterpret_cast<const float *>(dataPtr);
+  resultData.resize(length);
+  std::reverse_copy(data, data + length, resultData.begin());
 
-  AudioReverser reverser;
-  AudioBuffer result = reverser.reverse(buffer);
+  // Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조, 다음 호출 전까지 유효)
+  return val(typed_memory_view(resultData.size(), resultData.data()));
+}
+
+/**
+ * 효과 체인을 한 번의 호출로 적용
+ * pitch -> tempo -> filter -> reverse 를 각각 호출하는 대신 WASM 경계를 한 번만 넘고,
+ * ping-pong 버퍼 2개로 모든 스테이지를 처리
+ *
+ * @param dataPtr 오디오 데이터 포인터
+ * @param length 오디오 길이 (샘플 수)
+ * @param sampleRate 샘플레이트
+ * @param spec 직렬화된 스테이지 목록 (예: "pitch:3;tempo:1.25;filter:4,0.5,0.5;reverse;gain:0.8")
+ *             "rate:16000"을 넣으면 내부 샘플레이트 16kHz에서 처리 후 원래 샘플레이트로 복원
+ * @param perfCheckerVal PerformanceChecker 객체 (optional)
+ * @return 처리된 오디오 (Float32Array, 다음 applyEffectChain 호출 전까지 유효), 파싱 실패 시 null
+ */
+val applyEffectChain(
+    uintptr_t dataPtr,
+    int length,
+    int sampleRate,
+    const std::string& spec,
+    val perfCheckerVal = val::null()
+) {
+  // 체인 버퍼는 호출 간에 유지 (재할당 없음 + 반환된 view의 수명 보장)
+  static EffectChain chain;
+
+  if (!chain.parse(spec)) {
+    return val::null();
+  }
+  chain.setSearchPolicy(searchPolicy);
+  chain.setCrossfadeShape(crossfadeShape);
+
+  PerformanceChecker* perfChecker = nullptr;
+  if (!perfCheckerVal.isNull() && !perfCheckerVal.isUndefined()) {
+    perfChecker = &perfCheckerVal.as<PerformanceChecker&>();
+  }
+
+  const float* audioData = reinterpret_cast<const float*>(dataPtr);
+  const std::vector<float>& resultData = chain.process(audioData, length, sampleRate, perfChecker);
 
-  // Float32Array로 변환하여 반환 (Zero-copy: 메모리 직접 참조)
-  const auto& resultData = result.getData();
   return val(typed_memory_view(resultData.size(), resultData.data()));
 }
 
+/**
+ * ProcessingSession 입력 arena view (JS에서 직접 쓰기용)
+ * WASM 메모리가 커지면 무효화되므로 쓰기 직전에 다시 얻어야 함
+ */
+val sessionInputView(ProcessingSession& session) {
+  const float* data = reinterpret_cast<const float*>(session.getInputPointer());
+  return val(typed_memory_view(session.getInputLength(), data));
+}
+
+/**
+ * ProcessingSession 출력 view (다음 처리 호출 전까지 유효)
+ */
+val sessionOutputView(ProcessingSession& session) {
+  const float* data = reinterpret_cast<const float*>(session.getOutputPointer());
+  return val(typed_memory_view(session.getOutputLength(), data));
+}
+
 // Emscripten 바인딩
 EMSCRIPTEN_BINDINGS(audio_module) {
   // 초기화
   function("init", &init);
 
+  // 작업 풀 (멀티스레드 빌드)
+  function("setThreadCount", &setThreadCount);
+  function("getThreadCount", &getThreadCount);
+  function("isThreadedBuild", &isThreadedBuild);
+
+  // WSOLA 겹침 위치 탐색 정책
+  value_object<OverlapSearchPolicy>("OverlapSearchPolicy")
+      .field("goodEnoughThreshold", &OverlapSearchPolicy::goodEnoughThreshold)
+      .field("coarseStep", &OverlapSearchPolicy::coarseStep)
+      .field("maxCandidates", &OverlapSearchPolicy::maxCandidates)
+      .field("blockBudgetMs", &OverlapSearchPolicy::blockBudgetMs);
+  function("setSearchPolicy", &setSearchPolicy);
+  function("getSearchPolicy", &getSearchPolicy);
+
+  // WSOLA 크로스페이드 모양
+  enum_<CrossfadeShape>("CrossfadeShape")
+      .value("LINEAR", CrossfadeShape::LINEAR)
+      .value("EQUAL_POWER", CrossfadeShape::EQUAL_POWER)
+      .value("HANN", CrossfadeShape::HANN);
+  function("setCrossfadeShape", &setCrossfadeShape);
+  function("getCrossfadeShape", &getCrossfadeShape);
+
   // 분석 함수
   function("analyzePitch", &analyzePitch);
+  function("analyzePitchAtRate", &analyzePitchAtRate);
 
   // 효과 함수
   function("applyUniformPitchShift", &applyUniformPitchShift);
   function("applyUniformTimeStretch", &applyUniformTimeStretch);
+  function("applyUniformPitchTempo", &applyUniformPitchTempo);
+  function("applyPitchCurve", &applyPitchCurve);
+  function("applyFrameEdits", &applyFrameEdits);
   function("applyVoiceFilter", &applyVoiceFilter);
   function("reverseAudio", &reverseAudio);
+  function("applyEffectChain", &applyEffectChain);
+
+  // 다채널 (interleaved) 효과 함수
+  function("applyUniformPitchTempoInterleaved", &applyUniformPitchTempoInterleaved);
+  function("applyVoiceFilterInterleaved", &applyVoiceFilterInterleaved);
 
   // InPlace 효과 함수 (Zero-copy 최적화)
   function("applyUniformPitchShiftInPlace", &applyUniformPitchShiftInPlace);
   function("applyUniformTimeStretchInPlace", &applyUniformTimeStretchInPlace);
 
+  // 처리 세션 (입력/출력 arena + DSP 객체를 호출 간에 유지)
+  class_<ProcessingSession>("ProcessingSession")
+      .constructor<>()
+      .function("setSampleRate", &ProcessingSession::setSampleRate)
+      .function("getSampleRate", &ProcessingSession::getSampleRate)
+      .function("setChannels", &ProcessingSession::setChannels)
+      .function("getChannels", &ProcessingSession::getChannels)
+      .function("reserveInput", &ProcessingSession::reserveInput)
+      .function("getInputPointer", &ProcessingSession::getInputPointer)
+      .function("getInputLength", &ProcessingSession::getInputLength)
+      .function("getInputCapacity", &ProcessingSession::getInputCapacity)
+      .function("setInputLength", &ProcessingSession::setInputLength)
+      .function("getInputView", &sessionInputView)
+      .function("getOutputPointer", &ProcessingSession::getOutputPointer)
+      .function("getOutputLength", &ProcessingSession::getOutputLength)
+      .function("getOutputView", &sessionOutputView)
+      .function("commitOutput", &ProcessingSession::commitOutput)
+      .function("pitchShift", &ProcessingSession::pitchShift)
+      .function("timeStretch", &ProcessingSession::timeStretch)
+      // pitchTempo(semitones, tempo, algorithm): algorithm은 pitchShift와 같은 값 ("simple-sinc64" 등)
+      .function("pitchTempo", &ProcessingSession::pitchTempo)
+      .function("applyFilter", &ProcessingSession::applyFilter)
+      .function("reverse", &ProcessingSession::reverse)
+      .function("applyChain", &ProcessingSession::applyChain)
+      .function("setPerformanceChecker", &ProcessingSession::setPerformanceChecker, allow_raw_pointers())
+      .function("setSearchPolicy", &ProcessingSession::setSearchPolicy)
+      .function("getSearchPolicy", &ProcessingSession::getSearchPolicy)
+      .function("setCrossfadeShape", &ProcessingSession::setCrossfadeShape)
+      .function("getCrossfadeShape", &ProcessingSession::getCrossfadeShape);
+
   // FilterType enum
   enum_<FilterType>("FilterType")
       .value("LOW_PASS", FilterType::LOW_PASS)
@@ -328,13 +714,36 @@ EMSCRIPTEN_BINDINGS(audio_module) {
   value_object<PerformanceChecker::FunctionNode>("FunctionNode")
       .field("name", &PerformanceChecker::FunctionNode::name)
       .field("duration", &PerformanceChecker::FunctionNode::duration)
-      .field("children", &PerformanceChecker::FunctionNode::children);
+      .field("children", &PerformanceChecker::FunctionNode::children)
+      .field("count", &PerformanceChecker::FunctionNode::count)
+      .field("allocatedBytes", &PerformanceChecker::FunctionNode::allocatedBytes)
+      .field("allocations", &PerformanceChecker::FunctionNode::allocations)
+      .field("peakBytes", &PerformanceChecker::FunctionNode::peakBytes);
 
   // PerformanceChecker FeatureNode
   value_object<PerformanceChecker::FeatureNode>("FeatureNode")
       .field("feature", &PerformanceChecker::FeatureNode::feature)
       .field("duration", &PerformanceChecker::FeatureNode::duration)
-      .field("functions", &PerformanceChecker::FeatureNode::functions);
+      .field("functions", &PerformanceChecker::FeatureNode::functions)
+      .field("allocatedBytes", &PerformanceChecker::FeatureNode::allocatedBytes)
+      .field("allocations", &PerformanceChecker::FeatureNode::allocations)
+      .field("peakBytes", &PerformanceChecker::FeatureNode::peakBytes);
+
+  // PerformanceChecker Statistics (레이블별 누적 통계, ms)
+  value_object<PerformanceChecker::Statistics>("PerformanceStatistics")
+      .field("label", &PerformanceChecker::Statistics::label)
+      .field("count", &PerformanceChecker::Statistics::count)
+      .field("total", &PerformanceChecker::Statistics::totalMs)
+      .field("average", &PerformanceChecker::Statistics::averageMs)
+      .field("min", &PerformanceChecker::Statistics::minMs)
+      .field("max", &PerformanceChecker::Statistics::maxMs)
+      .field("p50", &PerformanceChecker::Statistics::p50Ms)
+      .field("p90", &PerformanceChecker::Statistics::p90Ms)
+      .field("p99", &PerformanceChecker::Statistics::p99Ms)
+      .field("p999", &PerformanceChecker::Statistics::p999Ms)
+      .field("allocatedBytes", &PerformanceChecker::Statistics::allocatedBytes)
+      .field("allocations", &PerformanceChecker::Statistics::allocations)
+      .field("peakBytes", &PerformanceChecker::Statistics::peakBytes);
 
   // PerformanceChecker class
   class_<PerformanceChecker>("PerformanceChecker")
@@ -342,17 +751,25 @@ EMSCRIPTEN_BINDINGS(audio_module) {
       .function("start", &PerformanceChecker::start)
       .function("end", &PerformanceChecker::end)
       .function("getAverage", &PerformanceChecker::getAverage)
+      .function("getPercentile", &PerformanceChecker::getPercentile)
+      .function("getStatistics", &PerformanceChecker::getStatistics)
       .function("reset", &PerformanceChecker::reset)
       .function("getReportJSON", &PerformanceChecker::getReportJSON)
       .function("getReportCSV", &PerformanceChecker::getReportCSV)
-      .function("startFeature", &PerformanceChecker::startFeature)
+      .function("startFeature", select_overload<void(const std::string&)>(&PerformanceChecker::startFeature))
       .function("endFeature", &PerformanceChecker::endFeature)
-      .function("startFunction", &PerformanceChecker::startFunction)
+      .function("startFunction", select_overload<void(const std::string&)>(&PerformanceChecker::startFunction))
       .function("endFunction", &PerformanceChecker::endFunction)
       .function("getFeatures", &PerformanceChecker::getFeatures)
-      .function("getTotalDuration", &PerformanceChecker::getTotalDuration);
+      .function("getTotalDuration", &PerformanceChecker::getTotalDuration)
+      .function("setTraceMode", &PerformanceChecker::setTraceMode)
+      .function("isTraceMode", &PerformanceChecker::isTraceMode)
+      .function("getChromeTrace", &PerformanceChecker::getChromeTrace)
+      .function("setMemoryTracking", &PerformanceChecker::setMemoryTracking)
+      .function("isMemoryTracking", &PerformanceChecker::isMemoryTracking);
 
   // Vector types
   register_vector<PerformanceChecker::FunctionNode>("VectorFunctionNode");
   register_vector<PerformanceChecker::FeatureNode>("VectorFeatureNode");
+  register_vector<PerformanceChecker::Statistics>("VectorPerformanceStatistics");
 }
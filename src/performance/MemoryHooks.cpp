@@ -0,0 +1,83 @@
+/**
+ * MemoryHooks.cpp
+ *
+ * 전역 operator new / delete 교체 (네이티브 / 테스트 빌드 전용, MemoryTracker 참고)
+ * - 모든 힙 할당을 MemoryTracker에 기록 (명시적으로 연결하지 않은 std::vector 임시 버퍼도 보임)
+ * - 블록 앞 16바이트에 요청 크기와 malloc 시작 위치까지의 거리를 기록 (해제할 때 크기를 알기 위해)
+ * - CMake: enable_memory_hooks(<target>)가 이 파일과 MEMORY_TRACKER_GLOBAL_HOOKS를 함께 추가
+ *   (정의 없이 링크하면 명시적 기록과 중복 집계되므로 컴파일 오류)
+ * - WASM 빌드(build.sh)에는 넣지 않음
+ */
+
+#ifndef MEMORY_TRACKER_GLOBAL_HOOKS
+#error "MemoryHooks.cpp requires MEMORY_TRACKER_GLOBAL_HOOKS (use enable_memory_hooks in CMake)"
+#endif
+
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+const size_t ALLOCATION_HEADER = 16;
+
+void* trackedAllocate(size_t size, size_t alignment) {
+    size_t align = std::max(alignment, ALLOCATION_HEADER);
+    char* raw = static_cast<char*>(std::malloc(size + align + ALLOCATION_HEADER));
+    if (!raw) {
+        return nullptr;
+    }
+    uintptr_t user = ((uintptr_t)raw + ALLOCATION_HEADER + align - 1) & ~(uintptr_t)(align - 1);
+    size_t* info = reinterpret_cast<size_t*>(user - ALLOCATION_HEADER);
+    info[0] = size;
+    info[1] = user - (uintptr_t)raw;
+
+    MemoryTracker::recordHeapAllocation(size);
+    return reinterpret_cast<void*>(user);
+}
+
+void trackedRelease(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    size_t* info = reinterpret_cast<size_t*>(static_cast<char*>(ptr) - ALLOCATION_HEADER);
+    MemoryTracker::recordHeapRelease(info[0]);
+    std::free(static_cast<char*>(ptr) - info[1]);
+}
+
+void* trackedAllocateOrThrow(size_t size, size_t alignment) {
+    void* ptr = trackedAllocate(size, alignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return trackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return trackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t align) { return trackedAllocateOrThrow(size, (size_t)align); }
+void* operator new[](size_t size, std::align_val_t align) { return trackedAllocateOrThrow(size, (size_t)align); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, (size_t)align);
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, (size_t)align);
+}
+void operator delete(void* ptr) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr) noexcept { trackedRelease(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedRelease(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedRelease(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { trackedRelease(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedRelease(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedRelease(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedRelease(ptr); }
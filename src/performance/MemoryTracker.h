@@ -0,0 +1,181 @@
+/**
+ * MemoryTracker.h
+ *
+ * 메모리 / 할당 집계 (프로세스 전체, 스레드 안전)
+ * - 누적 할당 바이트 / 할당 횟수 / 현재 사용 중인 바이트(live) / 최대 live
+ * - 기본 집계 대상은 명시적으로 연결한 저장소만 (전역 operator new는 건드리지 않음)
+ *   · AlignedAllocator (AudioBuffer planar 저장소)
+ *   · AudioBuffer interleaved 데이터 / pitch curve, BufferPool이 만든 버퍼
+ *   · DSP 처리기의 재사용 스크래치 버퍼 (MemoryAccount로 용량 변화 기록)
+ * - MEMORY_TRACKER_GLOBAL_HOOKS (네이티브 / 테스트 빌드, CMake enable_memory_hooks):
+ *   MemoryHooks.cpp가 전역 operator new / delete를 바꿔 모든 힙 할당을 집계
+ *   (필터 안에 새로 생긴 std::vector 복사본 같은 연결하지 않은 임시 버퍼까지)
+ *   이때 명시적 기록(recordAllocation / recordRelease / recordResize)은 중복 집계를 막기 위해 무시
+ * - WASM에서는 live 최대값이 곧 힙 증가(memory.grow)를 일으키는 양
+ *
+ * PerformanceChecker::setMemoryTracking을 켜면 기능 / 함수 구간마다
+ * 구간 안에서 할당한 바이트 / 횟수, 구간 시작 대비 최대 live 증가량을 기록
+ */
+
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MemoryTracker {
+public:
+    struct Snapshot {
+        uint64_t allocatedBytes;   // 누적 할당 바이트
+        uint64_t allocations;      // 누적 할당 횟수
+        int64_t liveBytes;         // 현재 사용 중
+        int64_t peakLiveBytes;     // 최대 사용량 (현재 구간 기준, beginPeakWindow 참고)
+    };
+
+    // 명시적으로 연결한 저장소 (전역 훅 빌드에서는 훅이 이미 집계하므로 무시)
+    static void recordAllocation(size_t bytes) {
+#ifndef MEMORY_TRACKER_GLOBAL_HOOKS
+        recordHeapAllocation(bytes);
+#else
+        (void)bytes;
+#endif
+    }
+
+    static void recordRelease(size_t bytes) {
+#ifndef MEMORY_TRACKER_GLOBAL_HOOKS
+        recordHeapRelease(bytes);
+#else
+        (void)bytes;
+#endif
+    }
+
+    // 실제 힙 할당 / 해제 (명시적 기록 또는 MemoryHooks.cpp의 전역 operator new / delete)
+    static void recordHeapAllocation(size_t bytes) {
+        if (bytes == 0) {
+            return;
+        }
+        allocatedBytes_.fetch_add(bytes, std::memory_order_relaxed);
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        int64_t live = liveBytes_.fetch_add((int64_t)bytes, std::memory_order_relaxed) + (int64_t)bytes;
+        raisePeak(live);
+    }
+
+    static void recordHeapRelease(size_t bytes) {
+        liveBytes_.fetch_sub((int64_t)bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * 용량이 previousBytes -> currentBytes로 바뀐 저장소 기록
+     * 늘어나면 재할당(새 블록 할당 + 이전 블록 해제), 줄어들면 해제분만
+     */
+    static void recordResize(size_t previousBytes, size_t currentBytes) {
+        if (currentBytes > previousBytes) {
+            recordAllocation(currentBytes);
+            recordRelease(previousBytes);
+        } else if (currentBytes < previousBytes) {
+            recordRelease(previousBytes - currentBytes);
+        }
+    }
+
+    static Snapshot snapshot() {
+        Snapshot result;
+        result.allocatedBytes = allocatedBytes_.load(std::memory_order_relaxed);
+        result.allocations = allocations_.load(std::memory_order_relaxed);
+        result.liveBytes = liveBytes_.load(std::memory_order_relaxed);
+        result.peakLiveBytes = peakLiveBytes_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+     * 구간별 최대 live 측정
+     * begin: 최대값을 현재 live로 낮추고 이전 최대값을 돌려줌
+     * end: 구간 안의 최대값을 돌려주고, 바깥 구간을 위해 이전 최대값과 합침 (중첩 가능)
+     * (여러 스레드가 동시에 구간을 열면 다른 스레드의 할당도 섞임)
+     */
+    static int64_t beginPeakWindow() {
+        return peakLiveBytes_.exchange(liveBytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    static int64_t endPeakWindow(int64_t previousPeak) {
+        int64_t windowPeak = peakLiveBytes_.load(std::memory_order_relaxed);
+        raisePeak(previousPeak);
+        return windowPeak;
+    }
+
+private:
+    static inline std::atomic<uint64_t> allocatedBytes_{0};
+    static inline std::atomic<uint64_t> allocations_{0};
+    static inline std::atomic<int64_t> liveBytes_{0};
+    static inline std::atomic<int64_t> peakLiveBytes_{0};
+
+    static void raisePeak(int64_t value) {
+        int64_t peak = peakLiveBytes_.load(std::memory_order_relaxed);
+        while (value > peak && !peakLiveBytes_.compare_exchange_weak(peak, value, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+/**
+ * 저장소 용량 (바이트)
+ */
+template <typename T, typename A>
+size_t capacityBytes(const std::vector<T, A>& buffer) {
+    return buffer.capacity() * sizeof(T);
+}
+
+template <typename T, typename A, typename B>
+size_t capacityBytes(const std::vector<std::vector<T, A>, B>& buffers) {
+    size_t bytes = buffers.capacity() * sizeof(std::vector<T, A>);
+    for (const auto& buffer : buffers) {
+        bytes += capacityBytes(buffer);
+    }
+    return bytes;
+}
+
+/**
+ * std::vector 스크래치 버퍼 묶음의 용량을 MemoryTracker에 반영
+ * - 버퍼를 키울 수 있는 처리가 끝날 때 update(현재 총 용량)
+ * - 소멸 시 남은 용량 해제, 복사하면 복사본 용량도 할당으로 기록
+ */
+class MemoryAccount {
+public:
+    MemoryAccount() : bytes_(0) {}
+    MemoryAccount(const MemoryAccount& other) : bytes_(other.bytes_) {
+        MemoryTracker::recordAllocation(bytes_);
+    }
+    MemoryAccount& operator=(const MemoryAccount& other) {
+        update(other.bytes_);
+        return *this;
+    }
+    // 이동: 저장소도 함께 옮겨지므로 용량만 넘김 (새 할당 없음)
+    MemoryAccount(MemoryAccount&& other) noexcept : bytes_(other.bytes_) {
+        other.bytes_ = 0;
+    }
+    MemoryAccount& operator=(MemoryAccount&& other) noexcept {
+        if (this != &other) {
+            MemoryTracker::recordRelease(bytes_);
+            bytes_ = other.bytes_;
+            other.bytes_ = 0;
+        }
+        return *this;
+    }
+    ~MemoryAccount() {
+        MemoryTracker::recordRelease(bytes_);
+    }
+
+    void update(size_t bytes) {
+        if (bytes != bytes_) {
+            MemoryTracker::recordResize(bytes_, bytes);
+            bytes_ = bytes;
+        }
+    }
+
+    size_t getBytes() const { return bytes_; }
+
+private:
+    size_t bytes_;
+};
+
+#endif // MEMORY_TRACKER_H
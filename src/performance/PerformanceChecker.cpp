@@ -1,10 +1,177 @@
 #include "PerformanceChecker.h"
-#include <numeric>
+#include <cmath>
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <map>
+
+namespace {
+
+// 측정기 / 스레드 번호 (스레드별 상태가 어느 측정기의 것인지 구분)
+std::atomic<uint64_t> nextInstanceId(1);
+std::atomic<uint32_t> nextThreadIndex(0);
+
+// JSON 문자열 이스케이프 (레이블은 호출자가 정하므로 따옴표 / 제어 문자가 있을 수 있음)
+std::string escapeJson(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char ch : text) {
+        switch (ch) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if ((unsigned char)ch < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", (unsigned)ch);
+                    escaped += code;
+                } else {
+                    escaped += ch;
+                }
+        }
+    }
+    return escaped;
+}
+
+// CSV 필드 (쉼표 / 따옴표 / 줄바꿈이 있으면 따옴표로 감싸고 따옴표는 두 번)
+std::string escapeCsv(const std::string& text) {
+    if (text.find_first_of(",\"\r\n") == std::string::npos) {
+        return text;
+    }
+    std::string escaped = "\"";
+    for (char ch : text) {
+        if (ch == '"') {
+            escaped += '"';
+        }
+        escaped += ch;
+    }
+    escaped += '"';
+    return escaped;
+}
+
+// 같은 이름의 형제 노드가 있으면 합치고 (자식도 재귀적으로), 없으면 추가
+// (세그먼트마다 호출되는 함수도 노드 수는 호출 위치 수만큼만 늘어남)
+void mergeFunctionNode(std::vector<PerformanceChecker::FunctionNode>& siblings,
+                       PerformanceChecker::FunctionNode&& node) {
+    for (PerformanceChecker::FunctionNode& existing : siblings) {
+        if (existing.name == node.name) {
+            existing.duration += node.duration;
+            existing.count += node.count;
+            existing.allocatedBytes += node.allocatedBytes;
+            existing.allocations += node.allocations;
+            existing.peakBytes = std::max(existing.peakBytes, node.peakBytes);
+            for (PerformanceChecker::FunctionNode& child : node.children) {
+                mergeFunctionNode(existing.children, std::move(child));
+            }
+            return;
+        }
+    }
+    siblings.push_back(std::move(node));
+}
+
+} // namespace
+
+const int PerformanceChecker::DEFAULT_TRACE_CAPACITY;
+const int PerformanceChecker::MAX_TRACE_DEPTH;
+const int PerformanceChecker::LABEL_CACHE_SIZE;
+const int PerformanceChecker::Histogram::SUB_BUCKET_BITS;
+const int PerformanceChecker::Histogram::SUB_BUCKETS;
+const int PerformanceChecker::Histogram::MAX_EXPONENT;
+const int PerformanceChecker::Histogram::BUCKET_COUNT;
+
+// === 히스토그램 ===
+
+PerformanceChecker::Histogram::Histogram() {
+    clear();
+}
+
+void PerformanceChecker::Histogram::clear() {
+    count = 0;
+    totalNs = 0;
+    minNs = 0;
+    maxNs = 0;
+    std::fill(buckets, buckets + BUCKET_COUNT, 0u);
+}
+
+int PerformanceChecker::Histogram::bucketIndex(int64_t ns) {
+    if (ns < SUB_BUCKETS) {
+        return ns < 0 ? 0 : (int)ns;
+    }
+
+    // 최상위 비트 위치 = 2의 거듭제곱 구간, 그 아래 4비트 = 구간 안의 칸
+#if defined(__GNUC__) || defined(__clang__)
+    int exponent = 63 - __builtin_clzll((unsigned long long)ns);
+#else
+    int exponent = 0;
+    for (uint64_t value = (uint64_t)ns; value > 1; value >>= 1) exponent++;
+#endif
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    int subBucket = (int)((ns >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+}
 
-PerformanceChecker::PerformanceChecker() : totalDuration(0.0) {}
+int64_t PerformanceChecker::Histogram::bucketMidpoint(int index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    int exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    int subBucket = index % SUB_BUCKETS;
+    int64_t width = (int64_t)1 << (exponent - SUB_BUCKET_BITS);
+    return (int64_t)(SUB_BUCKETS + subBucket) * width + width / 2;
+}
+
+void PerformanceChecker::Histogram::record(int64_t ns) {
+    if (count == 0 || ns < minNs) minNs = ns;
+    if (count == 0 || ns > maxNs) maxNs = ns;
+    count++;
+    totalNs += ns;
+    buckets[bucketIndex(ns)]++;
+}
+
+int64_t PerformanceChecker::Histogram::percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    if (percentile >= 100.0) {
+        return maxNs;
+    }
+    double clamped = std::min(100.0, std::max(0.0, percentile));
+    uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(clamped / 100.0 * count));
+
+    uint64_t cumulative = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        cumulative += buckets[i];
+        if (cumulative >= target) {
+            return std::min(maxNs, std::max(minNs, bucketMidpoint(i)));
+        }
+    }
+    return maxNs;
+}
+
+void PerformanceChecker::Histogram::merge(const Histogram& other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0 || other.minNs < minNs) minNs = other.minNs;
+    if (count == 0 || other.maxNs > maxNs) maxNs = other.maxNs;
+    count += other.count;
+    totalNs += other.totalNs;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+PerformanceChecker::PerformanceChecker()
+    : memoryTracking_(false), totalDuration(0.0), traceMode_(false), instanceId_(nextInstanceId++), traceEpoch_(0), ownerThread_(0),
+      traceMask_(0), traceWritten_(0), traceFeature_{}, traceFeatureThread_(0), traceFeatureOpen_(false) {
+}
 
 PerformanceChecker::~PerformanceChecker() {}
 
@@ -22,11 +189,11 @@ double PerformanceChecker::end(const std::string& label) {
     }
 
     auto startTime = it->second;
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-    double durationMs = duration.count() / 1000.0;
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+    double durationMs = duration.count() / 1e6;
 
-    // 결과 저장
-    measurements[label].push_back(durationMs);
+    // 결과 저장 (누적 통계만, 레이블당 메모리 고정)
+    measurements[label].record(duration.count());
 
     // 활성 타이머에서 제거
     activeTimers.erase(it);
@@ -34,21 +201,149 @@ double PerformanceChecker::end(const std::string& label) {
     return durationMs;
 }
 
-std::vector<double> PerformanceChecker::getMeasurements(const std::string& label) const {
+double PerformanceChecker::getAverage(const std::string& label) const {
+    auto it = measurements.find(label);
+    if (it == measurements.end() || it->second.count == 0) {
+        return 0.0;
+    }
+    return it->second.totalNs / 1e6 / it->second.count;
+}
+
+double PerformanceChecker::getPercentile(const std::string& label, double percentile) const {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
     auto it = measurements.find(label);
     if (it != measurements.end()) {
-        return it->second;
+        return it->second.percentile(percentile) / 1e6;
     }
-    return std::vector<double>();
+    auto id = labelIds_.find(label);
+    if (id != labelIds_.end()) {
+        Histogram histogram;
+        MemoryUsage memory{0, 0, 0};
+        mergeStatistics(id->second, histogram, memory);
+        return histogram.percentile(percentile) / 1e6;
+    }
+    return 0.0;
 }
 
-double PerformanceChecker::getAverage(const std::string& label) const {
-    auto data = getMeasurements(label);
-    if (data.empty()) {
-        return 0.0;
+PerformanceChecker::Statistics PerformanceChecker::summarize(const std::string& label,
+                                                             const Histogram& histogram,
+                                                             const MemoryUsage& memory) {
+    Statistics stats;
+    stats.label = label;
+    stats.count = (double)histogram.count;
+    stats.totalMs = histogram.totalNs / 1e6;
+    stats.averageMs = histogram.count > 0 ? stats.totalMs / histogram.count : 0.0;
+    stats.minMs = histogram.minNs / 1e6;
+    stats.maxMs = histogram.maxNs / 1e6;
+    stats.p50Ms = histogram.percentile(50.0) / 1e6;
+    stats.p90Ms = histogram.percentile(90.0) / 1e6;
+    stats.p99Ms = histogram.percentile(99.0) / 1e6;
+    stats.p999Ms = histogram.percentile(99.9) / 1e6;
+    stats.allocatedBytes = (double)memory.allocatedBytes;
+    stats.allocations = (double)memory.allocations;
+    stats.peakBytes = (double)memory.peakBytes;
+    return stats;
+}
+
+std::vector<PerformanceChecker::Statistics> PerformanceChecker::getStatistics() const {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    std::vector<Statistics> result;
+    Histogram histogram;
+    for (uint32_t i = 0; i < (uint32_t)labels_.size(); ++i) {
+        histogram.clear();
+        MemoryUsage memory{0, 0, 0};
+        mergeStatistics(i, histogram, memory);
+        if (histogram.count > 0) {
+            result.push_back(summarize(labels_[i], histogram, memory));
+        }
+    }
+    return result;
+}
+
+void PerformanceChecker::mergeStatistics(uint32_t label, Histogram& histogram, MemoryUsage& memory) const {
+    // statisticsMutex_를 잡은 상태에서 호출
+    for (const auto& shard : shards_) {
+        if (label >= shard->histograms.size()) {
+            continue;
+        }
+        histogram.merge(shard->histograms[label]);
+        const MemoryUsage& usage = shard->memory[label];
+        memory.allocatedBytes += usage.allocatedBytes;
+        memory.allocations += usage.allocations;
+        memory.peakBytes = std::max(memory.peakBytes, usage.peakBytes);
+    }
+}
+
+void PerformanceChecker::recordScope(uint32_t label, int64_t durationNs, const MemoryUsage& memory) {
+    // 스레드 자신의 통계에만 쓰므로 잠금 없음 (처음 쓰는 스레드 / 새 레이블만 attachShard)
+    ThreadState& state = threadState();
+    StatisticsShard* shard = state.shard;
+    if (state.shardOwner != instanceId_ || label >= shard->histograms.size()) {
+        shard = &attachShard(state, label);
+    }
+    shard->histograms[label].record(durationNs);
+    MemoryUsage& total = shard->memory[label];
+    total.allocatedBytes += memory.allocatedBytes;
+    total.allocations += memory.allocations;
+    total.peakBytes = std::max(total.peakBytes, memory.peakBytes);
+}
+
+PerformanceChecker::StatisticsShard& PerformanceChecker::attachShard(ThreadState& state, uint32_t label) {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    if (state.shardOwner != instanceId_) {
+        // 다른 측정기를 쓰다 돌아온 스레드면 전에 만든 통계를 다시 씀
+        state.shard = nullptr;
+        for (const auto& shard : shards_) {
+            if (shard->thread == state.thread) {
+                state.shard = shard.get();
+                break;
+            }
+        }
+        if (!state.shard) {
+            shards_.push_back(std::make_unique<StatisticsShard>());
+            shards_.back()->thread = state.thread;
+            state.shard = shards_.back().get();
+        }
+        state.shardOwner = instanceId_;
+    }
+
+    // 지금까지 등록된 레이블 전부 (새 레이블에서만 할당, 기록 경로는 할당 없음)
+    StatisticsShard& shard = *state.shard;
+    size_t size = std::max<size_t>(labels_.size(), (size_t)label + 1);
+    if (shard.histograms.size() < size) {
+        shard.histograms.resize(size);
+        shard.memory.resize(size, MemoryUsage{0, 0, 0});
+    }
+    return shard;
+}
+
+void PerformanceChecker::beginMemory(MemoryMark& mark) const {
+    if (!memoryTracking_) {
+        return;
     }
-    double sum = std::accumulate(data.begin(), data.end(), 0.0);
-    return sum / data.size();
+    mark.start = MemoryTracker::snapshot();
+    mark.previousPeak = MemoryTracker::beginPeakWindow();
+}
+
+PerformanceChecker::MemoryUsage PerformanceChecker::endMemory(const MemoryMark& mark) const {
+    MemoryUsage usage{0, 0, 0};
+    if (!memoryTracking_) {
+        return usage;
+    }
+    int64_t windowPeak = MemoryTracker::endPeakWindow(mark.previousPeak);
+    MemoryTracker::Snapshot end = MemoryTracker::snapshot();
+    usage.allocatedBytes = end.allocatedBytes - mark.start.allocatedBytes;
+    usage.allocations = end.allocations - mark.start.allocations;
+    usage.peakBytes = std::max<int64_t>(0, windowPeak - mark.start.liveBytes);
+    return usage;
+}
+
+void PerformanceChecker::setMemoryTracking(bool enabled) {
+    memoryTracking_ = enabled;
+}
+
+bool PerformanceChecker::isMemoryTracking() const {
+    return memoryTracking_;
 }
 
 void PerformanceChecker::reset() {
@@ -58,34 +353,92 @@ void PerformanceChecker::reset() {
     functionStack.clear();
     completedFeatures.clear();
     totalDuration = 0.0;
+    {
+        // 스레드별 통계는 비우기만 함 (스레드가 가진 포인터 유지)
+        std::lock_guard<std::mutex> lock(statisticsMutex_);
+        for (const auto& shard : shards_) {
+            for (Histogram& histogram : shard->histograms) {
+                histogram.clear();
+            }
+            std::fill(shard->memory.begin(), shard->memory.end(), MemoryUsage{0, 0, 0});
+        }
+    }
+
+    // 트레이스 버퍼는 유지 (레이블 번호 / 캐시도 유지), 스레드별 함수 스택은 다음 사용 때 비움
+    traceOrigin_ = std::chrono::steady_clock::now();
+    traceWritten_ = 0;
+    traceEpoch_++;
+    traceFeatureOpen_ = false;
 }
 
 // === 계층적 측정 API 구현 ===
 
 void PerformanceChecker::startFeature(const std::string& name) {
+    openFeature(name, internLabel(name));
+}
+
+void PerformanceChecker::startFeature(const char* name) {
+    openFeature(name, internLabel(name));
+}
+
+void PerformanceChecker::openFeature(const std::string& name, uint32_t label) {
+    if (traceMode_) {
+        ThreadState& state = traceThreadState();
+        traceFeature_.label = label;
+        beginMemory(traceFeature_.memory);
+        traceFeature_.startNs = traceNow();
+        traceFeatureThread_ = state.thread;
+        traceFeatureOpen_ = true;
+        state.depth = 0;
+        state.overflow = 0;
+        return;
+    }
+
     currentFeature = std::make_unique<FeatureContext>();
     currentFeature->name = name;
+    currentFeature->label = label;
+    beginMemory(currentFeature->memory);
     currentFeature->startTime = std::chrono::high_resolution_clock::now();
 }
 
 void PerformanceChecker::endFeature() {
+    if (traceMode_) {
+        if (!traceFeatureOpen_) {
+            std::cerr << "Warning: No feature to end!" << std::endl;
+            return;
+        }
+        ThreadState& state = traceThreadState();
+        int64_t durationNs = recordTraceEvent(traceFeature_.label, 0, traceFeatureThread_, traceFeature_.startNs,
+                                              endMemory(traceFeature_.memory));
+        totalDuration += durationNs / 1e6;
+        traceFeatureOpen_ = false;
+        state.depth = 0;
+        state.overflow = 0;
+        return;
+    }
+
     if (!currentFeature) {
         std::cerr << "Warning: No feature to end!" << std::endl;
         return;
     }
 
     auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
         endTime - currentFeature->startTime
     );
-    double durationMs = duration.count() / 1000.0;
+    double durationMs = duration.count() / 1e6;
+    MemoryUsage memory = endMemory(currentFeature->memory);
+    recordScope(currentFeature->label, duration.count(), memory);
 
     FeatureNode feature;
     feature.feature = currentFeature->name;
     feature.duration = durationMs;
-    feature.functions = currentFeature->functions;
+    feature.functions = std::move(currentFeature->functions);
+    feature.allocatedBytes = (double)memory.allocatedBytes;
+    feature.allocations = (double)memory.allocations;
+    feature.peakBytes = (double)memory.peakBytes;
 
-    completedFeatures.push_back(feature);
+    completedFeatures.push_back(std::move(feature));
     totalDuration += durationMs;
 
     currentFeature.reset();
@@ -93,13 +446,47 @@ void PerformanceChecker::endFeature() {
 }
 
 void PerformanceChecker::startFunction(const std::string& name) {
+    if (traceMode_) {
+        pushTraceScope(internLabel(name));
+        return;
+    }
+    openFunction(name, internLabel(name));
+}
+
+void PerformanceChecker::startFunction(const char* name) {
+    if (traceMode_) {
+        pushTraceScope(internLabel(name));
+        return;
+    }
+    openFunction(name, internLabel(name));
+}
+
+void PerformanceChecker::openFunction(const std::string& name, uint32_t label) {
     FunctionContext func;
     func.name = name;
-    func.startTime = std::chrono::high_resolution_clock::now();
-    functionStack.push_back(func);
+    func.label = label;
+    functionStack.push_back(std::move(func));
+    beginMemory(functionStack.back().memory);
+    functionStack.back().startTime = std::chrono::high_resolution_clock::now();
 }
 
 void PerformanceChecker::endFunction() {
+    if (traceMode_) {
+        ThreadState& state = traceThreadState();
+        if (state.overflow > 0) {
+            state.overflow--;   // 깊이 제한을 넘어 기록하지 않은 구간
+            return;
+        }
+        if (state.depth == 0) {
+            std::cerr << "Warning: No function to end!" << std::endl;
+            return;
+        }
+        const TraceScope& scope = state.stack[state.depth];
+        recordTraceEvent(scope.label, (uint16_t)state.depth, state.thread, scope.startNs, endMemory(scope.memory));
+        state.depth--;
+        return;
+    }
+
     if (functionStack.empty()) {
         std::cerr << "Warning: No function to end!" << std::endl;
         return;
@@ -107,27 +494,35 @@ void PerformanceChecker::endFunction() {
 
     auto& func = functionStack.back();
     auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
         endTime - func.startTime
     );
-    double durationMs = duration.count() / 1000.0;
+    double durationMs = duration.count() / 1e6;
+    MemoryUsage memory = endMemory(func.memory);
+    recordScope(func.label, duration.count(), memory);
 
     FunctionNode node;
     node.name = func.name;
     node.duration = durationMs;
-    node.children = func.children;
+    node.children = std::move(func.children);
+    node.allocatedBytes = (double)memory.allocatedBytes;
+    node.allocations = (double)memory.allocations;
+    node.peakBytes = (double)memory.peakBytes;
 
     functionStack.pop_back();
 
-    // 부모 함수가 있으면 자식으로 추가, 없으면 기능의 함수로 추가
+    // 부모 함수가 있으면 자식으로, 없으면 기능의 함수로 합침
     if (!functionStack.empty()) {
-        functionStack.back().children.push_back(node);
+        mergeFunctionNode(functionStack.back().children, std::move(node));
     } else if (currentFeature) {
-        currentFeature->functions.push_back(node);
+        mergeFunctionNode(currentFeature->functions, std::move(node));
     }
 }
 
 std::vector<PerformanceChecker::FeatureNode> PerformanceChecker::getFeatures() const {
+    if (traceMode_) {
+        return buildTraceFeatures();
+    }
     return completedFeatures;
 }
 
@@ -135,13 +530,267 @@ double PerformanceChecker::getTotalDuration() const {
     return totalDuration;
 }
 
+// === 트레이스 모드 구현 ===
+
+void PerformanceChecker::setTraceMode(bool enabled, int capacity) {
+    reset();
+    traceMode_ = enabled;
+    ownerThread_ = threadState().thread;
+    if (!enabled) {
+        std::vector<TraceEvent>().swap(traceRing_);
+        traceMask_ = 0;
+        return;
+    }
+
+    // 인덱스를 마스크로 계산하도록 2의 거듭제곱으로 올림
+    size_t size = 2;
+    while (size < (size_t)std::max(2, capacity)) {
+        size <<= 1;
+    }
+    traceRing_.assign(size, TraceEvent{0, 0, 0, 0, 0});
+    traceMask_ = size - 1;
+}
+
+bool PerformanceChecker::isTraceMode() const {
+    return traceMode_;
+}
+
+std::vector<PerformanceChecker::TraceEvent> PerformanceChecker::getTraceEvents() const {
+    std::vector<TraceEvent> events;
+    if (traceRing_.empty()) {
+        return events;
+    }
+    const uint64_t written = traceWritten_.load(std::memory_order_acquire);
+    const uint64_t capacity = traceMask_ + 1;
+    const uint64_t first = written > capacity ? written - capacity : 0;
+    events.reserve((size_t)(written - first));
+    for (uint64_t i = first; i < written; ++i) {
+        events.push_back(traceRing_[i & traceMask_]);
+    }
+    return events;
+}
+
+const std::string& PerformanceChecker::getLabel(uint32_t label) const {
+    static const std::string unknown;
+    return label < labels_.size() ? labels_[label] : unknown;
+}
+
+long long PerformanceChecker::getDroppedEvents() const {
+    const uint64_t written = traceWritten_.load(std::memory_order_acquire);
+    const uint64_t capacity = traceMask_ + 1;
+    return traceRing_.empty() || written <= capacity ? 0 : (long long)(written - capacity);
+}
+
+uint32_t PerformanceChecker::internLabel(const std::string& name) {
+    std::lock_guard<std::mutex> lock(statisticsMutex_);
+    auto it = labelIds_.find(name);
+    if (it != labelIds_.end()) {
+        return it->second;
+    }
+    uint32_t label = (uint32_t)labels_.size();
+    labels_.push_back(name);
+    labelIds_.emplace(name, label);
+    return label;
+}
+
+uint32_t PerformanceChecker::internLabel(const char* name) {
+    // 같은 호출 위치의 리터럴은 주소가 같으므로 포인터 비교만으로 번호를 찾음
+    // (스레드별 캐시라 잠금 없음, 처음 보는 포인터만 잠그고 등록)
+    uintptr_t address = reinterpret_cast<uintptr_t>(name);
+    LabelCacheEntry& entry = threadState().cache[((address >> 4) ^ address) & (LABEL_CACHE_SIZE - 1)];
+    if (entry.pointer != name || entry.owner != instanceId_) {
+        entry.label = internLabel(std::string(name));
+        entry.pointer = name;
+        entry.owner = instanceId_;
+    }
+    return entry.label;
+}
+
+PerformanceChecker::ThreadState& PerformanceChecker::threadState() {
+    thread_local ThreadState state = [] {
+        ThreadState initial{};
+        initial.thread = (uint16_t)nextThreadIndex++;
+        return initial;
+    }();
+    return state;
+}
+
+PerformanceChecker::ThreadState& PerformanceChecker::traceThreadState() {
+    ThreadState& state = threadState();
+    if (state.owner != instanceId_ || state.epoch != traceEpoch_) {
+        state.owner = instanceId_;
+        state.epoch = traceEpoch_;
+        state.depth = 0;
+        state.overflow = 0;
+    }
+    return state;
+}
+
+int64_t PerformanceChecker::traceNow() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - traceOrigin_).count();
+}
+
+void PerformanceChecker::pushTraceScope(uint32_t label) {
+    ThreadState& state = traceThreadState();
+    if (state.depth >= MAX_TRACE_DEPTH) {
+        state.overflow++;
+        return;
+    }
+    state.depth++;
+    TraceScope& scope = state.stack[state.depth];
+    scope.label = label;
+    beginMemory(scope.memory);
+    scope.startNs = traceNow();
+}
+
+int64_t PerformanceChecker::recordTraceEvent(uint32_t label, uint16_t depth, uint16_t thread, int64_t startNs,
+                                             const MemoryUsage& memory) {
+    const int64_t durationNs = traceNow() - startNs;
+
+    // 슬롯을 먼저 예약하므로 여러 스레드가 같은 칸에 쓰지 않음
+    const uint64_t slot = traceWritten_.fetch_add(1, std::memory_order_acq_rel);
+    TraceEvent& event = traceRing_[slot & traceMask_];
+    event.label = label;
+    event.depth = depth;
+    event.thread = thread;
+    event.startNs = startNs;
+    event.durationNs = durationNs;
+    recordScope(label, durationNs, memory);
+    return durationNs;
+}
+
+std::vector<PerformanceChecker::FeatureNode> PerformanceChecker::buildTraceFeatures() const {
+    // 끝난 순서로 기록되어 있으므로 시작 순서로 정렬 (같은 시각이면 바깥 구간 먼저)
+    std::vector<TraceEvent> events = getTraceEvents();
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.startNs != b.startNs ? a.startNs < b.startNs : a.depth < b.depth;
+    });
+
+    struct OpenScope {
+        uint16_t depth;   // TraceEvent::depth와 같은 타입
+        int64_t endNs;
+        std::vector<FunctionNode>* children;
+    };
+
+    // 다른 스레드의 기능이 겹쳐 추가되어도 열린 구간의 children 포인터가 유지되도록 deque로 모음
+    std::deque<FeatureNode> features;
+    std::map<uint16_t, std::vector<OpenScope>> stacks;   // 스레드별 [0] = 기능, 이후 = 열린 함수 (부모 -> 자식)
+
+    for (const TraceEvent& event : events) {
+        const int64_t endNs = event.startNs + event.durationNs;
+        std::vector<OpenScope>& stack = stacks[event.thread];
+
+        // 이 이벤트를 포함하지 않는 구간 닫기
+        while (!stack.empty() && (stack.back().depth >= event.depth || stack.back().endNs <= event.startNs)) {
+            stack.pop_back();
+        }
+
+        if (event.depth == 0) {
+            FeatureNode feature;
+            feature.feature = getLabel(event.label);
+            feature.duration = event.durationNs / 1e6;
+            features.push_back(std::move(feature));
+            stack.push_back({0, endNs, &features.back().functions});
+            continue;
+        }
+
+        // 부모가 없으면 (기능 밖에서 호출 / 기능이 없는 작업자 스레드 / 부모 이벤트가 덮어써짐) 계층 API와 같이 버림
+        if (stack.empty() || stack.back().depth + 1 != event.depth) {
+            continue;
+        }
+
+        // 계층 API와 같이 같은 이름의 형제 노드에 합침
+        const std::string& name = getLabel(event.label);
+        std::vector<FunctionNode>* siblings = stack.back().children;
+        FunctionNode* node = nullptr;
+        for (FunctionNode& existing : *siblings) {
+            if (existing.name == name) {
+                node = &existing;
+                break;
+            }
+        }
+        if (node) {
+            node->duration += event.durationNs / 1e6;
+            node->count += 1.0;
+        } else {
+            siblings->push_back(FunctionNode());
+            node = &siblings->back();
+            node->name = name;
+            node->duration = event.durationNs / 1e6;
+        }
+        stack.push_back({event.depth, endNs, &node->children});
+    }
+
+    return std::vector<FeatureNode>(std::make_move_iterator(features.begin()),
+                                    std::make_move_iterator(features.end()));
+}
+
+std::string PerformanceChecker::getChromeTrace() const {
+    std::ostringstream oss;
+    oss << "{\"traceEvents\":[";
+    if (!traceMode_) {
+        std::cerr << "Warning: Chrome trace requires trace mode!" << std::endl;
+        oss << "],\"displayTimeUnit\":\"ms\"}";
+        return oss.str();
+    }
+
+    std::vector<TraceEvent> events = getTraceEvents();
+    oss << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ownerThread_
+        << ",\"args\":{\"name\":\"PerformanceChecker\"}}";
+
+    // 스레드 트랙 이름 (번호 순서대로 정렬되도록 sort_index도 기록)
+    std::map<uint16_t, bool> threads;
+    threads[ownerThread_] = true;
+    for (const TraceEvent& event : events) {
+        threads[event.thread] = true;
+    }
+    int workers = 0;
+    for (const auto& pair : threads) {
+        int order = pair.first == ownerThread_ ? 0 : ++workers;
+        std::string name = order == 0 ? "main" : "worker " + std::to_string(order);
+        oss << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << pair.first
+            << ",\"args\":{\"name\":\"" << name << "\"}}";
+        oss << ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":" << pair.first
+            << ",\"args\":{\"sort_index\":" << order << "}}";
+    }
+
+    // complete 이벤트 (ts / dur는 us, ns 정밀도 유지)
+    oss << std::fixed << std::setprecision(3);
+    for (const TraceEvent& event : events) {
+        oss << ",\n{\"name\":\"" << escapeJson(getLabel(event.label)) << "\""
+            << ",\"cat\":\"" << (event.depth == 0 ? "feature" : "function") << "\""
+            << ",\"ph\":\"X\""
+            << ",\"ts\":" << event.startNs / 1e3
+            << ",\"dur\":" << event.durationNs / 1e3
+            << ",\"pid\":1,\"tid\":" << event.thread
+            << ",\"args\":{\"depth\":" << event.depth << "}}";
+    }
+
+    oss << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << getDroppedEvents() << "}}";
+    return oss.str();
+}
+
+// 메모리 필드 (앞 필드 뒤에 이어서 출력)
+static void serializeMemory(std::ostringstream& oss, double allocatedBytes, double allocations, double peakBytes,
+                            const std::string& indentStr) {
+    oss << ",\n" << indentStr << "  \"allocatedBytes\": " << (long long)allocatedBytes;
+    oss << ",\n" << indentStr << "  \"allocations\": " << (long long)allocations;
+    oss << ",\n" << indentStr << "  \"peakBytes\": " << (long long)peakBytes;
+}
+
 // 재귀적으로 FunctionNode를 JSON으로 직렬화하는 헬퍼 함수
-static void serializeFunctionNode(std::ostringstream& oss, const PerformanceChecker::FunctionNode& func, int indent) {
+static void serializeFunctionNode(std::ostringstream& oss, const PerformanceChecker::FunctionNode& func, int indent,
+                                  bool memory) {
     std::string indentStr(indent, ' ');
 
     oss << "\n" << indentStr << "{\n";
-    oss << indentStr << "  \"name\": \"" << func.name << "\",\n";
-    oss << indentStr << "  \"duration\": " << std::fixed << std::setprecision(3) << func.duration;
+    oss << indentStr << "  \"name\": \"" << escapeJson(func.name) << "\",\n";
+    oss << indentStr << "  \"duration\": " << std::fixed << std::setprecision(3) << func.duration << ",\n";
+    oss << indentStr << "  \"count\": " << (long long)func.count;
+    if (memory) {
+        serializeMemory(oss, func.allocatedBytes, func.allocations, func.peakBytes, indentStr);
+    }
 
     // 자식 함수들이 있으면 재귀적으로 출력
     if (!func.children.empty()) {
@@ -151,7 +800,7 @@ static void serializeFunctionNode(std::ostringstream& oss, const PerformanceChec
         for (const auto& child : func.children) {
             if (!firstChild) oss << ",";
             firstChild = false;
-            serializeFunctionNode(oss, child, indent + 4);
+            serializeFunctionNode(oss, child, indent + 4, memory);
         }
 
         oss << "\n" << indentStr << "  ]";
@@ -160,28 +809,64 @@ static void serializeFunctionNode(std::ostringstream& oss, const PerformanceChec
     oss << "\n" << indentStr << "}";
 }
 
+// 레이블 통계 하나를 JSON 객체로 직렬화하는 헬퍼 함수
+static void serializeStatistics(std::ostringstream& oss, const PerformanceChecker::Statistics& stats,
+                                const std::string& indentStr, bool memory) {
+    oss << "{\n";
+    oss << indentStr << "  \"count\": " << (long long)stats.count << ",\n";
+    oss << indentStr << "  \"total\": " << std::fixed << std::setprecision(3) << stats.totalMs << ",\n";
+    oss << indentStr << "  \"average\": " << std::fixed << std::setprecision(3) << stats.averageMs << ",\n";
+    oss << indentStr << "  \"min\": " << std::fixed << std::setprecision(3) << stats.minMs << ",\n";
+    oss << indentStr << "  \"max\": " << std::fixed << std::setprecision(3) << stats.maxMs << ",\n";
+    oss << indentStr << "  \"p50\": " << std::fixed << std::setprecision(3) << stats.p50Ms << ",\n";
+    oss << indentStr << "  \"p90\": " << std::fixed << std::setprecision(3) << stats.p90Ms << ",\n";
+    oss << indentStr << "  \"p99\": " << std::fixed << std::setprecision(3) << stats.p99Ms << ",\n";
+    oss << indentStr << "  \"p999\": " << std::fixed << std::setprecision(3) << stats.p999Ms;
+    if (memory) {
+        serializeMemory(oss, stats.allocatedBytes, stats.allocations, stats.peakBytes, indentStr);
+    }
+    oss << "\n" << indentStr << "}";
+}
+
 std::string PerformanceChecker::getReportJSON() const {
     std::ostringstream oss;
     oss << "{\n";
     oss << "  \"totalDuration\": " << std::fixed << std::setprecision(3) << totalDuration << ",\n";
+    if (traceMode_) {
+        oss << "  \"droppedEvents\": " << getDroppedEvents() << ",\n";
+    }
+    if (memoryTracking_) {
+        // 보고서 시점의 전체 집계 (live / 최대 live / 누적 할당)
+        MemoryTracker::Snapshot memory = MemoryTracker::snapshot();
+        oss << "  \"memory\": {\n";
+        oss << "    \"liveBytes\": " << memory.liveBytes << ",\n";
+        oss << "    \"peakLiveBytes\": " << memory.peakLiveBytes << ",\n";
+        oss << "    \"allocatedBytes\": " << memory.allocatedBytes << ",\n";
+        oss << "    \"allocations\": " << memory.allocations << "\n";
+        oss << "  },\n";
+    }
     oss << "  \"features\": [";
 
     // 계층적 구조 출력
     bool firstFeature = true;
-    for (const auto& feature : completedFeatures) {
+    for (const auto& feature : getFeatures()) {
         if (!firstFeature) oss << ",";
         firstFeature = false;
 
         oss << "\n    {\n";
-        oss << "      \"feature\": \"" << feature.feature << "\",\n";
-        oss << "      \"duration\": " << std::fixed << std::setprecision(3) << feature.duration << ",\n";
+        oss << "      \"feature\": \"" << escapeJson(feature.feature) << "\",\n";
+        oss << "      \"duration\": " << std::fixed << std::setprecision(3) << feature.duration;
+        if (memoryTracking_) {
+            serializeMemory(oss, feature.allocatedBytes, feature.allocations, feature.peakBytes, "    ");
+        }
+        oss << ",\n";
         oss << "      \"functions\": [";
 
         bool firstFunc = true;
         for (const auto& func : feature.functions) {
             if (!firstFunc) oss << ",";
             firstFunc = false;
-            serializeFunctionNode(oss, func, 8);
+            serializeFunctionNode(oss, func, 8, memoryTracking_);
         }
 
         oss << "\n      ]\n";
@@ -199,19 +884,23 @@ std::string PerformanceChecker::getReportJSON() const {
         }
         first = false;
 
-        const std::string& label = pair.first;
-        const std::vector<double>& durations = pair.second;
+        oss << "    \"" << escapeJson(pair.first) << "\": ";
+        serializeStatistics(oss, summarize(pair.first, pair.second, MemoryUsage{0, 0, 0}), "    ", false);
+    }
 
-        double avg = getAverage(label);
-        double min = *std::min_element(durations.begin(), durations.end());
-        double max = *std::max_element(durations.begin(), durations.end());
+    oss << "\n  },\n";
+    oss << "  \"statistics\": {\n";
 
-        oss << "    \"" << label << "\": {\n";
-        oss << "      \"count\": " << durations.size() << ",\n";
-        oss << "      \"average\": " << std::fixed << std::setprecision(3) << avg << ",\n";
-        oss << "      \"min\": " << std::fixed << std::setprecision(3) << min << ",\n";
-        oss << "      \"max\": " << std::fixed << std::setprecision(3) << max << "\n";
-        oss << "    }";
+    // 기능 / 함수 레이블별 누적 통계 (트리의 호출 위치별 노드와 달리 레이블 하나로 모은 요약 + 백분위)
+    first = true;
+    for (const Statistics& stats : getStatistics()) {
+        if (!first) {
+            oss << ",\n";
+        }
+        first = false;
+
+        oss << "    \"" << escapeJson(stats.label) << "\": ";
+        serializeStatistics(oss, stats, "    ", memoryTracking_);
     }
 
     oss << "\n  }\n";
@@ -221,21 +910,36 @@ std::string PerformanceChecker::getReportJSON() const {
 
 std::string PerformanceChecker::getReportCSV() const {
     std::ostringstream oss;
-    oss << "Label,Count,Average(ms),Min(ms),Max(ms)\n";
+    oss << "Label,Count,Average(ms),Min(ms),Max(ms),P50(ms),P90(ms),P99(ms),P99.9(ms)";
+    if (memoryTracking_) {
+        oss << ",AllocatedBytes,Allocations,PeakBytes";
+    }
+    oss << "\n";
 
+    // 평면 측정 다음에 기능 / 함수 레이블
+    std::vector<Statistics> rows;
     for (const auto& pair : measurements) {
-        const std::string& label = pair.first;
-        const std::vector<double>& durations = pair.second;
-
-        double avg = getAverage(label);
-        double min = *std::min_element(durations.begin(), durations.end());
-        double max = *std::max_element(durations.begin(), durations.end());
-
-        oss << label << ","
-            << durations.size() << ","
-            << std::fixed << std::setprecision(3) << avg << ","
-            << std::fixed << std::setprecision(3) << min << ","
-            << std::fixed << std::setprecision(3) << max << "\n";
+        rows.push_back(summarize(pair.first, pair.second, MemoryUsage{0, 0, 0}));
+    }
+    std::vector<Statistics> scopes = getStatistics();
+    rows.insert(rows.end(), scopes.begin(), scopes.end());
+
+    for (const Statistics& stats : rows) {
+        oss << escapeCsv(stats.label) << ","
+            << (long long)stats.count << ","
+            << std::fixed << std::setprecision(3) << stats.averageMs << ","
+            << std::fixed << std::setprecision(3) << stats.minMs << ","
+            << std::fixed << std::setprecision(3) << stats.maxMs << ","
+            << std::fixed << std::setprecision(3) << stats.p50Ms << ","
+            << std::fixed << std::setprecision(3) << stats.p90Ms << ","
+            << std::fixed << std::setprecision(3) << stats.p99Ms << ","
+            << std::fixed << std::setprecision(3) << stats.p999Ms;
+        if (memoryTracking_) {
+            oss << "," << (long long)stats.allocatedBytes
+                << "," << (long long)stats.allocations
+                << "," << (long long)stats.peakBytes;
+        }
+        oss << "\n";
     }
 
     return oss.str();
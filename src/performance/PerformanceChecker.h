@@ -1,9 +1,13 @@
 #ifndef PERFORMANCE_CHECKER_H
 #define PERFORMANCE_CHECKER_H
 
+#include "MemoryTracker.h"
 #include <string>
 #include <unordered_map>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <vector>
 #include <memory>
 
@@ -11,14 +15,39 @@
  * PerformanceChecker - 성능 측정 유틸리티
  * 각 기능의 실행 시간을 측정하고 결과를 수집
  * 계층적 구조 지원 추가
+ *
+ * 트레이스 모드 (setTraceMode):
+ * - WSOLA 세그먼트마다 호출되는 startFunction / endFunction을 켜 둔 채로 운영할 수 있도록
+ *   호출마다 문자열 / 벡터 / 트리 복사 없이 (레이블 번호, 시작 시각, 길이, 깊이)만 미리 할당한 원형 버퍼에 기록
+ * - 레이블은 문자열 리터럴 포인터로 번호를 캐시 (같은 호출 위치는 포인터 비교 한 번)
+ * - 트리(getFeatures / getReportJSON)는 보고서를 만들 때 이벤트에서 재구성
+ * - 버퍼가 가득 차면 가장 오래된 이벤트부터 덮어씀 (getDroppedEvents)
+ * - 여러 스레드에서 동시에 startFunction / endFunction 가능 (함수 스택은 스레드별, 이벤트에 스레드 번호 기록)
+ *   기능(startFeature / endFeature)은 한 번에 하나, 트리에는 기능을 연 스레드의 함수만 들어감
+ * - getChromeTrace: Chrome Trace Event 형식 (chrome://tracing, Perfetto에서 바로 열기, 스레드별 트랙)
+ *
+ * 레이블별 누적 통계 (getStatistics / getPercentile):
+ * - 호출 수, 합, 최소, 최대 + 로그 버킷 히스토그램 (2의 거듭제곱 구간마다 16칸, 상대 오차 약 3%)
+ * - 레이블당 메모리 고정 (호출 수와 무관), 모든 호출이 기록되므로 원형 버퍼가 넘쳐도 통계는 정확
+ * - 스레드마다 따로 누적하고 (기록 경로는 잠금 없음) 조회 / 보고서 생성 때 합침
+ *
+ * 메모리 집계 (setMemoryTracking, MemoryTracker 참고):
+ * - 구간마다 할당 바이트 / 할당 횟수 / 구간 시작 대비 최대 live 증가량(peakBytes)
+ * - 계층 API는 노드마다, 두 모드 모두 레이블별 통계(합계, peak는 최대값)에 기록
  */
 class PerformanceChecker {
 public:
     // 계층적 함수 정보
+    // 같은 부모 아래 같은 이름의 호출은 노드 하나로 합침 (duration / 메모리는 합계, peakBytes는 최대값)
+    // (메모리 필드는 setMemoryTracking을 켰을 때만 기록, 트레이스 모드 트리에서는 0)
     struct FunctionNode {
         std::string name;
         double duration;
         std::vector<FunctionNode> children;
+        double count = 1.0;           // 합쳐진 호출 수
+        double allocatedBytes = 0.0;
+        double allocations = 0.0;
+        double peakBytes = 0.0;       // 구간 시작 대비 최대 live 증가량
     };
 
     // 기능 정보
@@ -26,6 +55,9 @@ public:
         std::string feature;
         double duration;
         std::vector<FunctionNode> functions;
+        double allocatedBytes = 0.0;
+        double allocations = 0.0;
+        double peakBytes = 0.0;
     };
 
     struct Measurement {
@@ -34,6 +66,68 @@ public:
         std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
     };
 
+    // 트레이스 이벤트 (완료된 구간 하나)
+    struct TraceEvent {
+        uint32_t label;       // 레이블 번호 (getLabel)
+        uint16_t depth;       // 0 = 기능, 1 이상 = 함수 중첩 깊이
+        uint16_t thread;      // 기록한 스레드 번호 (프로세스 안에서 스레드마다 고유)
+        int64_t startNs;      // 시작 시각 (트레이스 시작 기준, ns)
+        int64_t durationNs;
+    };
+
+    // 레이블별 통계 요약 (ms, JS에서 쓰기 쉽도록 count도 double)
+    struct Statistics {
+        std::string label;
+        double count;
+        double totalMs;
+        double averageMs;
+        double minMs;
+        double maxMs;
+        double p50Ms;
+        double p90Ms;
+        double p99Ms;
+        double p999Ms;
+        double allocatedBytes = 0.0;   // 메모리 집계: 할당 합계
+        double allocations = 0.0;
+        double peakBytes = 0.0;        // 호출 중 가장 큰 live 증가량
+    };
+
+    /**
+     * 로그 버킷 히스토그램 (HDR 방식, ns 단위)
+     * 16 ns 미만은 1 ns 단위, 그 이상은 [2^e, 2^(e+1)) 구간을 16칸으로 나눔 (최대 약 39시간)
+     */
+    struct Histogram {
+        static const int SUB_BUCKET_BITS = 4;
+        static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+        static const int MAX_EXPONENT = 47;
+        static const int BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+        uint64_t count;
+        int64_t totalNs;
+        int64_t minNs;
+        int64_t maxNs;
+        uint32_t buckets[BUCKET_COUNT];
+
+        Histogram();
+        void clear();
+        void record(int64_t ns);
+
+        /**
+         * @param percentile 0 ~ 100
+         * @return 해당 백분위 값 (ns, 버킷 중앙값을 최소 ~ 최대로 제한)
+         */
+        int64_t percentile(double percentile) const;
+
+        // 다른 히스토그램의 기록을 더함 (스레드별 통계 합치기)
+        void merge(const Histogram& other);
+
+        static int bucketIndex(int64_t ns);
+        static int64_t bucketMidpoint(int index);
+    };
+
+    static const int DEFAULT_TRACE_CAPACITY = 1 << 16;   // 이벤트 수 (약 1.5MB)
+    static const int MAX_TRACE_DEPTH = 64;
+
     PerformanceChecker();
     ~PerformanceChecker();
 
@@ -43,12 +137,22 @@ public:
     // 측정 종료 및 기록
     double end(const std::string& label);
 
-    // 특정 레이블의 모든 측정 결과 조회
-    std::vector<double> getMeasurements(const std::string& label) const;
-
     // 특정 레이블의 평균 실행 시간
     double getAverage(const std::string& label) const;
 
+    /**
+     * 레이블의 백분위 실행 시간 (ms)
+     * start / end 레이블을 먼저 찾고, 없으면 기능 / 함수 레이블
+     * @param percentile 0 ~ 100 (예: 99.9)
+     */
+    double getPercentile(const std::string& label, double percentile) const;
+
+    /**
+     * 기능 / 함수 레이블별 통계 (호출 위치별 누적, 처음 기록된 순서)
+     * 스레드별 통계를 합치므로 처리 중이 아닐 때 호출 (getPercentile / 보고서도 같음)
+     */
+    std::vector<Statistics> getStatistics() const;
+
     // 모든 측정 결과 초기화
     void reset();
 
@@ -60,36 +164,176 @@ public:
 
     // === 계층적 측정 API ===
     void startFeature(const std::string& name);
+    void startFeature(const char* name);    // 문자열 리터럴 (레이블 번호를 잠금 없이 캐시에서 찾음)
     void endFeature();
     void startFunction(const std::string& name);
+    void startFunction(const char* name);   // 문자열 리터럴 (트레이스 모드에서 할당 없음)
     void endFunction();
     std::vector<FeatureNode> getFeatures() const;
     double getTotalDuration() const;
 
+    // === 메모리 집계 ===
+
+    /**
+     * 구간별 메모리 / 할당 집계 켜기 / 끄기 (기존 측정 결과는 유지)
+     * 켜면 구간마다 MemoryTracker 스냅샷 두 번 (원자적 읽기 몇 개)
+     */
+    void setMemoryTracking(bool enabled);
+    bool isMemoryTracking() const;
+
+    // === 트레이스 모드 ===
+
+    /**
+     * 트레이스 모드 켜기 / 끄기 (기존 측정 결과는 초기화)
+     * @param capacity 원형 버퍼 크기 (이벤트 수, 켤 때 한 번만 할당)
+     */
+    void setTraceMode(bool enabled, int capacity = DEFAULT_TRACE_CAPACITY);
+    bool isTraceMode() const;
+
+    /**
+     * 버퍼에 남아 있는 이벤트 (오래된 순서, 끝난 순서)
+     */
+    std::vector<TraceEvent> getTraceEvents() const;
+    const std::string& getLabel(uint32_t label) const;
+
+    /**
+     * 버퍼가 가득 차 덮어쓴 이벤트 수
+     */
+    long long getDroppedEvents() const;
+
+    /**
+     * 버퍼의 이벤트를 Chrome Trace Event 형식(JSON)으로 반환
+     * - 구간마다 complete 이벤트 ("ph": "X", ts / dur는 us), tid = 기록한 스레드
+     * - 스레드 이름 메타데이터: setTraceMode를 호출한 스레드 = "main", 나머지 = "worker N"
+     * 처리 중이 아닐 때 호출 (기록 중인 이벤트는 빠질 수 있음)
+     * @return 트레이스 모드가 아니면 빈 traceEvents
+     */
+    std::string getChromeTrace() const;
+
 private:
     // 현재 실행 중인 측정들 (label -> start time)
     std::unordered_map<std::string, std::chrono::time_point<std::chrono::high_resolution_clock>> activeTimers;
 
-    // 완료된 측정 결과들 (label -> list of durations)
-    std::unordered_map<std::string, std::vector<double>> measurements;
+    // 완료된 측정 결과들 (label -> 누적 통계)
+    std::unordered_map<std::string, Histogram> measurements;
+
+    // 구간 시작 시점의 메모리 상태 / 구간의 메모리 사용량
+    struct MemoryMark {
+        MemoryTracker::Snapshot start;
+        int64_t previousPeak;
+    };
+
+    struct MemoryUsage {
+        uint64_t allocatedBytes;
+        uint64_t allocations;
+        int64_t peakBytes;
+    };
+
+    /**
+     * 스레드 하나의 기능 / 함수 레이블별 누적 통계 (labels_와 같은 번호)
+     * 기록은 해당 스레드만 잠금 없이, 크기 변경 / 합치기는 statisticsMutex_ 아래에서
+     */
+    struct StatisticsShard {
+        uint16_t thread;
+        std::vector<Histogram> histograms;
+        std::vector<MemoryUsage> memory;
+    };
+
+    std::vector<std::unique_ptr<StatisticsShard>> shards_;
+    bool memoryTracking_;
 
     // 계층적 측정용
     struct FeatureContext {
         std::string name;
+        uint32_t label;       // 시작할 때 등록한 레이블 번호 (끝날 때 다시 찾지 않음)
         std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
         std::vector<FunctionNode> functions;
+        MemoryMark memory;
     };
 
     struct FunctionContext {
         std::string name;
+        uint32_t label;
         std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
         std::vector<FunctionNode> children;
+        MemoryMark memory;
     };
 
     std::unique_ptr<FeatureContext> currentFeature;
     std::vector<FunctionContext> functionStack;
     std::vector<FeatureNode> completedFeatures;
     double totalDuration;
+
+    // 트레이스 모드
+    struct TraceScope {
+        uint32_t label;
+        int64_t startNs;
+        MemoryMark memory;
+    };
+
+    struct LabelCacheEntry {
+        uint64_t owner;        // 캐시를 채운 측정기 (instanceId_)
+        const char* pointer;
+        uint32_t label;
+    };
+
+    static const int LABEL_CACHE_SIZE = 256;   // 2의 거듭제곱 (포인터 해시 마스크)
+
+    /**
+     * 스레드별 함수 스택 + 레이블 캐시 (thread_local, threadState)
+     * 다른 측정기 / reset 이전에 열린 스택이면 처음 쓸 때 비움
+     */
+    struct ThreadState {
+        uint64_t owner;        // 스택을 쓰는 측정기 (instanceId_)
+        uint64_t epoch;        // 측정기의 traceEpoch_ (reset마다 증가)
+        uint16_t thread;
+        int depth;             // 열린 함수 수
+        int overflow;          // MAX_TRACE_DEPTH를 넘어 기록하지 않은 열린 함수 수
+        uint64_t shardOwner;   // shard를 가진 측정기 (instanceId_)
+        StatisticsShard* shard;
+        TraceScope stack[MAX_TRACE_DEPTH + 1];   // [1..] = 함수
+        LabelCacheEntry cache[LABEL_CACHE_SIZE];
+    };
+
+    bool traceMode_;
+    const uint64_t instanceId_;
+    uint64_t traceEpoch_;
+    uint16_t ownerThread_;                       // setTraceMode를 호출한 스레드 ("main")
+    std::chrono::steady_clock::time_point traceOrigin_;
+    std::vector<TraceEvent> traceRing_;
+    size_t traceMask_;
+    std::atomic<uint64_t> traceWritten_;         // 지금까지 기록한 이벤트 수 (슬롯 예약)
+    TraceScope traceFeature_;
+    uint16_t traceFeatureThread_;
+    bool traceFeatureOpen_;
+
+    std::vector<std::string> labels_;
+    std::unordered_map<std::string, uint32_t> labelIds_;
+
+    // 레이블 등록 / 스레드별 통계 목록 보호 (트레이스 모드의 여러 스레드)
+    mutable std::mutex statisticsMutex_;
+
+    static ThreadState& threadState();
+    ThreadState& traceThreadState();
+    uint32_t internLabel(const std::string& name);
+    uint32_t internLabel(const char* name);
+    void openFeature(const std::string& name, uint32_t label);
+    void openFunction(const std::string& name, uint32_t label);
+    int64_t traceNow() const;
+    void pushTraceScope(uint32_t label);
+    int64_t recordTraceEvent(uint32_t label, uint16_t depth, uint16_t thread, int64_t startNs,
+                             const MemoryUsage& memory);
+    void recordScope(uint32_t label, int64_t durationNs, const MemoryUsage& memory);
+    StatisticsShard& attachShard(ThreadState& state, uint32_t label);
+    void mergeStatistics(uint32_t label, Histogram& histogram, MemoryUsage& memory) const;
+    void beginMemory(MemoryMark& mark) const;
+    MemoryUsage endMemory(const MemoryMark& mark) const;
+    static Statistics summarize(const std::string& label, const Histogram& histogram, const MemoryUsage& memory);
+
+    /**
+     * 원형 버퍼 이벤트로 기능 / 함수 트리 재구성
+     */
+    std::vector<FeatureNode> buildTraceFeatures() const;
 };
 
 #endif // PERFORMANCE_CHECKER_H
@@ -0,0 +1,206 @@
+/**
+ * TaskPool.cpp
+ *
+ * 동작:
+ * 1. parallelFor가 작업(body, 구간 크기, 구간 수)을 등록하고 작업자를 깨움
+ * 2. 호출 스레드와 작업자가 nextChunk_를 하나씩 가져가며 구간을 처리
+ * 3. 모든 구간이 끝나고 작업에 참여한 작업자가 모두 빠져나가면 반환
+ *    (늦게 깬 작업자가 다음 작업의 구간 번호를 건드리지 않도록 activeWorkers_로 확인)
+ */
+
+#include "TaskPool.h"
+#include <algorithm>
+
+#if TASK_POOL_THREADS
+namespace {
+// 작업자 스레드 안에서 다시 parallelFor를 부르면 그 자리에서 실행
+thread_local bool insideTask = false;
+}
+#endif
+
+const int TaskPool::MAX_THREADS;
+
+TaskPool& TaskPool::getInstance() {
+    static TaskPool instance;
+    return instance;
+}
+
+#if TASK_POOL_THREADS
+
+TaskPool::TaskPool()
+    : threadCount_(1), stopping_(false), body_(nullptr), count_(0), chunkSize_(0), chunkCount_(0),
+      generation_(0), nextChunk_(0), finishedChunks_(0), activeWorkers_(0) {
+    setThreadCount(0);
+}
+
+TaskPool::~TaskPool() {
+    stopWorkers();
+}
+
+bool TaskPool::isThreaded() {
+    return true;
+}
+
+void TaskPool::setThreadCount(int count) {
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+
+    if (count <= 0) {
+        count = (int)std::thread::hardware_concurrency();
+    }
+    count = std::max(1, std::min(count, MAX_THREADS));
+    if (count == threadCount_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // 작업자는 다음 parallelFor에서 새 스레드 수로 다시 생성
+    stopWorkers();
+    threadCount_.store(count, std::memory_order_relaxed);
+}
+
+int TaskPool::getThreadCount() const {
+    return threadCount_.load(std::memory_order_relaxed);
+}
+
+void TaskPool::parallelFor(int count, int minGrain, const std::function<void(int, int)>& body) {
+    if (count <= 0) {
+        return;
+    }
+    minGrain = std::max(1, minGrain);
+    if (threadCount_.load(std::memory_order_relaxed) <= 1 || count < minGrain * 2 || insideTask) {
+        body(0, count);
+        return;
+    }
+
+    // 스레드 수는 잠근 뒤 다시 읽음 (그 사이 setThreadCount가 바꿨을 수 있음, 작업자 수와 일치)
+    std::unique_lock<std::mutex> submitLock(submitMutex_);
+    const int threads = threadCount_.load(std::memory_order_relaxed);
+    if (threads <= 1) {
+        submitLock.unlock();
+        body(0, count);
+        return;
+    }
+    if (workers_.empty()) {
+        startWorkers();
+    }
+
+    // 스레드마다 구간 2개 정도 (처리 시간이 구간마다 달라도 균형 유지)
+    int chunkSize = std::max(minGrain, (count + threads * 2 - 1) / (threads * 2));
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        body_ = &body;
+        count_ = count;
+        chunkSize_ = chunkSize;
+        chunkCount_ = (count + chunkSize - 1) / chunkSize;
+        nextChunk_ = 0;
+        finishedChunks_ = 0;
+        ++generation_;
+    }
+    workReady_.notify_all();
+
+    insideTask = true;
+    runChunks();
+    insideTask = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    workDone_.wait(lock, [this] { return finishedChunks_ >= chunkCount_ && activeWorkers_ == 0; });
+    body_ = nullptr;
+}
+
+void TaskPool::startWorkers() {
+    stopping_ = false;
+    const int threads = threadCount_.load(std::memory_order_relaxed);
+    for (int i = 0; i < threads - 1; ++i) {
+        workers_.emplace_back(&TaskPool::workerLoop, this);
+    }
+}
+
+void TaskPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workReady_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+void TaskPool::workerLoop() {
+    insideTask = true;
+    unsigned long long seen = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        seen = generation_;
+    }
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workReady_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+            if (body_ == nullptr) {
+                continue;   // 이미 끝난 작업
+            }
+            ++activeWorkers_;
+        }
+
+        runChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --activeWorkers_;
+        }
+        workDone_.notify_all();
+    }
+}
+
+void TaskPool::runChunks() {
+    while (true) {
+        int chunk = nextChunk_.fetch_add(1);
+        if (chunk >= chunkCount_) {
+            return;
+        }
+        int begin = chunk * chunkSize_;
+        int end = std::min(count_, begin + chunkSize_);
+        (*body_)(begin, end);
+
+        if (finishedChunks_.fetch_add(1) + 1 == chunkCount_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            workDone_.notify_all();
+        }
+    }
+}
+
+#else
+
+// 단일 스레드 빌드: 모든 작업을 호출 스레드에서 실행
+TaskPool::TaskPool() : threadCount_(1) {
+}
+
+TaskPool::~TaskPool() {
+}
+
+bool TaskPool::isThreaded() {
+    return false;
+}
+
+void TaskPool::setThreadCount(int count) {
+    (void)count;
+}
+
+int TaskPool::getThreadCount() const {
+    return 1;
+}
+
+void TaskPool::parallelFor(int count, int minGrain, const std::function<void(int, int)>& body) {
+    (void)minGrain;
+    if (count > 0) {
+        body(0, count);
+    }
+}
+
+#endif
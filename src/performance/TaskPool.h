@@ -0,0 +1,91 @@
+/**
+ * TaskPool.h
+ *
+ * 프레임 / 채널 / 출력 구간처럼 서로 독립적인 작업을 여러 스레드로 나눠 실행하는 작은 작업 풀
+ * - 네이티브 빌드와 WASM pthreads 빌드(-pthread, build.sh의 멀티스레드 변형)에서 스레드 사용
+ * - 단일 스레드 WASM 빌드(cross-origin isolation이 없는 호스트용)에서는 호출 스레드에서 바로 실행
+ *
+ * parallelFor는 [0, count)를 겹치지 않는 구간으로 나누고, 구간마다 body를 한 번씩 호출
+ * 구간은 서로 다른 출력을 쓰므로 스레드 수와 상관없이 결과가 같음 (구간 나누는 방식만 달라짐)
+ * 작업 안에서 다시 parallelFor를 호출하면 그 자리에서 순서대로 실행 (교착 방지)
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <functional>
+
+// 스레드 사용 여부 (네이티브 또는 Emscripten -pthread)
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define TASK_POOL_THREADS 1
+#else
+#define TASK_POOL_THREADS 0
+#endif
+
+#if TASK_POOL_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+class TaskPool {
+public:
+    static TaskPool& getInstance();
+
+    /**
+     * 스레드 수 설정 (호출 스레드 포함)
+     * @param count 0 = 하드웨어 코어 수 (최대 MAX_THREADS), 1 = 단일 스레드
+     *        스레드를 지원하지 않는 빌드에서는 항상 1
+     */
+    void setThreadCount(int count);
+    int getThreadCount() const;
+
+    // 이 빌드에서 스레드를 쓸 수 있는지 (단일 스레드 WASM 빌드면 false)
+    static bool isThreaded();
+
+    /**
+     * [0, count)를 구간으로 나눠 병렬 실행 (모든 구간이 끝나야 반환)
+     * @param minGrain 구간 하나의 최소 크기 (count가 이보다 작으면 호출 스레드에서 바로 실행)
+     * @param body body(begin, end): 구간 하나 처리, 다른 구간과 같은 데이터를 쓰면 안 됨
+     */
+    void parallelFor(int count, int minGrain, const std::function<void(int, int)>& body);
+
+    static const int MAX_THREADS = 8;
+
+private:
+    TaskPool();
+    ~TaskPool();
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    std::atomic<int> threadCount_;   // setThreadCount는 submitMutex_ 아래에서 쓰고, 빠른 경로는 잠금 없이 읽음
+
+#if TASK_POOL_THREADS
+    // 작업자 스레드 (threadCount_ - 1개, 첫 parallelFor에서 생성)
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable workReady_;
+    std::condition_variable workDone_;
+    std::mutex submitMutex_;   // 여러 스레드가 동시에 parallelFor를 호출하면 순서대로 실행
+    bool stopping_;
+
+    // 현재 작업 (generation_이 바뀌면 새 작업)
+    const std::function<void(int, int)>* body_;
+    int count_;
+    int chunkSize_;
+    int chunkCount_;
+    unsigned long long generation_;
+    std::atomic<int> nextChunk_;
+    std::atomic<int> finishedChunks_;
+    int activeWorkers_;
+
+    void startWorkers();
+    void stopWorkers();
+    void workerLoop();
+    void runChunks();
+#endif
+};
+
+#endif // TASK_POOL_H
@@ -0,0 +1,257 @@
+/**
+ * AudioBuffer planar (SoA) 저장 모드 테스트
+ *
+ * 검증 항목:
+ *   1. 각 채널 plane의 시작 주소가 요청한 정렬(16 / 32 / 64 바이트) 경계인지
+ *   2. interleaved -> planar -> interleaved 왕복이 원본과 같은지
+ *   3. 채널 view / 길이 / duration / plane 끝 패딩(0)
+ *   4. 복사한 AudioBuffer도 정렬 유지
+ *   5. planar 입력 DSP 결과 = interleaved 입력 DSP 결과 (pitch + tempo, filter)
+ *   6. 나머지 AudioBuffer 소비자도 planar 입력 = interleaved 입력
+ *      (reverse, pitch 분석, 전처리, 효과 체인 / 가변 피치 렌더링은 모노 planar)
+ *
+ * 사용법:
+ *   ./test_audio_buffer_layout
+ */
+
+#include "src/audio/AudioBuffer.h"
+#include "src/audio/AudioPreprocessor.h"
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/dsp/VariablePitchRenderer.h"
+#include "src/effects/AudioReverser.h"
+#include "src/effects/EffectChain.h"
+#include "src/effects/VoiceFilter.h"
+#include "tests/test_helpers.h"
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// 채널마다 다른 주파수의 interleaved 신호 생성
+std::vector<float> generateInterleaved(int frames, int channels) {
+    std::vector<float> data((size_t)frames * channels);
+    for (int i = 0; i < frames; ++i) {
+        float t = static_cast<float>(i) / SAMPLE_RATE;
+        for (int c = 0; c < channels; ++c) {
+            float frequency = 150.0f + 70.0f * c;
+            data[(size_t)i * channels + c] = 0.5f * std::sin(2.0f * M_PI * frequency * t)
+                                           + 0.2f * std::sin(2.0f * M_PI * frequency * 2.0f * t);
+        }
+    }
+    return data;
+}
+
+bool isAligned(const float* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+// planar 결과는 interleaved로 바꿔 비교 (planar 출력 여부도 확인)
+bool samePlanarResult(AudioBuffer result, const AudioBuffer& expected) {
+    bool planar = result.isPlanar();
+    result.convertToInterleaved();
+    return planar && result.getChannels() == expected.getChannels() && result.getData() == expected.getData();
+}
+
+bool samePitchPoints(const std::vector<PitchPoint>& a, const std::vector<PitchPoint>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].time != b[i].time || a[i].frequency != b[i].frequency || a[i].confidence != b[i].confidence) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    AudioBuffer planar 저장 모드 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    const int frames = 44101;  // 정렬 단위의 배수가 아닌 길이 (패딩 확인)
+    const int channels = 3;
+    std::vector<float> interleaved = generateInterleaved(frames, channels);
+
+    // 1 ~ 3. 정렬 / 왕복 / view
+    const size_t alignments[] = {16, 32, 64};
+    for (size_t alignment : alignments) {
+        AudioBuffer buffer(SAMPLE_RATE, channels);
+        buffer.setData(interleaved);
+        float duration = buffer.getDuration();
+        buffer.convertToPlanar(alignment);
+
+        bool aligned = buffer.isPlanar() && buffer.getAlignment() == alignment;
+        bool padded = true;
+        bool viewOk = true;
+        for (int c = 0; c < channels; ++c) {
+            const float* plane = buffer.getChannelData(c);
+            aligned = aligned && isAligned(plane, alignment);
+            for (size_t i = frames; i < buffer.getChannelStride(); ++i) {
+                padded = padded && plane[i] == 0.0f;
+            }
+            ConstChannelView view = static_cast<const AudioBuffer&>(buffer).getChannel(c);
+            viewOk = viewOk && view.size() == (size_t)frames
+                            && view[frames - 1] == interleaved[(size_t)(frames - 1) * channels + c];
+        }
+
+        std::cout << "  정렬 " << alignment << "바이트: stride " << buffer.getChannelStride() << " 샘플" << std::endl;
+        check("plane 시작 주소 정렬", aligned, failures);
+        check("plane 끝 패딩 = 0", padded, failures);
+        check("채널 view 길이 / 값", viewOk, failures);
+        check("planar 모드 길이 / duration 유지",
+              buffer.getLength() == interleaved.size() && buffer.getFrameCount() == (size_t)frames
+              && buffer.getDuration() == duration && buffer.getData().empty(), failures);
+
+        // 4. 복사해도 정렬 유지
+        AudioBuffer copy = buffer;
+        bool copyAligned = copy.isPlanar();
+        for (int c = 0; c < channels; ++c) {
+            copyAligned = copyAligned && isAligned(copy.getChannelData(c), alignment);
+        }
+        check("복사본 정렬 유지", copyAligned, failures);
+
+        buffer.convertToInterleaved();
+        check("interleaved 왕복 = 원본", !buffer.isPlanar() && buffer.getData() == interleaved, failures);
+    }
+
+    // 쓰기 view
+    {
+        AudioBuffer buffer(SAMPLE_RATE, 2);
+        buffer.setData(generateInterleaved(100, 2));
+        buffer.convertToPlanar();
+        ChannelView right = buffer.getChannel(1);
+        for (float& sample : right) {
+            sample = 0.25f;
+        }
+        buffer.convertToInterleaved();
+        bool ok = true;
+        for (size_t i = 1; i < buffer.getData().size(); i += 2) {
+            ok = ok && buffer.getData()[i] == 0.25f;
+        }
+        check("ChannelView 쓰기 -> interleaved 반영", ok, failures);
+    }
+
+    // 5. planar 입력 DSP = interleaved 입력 DSP
+    std::vector<float> stereo = generateInterleaved(SAMPLE_RATE, 2);
+    {
+        AudioBuffer interleavedBuffer(SAMPLE_RATE, 2);
+        interleavedBuffer.setData(stereo);
+        AudioBuffer planarBuffer = interleavedBuffer;
+        planarBuffer.convertToPlanar(64);
+
+        SimplePitchShifter shifter;
+        AudioBuffer expected = shifter.processWithTempo(interleavedBuffer, 3.0f, 1.2f);
+        AudioBuffer result = shifter.processWithTempo(planarBuffer, 3.0f, 1.2f);
+
+        bool planarOut = result.isPlanar() && result.getAlignment() == 64 && result.getChannels() == 2;
+        result.convertToInterleaved();
+        check("Pitch + Tempo: planar 입력 -> planar 출력 (정렬 유지)", planarOut, failures);
+        check("Pitch + Tempo: planar 결과 = interleaved 결과", result.getData() == expected.getData(), failures);
+
+        SimpleTimeStretcher stretcher;
+        expected = stretcher.process(interleavedBuffer, 0.8f);
+        result = stretcher.process(planarBuffer, 0.8f);
+        planarOut = result.isPlanar();
+        result.convertToInterleaved();
+        check("Time stretch: planar 결과 = interleaved 결과",
+              planarOut && result.getData() == expected.getData(), failures);
+    }
+    {
+        AudioBuffer interleavedBuffer(SAMPLE_RATE, 2);
+        interleavedBuffer.setData(stereo);
+        AudioBuffer planarBuffer = interleavedBuffer;
+        planarBuffer.convertToPlanar();
+
+        VoiceFilter filter;
+        bool ok = true;
+        const FilterType types[] = {FilterType::REVERB, FilterType::FLANGER};
+        for (FilterType type : types) {
+            AudioBuffer expected = filter.applyFilter(interleavedBuffer, type, 0.5f, 0.5f);
+            AudioBuffer result = filter.applyFilter(planarBuffer, type, 0.5f, 0.5f);
+            ok = ok && result.isPlanar();
+            result.convertToInterleaved();
+            ok = ok && result.getData() == expected.getData();
+        }
+        AudioBuffer expected = filter.applyEcho(interleavedBuffer, 0.2f, 0.4f);
+        AudioBuffer result = filter.applyEcho(planarBuffer, 0.2f, 0.4f);
+        result.convertToInterleaved();
+        ok = ok && result.getData() == expected.getData();
+        check("VoiceFilter: planar 결과 = interleaved 결과", ok, failures);
+    }
+
+    // 6. 나머지 소비자
+    {
+        AudioBuffer interleavedBuffer(SAMPLE_RATE, 2);
+        interleavedBuffer.setData(stereo);
+        AudioBuffer planarBuffer = interleavedBuffer;
+        planarBuffer.convertToPlanar();
+
+        AudioReverser reverser;
+        check("reverse: planar 결과 = interleaved 결과",
+              samePlanarResult(reverser.reverse(planarBuffer), reverser.reverse(interleavedBuffer)), failures);
+
+        PitchAnalyzer analyzer;
+        std::vector<PitchPoint> expectedPoints = analyzer.analyze(interleavedBuffer);
+        check("PitchAnalyzer: planar 결과 = interleaved 결과",
+              !expectedPoints.empty() && samePitchPoints(analyzer.analyze(planarBuffer), expectedPoints), failures);
+
+        AudioPreprocessor preprocessor;
+        std::vector<FrameData> expectedFrames = preprocessor.process(interleavedBuffer);
+        std::vector<FrameData> planarFrames = preprocessor.process(planarBuffer);
+        bool sameFrames = !expectedFrames.empty() && planarFrames.size() == expectedFrames.size();
+        for (size_t i = 0; sameFrames && i < planarFrames.size(); ++i) {
+            sameFrames = planarFrames[i].time == expectedFrames[i].time
+                      && planarFrames[i].samples == expectedFrames[i].samples;
+        }
+        check("AudioPreprocessor: planar 프레임 = interleaved 프레임", sameFrames, failures);
+    }
+    {
+        // 효과 체인 / 가변 피치 렌더링은 모노만 지원: 모노 planar = 모노 interleaved
+        AudioBuffer monoBuffer(SAMPLE_RATE, 1);
+        monoBuffer.setData(generateInterleaved(SAMPLE_RATE, 1));
+        AudioBuffer monoPlanar = monoBuffer;
+        monoPlanar.convertToPlanar();
+
+        EffectChain chain;
+        chain.parse("pitch:2;tempo:1.2;gain:0.8");
+        AudioBuffer expected = chain.process(monoBuffer);
+        AudioBuffer result = chain.process(monoPlanar);
+        check("EffectChain: 모노 planar 결과 = 모노 interleaved 결과",
+              !expected.getData().empty() && result.getData() == expected.getData(), failures);
+
+        VariablePitchRenderer renderer;
+        std::vector<float> curve(monoBuffer.getLength(), 3.0f);
+        monoBuffer.setPitchCurve(curve);
+        monoPlanar.setPitchCurve(curve);
+        expected = renderer.render(monoBuffer);
+        result = renderer.render(monoPlanar);
+        check("VariablePitchRenderer (pitch curve): 모노 planar 결과 = 모노 interleaved 결과",
+              !expected.getData().empty() && result.getData() == expected.getData(), failures);
+
+        std::vector<FrameData> frames = AudioPreprocessor().process(monoBuffer);
+        for (auto& frame : frames) {
+            frame.pitchSemitones = -2.0f;
+            frame.durationRatio = 1.1f;
+        }
+        expected = renderer.render(monoBuffer, frames);
+        result = renderer.render(monoPlanar, frames);
+        check("VariablePitchRenderer (FrameData): 모노 planar 결과 = 모노 interleaved 결과",
+              !expected.getData().empty() && result.getData() == expected.getData(), failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
@@ -0,0 +1,615 @@
+/**
+ * 객관적 음질 테스트 (속도 최적화가 품질을 떨어뜨리지 않는지 자동 확인)
+ *
+ * 입력 신호 (2초, 44.1 kHz, original.wav는 원래 샘플레이트):
+ *   - sine220 / sine1k: 순음
+ *   - chirp: 100 Hz -> 3 kHz 선형 sweep
+ *   - voice: 기본 주파수 + 1/k 배음 (비브라토, 음절 단위 진폭)
+ *   - noise: 저역 통과한 백색 잡음 (고정 seed)
+ *   - original.wav: 저장소의 음성 녹음
+ *
+ * 처리 (SimpleTimeStretcher / SimplePitchShifter):
+ *   - stretch x0.5 / 0.8 / 1.25 / 2.0 (STANDARD), x0.8 / 1.25 (HIERARCHICAL), x0.8 / 1.25 (AUTO)
+ *   - pitch -12 / -5 / +5 / +12 (LINEAR), -5 / +5 (SINC_16)
+ *   - pitch +4 & tempo 1.2 (processWithTempo)
+ *   - 크로스페이드 모양: stretch x1.25 / pitch +5 (HANN)
+ *     (EQUAL_POWER는 상관관계가 높은 이음새에서 최대 +3 dB 부풀어 순음 THD+N이 -18 dB 정도라 5번으로만 확인)
+ *
+ * 검증 항목 (신호 x 처리마다, 해당하는 것만):
+ *   1. 길이: 입력 길이 / tempo 와 2% 이내
+ *   2. 주파수: 순음은 스펙트럼 피크(보간), voice / original.wav는 PitchAnalyzer 중앙값이 기대값과 오차 이내
+ *      (PitchAnalyzer: 50 ms 프레임, 신뢰도 0.5 이상, 옥타브 오류를 피하려고 탐색 범위를 기대값의 1/2 ~ 2배로 제한)
+ *   3. 스펙트럼 왜곡:
+ *      - 순음: THD+N (기대 주파수 주변 ±4 bin 밖 에너지 / 안 에너지, dB)
+ *      - chirp / voice: 같은 생성기로 합성한 이상적인 결과와 장시간 평균 스펙트럼(LTAS)의 log-spectral distance (dB)
+ *      - noise: stretch는 입력 LTAS, pitch는 주파수축을 2^(s/12)배 늘인 입력 LTAS와 비교
+ *      - original.wav: stretch만 입력 LTAS와 비교 (pitch는 배음 피크 모양이 달라져 기준을 만들 수 없음)
+ *      (LTAS는 전체 파워를 맞춘 뒤 0.35 fs 이하에서 기준 최대값 -40 dB 이상인 bin만 비교,
+ *       그 위는 리샘플러 필터 전이 대역)
+ *   4. 클릭 / 불연속: 2차 차분의 국소 crest factor (|e[n]| / 주변 768 샘플 RMS)의 최대값
+ *      이음새가 어긋나면 2차 차분이 튀어 커짐 (noise는 원래 crest가 커서 제외,
+ *      허용치는 8 또는 입력 crest의 1.5배 중 큰 값)
+ *      마지막 100 ms는 제외: 끝의 남은 입력은 크로스페이드 없이 이어 붙이므로 (세그먼트 이음새와 별개)
+ *   5. 크로스페이드 음량: 백색 잡음을 탐색 없이(이음새 양쪽이 무상관) stretch x0.8 했을 때
+ *      이음새 구간 / 나머지 구간 파워 비: LINEAR / HANN은 꺼지고 EQUAL_POWER는 유지
+ *
+ * 현재 기준 (허용치를 정한 근거):
+ *   - 순음 THD+N: STANDARD 탐색은 -22 ~ -30 dB, 220 Hz 주파수 오차 최대 0.65%
+ *     (상관관계 0.95 이상에서 조기 종료해 위상이 약간 어긋남), HIERARCHICAL은 -45 ~ -55 dB / 0.03%
+ *   - LSD 허용치는 신호별: voice 2 dB (측정 최대 약 1 dB), original.wav 3 dB (약 2.1),
+ *     noise 4 dB (pitch down에서 약 2.8), chirp 6 dB (x2에서 약 4.7, 빠른 sweep을 건너뛰며 이어 붙임)
+ *   - 클릭 crest: 순음 / chirp 1.4 ~ 7, voice 6 ~ 8.5, 이음새가 어긋나면 15 이상
+ *
+ * 사용법:
+ *   ./test_audio_quality [original.wav 경로]
+ */
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include "src/audio/WavFile.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/external/kissfft/kiss_fft.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef PROJECT_SOURCE_DIR
+#define PROJECT_SOURCE_DIR "."
+#endif
+
+namespace {
+
+const double DURATION = 2.0;
+
+// 허용 오차
+const double LENGTH_TOLERANCE = 0.02;        // 2%
+const double SINE_FREQUENCY_TOLERANCE = 0.01;
+const double PITCH_TOLERANCE = 0.03;         // PitchAnalyzer 중앙값 (3%)
+const double MAX_THDN_DB = -20.0;
+const double MAX_CLICK_CREST = 8.0;         // 또는 입력 crest의 1.5배 중 큰 값
+const double LSD_MAX_FREQUENCY = 0.35;      // 비교 대역 상한 (fs 배수)
+const float PITCH_FRAME = 0.05f;            // 초
+const float PITCH_MIN_CONFIDENCE = 0.5f;
+const float VOICE_F0 = 150.0f;
+
+enum class SignalKind {
+    SINE_220,
+    SINE_1K,
+    CHIRP,
+    VOICE,
+    NOISE,
+    RECORDING
+};
+
+enum class Method {
+    STRETCH,
+    PITCH,
+    PITCH_TEMPO
+};
+
+struct Operation {
+    std::string name;
+    Method method;
+    float semitones;
+    float tempo;
+    OverlapSearchMode search;
+    StretchParameterMode parameters;
+    ResamplerQuality quality;
+    CrossfadeShape fade = CrossfadeShape::LINEAR;
+};
+
+struct Signal {
+    std::string name;
+    SignalKind kind;
+    int sampleRate;
+    std::vector<float> data;
+};
+
+// ---------------------------------------------------------------------------
+// 신호 생성 (timeScale: 출력 1초가 원래 신호의 몇 초인지, pitchScale: 모든 주파수 배율)
+// ---------------------------------------------------------------------------
+
+std::vector<float> generate(SignalKind kind, int length, double timeScale, double pitchScale) {
+    std::vector<float> data(length, 0.0f);
+    const double nyquistLimit = 0.45 * SAMPLE_RATE;
+    double phase = 0.0;
+
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / SAMPLE_RATE * timeScale;
+        double value = 0.0;
+
+        switch (kind) {
+            case SignalKind::SINE_220:
+            case SignalKind::SINE_1K: {
+                double frequency = kind == SignalKind::SINE_220 ? 220.0 : 1000.0;
+                phase += 2.0 * M_PI * frequency * pitchScale / SAMPLE_RATE;
+                value = 0.5 * std::sin(phase);
+                break;
+            }
+            case SignalKind::CHIRP: {
+                double frequency = 100.0 + (3000.0 - 100.0) * t / DURATION;
+                phase += 2.0 * M_PI * frequency * pitchScale / SAMPLE_RATE;
+                value = 0.5 * std::sin(phase);
+                break;
+            }
+            case SignalKind::VOICE: {
+                const double maxF0 = 150.0 * 1.12;
+                double f0 = 150.0 * (1.0 + 0.1 * std::sin(2.0 * M_PI * 0.7 * t) + 0.02 * std::sin(2.0 * M_PI * 5.0 * t));
+                phase += 2.0 * M_PI * f0 * pitchScale / SAMPLE_RATE;
+                for (int k = 1; k <= 20 && maxF0 * k * pitchScale < nyquistLimit; ++k) {
+                    value += std::sin(phase * k) / k;
+                }
+                value *= 0.3 * (0.55 + 0.45 * std::sin(2.0 * M_PI * 3.0 * t));
+                break;
+            }
+            default:
+                break;
+        }
+        data[i] = (float)value;
+    }
+    return data;
+}
+
+// 저역 통과한 백색 잡음 (one-pole, 약 2 kHz)
+std::vector<float> generateNoise(int length) {
+    std::vector<float> data(length);
+    unsigned int seed = 12345;
+    const float coefficient = (float)std::exp(-2.0 * M_PI * 2000.0 / SAMPLE_RATE);
+    float state = 0.0f;
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        float white = (float)((seed >> 8) / 16777216.0 - 0.5);
+        state = (1.0f - coefficient) * white + coefficient * state;
+        data[i] = 2.0f * state;
+    }
+    return data;
+}
+
+// 필터 없는 백색 잡음 (크로스페이드 음량 측정용, 이음새 양쪽 상관관계가 거의 없음)
+std::vector<float> generateWhiteNoise(int length) {
+    std::vector<float> data(length);
+    unsigned int seed = 54321;
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (float)((seed >> 8) / 16777216.0 - 0.5);
+    }
+    return data;
+}
+
+// 신호별 LSD 허용치 (dB)
+double maxLogSpectralDistance(SignalKind kind) {
+    switch (kind) {
+        case SignalKind::VOICE: return 2.0;
+        case SignalKind::RECORDING: return 3.0;
+        case SignalKind::NOISE: return 4.0;
+        case SignalKind::CHIRP: return 6.0;
+        default: return 3.0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 처리
+// ---------------------------------------------------------------------------
+
+double pitchScale(const Operation& op) {
+    return op.method == Method::STRETCH ? 1.0 : std::pow(2.0, op.semitones / 12.0);
+}
+
+double tempoOf(const Operation& op) {
+    return op.method == Method::PITCH ? 1.0 : op.tempo;
+}
+
+void runOperation(const Operation& op, const Signal& signal, std::vector<float>& output) {
+    const int length = (int)signal.data.size();
+    if (op.method == Method::STRETCH) {
+        SimpleTimeStretcher stretcher;
+        stretcher.setSearchMode(op.search);
+        stretcher.setParameterMode(op.parameters);
+        stretcher.setCrossfadeShape(op.fade);
+        stretcher.process(signal.data.data(), length, signal.sampleRate, op.tempo, output);
+    } else {
+        SimplePitchShifter shifter;
+        shifter.setResamplerQuality(op.quality);
+        shifter.setCrossfadeShape(op.fade);
+        if (op.method == Method::PITCH) {
+            shifter.process(signal.data.data(), length, signal.sampleRate, op.semitones, output);
+        } else {
+            shifter.processWithTempo(signal.data.data(), length, signal.sampleRate, op.semitones, op.tempo, output);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 측정
+// ---------------------------------------------------------------------------
+
+// 장시간 평균 파워 스펙트럼 (Hann 창, 50% 겹침)
+std::vector<double> averageSpectrum(const std::vector<float>& data, int fftSize) {
+    std::vector<double> power(fftSize / 2 + 1, 0.0);
+    if ((int)data.size() < fftSize) {
+        return power;
+    }
+
+    kiss_fft_cfg config = kiss_fft_alloc(fftSize, 0, nullptr, nullptr);
+    std::vector<kiss_fft_cpx> in(fftSize);
+    std::vector<kiss_fft_cpx> out(fftSize);
+    int frames = 0;
+    for (size_t start = 0; start + fftSize <= data.size(); start += fftSize / 2) {
+        for (int i = 0; i < fftSize; ++i) {
+            float window = (float)(0.5 - 0.5 * std::cos(2.0 * M_PI * i / fftSize));
+            in[i].r = data[start + i] * window;
+            in[i].i = 0.0f;
+        }
+        kiss_fft(config, in.data(), out.data());
+        for (int k = 0; k <= fftSize / 2; ++k) {
+            power[k] += (double)out[k].r * out[k].r + (double)out[k].i * out[k].i;
+        }
+        frames++;
+    }
+    kiss_fft_free(config);
+
+    for (double& value : power) {
+        value /= frames;
+    }
+    return power;
+}
+
+// 순음 주파수 (최대 bin + 포물선 보간)
+double peakFrequency(const std::vector<double>& power, int fftSize, int sampleRate) {
+    size_t peak = 1;
+    for (size_t k = 1; k + 1 < power.size(); ++k) {
+        if (power[k] > power[peak]) {
+            peak = k;
+        }
+    }
+    double left = std::log(power[peak - 1] + 1e-30);
+    double center = std::log(power[peak] + 1e-30);
+    double right = std::log(power[peak + 1] + 1e-30);
+    double denominator = left - 2.0 * center + right;
+    double offset = denominator != 0.0 ? 0.5 * (left - right) / denominator : 0.0;
+    return (peak + offset) * sampleRate / fftSize;
+}
+
+// THD+N (dB): 기대 주파수 ±4 bin 밖 에너지 / 안 에너지
+double thdPlusNoise(const std::vector<double>& power, int fftSize, int sampleRate, double frequency) {
+    int center = (int)std::lround(frequency * fftSize / sampleRate);
+    double inside = 0.0;
+    double outside = 0.0;
+    for (int k = 1; k < (int)power.size(); ++k) {
+        if (std::abs(k - center) <= 4) {
+            inside += power[k];
+        } else {
+            outside += power[k];
+        }
+    }
+    return 10.0 * std::log10((outside + 1e-30) / (inside + 1e-30));
+}
+
+// 주파수축을 scale배 늘인 스펙트럼 (pitch shift된 광대역 신호의 기준)
+std::vector<double> warpSpectrum(const std::vector<double>& power, double scale) {
+    std::vector<double> warped(power.size(), 0.0);
+    for (size_t k = 0; k < power.size(); ++k) {
+        double source = k / scale;
+        size_t index = (size_t)source;
+        if (index + 1 >= power.size()) {
+            break;
+        }
+        double fraction = source - index;
+        warped[k] = power[index] * (1.0 - fraction) + power[index + 1] * fraction;
+    }
+    return warped;
+}
+
+/**
+ * LTAS log-spectral distance (dB)
+ * 전체 파워를 맞춘 뒤 기준 최대값 -40 dB 이상인 bin만 비교
+ */
+double logSpectralDistance(const std::vector<double>& reference, const std::vector<double>& output) {
+    const size_t bins = (size_t)(LSD_MAX_FREQUENCY * 2.0 * (reference.size() - 1));
+    double referenceTotal = 0.0;
+    double outputTotal = 0.0;
+    double referenceMax = 0.0;
+    for (size_t k = 0; k < bins; ++k) {
+        referenceTotal += reference[k];
+        outputTotal += output[k];
+        referenceMax = std::max(referenceMax, reference[k]);
+    }
+    if (referenceTotal <= 0.0 || outputTotal <= 0.0) {
+        return 1e9;
+    }
+    const double gain = referenceTotal / outputTotal;
+    const double floor = referenceMax * 1e-6;
+
+    double sum = 0.0;
+    int count = 0;
+    for (size_t k = 1; k < bins; ++k) {
+        if (reference[k] < referenceMax * 1e-4) {
+            continue;
+        }
+        double difference = 10.0 * std::log10((reference[k] + floor) / (output[k] * gain + floor));
+        sum += difference * difference;
+        count++;
+    }
+    return count > 0 ? std::sqrt(sum / count) : 1e9;
+}
+
+/**
+ * 2차 차분의 최대 국소 crest factor
+ * 256 샘플 블록마다 앞뒤 블록을 포함한 RMS로 나눔
+ * 앞 1024 샘플 / 마지막 100 ms / 거의 무음인 블록은 제외
+ */
+double maxClickCrest(const std::vector<float>& data, int sampleRate) {
+    const int block = 256;
+    const int headMargin = 1024;
+    const int tailMargin = sampleRate / 10;
+    if ((int)data.size() < headMargin + tailMargin + 3 * block) {
+        return 0.0;
+    }
+
+    std::vector<float> difference(data.size(), 0.0f);
+    double signalPeak = 0.0;
+    for (size_t i = 2; i < data.size(); ++i) {
+        difference[i] = data[i] - 2.0f * data[i - 1] + data[i - 2];
+        signalPeak = std::max(signalPeak, (double)std::fabs(data[i]));
+    }
+
+    const int blocks = (int)data.size() / block;
+    std::vector<double> blockEnergy(blocks, 0.0);
+    std::vector<double> blockLevel(blocks, 0.0);
+    for (int b = 0; b < blocks; ++b) {
+        for (int i = b * block; i < (b + 1) * block; ++i) {
+            blockEnergy[b] += (double)difference[i] * difference[i];
+            blockLevel[b] = std::max(blockLevel[b], (double)std::fabs(data[i]));
+        }
+    }
+
+    double worst = 0.0;
+    for (int b = headMargin / block; b < (int)(data.size() - tailMargin) / block; ++b) {
+        if (blockLevel[b] < signalPeak * 0.05) {
+            continue;
+        }
+        double rms = std::sqrt((blockEnergy[b - 1] + blockEnergy[b] + blockEnergy[b + 1]) / (3.0 * block));
+        if (rms <= 0.0) {
+            continue;
+        }
+        for (int i = b * block; i < (b + 1) * block; ++i) {
+            worst = std::max(worst, std::fabs(difference[i]) / rms);
+        }
+    }
+    return worst;
+}
+
+std::string formatFixed(double value, int precision) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(precision) << value;
+    return oss.str();
+}
+
+/**
+ * 신호 하나 x 처리 하나 측정 + 판정
+ * @param inputCrest 입력의 클릭 crest (허용치 계산용)
+ * @param recordingPitch original.wav 입력의 중앙 피치 (RECORDING만 사용)
+ */
+void evaluate(const Signal& signal, const Operation& op, double inputCrest, float recordingPitch, int& failures) {
+    std::vector<float> output;
+    runOperation(op, signal, output);
+
+    const int length = (int)signal.data.size();
+    const double scale = pitchScale(op);
+    const double tempo = tempoOf(op);
+    const double expectedLength = length / tempo;
+
+    std::ostringstream detail;
+    bool ok = true;
+
+    // 1. 길이
+    double lengthError = std::fabs(output.size() - expectedLength) / expectedLength;
+    detail << "길이 " << formatFixed(lengthError * 100.0, 2) << "%";
+    ok = ok && lengthError <= LENGTH_TOLERANCE;
+
+    const int fftSize = signal.kind == SignalKind::SINE_220 || signal.kind == SignalKind::SINE_1K ? 8192 : 2048;
+    std::vector<double> spectrum = averageSpectrum(output, fftSize);
+
+    // 2. 주파수 / 3. 스펙트럼 왜곡
+    switch (signal.kind) {
+        case SignalKind::SINE_220:
+        case SignalKind::SINE_1K: {
+            double expected = (signal.kind == SignalKind::SINE_220 ? 220.0 : 1000.0) * scale;
+            double measured = peakFrequency(spectrum, fftSize, signal.sampleRate);
+            double frequencyError = std::fabs(measured - expected) / expected;
+            double thdn = thdPlusNoise(spectrum, fftSize, signal.sampleRate, expected);
+            detail << ", 주파수 " << formatFixed(frequencyError * 100.0, 2) << "%, THD+N " << formatFixed(thdn, 1) << " dB";
+            ok = ok && frequencyError <= SINE_FREQUENCY_TOLERANCE && thdn <= MAX_THDN_DB;
+            break;
+        }
+        case SignalKind::CHIRP:
+        case SignalKind::VOICE: {
+            std::vector<float> reference = generate(signal.kind, (int)std::lround(expectedLength), tempo, scale);
+            double lsd = logSpectralDistance(averageSpectrum(reference, fftSize), spectrum);
+            detail << ", LSD " << formatFixed(lsd, 2) << " dB";
+            ok = ok && lsd <= maxLogSpectralDistance(signal.kind);
+
+            if (signal.kind == SignalKind::VOICE) {
+                float nominal = (float)(VOICE_F0 * scale);
+                double expected = measureMedianPitch(reference, signal.sampleRate, nominal * 0.5f, nominal * 2.0f,
+                                                     PITCH_FRAME, PITCH_MIN_CONFIDENCE);
+                double measured = measureMedianPitch(output, signal.sampleRate, nominal * 0.5f, nominal * 2.0f,
+                                                     PITCH_FRAME, PITCH_MIN_CONFIDENCE);
+                double pitchError = expected > 0.0 ? std::fabs(measured - expected) / expected : 1.0;
+                detail << ", 피치 " << formatFixed(pitchError * 100.0, 2) << "%";
+                ok = ok && pitchError <= PITCH_TOLERANCE;
+            }
+            break;
+        }
+        case SignalKind::NOISE: {
+            std::vector<double> reference = warpSpectrum(averageSpectrum(signal.data, fftSize), scale);
+            double lsd = logSpectralDistance(reference, spectrum);
+            detail << ", LSD " << formatFixed(lsd, 2) << " dB";
+            ok = ok && lsd <= maxLogSpectralDistance(signal.kind);
+            break;
+        }
+        case SignalKind::RECORDING: {
+            if (op.method == Method::STRETCH) {
+                double lsd = logSpectralDistance(averageSpectrum(signal.data, fftSize), spectrum);
+                detail << ", LSD " << formatFixed(lsd, 2) << " dB";
+                ok = ok && lsd <= maxLogSpectralDistance(signal.kind);
+            }
+            float expected = (float)(recordingPitch * scale);
+            double measured = measureMedianPitch(output, signal.sampleRate, expected * 0.5f, expected * 2.0f,
+                                                 PITCH_FRAME, PITCH_MIN_CONFIDENCE);
+            double pitchError = expected > 0.0 ? std::fabs(measured - expected) / expected : 1.0;
+            detail << ", 피치 " << formatFixed(pitchError * 100.0, 2) << "%";
+            ok = ok && pitchError <= PITCH_TOLERANCE;
+            break;
+        }
+    }
+
+    // 4. 클릭
+    if (signal.kind != SignalKind::NOISE) {
+        double crest = maxClickCrest(output, signal.sampleRate);
+        double limit = std::max(MAX_CLICK_CREST, inputCrest * 1.5);
+        detail << ", crest " << formatFixed(crest, 1);
+        ok = ok && crest <= limit;
+    }
+
+    check(signal.name + " / " + op.name + " (" + detail.str() + ")", ok, failures);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    객관적 음질 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    const int length = (int)(DURATION * SAMPLE_RATE);
+
+    std::vector<Signal> signals;
+    signals.push_back({ "sine220", SignalKind::SINE_220, SAMPLE_RATE, generate(SignalKind::SINE_220, length, 1.0, 1.0) });
+    signals.push_back({ "sine1k", SignalKind::SINE_1K, SAMPLE_RATE, generate(SignalKind::SINE_1K, length, 1.0, 1.0) });
+    signals.push_back({ "chirp", SignalKind::CHIRP, SAMPLE_RATE, generate(SignalKind::CHIRP, length, 1.0, 1.0) });
+    signals.push_back({ "voice", SignalKind::VOICE, SAMPLE_RATE, generate(SignalKind::VOICE, length, 1.0, 1.0) });
+    signals.push_back({ "noise", SignalKind::NOISE, SAMPLE_RATE, generateNoise(length) });
+
+    // original.wav (없으면 건너뜀)
+    std::string recordingPath = argc > 1 ? argv[1] : std::string(PROJECT_SOURCE_DIR) + "/original.wav";
+    float recordingPitch = 0.0f;
+    {
+        WavReader reader;
+        if (reader.open(recordingPath) && reader.getChannels() == 1) {
+            std::vector<float> samples(reader.getFrameCount());
+            reader.readFrames(0, samples.size(), samples.data());
+            recordingPitch = measureMedianPitch(samples, reader.getSampleRate(), 60.0f, 400.0f,
+                                                PITCH_FRAME, PITCH_MIN_CONFIDENCE);
+            std::cout << "original.wav: " << reader.getDuration() << "초, 중앙 피치 " << recordingPitch
+                      << " Hz" << std::endl;
+            signals.push_back({ "original.wav", SignalKind::RECORDING, reader.getSampleRate(), samples });
+        } else {
+            std::cout << "[SKIP] original.wav 없음: " << recordingPath << std::endl;
+        }
+    }
+    std::cout << std::endl;
+
+    const OverlapSearchMode standard = OverlapSearchMode::STANDARD;
+    const OverlapSearchMode hierarchical = OverlapSearchMode::HIERARCHICAL;
+    const StretchParameterMode fixed = StretchParameterMode::FIXED;
+    const StretchParameterMode automatic = StretchParameterMode::AUTO;
+    const ResamplerQuality linear = ResamplerQuality::LINEAR;
+    const ResamplerQuality sinc16 = ResamplerQuality::SINC_16;
+    const CrossfadeShape equalPower = CrossfadeShape::EQUAL_POWER;
+    const CrossfadeShape hann = CrossfadeShape::HANN;
+
+    const std::vector<Operation> operations = {
+        { "stretch x0.5", Method::STRETCH, 0.0f, 0.5f, standard, fixed, linear },
+        { "stretch x0.8", Method::STRETCH, 0.0f, 0.8f, standard, fixed, linear },
+        { "stretch x1.25", Method::STRETCH, 0.0f, 1.25f, standard, fixed, linear },
+        { "stretch x2", Method::STRETCH, 0.0f, 2.0f, standard, fixed, linear },
+        { "stretch x0.8 hierarchical", Method::STRETCH, 0.0f, 0.8f, hierarchical, fixed, linear },
+        { "stretch x1.25 hierarchical", Method::STRETCH, 0.0f, 1.25f, hierarchical, fixed, linear },
+        { "stretch x0.8 auto", Method::STRETCH, 0.0f, 0.8f, standard, automatic, linear },
+        { "stretch x1.25 auto", Method::STRETCH, 0.0f, 1.25f, standard, automatic, linear },
+        { "pitch -12", Method::PITCH, -12.0f, 1.0f, standard, fixed, linear },
+        { "pitch -5", Method::PITCH, -5.0f, 1.0f, standard, fixed, linear },
+        { "pitch +5", Method::PITCH, 5.0f, 1.0f, standard, fixed, linear },
+        { "pitch +12", Method::PITCH, 12.0f, 1.0f, standard, fixed, linear },
+        { "pitch -5 sinc16", Method::PITCH, -5.0f, 1.0f, standard, fixed, sinc16 },
+        { "pitch +5 sinc16", Method::PITCH, 5.0f, 1.0f, standard, fixed, sinc16 },
+        { "pitch +4 tempo 1.2", Method::PITCH_TEMPO, 4.0f, 1.2f, standard, fixed, linear },
+        { "stretch x1.25 hann", Method::STRETCH, 0.0f, 1.25f, standard, fixed, linear, hann },
+        { "pitch +5 hann", Method::PITCH, 5.0f, 1.0f, standard, fixed, linear, hann },
+    };
+
+    for (const Signal& signal : signals) {
+        double inputCrest = maxClickCrest(signal.data, signal.sampleRate);
+        std::cout << "[" << signal.name << "] 입력 crest " << formatFixed(inputCrest, 1) << std::endl;
+        for (const Operation& op : operations) {
+            evaluate(signal, op, inputCrest, recordingPitch, failures);
+        }
+        std::cout << std::endl;
+    }
+
+    // 크로스페이드 음량 (무상관 이음새)
+    {
+        // 백색 잡음 + 탐색 생략(시간 예산 초과 -> 명목 위치): 이음새 양쪽이 서로 무상관
+        std::vector<float> white = generateWhiteNoise(length);
+        OverlapSearchPolicy noSearch;
+        noSearch.blockBudgetMs = 1e-6f;
+
+        // 기본 파라미터 (40 / 8 ms): k번째 이음새는 출력 [k * hop, k * hop + overlap)
+        const int sequence = 40 * SAMPLE_RATE / 1000;
+        const int overlap = 8 * SAMPLE_RATE / 1000;
+        const int hop = sequence - overlap;
+
+        const CrossfadeShape shapes[] = { CrossfadeShape::LINEAR, equalPower, hann };
+        const char* names[] = { "linear", "equal-power", "hann" };
+        double seamDb[3];
+        for (int s = 0; s < 3; ++s) {
+            SimpleTimeStretcher stretcher;
+            stretcher.setCrossfadeShape(shapes[s]);
+            stretcher.setSearchPolicy(noSearch);
+            std::vector<float> output;
+            stretcher.process(white.data(), length, SAMPLE_RATE, 0.8f, output);
+
+            // 이음새 구간 / 나머지 구간의 평균 파워 비 (끝의 남은 입력은 제외)
+            double seamPower = 0.0, bodyPower = 0.0;
+            long long seamCount = 0, bodyCount = 0;
+            const int end = (int)output.size() - SAMPLE_RATE / 10;
+            for (int i = hop; i < end; ++i) {
+                double power = (double)output[i] * output[i];
+                if ((i % hop) < overlap) {
+                    seamPower += power;
+                    seamCount++;
+                } else {
+                    bodyPower += power;
+                    bodyCount++;
+                }
+            }
+            seamDb[s] = 10.0 * std::log10((seamPower / seamCount) / (bodyPower / bodyCount));
+            std::cout << "  white noise stretch x0.8 " << names[s] << ": 이음새 음량 "
+                      << formatFixed(seamDb[s], 2) << " dB (탐색 생략 " << stretcher.getBudgetFallbackCount()
+                      << "회)" << std::endl;
+        }
+        // 무상관 신호의 이론값: linear 2/3 (-1.76 dB), hann 3/4 (-1.25 dB), equal-power 1 (0 dB)
+        check("크로스페이드: 무상관 이음새에서 equal-power는 음량 유지, linear / hann은 꺼짐",
+              std::abs(seamDb[1]) < 0.5 && seamDb[0] < -1.0 && seamDb[2] < -0.6, failures);
+        std::cout << std::endl;
+    }
+
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * 효과 체인 실행기 (EffectChain) 테스트
+ *
+ * 검증 항목:
+ *   1. 잘못된 스테이지 목록은 거부 (기존 스테이지 유지)
+ *   2. 실행 계획: no-op 제거, 인접 스테이지 병합, gain 융합 결과
+ *   3. ping-pong 실행 결과 = 효과마다 단독 처리기를 차례로 호출한 결과 (반복 호출도 같음)
+ *   4. 융합된 gain도 단독 gain 스테이지와 같은 위치에서 클램프 (중간 클램프 유지)
+ *
+ * 사용법:
+ *   ./test_effect_chain
+ */
+
+#include "src/effects/EffectChain.h"
+#include "src/effects/VoiceFilter.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 효과마다 단독 처리기를 차례로 호출 (실행 계획 없이 getStages() 순서 그대로)
+std::vector<float> runSequential(const std::vector<EffectStage>& stages, const std::vector<float>& input,
+                                 int sampleRate) {
+    std::vector<float> data = input;
+    for (const EffectStage& stage : stages) {
+        std::vector<float> next;
+        switch (stage.type) {
+            case EffectStageType::PITCH: {
+                SimplePitchShifter pitchShifter;
+                pitchShifter.setResamplerQuality(static_cast<ResamplerQuality>(static_cast<int>(stage.param3)));
+                pitchShifter.process(data.data(), (int)data.size(), sampleRate, stage.param1, next);
+                data.swap(next);
+                break;
+            }
+            case EffectStageType::TEMPO: {
+                SimpleTimeStretcher timeStretcher;
+                timeStretcher.process(data.data(), (int)data.size(), sampleRate, stage.param1, next);
+                data.swap(next);
+                break;
+            }
+            case EffectStageType::FILTER: {
+                VoiceFilter filter;
+                filter.applyFilterInPlace(data, sampleRate, static_cast<FilterType>(static_cast<int>(stage.param1)),
+                                          stage.param2, stage.param3);
+                break;
+            }
+            case EffectStageType::REVERSE:
+                std::reverse(data.begin(), data.end());
+                break;
+            case EffectStageType::GAIN:
+                for (float& sample : data) {
+                    sample = std::max(-1.0f, std::min(1.0f, sample * stage.param1));
+                }
+                break;
+            case EffectStageType::PITCH_TEMPO:
+                break;
+        }
+    }
+    return data;
+}
+
+bool samePlan(const std::vector<EffectStage>& planned, const std::vector<EffectStageType>& types,
+              const std::vector<float>& postGains) {
+    if (planned.size() != types.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < planned.size(); ++i) {
+        if (planned[i].type != types[i] || std::abs(planned[i].postGain - postGains[i]) > 1e-6f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    효과 체인 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> input = generateSignal(180.0f, 1.0f, SAMPLE_RATE);
+    const int length = (int)input.size();
+
+    // 1. 잘못된 스테이지 목록
+    {
+        EffectChain chain;
+        chain.parse("pitch:3;reverse");
+        const char* rejected[] = {
+            "pitch", "pitch:3,9", "pitch:abc", "tempo:0", "tempo:-1", "tempo:1,2",
+            "filter:99", "filter:-1", "filter", "reverse:1", "gain:-1", "gain", "rate:-8000", "unknown:1",
+            "pitch:3;;bogus"
+        };
+        bool allRejected = true;
+        for (const char* spec : rejected) {
+            if (chain.parse(spec)) {
+                std::cout << "  거부되지 않음: '" << spec << "'" << std::endl;
+                allRejected = false;
+            }
+        }
+        bool kept = chain.getStages().size() == 2 && chain.getStages()[0].type == EffectStageType::PITCH &&
+                    chain.getStages()[1].type == EffectStageType::REVERSE;
+        check("잘못된 스테이지 목록 거부 + 기존 스테이지 유지", allRejected && kept, failures);
+        check("빈 목록 / 공백은 허용 (스테이지 없음)", chain.parse(" ; ") && chain.getPlannedStages().empty(), failures);
+    }
+
+    // 2. 실행 계획
+    {
+        EffectChain chain;
+        chain.parse("pitch:3;tempo:1.25;filter:4,0.5,0.5;reverse;gain:0.8");
+        const std::vector<EffectStage>& planned = chain.getPlannedStages();
+        bool merged = samePlan(planned, {EffectStageType::PITCH_TEMPO, EffectStageType::FILTER, EffectStageType::REVERSE},
+                               {1.0f, 1.0f, 0.8f}) &&
+                      planned[0].param1 == 3.0f && planned[0].param2 == 1.25f;
+        check("계획: pitch + tempo 병합, gain은 reverse에 융합", merged, failures);
+
+        chain.parse("pitch:2;pitch:-2;reverse;reverse;gain:1;tempo:1.0");
+        check("계획: 상쇄되는 스테이지 / no-op 제거", chain.getPlannedStages().empty(), failures);
+
+        chain.parse("tempo:1.25;gain:0.8");
+        check("계획: tempo 뒤 gain은 단독 스테이지",
+              samePlan(chain.getPlannedStages(), {EffectStageType::TEMPO, EffectStageType::GAIN}, {1.0f, 0.8f}), failures);
+
+        chain.parse("pitch:3;gain:0.5;gain:2");
+        check("계획: 클램프 없는 스테이지에 gain < 1 융합, 클램프가 사라지는 융합은 하지 않음",
+              samePlan(chain.getPlannedStages(), {EffectStageType::PITCH, EffectStageType::GAIN}, {0.5f, 2.0f}), failures);
+
+        chain.parse("gain:4;gain:0.5");
+        check("계획: 클램프한 출력에 gain < 1은 융합하지 않음",
+              samePlan(chain.getPlannedStages(), {EffectStageType::GAIN, EffectStageType::GAIN}, {4.0f, 0.5f}), failures);
+
+        chain.parse("filter:0;gain:2;gain:0.5");
+        check("계획: filter에는 gain >= 1만 융합",
+              samePlan(chain.getPlannedStages(), {EffectStageType::FILTER, EffectStageType::GAIN}, {2.0f, 0.5f}), failures);
+
+        chain.parse("rate:16000;pitch:3");
+        check("계획: rate는 스테이지가 아닌 설정",
+              chain.getProcessingRate() == 16000 && chain.getPlannedStages().size() == 1, failures);
+    }
+
+    // 3. ping-pong 실행 결과 = 효과별 단독 처리
+    // (융합된 gain은 곱셈 순서만 다르므로 float 반올림 오차까지 허용)
+    {
+        const char* specs[] = {
+            "pitch:3,2;filter:0,0.4,0.5;reverse;gain:0.8",
+            "tempo:1.25;filter:8,0.5,0.5;gain:1.5;reverse",
+            "reverse;filter:4,0.3,0.4;gain:0.5;pitch:-4,1",
+            "filter:2,0.5,0.5;filter:6,0.5,0.5;reverse"
+        };
+        for (const char* spec : specs) {
+            EffectChain chain;
+            chain.parse(spec);
+            std::vector<float> expected = runSequential(chain.getStages(), input, SAMPLE_RATE);
+            std::vector<float> first = chain.process(input.data(), length, SAMPLE_RATE);
+            std::vector<float> second = chain.process(input.data(), length, SAMPLE_RATE);
+            float diff = std::max(maxDifference(first, expected), maxDifference(second, expected));
+            std::cout << "  '" << spec << "' 최대 차이 " << diff << std::endl;
+            check(std::string("체인 결과 = 단독 처리 (반복 호출 포함): ") + spec, diff < 1e-5f, failures);
+        }
+    }
+
+    // 4. 융합된 gain의 클램프
+    {
+        const char* specs[] = {
+            "gain:4;gain:0.5",
+            "gain:0.5;gain:2",
+            "pitch:3;gain:0.5;gain:2",
+            "pitch:3;gain:3;gain:0.5",
+            "reverse;gain:2;gain:0.25",
+            "filter:0,0.5,0.5;gain:3;gain:0.4"
+        };
+        for (const char* spec : specs) {
+            EffectChain chain;
+            chain.parse(spec);
+            std::vector<float> expected = runSequential(chain.getStages(), input, SAMPLE_RATE);
+            const std::vector<float>& output = chain.process(input.data(), length, SAMPLE_RATE);
+            float peak = 0.0f;
+            for (float sample : output) {
+                peak = std::max(peak, std::abs(sample));
+            }
+            float diff = maxDifference(output, expected);
+            std::cout << "  '" << spec << "' 최대 차이 " << diff << ", peak " << peak << std::endl;
+            check(std::string("gain 클램프 위치 = 단독 gain 스테이지: ") + spec, diff < 1e-5f, failures);
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
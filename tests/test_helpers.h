@@ -0,0 +1,126 @@
+/**
+ * 테스트 공용 도구
+ * - 결과 출력 / 실패 집계 (check)
+ * - 기본 샘플레이트, 합성 신호, 버퍼 비교
+ * - PitchAnalyzer 중앙값 피치 측정
+ */
+
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+const int SAMPLE_RATE = 44100;
+
+// [PASS] / [FAIL] 출력, 실패하면 failures 증가
+inline bool check(const char* label, bool ok, int& failures) {
+    if (!ok) failures++;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << label << std::endl;
+    return ok;
+}
+
+inline bool check(const std::string& label, bool ok, int& failures) {
+    return check(label.c_str(), ok, failures);
+}
+
+// 배음 + 주파수가 변하는 신호 (세그먼트 탐색 위치가 매번 달라지도록)
+inline std::vector<float> generateSignal(float frequency, float duration, int sampleRate) {
+    int length = static_cast<int>(duration * sampleRate);
+    std::vector<float> data(length);
+
+    double phase = 0.0;
+    for (int i = 0; i < length; ++i) {
+        float t = static_cast<float>(i) / sampleRate;
+        float f = frequency * (1.0f + 0.2f * std::sin(2.0f * M_PI * 1.5f * t));
+        phase += 2.0 * M_PI * f / sampleRate;
+        data[i] = 0.5f * std::sin(phase) + 0.2f * std::sin(2.0 * phase) + 0.1f * std::sin(3.0 * phase);
+    }
+    return data;
+}
+
+// 단일 사인파 (영점 교차로 주파수를 확인하는 테스트용)
+inline std::vector<float> generateSine(float frequency, float duration, int sampleRate, float amplitude) {
+    int length = static_cast<int>(duration * sampleRate);
+    std::vector<float> data(length);
+    for (int i = 0; i < length; ++i) {
+        data[i] = amplitude * std::sin(2.0 * M_PI * frequency * i / sampleRate);
+    }
+    return data;
+}
+
+// 배음이 있는 음성 모델 신호 (기본 주파수 + 3개 배음)
+inline std::vector<float> generateVoiceSignal(float frequency, float duration, int sampleRate) {
+    int length = static_cast<int>(duration * sampleRate);
+    std::vector<float> data(length);
+
+    for (int i = 0; i < length; ++i) {
+        float t = static_cast<float>(i) / sampleRate;
+        data[i] = 0.5f * std::sin(2.0f * M_PI * frequency * t)
+                + 0.25f * std::sin(2.0f * M_PI * frequency * 2.0f * t)
+                + 0.12f * std::sin(2.0f * M_PI * frequency * 3.0f * t)
+                + 0.06f * std::sin(2.0f * M_PI * frequency * 4.0f * t);
+    }
+    return data;
+}
+
+/**
+ * PitchAnalyzer 중앙값 주파수 (유성 프레임 중 신뢰도 minConfidence 이상만)
+ * @return 측정된 프레임이 없으면 0
+ */
+inline float measureMedianPitch(const float* data, size_t length, int sampleRate,
+                                float minFrequency = 80.0f, float maxFrequency = 600.0f,
+                                float frameSize = 0.03f, float minConfidence = 0.0f) {
+    if (length == 0) {
+        return 0.0f;
+    }
+    AudioBuffer buffer(sampleRate, 1);
+    buffer.setData(std::vector<float>(data, data + length));
+
+    PitchAnalyzer analyzer;
+    analyzer.setMinFrequency(minFrequency);
+    analyzer.setMaxFrequency(maxFrequency);
+    auto points = analyzer.analyze(buffer, frameSize);
+
+    std::vector<float> freqs;
+    for (const auto& point : points) {
+        if (point.frequency > 0.0f && point.confidence >= minConfidence) {
+            freqs.push_back(point.frequency);
+        }
+    }
+    if (freqs.empty()) {
+        return 0.0f;
+    }
+    std::sort(freqs.begin(), freqs.end());
+    return freqs[freqs.size() / 2];
+}
+
+inline float measureMedianPitch(const std::vector<float>& data, int sampleRate,
+                                float minFrequency = 80.0f, float maxFrequency = 600.0f,
+                                float frameSize = 0.03f, float minConfidence = 0.0f) {
+    return measureMedianPitch(data.data(), data.size(), sampleRate, minFrequency, maxFrequency,
+                              frameSize, minConfidence);
+}
+
+// 샘플별 최대 차이 (길이가 다르면 1e9)
+inline float maxDifference(const std::vector<float>& a, const std::vector<float>& b) {
+    if (a.size() != b.size()) {
+        return 1e9f;
+    }
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        maxDiff = std::max(maxDiff, std::abs(a[i] - b[i]));
+    }
+    return maxDiff;
+}
+
+#endif // TEST_HELPERS_H
@@ -0,0 +1,227 @@
+/**
+ * 다채널 처리 테스트
+ *
+ * 검증 항목:
+ *   1. 양쪽 채널이 같으면 각 채널 결과 = 모노 처리 결과 (WSOLA / pitch / filter)
+ *   2. R = g * L 이면 결과도 R = g * L (모든 채널이 같은 세그먼트 위치 사용, 채널 간 어긋남 없음)
+ *      (WSOLA는 계층적 겹침 위치 탐색에서도 확인)
+ *   3. 채널 길이가 모두 같고 interleaved 출력 = planar 출력
+ *   4. 다채널 AudioBuffer 입력은 채널 수를 유지
+ *   5. 나머지 AudioBuffer 소비자: reverse는 프레임 단위 (L / R 유지), pitch 분석은 mid,
+ *      모노 전용 (효과 체인, 가변 피치 렌더링)은 스테레오 입력을 거부하고 빈 버퍼 반환
+ *
+ * 사용법:
+ *   ./test_multichannel
+ */
+
+#include "src/audio/AudioBuffer.h"
+#include "src/audio/ChannelLayout.h"
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/dsp/VariablePitchRenderer.h"
+#include "src/effects/AudioReverser.h"
+#include "src/effects/EffectChain.h"
+#include "src/effects/VoiceFilter.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+std::vector<float> makeInterleaved(const std::vector<float>& left, const std::vector<float>& right) {
+    std::vector<std::vector<float>> planes = {left, right};
+    std::vector<float> interleaved;
+    ChannelLayout::interleave(planes, (int)left.size(), interleaved);
+    return interleaved;
+}
+
+std::vector<float> scaled(const std::vector<float>& data, float gain) {
+    std::vector<float> result(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        result[i] = data[i] * gain;
+    }
+    return result;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    다채널 처리 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> mono = generateSignal(180.0f, 1.5f, SAMPLE_RATE);
+    const int frames = (int)mono.size();
+    std::vector<std::vector<float>> planes;
+
+    // 1. 같은 채널 = 모노 결과
+    {
+        SimpleTimeStretcher monoStretcher;
+        SimpleTimeStretcher stereoStretcher;
+        std::vector<float> expected;
+        std::vector<float> output;
+        monoStretcher.process(mono.data(), frames, SAMPLE_RATE, 1.3f, expected);
+        std::vector<float> stereo = makeInterleaved(mono, mono);
+        stereoStretcher.processInterleaved(stereo.data(), frames, 2, SAMPLE_RATE, 1.3f, output);
+        ChannelLayout::deinterleave(output.data(), (int)output.size() / 2, 2, planes);
+        check("WSOLA: 같은 채널 -> 모노 결과와 동일",
+              planes[0] == expected && planes[1] == expected, failures);
+    }
+    {
+        SimplePitchShifter monoShifter;
+        SimplePitchShifter stereoShifter;
+        std::vector<float> expected;
+        std::vector<float> output;
+        monoShifter.setResamplerQuality(ResamplerQuality::SINC_16);
+        stereoShifter.setResamplerQuality(ResamplerQuality::SINC_16);
+        monoShifter.processWithTempo(mono.data(), frames, SAMPLE_RATE, 5.0f, 0.9f, expected);
+        std::vector<float> stereo = makeInterleaved(mono, mono);
+        stereoShifter.processWithTempoInterleaved(stereo.data(), frames, 2, SAMPLE_RATE, 5.0f, 0.9f, output);
+        ChannelLayout::deinterleave(output.data(), (int)output.size() / 2, 2, planes);
+        check("Pitch + Tempo: 같은 채널 -> 모노 결과와 동일",
+              planes[0] == expected && planes[1] == expected, failures);
+    }
+    {
+        const FilterType types[] = {FilterType::ECHO, FilterType::REVERB, FilterType::CHORUS,
+                                    FilterType::BAND_PASS};
+        bool ok = true;
+        for (FilterType type : types) {
+            VoiceFilter filter;
+            std::vector<float> expected = mono;
+            filter.applyFilterInPlace(expected, SAMPLE_RATE, type, 0.4f, 0.6f);
+
+            std::vector<float> stereo = makeInterleaved(mono, mono);
+            filter.applyFilterInterleaved(stereo, 2, SAMPLE_RATE, type, 0.4f, 0.6f);
+            ChannelLayout::deinterleave(stereo.data(), (int)stereo.size() / 2, 2, planes);
+            ok = ok && planes[0] == expected && planes[1] == expected;
+        }
+        check("VoiceFilter: 같은 채널 -> 모노 결과와 동일 (echo / reverb / chorus / band-pass)", ok, failures);
+    }
+
+    // 2. R = 0.5 * L -> 결과도 R = 0.5 * L (같은 세그먼트 위치 / 같은 볼륨 보정)
+    std::vector<float> stereo = makeInterleaved(mono, scaled(mono, 0.5f));
+    {
+        SimpleTimeStretcher stretcher;
+        std::vector<float> output;
+        stretcher.processInterleaved(stereo.data(), frames, 2, SAMPLE_RATE, 0.75f, output);
+        ChannelLayout::deinterleave(output.data(), (int)output.size() / 2, 2, planes);
+        float diff = maxDifference(scaled(planes[0], 0.5f), planes[1]);
+        std::cout << "  WSOLA 채널 비율 오차: " << diff << std::endl;
+        check("WSOLA: R = 0.5 * L 유지", diff < 1e-5f, failures);
+
+        // 계층적 탐색: 위치만 다를 수 있고 출력 길이 / 채널 비율은 같아야 함
+        SimpleTimeStretcher hierarchical;
+        hierarchical.setSearchMode(OverlapSearchMode::HIERARCHICAL);
+        std::vector<float> hierarchicalOutput;
+        hierarchical.processInterleaved(stereo.data(), frames, 2, SAMPLE_RATE, 0.75f, hierarchicalOutput);
+        ChannelLayout::deinterleave(hierarchicalOutput.data(), (int)hierarchicalOutput.size() / 2, 2, planes);
+        diff = maxDifference(scaled(planes[0], 0.5f), planes[1]);
+        check("WSOLA (계층적 탐색): 출력 길이 동일 / R = 0.5 * L 유지",
+              hierarchicalOutput.size() == output.size() && diff < 1e-5f, failures);
+    }
+    {
+        SimplePitchShifter shifter;
+        std::vector<float> output;
+        shifter.processWithTempoInterleaved(stereo.data(), frames, 2, SAMPLE_RATE, -4.0f, 1.2f, output);
+        ChannelLayout::deinterleave(output.data(), (int)output.size() / 2, 2, planes);
+        float diff = maxDifference(scaled(planes[0], 0.5f), planes[1]);
+        std::cout << "  Pitch + Tempo 채널 비율 오차: " << diff << std::endl;
+        check("Pitch + Tempo: R = 0.5 * L 유지", diff < 1e-5f, failures);
+    }
+    {
+        VoiceFilter filter;
+        std::vector<float> output = stereo;
+        filter.applyFilterInterleaved(output, 2, SAMPLE_RATE, FilterType::VOICE_CHANGER_MALE_TO_FEMALE, 0.3f, 0.5f);
+        ChannelLayout::deinterleave(output.data(), (int)output.size() / 2, 2, planes);
+        float diff = maxDifference(scaled(planes[0], 0.5f), planes[1]);
+        std::cout << "  Voice changer 채널 비율 오차: " << diff << std::endl;
+        check("Voice changer (SoundTouch 다채널): R = 0.5 * L 유지", diff < 1e-3f, failures);
+    }
+
+    // 3. planar 출력 = interleaved 출력
+    {
+        SimplePitchShifter planarShifter;
+        SimplePitchShifter interleavedShifter;
+        std::vector<float> left = mono;
+        std::vector<float> right = scaled(mono, -0.7f);
+        const float* inputs[] = {left.data(), right.data()};
+        std::vector<std::vector<float>> planarOutput;
+        planarShifter.processWithTempoPlanar(inputs, 2, frames, SAMPLE_RATE, 3.0f, 1.0f, planarOutput);
+
+        std::vector<float> interleavedOutput;
+        std::vector<float> interleavedInput = makeInterleaved(left, right);
+        interleavedShifter.processWithTempoInterleaved(interleavedInput.data(), frames, 2, SAMPLE_RATE,
+                                                       3.0f, 1.0f, interleavedOutput);
+        ChannelLayout::deinterleave(interleavedOutput.data(), (int)interleavedOutput.size() / 2, 2, planes);
+
+        check("planar 채널 길이 동일", planarOutput[0].size() == planarOutput[1].size(), failures);
+        check("planar 출력 = interleaved 출력", planes == planarOutput, failures);
+    }
+
+    // 4. 다채널 AudioBuffer
+    {
+        AudioBuffer buffer(SAMPLE_RATE, 2);
+        buffer.setData(stereo);
+        SimplePitchShifter shifter;
+        AudioBuffer result = shifter.processWithTempo(buffer, 2.0f, 1.5f);
+        bool ok = result.getChannels() == 2 && result.getLength() % 2 == 0;
+        float expectedDuration = buffer.getDuration() / 1.5f;
+        ok = ok && std::abs(result.getDuration() - expectedDuration) / expectedDuration < 0.03f;
+        std::cout << "  길이: " << buffer.getDuration() << "초 -> " << result.getDuration() << "초" << std::endl;
+        check("AudioBuffer (2채널): 채널 수 / 길이 유지", ok, failures);
+    }
+
+    // 5. 나머지 AudioBuffer 소비자
+    {
+        std::vector<float> right = scaled(mono, 0.5f);
+        AudioBuffer buffer(SAMPLE_RATE, 2);
+        buffer.setData(makeInterleaved(mono, right));
+
+        AudioReverser reverser;
+        AudioBuffer reversed = reverser.reverse(buffer);
+        ChannelLayout::deinterleave(reversed.getData().data(), frames, 2, planes);
+        bool ok = reversed.getChannels() == 2 && planes.size() == 2
+               && std::equal(planes[0].begin(), planes[0].end(), mono.rbegin())
+               && std::equal(planes[1].begin(), planes[1].end(), right.rbegin());
+        check("AudioReverser (2채널): 프레임 단위 역순, L / R 유지", ok, failures);
+
+        AudioBuffer monoBuffer(SAMPLE_RATE, 1);
+        monoBuffer.setData(mono);
+
+        AudioBuffer same(SAMPLE_RATE, 2);
+        same.setData(makeInterleaved(mono, mono));
+        PitchAnalyzer analyzer;
+        std::vector<PitchPoint> monoPoints = analyzer.analyze(monoBuffer);
+        std::vector<PitchPoint> stereoPoints = analyzer.analyze(same);
+        ok = !monoPoints.empty() && stereoPoints.size() == monoPoints.size();
+        for (size_t i = 0; ok && i < monoPoints.size(); ++i) {
+            ok = stereoPoints[i].time == monoPoints[i].time
+              && std::abs(stereoPoints[i].frequency - monoPoints[i].frequency) < 0.01f;
+        }
+        check("PitchAnalyzer (2채널): 같은 채널 = 모노 분석", ok, failures);
+
+        EffectChain chain;
+        chain.parse("pitch:2;gain:0.8");
+        AudioBuffer chained = chain.process(buffer);
+        check("EffectChain (2채널): 거부 (빈 버퍼)", chained.getLength() == 0, failures);
+
+        VariablePitchRenderer renderer;
+        buffer.setPitchCurve(std::vector<float>(frames, 2.0f));
+        AudioBuffer rendered = renderer.render(buffer);
+        AudioBuffer renderedFrames = renderer.render(buffer, std::vector<FrameData>(1));
+        check("VariablePitchRenderer (2채널): 거부 (빈 버퍼)",
+              rendered.getLength() == 0 && renderedFrames.getLength() == 0, failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
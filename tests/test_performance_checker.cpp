@@ -0,0 +1,497 @@
+/**
+ * 성능 측정기 (PerformanceChecker) 테스트
+ *
+ * 검증 항목:
+ *   1. 계층 API: 기능 / 함수 중첩 트리, 같은 위치의 반복 호출은 노드 하나 (호출 수 / 시간 합계)
+ *   2. 트레이스 모드: 같은 호출 순서로 같은 트리를 재구성 (이름 / 중첩 / 순서 / 호출 수)
+ *   3. 트레이스 모드의 startFunction / endFunction에서 메모리 할당 없음 (전역 훅의 할당 횟수로 확인)
+ *   4. 원형 버퍼가 가득 차면 오래된 이벤트부터 덮어쓰고 개수를 보고
+ *   5. 깊이 제한을 넘는 중첩도 짝이 맞게 처리
+ *   6. 구간당 오버헤드 (참고용 출력만, 상한은 benchmarks/bench_trace_overhead)
+ *   7. 히스토그램 백분위: 알려진 분포에서 p50 / p90 / p99 / p99.9 오차 4% 이내, 최소 / 최대는 정확
+ *   8. 레이블별 통계: 호출 수 / 백분위가 JSON / CSV / getPercentile에 포함 (두 모드 모두),
+ *      따옴표 / 쉼표가 있는 레이블도 JSON / CSV에 이스케이프되어 출력
+ *   9. Chrome Trace Event 내보내기: 구간마다 complete 이벤트, 스레드 이름 메타데이터
+ *  10. 여러 스레드 동시 기록: 스레드별 트랙(tid), 통계 호출 수 정확, 트리는 기능을 연 스레드만
+ *  11. 메모리 집계: AudioBuffer 전체 복사가 구간의 할당 / 최대 live 증가로 보이고,
+ *      제자리 처리 구간은 0, 버퍼 해제 후 live가 원래대로 (두 모드, JSON / CSV 포함)
+ *  12. 전역 할당 훅: 필터에 끼워 넣은 std::vector 전체 복사(명시적으로 연결하지 않은 임시 버퍼)도 집계
+ *
+ * 전역 operator new / delete 교체(MemoryHooks.cpp, enable_memory_hooks)로 빌드
+ *
+ * 사용법:
+ *   ./test_performance_checker
+ */
+
+#include "src/audio/AudioBuffer.h"
+#include "src/effects/VoiceFilter.h"
+#include "src/performance/MemoryTracker.h"
+#include "src/performance/PerformanceChecker.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// WSOLA 처리와 같은 모양의 호출: 기능 하나 안에 세그먼트마다 탐색 + 크로스페이드
+void runWorkload(PerformanceChecker& checker, int segments) {
+    checker.startFeature("timeStretch");
+    checker.startFunction("stretch");
+    for (int i = 0; i < segments; ++i) {
+        checker.startFunction("findBestOverlapPosition");
+        checker.endFunction();
+        checker.startFunction("overlapAndAdd");
+        checker.endFunction();
+    }
+    checker.endFunction();
+    checker.startFunction("resample");
+    checker.endFunction();
+    checker.endFeature();
+}
+
+size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+bool sameNodes(const std::vector<PerformanceChecker::FunctionNode>& a,
+               const std::vector<PerformanceChecker::FunctionNode>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].name != b[i].name || a[i].count != b[i].count || !sameNodes(a[i].children, b[i].children)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameFeatures(const std::vector<PerformanceChecker::FeatureNode>& a,
+                  const std::vector<PerformanceChecker::FeatureNode>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].feature != b[i].feature || !sameNodes(a[i].functions, b[i].functions)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    성능 측정기 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+
+    // 1. 계층 API
+    PerformanceChecker hierarchical;
+    runWorkload(hierarchical, 3);
+    runWorkload(hierarchical, 2);
+    {
+        std::vector<PerformanceChecker::FeatureNode> features = hierarchical.getFeatures();
+        bool ok = features.size() == 2 && features[0].functions.size() == 2 &&
+                  features[0].functions[0].name == "stretch" &&
+                  features[0].functions[0].children.size() == 2 &&
+                  features[0].functions[0].children[1].name == "overlapAndAdd" &&
+                  features[1].functions[0].children.size() == 2;
+        check("계층 API: 기능 / 함수 중첩 트리", ok, failures);
+
+        const PerformanceChecker::FunctionNode& stretch = features[0].functions[0];
+        bool merged = stretch.count == 1 && stretch.children[0].count == 3 && stretch.children[1].count == 3 &&
+                      features[1].functions[0].children[0].count == 2 &&
+                      stretch.children[0].duration <= stretch.duration;
+        check("계층 API: 반복 호출은 노드 하나로 합침 (호출 수 / 시간 합계)", merged, failures);
+
+        PerformanceChecker many;
+        runWorkload(many, 10000);
+        std::vector<PerformanceChecker::FeatureNode> manyFeatures = many.getFeatures();
+        check("계층 API: 노드 수는 호출 수와 무관",
+              manyFeatures[0].functions[0].children.size() == 2 &&
+              manyFeatures[0].functions[0].children[0].count == 10000, failures);
+    }
+
+    // 2. 트레이스 모드 트리 재구성
+    PerformanceChecker traced;
+    traced.setTraceMode(true);
+    runWorkload(traced, 3);
+    runWorkload(traced, 2);
+    {
+        std::vector<PerformanceChecker::FeatureNode> features = traced.getFeatures();
+        check("트레이스 모드: 계층 API와 같은 트리", sameFeatures(features, hierarchical.getFeatures()), failures);
+
+        bool durations = !features.empty() && features[0].duration >= features[0].functions[0].duration &&
+                         traced.getTotalDuration() > 0.0;
+        check("트레이스 모드: 기능 시간 >= 함수 시간, 전체 시간 기록", durations, failures);
+
+        std::string json = traced.getReportJSON();
+        check("트레이스 모드: JSON 보고서에 재구성된 함수 포함",
+              json.find("\"findBestOverlapPosition\"") != std::string::npos &&
+              json.find("\"droppedEvents\": 0") != std::string::npos, failures);
+    }
+
+    // 3. 기록 경로 할당 없음 (레이블 캐시가 채워진 뒤)
+    {
+        traced.reset();
+        runWorkload(traced, 1);
+        uint64_t before = MemoryTracker::snapshot().allocations;
+        runWorkload(traced, 1000);
+        long long allocations = (long long)(MemoryTracker::snapshot().allocations - before);
+        std::cout << "  세그먼트 1000개 기록 중 할당: " << allocations << "회" << std::endl;
+        check("트레이스 모드: startFunction / endFunction에서 할당 없음", allocations == 0, failures);
+    }
+
+    // 4. 원형 버퍼 넘침
+    {
+        PerformanceChecker small;
+        small.setTraceMode(true, 64);
+        runWorkload(small, 100);   // 이벤트 203개 (함수 202 + 기능 1)
+        std::vector<PerformanceChecker::TraceEvent> events = small.getTraceEvents();
+        bool ok = events.size() == 64 && small.getDroppedEvents() == 203 - 64 &&
+                  events.back().depth == 0 && small.getLabel(events.back().label) == "timeStretch";
+        check("원형 버퍼: 오래된 이벤트부터 덮어쓰고 개수 보고", ok, failures);
+
+        // 남은 이벤트 중 부모가 있는 것만 트리에 포함 (stretch는 남아 있음)
+        std::vector<PerformanceChecker::FeatureNode> features = small.getFeatures();
+        bool partial = features.size() == 1 && !features[0].functions.empty() &&
+                       features[0].functions[0].name == "stretch" &&
+                       features[0].functions[0].children.size() == 2 &&
+                       features[0].functions[0].children[0].count < 100;
+        check("원형 버퍼: 남은 이벤트로 부분 트리 재구성", partial, failures);
+    }
+
+    // 5. 깊이 제한
+    {
+        PerformanceChecker deep;
+        deep.setTraceMode(true);
+        const int depth = PerformanceChecker::MAX_TRACE_DEPTH + 10;
+        deep.startFeature("deep");
+        for (int i = 0; i < depth; ++i) deep.startFunction("level");
+        for (int i = 0; i < depth; ++i) deep.endFunction();
+        deep.startFunction("after");
+        deep.endFunction();
+        deep.endFeature();
+
+        std::vector<PerformanceChecker::FeatureNode> features = deep.getFeatures();
+        bool ok = features.size() == 1 && features[0].functions.size() == 2 &&
+                  features[0].functions[1].name == "after" &&
+                  (int)deep.getTraceEvents().size() == PerformanceChecker::MAX_TRACE_DEPTH + 2;
+        check("깊이 제한: 넘는 구간은 건너뛰고 짝 유지", ok, failures);
+    }
+
+    // 6. 구간당 오버헤드
+    {
+        PerformanceChecker checker;
+        checker.setTraceMode(true, 1 << 12);
+        const int scopes = 1000000;
+        checker.startFeature("overhead");
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < scopes; ++i) {
+            checker.startFunction("scope");
+            checker.endFunction();
+        }
+        auto end = std::chrono::steady_clock::now();
+        checker.endFeature();
+        double nsPerScope = std::chrono::duration<double, std::nano>(end - start).count() / scopes;
+
+        PerformanceChecker legacy;
+        legacy.startFeature("overhead");
+        legacy.startFunction("root");
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < scopes / 10; ++i) {
+            legacy.startFunction("findBestOverlapPosition");
+            legacy.endFunction();
+        }
+        end = std::chrono::steady_clock::now();
+        double legacyNs = std::chrono::duration<double, std::nano>(end - start).count() / (scopes / 10);
+
+        // 벽시계 상한은 부하 / sanitizer 빌드에서 흔들리므로 검사하지 않음 (bench_trace_overhead --budget-ns)
+        std::cout << "  구간당 오버헤드: 트레이스 " << nsPerScope << " ns / 계층 API " << legacyNs << " ns" << std::endl;
+        check("트레이스 모드: 오버헤드 측정 (구간 기록 완료)", checker.getTraceEvents().size() == (size_t)(1 << 12), failures);
+    }
+
+    // 7. 히스토그램 백분위 (1 us ~ 100 ms 균등 분포)
+    {
+        PerformanceChecker::Histogram histogram;
+        const int count = 100000;
+        for (int i = 1; i <= count; ++i) {
+            histogram.record((int64_t)i * 1000);
+        }
+        const double percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+        bool accurate = true;
+        for (double p : percentiles) {
+            double expected = p / 100.0 * count * 1000.0;
+            double measured = (double)histogram.percentile(p);
+            double error = std::abs(measured - expected) / expected;
+            std::cout << "  p" << p << ": " << measured / 1e6 << " ms (기대 " << expected / 1e6
+                      << " ms, 오차 " << error * 100.0 << "%)" << std::endl;
+            accurate = accurate && error < 0.04;
+        }
+        check("히스토그램: 백분위 오차 4% 이내", accurate, failures);
+        check("히스토그램: 최소 / 최대 / 개수 정확",
+              histogram.minNs == 1000 && histogram.maxNs == (int64_t)count * 1000 &&
+              histogram.count == (uint64_t)count && histogram.percentile(100.0) == histogram.maxNs, failures);
+        check("히스토그램: 고정 크기 (호출 수와 무관)",
+              sizeof(PerformanceChecker::Histogram) < 4096, failures);
+    }
+
+    // 8. 레이블별 통계 (두 모드)
+    for (int mode = 0; mode < 2; ++mode) {
+        PerformanceChecker checker;
+        checker.setTraceMode(mode == 1);
+        runWorkload(checker, 500);
+        runWorkload(checker, 500);
+        checker.start("applyEffectChain");
+        checker.end("applyEffectChain");
+        checker.startFeature("feature \"quoted\"");
+        checker.startFunction("label \"quoted\", 1");
+        checker.endFunction();
+        checker.endFeature();
+
+        bool counted = false;
+        for (const PerformanceChecker::Statistics& stats : checker.getStatistics()) {
+            if (stats.label == "findBestOverlapPosition") {
+                counted = stats.count == 1000 && stats.minMs <= stats.p50Ms && stats.p50Ms <= stats.p99Ms &&
+                          stats.p99Ms <= stats.p999Ms && stats.p999Ms <= stats.maxMs;
+            }
+        }
+        std::string json = checker.getReportJSON();
+        std::string csv = checker.getReportCSV();
+        bool reported = json.find("\"statistics\"") != std::string::npos &&
+                        json.find("\"p999\"") != std::string::npos &&
+                        csv.find("P99.9(ms)") != std::string::npos &&
+                        csv.find("\nfindBestOverlapPosition,1000,") != std::string::npos &&
+                        csv.find("\napplyEffectChain,1,") != std::string::npos &&
+                        checker.getPercentile("findBestOverlapPosition", 99.0) > 0.0 &&
+                        checker.getPercentile("applyEffectChain", 50.0) >= 0.0;
+        bool escaped = json.find("\"feature \\\"quoted\\\"\"") != std::string::npos &&
+                       countOccurrences(json, "\"label \\\"quoted\\\", 1\"") == 2 &&
+                       json.find("label \"quoted\"") == std::string::npos &&
+                       csv.find("\n\"label \"\"quoted\"\", 1\",1,") != std::string::npos;
+        check(mode == 1 ? "레이블별 통계 (트레이스 모드): 호출 수 / 백분위 / 보고서"
+                        : "레이블별 통계 (계층 API): 호출 수 / 백분위 / 보고서", counted && reported, failures);
+        check(mode == 1 ? "레이블 이스케이프 (트레이스 모드): JSON 문자열 / CSV 필드"
+                        : "레이블 이스케이프 (계층 API): JSON 문자열 / CSV 필드", escaped, failures);
+    }
+
+    // 9. Chrome Trace Event 내보내기
+    {
+        PerformanceChecker checker;
+        checker.setTraceMode(true);
+        runWorkload(checker, 3);
+        checker.startFunction("label \"quoted\"");
+        checker.endFunction();
+
+        std::string trace = checker.getChromeTrace();
+        size_t events = checker.getTraceEvents().size();
+        bool ok = trace.find("{\"traceEvents\":[") == 0 &&
+                  countOccurrences(trace, "\"ph\":\"X\"") == events &&
+                  countOccurrences(trace, "\"cat\":\"feature\"") == 1 &&
+                  trace.find("\"name\":\"thread_name\"") != std::string::npos &&
+                  trace.find("\"args\":{\"name\":\"main\"}") != std::string::npos &&
+                  trace.find("\"name\":\"findBestOverlapPosition\",\"cat\":\"function\"") != std::string::npos &&
+                  trace.find("label \\\"quoted\\\"") != std::string::npos &&
+                  trace.find("\"droppedEvents\":0") != std::string::npos;
+        check("Chrome 트레이스: complete 이벤트 / 스레드 이름 / 문자열 이스케이프", ok, failures);
+
+        PerformanceChecker legacy;
+        runWorkload(legacy, 1);
+        check("Chrome 트레이스: 트레이스 모드가 아니면 빈 이벤트 목록",
+              countOccurrences(legacy.getChromeTrace(), "\"ph\"") == 0, failures);
+    }
+
+    // 10. 여러 스레드 동시 기록
+    {
+        PerformanceChecker checker;
+        checker.setTraceMode(true);
+        const int threadCount = 4;
+        const int scopesPerThread = 2000;
+
+        checker.startFeature("parallel");
+        checker.startFunction("renderSegments");
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&checker]() {
+                for (int i = 0; i < scopesPerThread; ++i) {
+                    checker.startFunction("renderChannel");
+                    checker.startFunction("overlapAndAdd");
+                    checker.endFunction();
+                    checker.endFunction();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        checker.endFunction();
+        checker.endFeature();
+
+        std::vector<PerformanceChecker::TraceEvent> events = checker.getTraceEvents();
+        std::vector<uint16_t> tids;
+        bool depthsOk = true;
+        for (const PerformanceChecker::TraceEvent& event : events) {
+            if (std::find(tids.begin(), tids.end(), event.thread) == tids.end()) {
+                tids.push_back(event.thread);
+            }
+            if (checker.getLabel(event.label) == "overlapAndAdd") {
+                depthsOk = depthsOk && event.depth == 2;
+            }
+        }
+        check("여러 스레드: 이벤트 수 / 스레드별 중첩 깊이",
+              events.size() == (size_t)threadCount * scopesPerThread * 2 + 2 && depthsOk, failures);
+        check("여러 스레드: 스레드마다 다른 tid", tids.size() == (size_t)threadCount + 1, failures);
+
+        bool counted = false;
+        for (const PerformanceChecker::Statistics& stats : checker.getStatistics()) {
+            if (stats.label == "renderChannel") {
+                counted = stats.count == threadCount * scopesPerThread;
+            }
+        }
+        check("여러 스레드: 레이블별 호출 수 정확", counted, failures);
+
+        // 작업자 스레드에는 기능이 없으므로 트리에는 기능을 연 스레드의 함수만 들어감
+        std::vector<PerformanceChecker::FeatureNode> features = checker.getFeatures();
+        bool tree = features.size() == 1 && features[0].functions.size() == 1 &&
+                    features[0].functions[0].name == "renderSegments" &&
+                    features[0].functions[0].children.empty();
+        check("여러 스레드: 트리는 기능을 연 스레드 기준", tree, failures);
+
+        std::string trace = checker.getChromeTrace();
+        check("여러 스레드: Chrome 트레이스에 작업자 트랙",
+              trace.find("\"args\":{\"name\":\"worker 4\"}") != std::string::npos &&
+              countOccurrences(trace, "\"name\":\"thread_name\"") == (size_t)threadCount + 1, failures);
+    }
+
+    // 11. 메모리 집계
+    for (int mode = 0; mode < 2; ++mode) {
+        const int frames = 44100;
+        const double bufferBytes = frames * sizeof(float);
+
+        PerformanceChecker checker;
+        checker.setTraceMode(mode == 1);
+        checker.setMemoryTracking(true);
+
+        AudioBuffer source(44100, 1);
+        source.setData(std::vector<float>(frames, 0.25f));
+
+        // (전역 훅이 측정기 자신의 노드 / 통계 할당도 집계하므로 live 복귀는 복사 전후로 확인)
+        checker.startFeature("filter");
+        checker.startFunction("copyBuffer");
+        const int64_t liveBefore = MemoryTracker::snapshot().liveBytes;
+        {
+            AudioBuffer copy = source;   // 전체 버퍼 복사 (필터에 끼어든 불필요한 복사를 흉내)
+            copy.getData()[0] = 0.0f;
+        }
+        const int64_t liveAfter = MemoryTracker::snapshot().liveBytes;
+        checker.endFunction();
+        checker.startFunction("inPlace");
+        for (float& sample : source.getData()) {
+            sample *= 0.5f;
+        }
+        checker.endFunction();
+        checker.endFeature();
+
+        PerformanceChecker::Statistics copyStats{};
+        PerformanceChecker::Statistics inPlaceStats{};
+        for (const PerformanceChecker::Statistics& stats : checker.getStatistics()) {
+            if (stats.label == "copyBuffer") copyStats = stats;
+            if (stats.label == "inPlace") inPlaceStats = stats;
+        }
+        bool copied = copyStats.allocatedBytes >= bufferBytes && copyStats.allocations >= 1 &&
+                      copyStats.peakBytes >= bufferBytes;
+        bool clean = inPlaceStats.count == 1 && inPlaceStats.allocatedBytes == 0 && inPlaceStats.allocations == 0;
+        std::cout << "  copyBuffer: " << (long long)copyStats.allocatedBytes << " B / "
+                  << (long long)copyStats.allocations << "회 / peak " << (long long)copyStats.peakBytes << " B"
+                  << std::endl;
+
+        bool nodes = true;
+        if (mode == 0) {
+            std::vector<PerformanceChecker::FeatureNode> features = checker.getFeatures();
+            nodes = features.size() == 1 && features[0].functions.size() == 2 &&
+                    features[0].functions[0].allocatedBytes >= bufferBytes &&
+                    features[0].functions[1].allocations == 0 &&
+                    features[0].peakBytes >= bufferBytes;
+        }
+
+        std::string json = checker.getReportJSON();
+        std::string csv = checker.getReportCSV();
+        bool reported = json.find("\"peakBytes\"") != std::string::npos &&
+                        json.find("\"peakLiveBytes\"") != std::string::npos &&
+                        csv.find(",AllocatedBytes,Allocations,PeakBytes") != std::string::npos;
+
+        check(mode == 1 ? "메모리 집계 (트레이스 모드): 복사 구간 할당 / 제자리 구간 0 / 보고서"
+                        : "메모리 집계 (계층 API): 복사 구간 할당 / 제자리 구간 0 / 노드 / 보고서",
+              copied && clean && nodes && reported, failures);
+        check(mode == 1 ? "메모리 집계 (트레이스 모드): 해제 후 live 복귀"
+                        : "메모리 집계 (계층 API): 해제 후 live 복귀", liveAfter == liveBefore, failures);
+    }
+    {
+        PerformanceChecker checker;
+        runWorkload(checker, 1);
+        std::vector<PerformanceChecker::FeatureNode> features = checker.getFeatures();
+        check("메모리 집계: 끄면 보고서에 메모리 필드 없음",
+              checker.getReportJSON().find("\"peakBytes\"") == std::string::npos &&
+              features[0].functions[0].allocations == 0, failures);
+    }
+
+    // 12. 전역 할당 훅: 필터에 끼워 넣은 임시 복사본
+    {
+        const int frames = 44100;
+        const double bufferBytes = frames * sizeof(float);
+        std::vector<float> data = generateSignal(220.0f, 1.0f, SAMPLE_RATE);
+        VoiceFilter filter;
+        filter.applyFilterInPlace(data, SAMPLE_RATE, FilterType::LOW_PASS, 0.5f, 0.5f);   // 스크래치 준비
+
+        PerformanceChecker checker;
+        checker.setMemoryTracking(true);
+        checker.startFeature("filter");
+        checker.startFunction("clean");
+        filter.applyFilterInPlace(data, SAMPLE_RATE, FilterType::LOW_PASS, 0.5f, 0.5f);
+        checker.endFunction();
+        checker.startFunction("planted");
+        {
+            // 명시적으로 연결하지 않은 저장소: 훅이 없으면 MemoryTracker에 보이지 않음
+            std::vector<float> copy = data;
+            filter.applyFilterInPlace(copy, SAMPLE_RATE, FilterType::LOW_PASS, 0.5f, 0.5f);
+            data = copy;
+        }
+        checker.endFunction();
+        checker.endFeature();
+
+        PerformanceChecker::Statistics clean{};
+        PerformanceChecker::Statistics planted{};
+        for (const PerformanceChecker::Statistics& stats : checker.getStatistics()) {
+            if (stats.label == "clean") clean = stats;
+            if (stats.label == "planted") planted = stats;
+        }
+        std::cout << "  clean: " << (long long)clean.allocatedBytes << " B / planted: "
+                  << (long long)planted.allocatedBytes << " B / peak " << (long long)planted.peakBytes << " B"
+                  << std::endl;
+        check("전역 할당 훅: 필터 안의 std::vector 전체 복사가 할당 / 최대 live 증가로 보임",
+              data.size() == (size_t)frames &&
+              planted.allocatedBytes >= clean.allocatedBytes + bufferBytes &&
+              planted.allocations >= clean.allocations + 1 &&
+              planted.peakBytes >= bufferBytes, failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
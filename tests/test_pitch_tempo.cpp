@@ -0,0 +1,223 @@
+/**
+ * Pitch + Tempo 통합 처리 테스트
+ *
+ * SimplePitchShifter::processWithTempo (WSOLA 1회 + 리샘플 1회)가
+ * 2단계 처리 (SimplePitchShifter::process -> SimpleTimeStretcher::process)와
+ * 같은 결과를 내는지 검증
+ *
+ * 검증 항목:
+ *   1. 출력 길이: 입력 길이 / tempo 와 두 방식 모두 2% 이내
+ *   2. 피치: PitchAnalyzer로 측정한 주파수가 목표 주파수와 3% 이내
+ *   3. 처리 시간 비교 (참고용 출력)
+ *   4. 자동 파라미터 (StretchParameterMode::AUTO, 피치 곡선 사용 / 미사용): 길이 2% / 피치 3% 이내,
+ *      비율에 따라 sequence가 변하고 overlap >= 기본 주기
+ *   5. 탐색 정책 (OverlapSearchPolicy): 전체 탐색 / 간격 확대 / 후보 수 상한 / 시간 예산 모두 길이 2% / 피치 3% 이내,
+ *      시간 예산을 넘으면 남은 세그먼트는 탐색을 건너뜀, 잘못된 값은 보정
+ *
+ * 사용법:
+ *   ./test_pitch_tempo
+ */
+
+#include "src/audio/AudioBuffer.h"
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    Pitch + Tempo 통합 처리 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    const int sampleRate = 44100;
+    const float baseFrequency = 200.0f;
+    AudioBuffer input(sampleRate, 1);
+    input.setData(generateVoiceSignal(baseFrequency, 2.0f, sampleRate));
+
+    struct TestCase {
+        float semitones;
+        float tempo;
+    };
+    const TestCase cases[] = {
+        { 4.0f, 1.25f },
+        { 7.0f, 0.8f },
+        { -5.0f, 1.5f },
+        { -3.0f, 0.7f },
+        { 0.0f, 1.3f },
+        { 5.0f, 1.0f },
+    };
+
+    int failures = 0;
+
+    for (const auto& tc : cases) {
+        SimplePitchShifter pitchShifter;
+        SimpleTimeStretcher timeStretcher;
+
+        // 2단계 처리
+        auto start = std::chrono::steady_clock::now();
+        AudioBuffer twoStep = pitchShifter.process(input, tc.semitones);
+        twoStep = timeStretcher.process(twoStep, tc.tempo);
+        double twoStepMs = elapsedMs(start);
+
+        // 통합 처리
+        start = std::chrono::steady_clock::now();
+        AudioBuffer combined = pitchShifter.processWithTempo(input, tc.semitones, tc.tempo);
+        double combinedMs = elapsedMs(start);
+
+        float expectedLength = input.getLength() / tc.tempo;
+        float expectedFreq = baseFrequency * std::pow(2.0f, tc.semitones / 12.0f);
+
+        float twoStepLengthError = std::abs(twoStep.getLength() - expectedLength) / expectedLength;
+        float combinedLengthError = std::abs(combined.getLength() - expectedLength) / expectedLength;
+
+        float twoStepFreq = measureMedianPitch(twoStep.getData(), sampleRate);
+        float combinedFreq = measureMedianPitch(combined.getData(), sampleRate);
+        float twoStepFreqError = std::abs(twoStepFreq - expectedFreq) / expectedFreq;
+        float combinedFreqError = std::abs(combinedFreq - expectedFreq) / expectedFreq;
+
+        bool ok = twoStepLengthError < 0.02f && combinedLengthError < 0.02f &&
+                  twoStepFreqError < 0.03f && combinedFreqError < 0.03f;
+        if (!ok) failures++;
+
+        std::cout << (ok ? "[PASS] " : "[FAIL] ")
+                  << "semitones=" << tc.semitones << ", tempo=" << tc.tempo << std::endl;
+        std::cout << "  길이: 기대 " << static_cast<int>(expectedLength)
+                  << " / 2단계 " << twoStep.getLength()
+                  << " / 통합 " << combined.getLength() << std::endl;
+        std::cout << "  피치: 기대 " << expectedFreq << " Hz"
+                  << " / 2단계 " << twoStepFreq << " Hz"
+                  << " / 통합 " << combinedFreq << " Hz" << std::endl;
+        std::cout << "  시간: 2단계 " << twoStepMs << " ms / 통합 " << combinedMs << " ms" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // 자동 파라미터 (낮은 목소리: 주기 10ms > 기본 overlap 8ms)
+    {
+        AudioBuffer lowVoice(sampleRate, 1);
+        lowVoice.setData(generateVoiceSignal(100.0f, 2.0f, sampleRate));
+        PitchAnalyzer analyzer;
+        std::vector<PitchPoint> contour = analyzer.analyze(lowVoice);
+
+        const float tempos[] = { 0.6f, 1.6f };
+        int sequenceAt[2] = { 0, 0 };
+        for (int t = 0; t < 2; ++t) {
+            for (int withContour = 0; withContour < 2; ++withContour) {
+                SimpleTimeStretcher stretcher;
+                stretcher.setParameterMode(StretchParameterMode::AUTO);
+                if (withContour) {
+                    stretcher.setPitchContour(contour);
+                }
+                AudioBuffer output = stretcher.process(lowVoice, tempos[t]);
+
+                float expectedLength = lowVoice.getLength() / tempos[t];
+                float lengthError = std::abs(output.getLength() - expectedLength) / expectedLength;
+                float freq = measureMedianPitch(output.getData(), sampleRate);
+                float freqError = std::abs(freq - 100.0f) / 100.0f;
+                bool ok = lengthError < 0.02f && freqError < 0.03f;
+                if (withContour) {
+                    ok = ok && stretcher.getOverlapMs() >= 10;
+                }
+                sequenceAt[t] = stretcher.getSequenceMs();
+                if (!ok) failures++;
+
+                std::cout << (ok ? "[PASS] " : "[FAIL] ") << "자동 파라미터"
+                          << (withContour ? " + 피치 곡선" : "") << ", tempo=" << tempos[t] << std::endl;
+                std::cout << "  sequence " << stretcher.getSequenceMs() << " ms / seek "
+                          << stretcher.getSeekWindowMs() << " ms / overlap " << stretcher.getOverlapMs()
+                          << " ms, 길이 오차 " << lengthError * 100.0f << "%, 피치 " << freq << " Hz"
+                          << std::endl;
+            }
+        }
+
+        bool adapts = sequenceAt[0] > sequenceAt[1];
+        if (!adapts) failures++;
+        std::cout << (adapts ? "[PASS] " : "[FAIL] ") << "자동 파라미터: 느릴수록 긴 sequence" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // 탐색 정책 (품질 <-> CPU)
+    {
+        AudioBuffer voice(sampleRate, 1);
+        voice.setData(generateVoiceSignal(180.0f, 2.0f, sampleRate));
+        const float tempo = 1.3f;
+
+        struct PolicyCase {
+            const char* name;
+            OverlapSearchMode mode;
+            float threshold;
+            int coarseStep;
+            int maxCandidates;
+            float budgetMs;
+        };
+        const PolicyCase cases[] = {
+            { "기본", OverlapSearchMode::STANDARD, 0.95f, 2, 0, 0.0f },
+            { "전체 탐색 (조기 종료 없음, 간격 1)", OverlapSearchMode::STANDARD, 1.0f, 1, 0, 0.0f },
+            { "간격 8", OverlapSearchMode::STANDARD, 0.95f, 8, 0, 0.0f },
+            { "후보 16개", OverlapSearchMode::STANDARD, 1.0f, 2, 16, 0.0f },
+            { "계층적 + 후보 4개", OverlapSearchMode::HIERARCHICAL, 0.95f, 2, 4, 0.0f },
+            { "시간 예산 1 us", OverlapSearchMode::STANDARD, 0.95f, 2, 0, 0.001f },
+        };
+
+        for (const PolicyCase& pc : cases) {
+            OverlapSearchPolicy policy;
+            policy.goodEnoughThreshold = pc.threshold;
+            policy.coarseStep = pc.coarseStep;
+            policy.maxCandidates = pc.maxCandidates;
+            policy.blockBudgetMs = pc.budgetMs;
+
+            SimpleTimeStretcher stretcher;
+            stretcher.setSearchMode(pc.mode);
+            stretcher.setSearchPolicy(policy);
+            auto start = std::chrono::high_resolution_clock::now();
+            AudioBuffer output = stretcher.process(voice, tempo);
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+            float expectedLength = voice.getLength() / tempo;
+            float lengthError = std::abs(output.getLength() - expectedLength) / expectedLength;
+            float freq = measureMedianPitch(output.getData(), sampleRate);
+            float freqError = std::abs(freq - 180.0f) / 180.0f;
+            int fallbacks = stretcher.getBudgetFallbackCount();
+            bool ok = lengthError < 0.02f && freqError < 0.03f;
+            ok = ok && (pc.budgetMs > 0.0f ? fallbacks > 0 : fallbacks == 0);
+            if (!ok) failures++;
+
+            std::cout << (ok ? "[PASS] " : "[FAIL] ") << "탐색 정책: " << pc.name << std::endl;
+            std::cout << "  길이 오차 " << lengthError * 100.0f << "%, 피치 " << freq << " Hz, 예산 초과 "
+                      << fallbacks << "회, 시간 " << ms << " ms" << std::endl;
+        }
+
+        OverlapSearchPolicy invalid;
+        invalid.coarseStep = 0;
+        invalid.maxCandidates = -3;
+        invalid.blockBudgetMs = -1.0f;
+        SimpleTimeStretcher stretcher;
+        stretcher.setSearchPolicy(invalid);
+        const OverlapSearchPolicy& corrected = stretcher.getSearchPolicy();
+        bool ok = corrected.coarseStep == 1 && corrected.maxCandidates == 0 && corrected.blockBudgetMs == 0.0f;
+        if (!ok) failures++;
+        std::cout << (ok ? "[PASS] " : "[FAIL] ") << "탐색 정책: 잘못된 값 보정" << std::endl;
+        std::cout << std::endl;
+    }
+
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * ProcessingSession 테스트
+ *
+ * 검증 항목:
+ *   1. 세션 처리 결과 = 단독 처리기 결과 (pitch / tempo / filter / reverse)
+ *   2. 같은 길이로 반복 처리 시 입력 / 출력 arena가 재할당되지 않는지 (포인터 유지)
+ *   3. commitOutput으로 이어서 처리한 결과 = 단계별로 따로 처리한 결과
+ *   4. 효과 체인 결과가 EffectChain 단독 실행과 같은지
+ *   5. 잘못된 입력 시 실패 반환 + 빈 출력
+ *   6. 결과가 없을 때 commitOutput은 입력을 바꾸지 않음 (중복 commit, 실패 후 commit)
+ *   7. pitchTempo의 algorithm이 리샘플러 품질에 반영되는지
+ *
+ * 사용법:
+ *   ./test_processing_session
+ */
+
+#include "src/effects/ProcessingSession.h"
+#include "src/effects/EffectChain.h"
+#include "src/effects/VoiceFilter.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// 세션 입력 arena에 직접 쓰기 (JS의 HEAPF32.set과 같은 역할)
+void writeInput(ProcessingSession& session, const std::vector<float>& data) {
+    float* ptr = reinterpret_cast<float*>(session.reserveInput((int)data.size()));
+    std::copy(data.begin(), data.end(), ptr);
+}
+
+std::vector<float> readOutput(const ProcessingSession& session) {
+    const float* ptr = reinterpret_cast<const float*>(session.getOutputPointer());
+    return std::vector<float>(ptr, ptr + session.getOutputLength());
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    ProcessingSession 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> input = generateVoiceSignal(220.0f, 1.0f, SAMPLE_RATE);
+    const int length = (int)input.size();
+
+    ProcessingSession session;
+    session.setSampleRate(SAMPLE_RATE);
+
+    // 1. 단독 처리기와 같은 결과
+    {
+        SimplePitchShifter pitchShifter;
+        std::vector<float> expected;
+        pitchShifter.setResamplerQuality(ResamplerQuality::CUBIC);
+        pitchShifter.process(input.data(), length, SAMPLE_RATE, 4.0f, expected);
+
+        writeInput(session, input);
+        bool ok = session.pitchShift(4.0f, "simple-cubic");
+        check("pitchShift 결과 = SimplePitchShifter", ok && readOutput(session) == expected, failures);
+    }
+    {
+        SimpleTimeStretcher timeStretcher;
+        std::vector<float> expected;
+        timeStretcher.process(input.data(), length, SAMPLE_RATE, 1.25f, expected);
+
+        writeInput(session, input);
+        bool ok = session.timeStretch(1.25f, "simple");
+        check("timeStretch 결과 = SimpleTimeStretcher", ok && readOutput(session) == expected, failures);
+    }
+    {
+        VoiceFilter filter;
+        std::vector<float> expected = input;
+        filter.applyFilterInPlace(expected, SAMPLE_RATE, FilterType::ROBOT, 0.5f, 0.5f);
+
+        writeInput(session, input);
+        bool ok = session.applyFilter(static_cast<int>(FilterType::ROBOT), 0.5f, 0.5f);
+        check("applyFilter 결과 = VoiceFilter", ok && readOutput(session) == expected, failures);
+    }
+    {
+        std::vector<float> expected(input.rbegin(), input.rend());
+        writeInput(session, input);
+        bool ok = session.reverse();
+        check("reverse 결과 = 역순 입력", ok && readOutput(session) == expected, failures);
+    }
+
+    // 2. 반복 처리 시 arena 재할당 없음
+    {
+        writeInput(session, input);
+        session.pitchShift(-3.0f, "simple");
+        uintptr_t inputPtr = session.getInputPointer();
+        uintptr_t outputPtr = session.getOutputPointer();
+
+        bool stable = true;
+        for (int i = 0; i < 5; ++i) {
+            writeInput(session, input);
+            session.pitchShift(-3.0f, "simple");
+            stable = stable && session.getInputPointer() == inputPtr
+                            && session.getOutputPointer() == outputPtr;
+        }
+        check("반복 처리 시 입력 / 출력 포인터 유지", stable, failures);
+    }
+
+    // 3. commitOutput으로 이어서 처리
+    {
+        SimplePitchShifter pitchShifter;
+        SimpleTimeStretcher timeStretcher;
+        std::vector<float> step1;
+        std::vector<float> expected;
+        pitchShifter.process(input.data(), length, SAMPLE_RATE, 2.0f, step1);
+        timeStretcher.process(step1.data(), (int)step1.size(), SAMPLE_RATE, 0.8f, expected);
+
+        writeInput(session, input);
+        session.pitchShift(2.0f, "simple");
+        session.commitOutput();
+        bool lengthOk = session.getInputLength() == (int)step1.size() && session.getOutputLength() == 0;
+        session.timeStretch(0.8f, "simple");
+        check("commitOutput 후 입력 길이 = 이전 출력 길이", lengthOk, failures);
+        check("pitch -> commit -> tempo 결과 = 단계별 처리", readOutput(session) == expected, failures);
+    }
+
+    // 4. 효과 체인
+    {
+        const std::string spec = "pitch:3;filter:4,0.3,0.4;gain:0.8";
+        EffectChain chain;
+        chain.parse(spec);
+        std::vector<float> expected = chain.process(input.data(), length, SAMPLE_RATE);
+
+        writeInput(session, input);
+        bool ok = session.applyChain(spec);
+        check("applyChain 결과 = EffectChain", ok && readOutput(session) == expected, failures);
+
+        // 체인 결과도 commitOutput으로 입력 arena에 옮길 수 있어야 함
+        session.commitOutput();
+        const float* committed = reinterpret_cast<const float*>(session.getInputPointer());
+        bool same = session.getInputLength() == (int)expected.size()
+                 && std::equal(expected.begin(), expected.end(), committed);
+        check("체인 결과 commitOutput", same, failures);
+    }
+
+    // 5. 잘못된 입력
+    {
+        writeInput(session, input);
+        bool ok = session.timeStretch(0.0f, "simple");
+        check("속도 비율 0: 실패 + 빈 출력", !ok && session.getOutputLength() == 0, failures);
+
+        ok = session.applyFilter(99, 0.5f, 0.5f);
+        check("알 수 없는 필터: 실패 + 빈 출력", !ok && session.getOutputLength() == 0, failures);
+
+        ok = session.applyChain("unknown:1");
+        check("잘못된 체인: 실패 + 빈 출력", !ok && session.getOutputLength() == 0, failures);
+    }
+
+    // 6. 결과가 없을 때 commitOutput
+    {
+        writeInput(session, input);
+        session.reverse();
+        session.commitOutput();
+        std::vector<float> committed(input.rbegin(), input.rend());
+        session.commitOutput();
+        const float* ptr = reinterpret_cast<const float*>(session.getInputPointer());
+        bool kept = session.getInputLength() == length && std::equal(committed.begin(), committed.end(), ptr);
+        check("중복 commitOutput: 입력 유지", kept, failures);
+
+        writeInput(session, input);
+        session.timeStretch(0.0f, "simple");
+        session.commitOutput();
+        ptr = reinterpret_cast<const float*>(session.getInputPointer());
+        kept = session.getInputLength() == length && std::equal(input.begin(), input.end(), ptr);
+        check("실패한 처리 후 commitOutput: 입력 유지", kept, failures);
+    }
+
+    // 7. pitchTempo 리샘플러 품질
+    {
+        SimplePitchShifter pitchShifter;
+        std::vector<float> expected;
+        pitchShifter.setResamplerQuality(ResamplerQuality::SINC_64);
+        pitchShifter.processWithTempo(input.data(), length, SAMPLE_RATE, 3.0f, 1.2f, expected);
+
+        writeInput(session, input);
+        bool ok = session.pitchTempo(3.0f, 1.2f, "simple-sinc64");
+        check("pitchTempo(simple-sinc64) 결과 = SINC_64 SimplePitchShifter",
+              ok && readOutput(session) == expected, failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
@@ -0,0 +1,330 @@
+/**
+ * 실시간 처리기 (RealtimeProcessor) 테스트
+ *
+ * 검증 항목:
+ *   1. 잘못된 설정 거부 / 스테이지가 없으면 지연 없이 그대로 출력
+ *   2. gain 스테이지: 지연 없이 입력 * gain
+ *   3. pitch 스테이지: 보고한 지연 안에 출력 시작, 출력 주파수 = 입력 * 2^(semitones / 12), FIFO 끊김 없음
+ *   4. render 경로에서 메모리 할당 없음 (전역 훅이 집계한 MemoryTracker 할당 횟수로 확인)
+ *   5. tempo / reverse가 들어간 목록은 거부하고 기존 스테이지 유지
+ *   6. plain C 인터페이스 (realtime_*)가 클래스와 같은 결과
+ *   7. 저지연 프로파일: 지연 20 ms 미만, 피치 정확도 유지, 할당 / 끊김 없음
+ *   8. 탐색 정책: 블록 시간 예산을 넘으면 탐색을 건너뛰고(출력 길이 동일), render 경로 할당 / 끊김 없음,
+ *      realtime_set_search_policy는 잘못된 값 거부
+ *   9. 크로스페이드 모양: equal-power로 바꿔도 피치 유지 / 할당 / 끊김 없음, realtime_set_crossfade는 잘못된 값 거부
+ *
+ * 전역 operator new / delete 교체(MemoryHooks.cpp, enable_memory_hooks)로 빌드
+ *
+ * 사용법:
+ *   ./test_realtime_processor
+ */
+
+#include "src/effects/RealtimeProcessor.h"
+#include "src/performance/MemoryTracker.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+const int QUANTUM = RealtimeProcessor::QUANTUM_FRAMES;
+
+// quantum 단위로 입력 버퍼에 복사 -> render -> 출력 버퍼에서 복사
+// renderAllocations: render 호출 안에서 일어난 할당 횟수 (optional)
+std::vector<std::vector<float>> renderAll(RealtimeProcessor& processor, const std::vector<std::vector<float>>& planes,
+                                          long long* renderAllocations = nullptr) {
+    const int channels = processor.getChannels();
+    const int frames = (int)planes[0].size();
+    std::vector<std::vector<float>> outputs(channels, std::vector<float>(frames, 0.0f));
+    for (int position = 0; position < frames; position += QUANTUM) {
+        int block = std::min(QUANTUM, frames - position);
+        for (int c = 0; c < channels; ++c) {
+            std::copy(planes[c].begin() + position, planes[c].begin() + position + block,
+                      processor.getInputBuffer(c));
+        }
+        uint64_t before = MemoryTracker::snapshot().allocations;
+        processor.render(block);
+        if (renderAllocations) *renderAllocations += (long long)(MemoryTracker::snapshot().allocations - before);
+        for (int c = 0; c < channels; ++c) {
+            const float* output = processor.getOutputBuffer(c);
+            std::copy(output, output + block, outputs[c].begin() + position);
+        }
+    }
+    return outputs;
+}
+
+// 양의 방향 영점 교차로 주파수 추정
+float estimateFrequency(const std::vector<float>& data, int begin, int end, int sampleRate) {
+    int first = -1;
+    int last = -1;
+    int crossings = 0;
+    for (int i = std::max(1, begin); i < end; ++i) {
+        if (data[i - 1] <= 0.0f && data[i] > 0.0f) {
+            if (first < 0) first = i;
+            last = i;
+            crossings++;
+        }
+    }
+    if (crossings < 2) {
+        return 0.0f;
+    }
+    return (float)(crossings - 1) * sampleRate / (float)(last - first);
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    실시간 처리기 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> left = generateSine(220.0f, 3.0f, SAMPLE_RATE, 0.6f);
+    std::vector<float> right = generateSine(330.0f, 3.0f, SAMPLE_RATE, 0.4f);
+    const int frames = (int)left.size();
+
+    // 1. 설정 / passthrough
+    {
+        RealtimeProcessor invalid;
+        check("잘못된 설정 거부 (채널 수 / 샘플레이트)",
+              !invalid.setup(SAMPLE_RATE, 3) && !invalid.setup(0, 1) && !invalid.configure("gain:0.5"), failures);
+
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 2);
+        std::vector<std::vector<float>> out = renderAll(processor, {left, right});
+        check("스테이지 없음: 지연 0, 입력 그대로",
+              processor.getLatency() == 0 && out[0] == left && out[1] == right, failures);
+    }
+
+    // 2. gain
+    {
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        bool configured = processor.configure("gain:0.5");
+        std::vector<std::vector<float>> out = renderAll(processor, {left});
+        bool same = true;
+        for (int i = 0; i < frames; ++i) {
+            same = same && out[0][i] == left[i] * 0.5f;
+        }
+        check("gain: 지연 0, 입력 * gain", configured && processor.getLatency() == 0 && same, failures);
+    }
+
+    // 3. pitch
+    {
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        bool configured = processor.configure("pitch:12");
+        int latency = processor.getLatency();
+        std::vector<std::vector<float>> out = renderAll(processor, {left});
+
+        check("pitch: 지연 0 초과 100 ms 미만", configured && latency > 0 && latency < SAMPLE_RATE / 10, failures);
+        check("pitch: FIFO 끊김 없음", processor.getDropouts() == 0, failures);
+
+        int firstSound = 0;
+        while (firstSound < frames && std::abs(out[0][firstSound]) < 1e-4f) {
+            firstSound++;
+        }
+        float frequency = estimateFrequency(out[0], latency + SAMPLE_RATE / 10, frames, SAMPLE_RATE);
+        std::cout << "  지연 " << latency << " 샘플 (첫 출력 " << firstSound << "), 출력 주파수 "
+                  << frequency << " Hz" << std::endl;
+        // WSOLA 탐색 범위만큼 앞쪽 입력이 섞일 수 있으므로 지연은 상한
+        check("pitch: 보고한 지연 안에 출력 시작", firstSound > 0 && firstSound <= latency, failures);
+        check("pitch: +12 반음 -> 440 Hz", std::abs(frequency - 440.0f) < 5.0f, failures);
+    }
+
+    // 4. render 경로 할당 없음
+    {
+        const char* specs[] = {
+            "pitch:5;filter:4,0.5,0.5;gain:0.8",
+            "pitch:-4,2;rate:22050",
+            "filter:10,0.7",
+            "filter:8,0.6,0.4",
+        };
+        for (const char* spec : specs) {
+            RealtimeProcessor processor;
+            processor.setup(SAMPLE_RATE, 2);
+            bool configured = processor.configure(spec);
+
+            // 15초 = quantum 5000여 개
+            long long allocations = 0;
+            for (int round = 0; round < 5; ++round) {
+                renderAll(processor, {left, right}, &allocations);
+            }
+            std::string label = std::string("할당 없음 + 끊김 없음: ") + spec;
+            if (allocations != 0) {
+                std::cout << "  render 중 할당 " << allocations << "회" << std::endl;
+            }
+            check(label.c_str(), configured && allocations == 0 && processor.getDropouts() == 0, failures);
+        }
+    }
+
+    // 5. tempo / reverse 거부
+    {
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        processor.configure("pitch:7");
+        int latency = processor.getLatency();
+        bool rejected = !processor.configure("tempo:1.2") && !processor.configure("pitch:2,0;tempo:0.8") &&
+                        !processor.configure("pitch:2;reverse");
+        std::vector<std::vector<float>> out = renderAll(processor, {left});
+        float frequency = estimateFrequency(out[0], latency + SAMPLE_RATE / 10, frames, SAMPLE_RATE);
+        check("tempo / reverse 거부, 기존 스테이지 유지",
+              rejected && processor.getLatency() == latency &&
+              std::abs(frequency - 220.0f * std::pow(2.0f, 7.0f / 12.0f)) < 5.0f, failures);
+    }
+
+    // 6. plain C 인터페이스
+    {
+        check("realtime_create: 잘못된 설정이면 nullptr", realtime_create(SAMPLE_RATE, 0, QUANTUM) == nullptr, failures);
+
+        RealtimeProcessor* handle = realtime_create(SAMPLE_RATE, 1, QUANTUM);
+        RealtimeProcessor reference;
+        reference.setup(SAMPLE_RATE, 1);
+        bool configured = handle && realtime_configure(handle, "pitch:-3;filter:4,0.4,0.5") == 1 &&
+                          reference.configure("pitch:-3;filter:4,0.4,0.5") &&
+                          realtime_configure(handle, "tempo:2") == 0;
+
+        bool same = configured && realtime_latency(handle) == reference.getLatency();
+        float* input = configured ? realtime_input(handle, 0) : nullptr;
+        float* output = configured ? realtime_output(handle, 0) : nullptr;
+        same = same && input && output && realtime_input(handle, 1) == nullptr;
+        for (int position = 0; same && position + QUANTUM <= frames; position += QUANTUM) {
+            std::copy(left.begin() + position, left.begin() + position + QUANTUM, input);
+            std::copy(left.begin() + position, left.begin() + position + QUANTUM, reference.getInputBuffer(0));
+            realtime_render(handle, QUANTUM);
+            reference.render(QUANTUM);
+            same = std::equal(output, output + QUANTUM, reference.getOutputBuffer(0));
+        }
+        check("C 인터페이스 = RealtimeProcessor", same && realtime_dropouts(handle) == 0, failures);
+        realtime_destroy(handle);
+    }
+
+    // 7. 저지연 프로파일
+    {
+        RealtimeProcessor standard;
+        standard.setup(SAMPLE_RATE, 1);
+        standard.configure("pitch:12");
+
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        bool configured = processor.configure("pitch:12") && processor.setProfile(StretchProfile::LOW_LATENCY);
+        int latency = processor.getLatency();
+        long long allocations = 0;
+        std::vector<std::vector<float>> out = renderAll(processor, {left}, &allocations);
+        float frequency = estimateFrequency(out[0], latency + SAMPLE_RATE / 10, frames, SAMPLE_RATE);
+
+        std::cout << "  지연: 기본 " << standard.getLatency() * 1000.0 / SAMPLE_RATE << " ms -> 저지연 "
+                  << latency * 1000.0 / SAMPLE_RATE << " ms, 출력 주파수 " << frequency << " Hz" << std::endl;
+        check("저지연: 지연 20 ms 미만 (기본 프로파일보다 짧음)",
+              configured && latency < SAMPLE_RATE / 50 && latency < standard.getLatency(), failures);
+        check("저지연: +12 반음 -> 440 Hz", std::abs(frequency - 440.0f) < 5.0f, failures);
+        check("저지연: 할당 없음 + 끊김 없음", allocations == 0 && processor.getDropouts() == 0, failures);
+
+        RealtimeProcessor* handle = realtime_create(SAMPLE_RATE, 2, QUANTUM);
+        bool viaC = handle && realtime_configure(handle, "pitch:-5;gain:0.9") == 1 &&
+                    realtime_set_profile(handle, 1) == 1 && realtime_latency(handle) < SAMPLE_RATE / 50 &&
+                    realtime_set_profile(handle, 2) == 0 &&
+                    realtime_set_profile(handle, 0) == 1 && realtime_latency(handle) >= SAMPLE_RATE / 50;
+        check("realtime_set_profile: 프로파일 전환 / 잘못된 값 거부", viaC, failures);
+        realtime_destroy(handle);
+    }
+
+    // 8. 탐색 정책 (블록 시간 예산)
+    {
+        // 스트리밍 커널: 예산 없음 / 아주 작은 예산 (블록마다 첫 탐색 이후는 명목 위치)
+        const int blockFrames = QUANTUM * 64;
+        OverlapSearchPolicy tight;
+        tight.blockBudgetMs = 0.001f;
+        const StretchProfile profiles[] = { StretchProfile::DEFAULT, StretchProfile::LOW_LATENCY };
+        for (StretchProfile profile : profiles) {
+            StreamingTimeStretcher unlimited;
+            StreamingTimeStretcher budgeted;
+            unlimited.setProfile(profile);
+            budgeted.setProfile(profile);
+            budgeted.setSearchPolicy(tight);
+            unlimited.setup(SAMPLE_RATE, 1, 0.8f);
+            budgeted.setup(SAMPLE_RATE, 1, 0.8f);
+
+            std::vector<std::vector<float>> unlimitedOut;
+            std::vector<std::vector<float>> budgetedOut;
+            int fallbacks = 0;
+            for (int position = 0; position < frames; position += blockFrames) {
+                const float* block[] = { left.data() + position };
+                int count = std::min(blockFrames, frames - position);
+                unlimited.process(block, count, unlimitedOut);
+                budgeted.process(block, count, budgetedOut);
+                fallbacks += budgeted.getBudgetFallbackCount();
+            }
+            unlimited.flush(unlimitedOut);
+            budgeted.flush(budgetedOut);
+
+            std::string label = std::string("시간 예산: 탐색 생략 + 출력 길이 동일 (")
+                              + (profile == StretchProfile::DEFAULT ? "기본" : "저지연") + ")";
+            std::cout << "  예산 초과 " << fallbacks << "회" << std::endl;
+            check(label.c_str(), fallbacks > 0 && unlimited.getBudgetFallbackCount() == 0 &&
+                  unlimitedOut[0].size() == budgetedOut[0].size(), failures);
+        }
+
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        bool configured = processor.configure("pitch:12");
+        OverlapSearchPolicy cheap;
+        cheap.coarseStep = 4;
+        cheap.maxCandidates = 32;
+        cheap.blockBudgetMs = 0.5f;
+        processor.setSearchPolicy(cheap);
+        int latency = processor.getLatency();
+        long long allocations = 0;
+        std::vector<std::vector<float>> out = renderAll(processor, {left}, &allocations);
+        float frequency = estimateFrequency(out[0], latency + SAMPLE_RATE / 10, frames, SAMPLE_RATE);
+        std::cout << "  저비용 정책 출력 주파수 " << frequency << " Hz" << std::endl;
+        check("탐색 정책: +12 반음 유지, 할당 없음 + 끊김 없음",
+              configured && processor.getSearchPolicy().maxCandidates == 32 &&
+              std::abs(frequency - 440.0f) < 5.0f && allocations == 0 && processor.getDropouts() == 0, failures);
+
+        RealtimeProcessor* handle = realtime_create(SAMPLE_RATE, 1, QUANTUM);
+        bool viaC = handle && realtime_configure(handle, "pitch:3") == 1 &&
+                    realtime_set_search_policy(handle, 0.9f, 3, 24, 1.0f) == 1 &&
+                    handle->getSearchPolicy().coarseStep == 3 &&
+                    realtime_set_search_policy(handle, 0.9f, 0, 24, 1.0f) == 0 &&
+                    realtime_set_search_policy(handle, 0.9f, 3, -1, 1.0f) == 0 &&
+                    realtime_set_search_policy(handle, 0.9f, 3, 24, -1.0f) == 0;
+        check("realtime_set_search_policy: 적용 / 잘못된 값 거부", viaC, failures);
+        realtime_destroy(handle);
+    }
+
+    // 9. 크로스페이드 모양
+    {
+        RealtimeProcessor processor;
+        processor.setup(SAMPLE_RATE, 1);
+        bool configured = processor.configure("pitch:12");
+        processor.setCrossfadeShape(CrossfadeShape::EQUAL_POWER);
+        int latency = processor.getLatency();
+        long long allocations = 0;
+        std::vector<std::vector<float>> out = renderAll(processor, {left}, &allocations);
+        float frequency = estimateFrequency(out[0], latency + SAMPLE_RATE / 10, frames, SAMPLE_RATE);
+        std::cout << "  equal-power 출력 주파수 " << frequency << " Hz" << std::endl;
+        check("크로스페이드 (equal-power): +12 반음 유지, 할당 없음 + 끊김 없음",
+              configured && std::abs(frequency - 440.0f) < 5.0f && allocations == 0 &&
+              processor.getDropouts() == 0, failures);
+
+        RealtimeProcessor* handle = realtime_create(SAMPLE_RATE, 1, QUANTUM);
+        bool viaC = handle && realtime_configure(handle, "pitch:3") == 1 &&
+                    realtime_set_crossfade(handle, 2) == 1 &&
+                    handle->getCrossfadeShape() == CrossfadeShape::HANN &&
+                    realtime_set_crossfade(handle, 3) == 0 && realtime_set_crossfade(handle, -1) == 0;
+        check("realtime_set_crossfade: 적용 / 잘못된 값 거부", viaC, failures);
+        realtime_destroy(handle);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
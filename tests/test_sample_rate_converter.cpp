@@ -0,0 +1,148 @@
+/**
+ * SampleRateConverter 테스트
+ *
+ * 검증 항목:
+ *   1. 출력 길이: 입력 길이 * outputRate / inputRate
+ *   2. 스트리밍: 블록 크기(64 / 1000 / 4096)와 상관없이 convert() 한 번과 같은 결과
+ *   3. 왕복 품질: 44.1k -> 16k -> 44.1k 변환 후 통과 대역(6kHz 이하) 신호의 SNR 40dB 이상
+ *   4. 안티앨리어싱: 다운샘플 시 새 Nyquist를 넘는 톤이 -40dB 이하로 제거
+ *
+ * 사용법:
+ *   ./test_sample_rate_converter
+ */
+
+#include "src/dsp/SampleRateConverter.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+std::vector<float> generateTone(const std::vector<float>& frequencies, float amplitude,
+                                int length, int sampleRate) {
+    std::vector<float> data(length, 0.0f);
+    for (int i = 0; i < length; ++i) {
+        double t = (double)i / sampleRate;
+        for (float frequency : frequencies) {
+            data[i] += amplitude * (float)std::sin(2.0 * M_PI * frequency * t);
+        }
+    }
+    return data;
+}
+
+// 양 끝 margin 샘플을 제외한 에너지
+double energy(const std::vector<float>& data, int margin) {
+    double sum = 0.0;
+    for (int i = margin; i < (int)data.size() - margin; ++i) {
+        sum += (double)data[i] * data[i];
+    }
+    return sum;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    SampleRateConverter 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    const int inputRate = 44100;
+    const int length = inputRate;  // 1초
+    std::vector<float> input = generateTone({ 220.0f, 1500.0f, 5000.0f }, 0.25f, length, inputRate);
+
+    const ResamplerQuality qualities[] = {
+        ResamplerQuality::LINEAR, ResamplerQuality::CUBIC,
+        ResamplerQuality::SINC_16, ResamplerQuality::SINC_64
+    };
+    const int outputRates[] = { 16000, 24000, 48000 };
+
+    // 1 + 2. 길이 / 스트리밍 일치
+    for (ResamplerQuality quality : qualities) {
+        for (int outputRate : outputRates) {
+            SampleRateConverter converter;
+            converter.setQuality(quality);
+            converter.setRates(inputRate, outputRate);
+
+            std::vector<float> expected;
+            converter.convert(input.data(), length, expected);
+            size_t expectedLength = (size_t)((long long)length * outputRate / inputRate);
+
+            bool ok = expected.size() == expectedLength;
+            float maxDiff = 0.0f;
+            for (int blockSize : { 64, 1000, 4096 }) {
+                std::vector<float> streamed;
+                for (int pos = 0; pos < length; pos += blockSize) {
+                    int count = std::min(blockSize, length - pos);
+                    converter.process(input.data() + pos, count, streamed);
+                }
+                converter.flush(streamed);
+
+                if (streamed.size() != expected.size()) {
+                    ok = false;
+                    continue;
+                }
+                for (size_t i = 0; i < streamed.size(); ++i) {
+                    maxDiff = std::max(maxDiff, std::abs(streamed[i] - expected[i]));
+                }
+            }
+            ok = ok && maxDiff < 1e-4f;
+            if (!ok) failures++;
+
+            std::cout << (ok ? "[PASS] " : "[FAIL] ")
+                      << "품질 " << static_cast<int>(quality) << ", " << inputRate << " -> " << outputRate
+                      << ": 길이 " << expected.size() << " (기대 " << expectedLength << ")"
+                      << ", 스트리밍 최대 오차 " << maxDiff << std::endl;
+        }
+    }
+    std::cout << std::endl;
+
+    // 3. 왕복 품질
+    {
+        SampleRateConverter down;
+        SampleRateConverter up;
+        down.setRates(inputRate, 16000);
+        up.setRates(16000, inputRate);
+
+        std::vector<float> low;
+        std::vector<float> restored;
+        down.convert(input.data(), length, low);
+        up.convert(low.data(), (int)low.size(), restored);
+
+        std::vector<float> error(std::min(restored.size(), input.size()));
+        for (size_t i = 0; i < error.size(); ++i) {
+            error[i] = restored[i] - input[i];
+        }
+        double snr = 10.0 * std::log10(energy(input, 256) / std::max(energy(error, 256), 1e-20));
+        bool ok = snr > 40.0;
+        if (!ok) failures++;
+        std::cout << (ok ? "[PASS] " : "[FAIL] ")
+                  << "왕복 44100 -> 16000 -> 44100 SNR: " << snr << " dB" << std::endl;
+    }
+
+    // 4. 안티앨리어싱 (12kHz 톤은 16kHz 출력의 Nyquist(8kHz)를 넘으므로 제거되어야 함)
+    {
+        std::vector<float> high = generateTone({ 12000.0f }, 0.5f, length, inputRate);
+        SampleRateConverter down;
+        down.setRates(inputRate, 16000);
+        std::vector<float> low;
+        down.convert(high.data(), length, low);
+
+        double ratio = energy(low, 256) / (low.size() - 512) / (energy(high, 256) / (high.size() - 512));
+        double attenuation = 10.0 * std::log10(std::max(ratio, 1e-20));
+        bool ok = attenuation < -40.0;
+        if (!ok) failures++;
+        std::cout << (ok ? "[PASS] " : "[FAIL] ")
+                  << "12kHz 톤 다운샘플 (16kHz) 감쇠: " << attenuation << " dB" << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
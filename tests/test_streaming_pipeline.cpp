@@ -0,0 +1,318 @@
+/**
+ * 스트리밍 처리 테스트
+ *
+ * 검증 항목:
+ *   1. StreamingTimeStretcher: 블록 크기를 섞어 넣어도 SimpleTimeStretcher 한 번 처리와 동일 (모노 / 스테레오)
+ *   2. StreamingPitchShifter: SimplePitchShifter::processWithTempo와 같은 결과 (리샘플 위치 계산 오차 이내)
+ *   3. StreamingVoiceFilter: 블록 크기와 상관없이 같은 결과, 볼륨 보정 전 커널 = VoiceFilter 커널
+ *   4. StreamingChain: 메모리 스트림 처리 결과가 블록 크기와 상관없음
+ *      StreamingPipeline: 파일 처리 결과 길이 / 청크 크기와 상관없는 결과 / realtime factor 보고
+ *   5. reverse가 들어간 스테이지 목록은 거부
+ *
+ * 사용법:
+ *   ./test_streaming_pipeline
+ */
+
+#include "src/audio/WavFile.h"
+#include "src/dsp/SimplePitchShifter.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/dsp/StreamingPitchShifter.h"
+#include "src/dsp/StreamingTimeStretcher.h"
+#include "src/effects/StreamingChain.h"
+#include "src/effects/StreamingPipeline.h"
+#include "src/effects/StreamingVoiceFilter.h"
+#include "src/effects/VoiceFilter.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 길이가 1 이내로 다를 때 공통 구간의 최대 차이
+float maxCommonDifference(const std::vector<float>& a, const std::vector<float>& b) {
+    size_t length = std::min(a.size(), b.size());
+    if (std::max(a.size(), b.size()) - length > 1) {
+        return 1e9f;
+    }
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < length; ++i) {
+        maxDiff = std::max(maxDiff, std::abs(a[i] - b[i]));
+    }
+    return maxDiff;
+}
+
+// 불규칙한 블록 크기 (1 ~ 5000 샘플)
+int nextBlockSize(unsigned int& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return 1 + (int)((seed >> 16) % 5000);
+}
+
+// 블록 단위로 나눠 넣기 (Processor: process(inputs, frames, outputs) / flush(outputs))
+template <typename Processor>
+std::vector<std::vector<float>> runChunked(Processor& processor, const std::vector<std::vector<float>>& planes,
+                                           unsigned int seed) {
+    std::vector<std::vector<float>> outputs(planes.size());
+    std::vector<const float*> pointers(planes.size());
+    const int frames = (int)planes[0].size();
+    int position = 0;
+    while (position < frames) {
+        int block = std::min(nextBlockSize(seed), frames - position);
+        for (size_t c = 0; c < planes.size(); ++c) {
+            pointers[c] = planes[c].data() + position;
+        }
+        processor.process(pointers.data(), block, outputs);
+        position += block;
+    }
+    processor.flush(outputs);
+    return outputs;
+}
+
+std::vector<std::vector<float>> runChain(StreamingChain& chain, const std::vector<std::vector<float>>& planes,
+                                         unsigned int seed) {
+    std::vector<std::vector<float>> outputs;
+    std::vector<const float*> pointers(planes.size());
+    const int frames = (int)planes[0].size();
+    chain.begin(SAMPLE_RATE, (int)planes.size());
+    int position = 0;
+    while (position < frames) {
+        int block = std::min(nextBlockSize(seed), frames - position);
+        for (size_t c = 0; c < planes.size(); ++c) {
+            pointers[c] = planes[c].data() + position;
+        }
+        chain.process(pointers.data(), block, outputs);
+        position += block;
+    }
+    chain.finish(outputs);
+    return outputs;
+}
+
+// 볼륨 보정 (VoiceFilter::applyFilterPlanar와 같은 식, RMS는 double 누적)
+void applyVolumeCorrection(const std::vector<std::vector<float>>& original, std::vector<std::vector<float>>& filtered) {
+    double originalSum = 0.0;
+    double filteredSum = 0.0;
+    size_t originalCount = 0;
+    size_t filteredCount = 0;
+    for (const auto& channel : original) {
+        for (float s : channel) originalSum += (double)s * s;
+        originalCount += channel.size();
+    }
+    for (const auto& channel : filtered) {
+        for (float s : channel) filteredSum += (double)s * s;
+        filteredCount += channel.size();
+    }
+    float originalRMS = (float)std::sqrt(originalSum / originalCount);
+    float filteredRMS = (float)std::sqrt(filteredSum / filteredCount);
+    float gain = 1.0f;
+    if (filteredRMS > 0.0001f && originalRMS > 0.0001f) {
+        gain = std::min(originalRMS / filteredRMS, 3.0f);
+    }
+    for (auto& channel : filtered) {
+        for (float& s : channel) {
+            s = std::max(-1.0f, std::min(1.0f, s * gain));
+        }
+    }
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    스트리밍 처리 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> left = generateSignal(180.0f, 2.0f, SAMPLE_RATE);
+    std::vector<float> right = generateSignal(260.0f, 2.0f, SAMPLE_RATE);
+    const int frames = (int)left.size();
+    const std::vector<std::vector<float>> mono = {left};
+    const std::vector<std::vector<float>> stereo = {left, right};
+
+    // 1. 스트리밍 WSOLA = 한 번 처리
+    const float ratios[] = {0.7f, 1.3f};
+    for (float ratio : ratios) {
+        SimpleTimeStretcher batch;
+        std::vector<float> expectedMono;
+        batch.process(left.data(), frames, SAMPLE_RATE, ratio, expectedMono);
+
+        StreamingTimeStretcher streaming;
+        streaming.setup(SAMPLE_RATE, 1, ratio);
+        std::vector<std::vector<float>> outputs = runChunked(streaming, mono, 1u);
+        std::string label = "WSOLA 모노 (ratio " + std::to_string(ratio) + "): 블록 처리 = 한 번 처리";
+        check(label.c_str(), outputs[0] == expectedMono, failures);
+
+        const float* inputs[] = {left.data(), right.data()};
+        std::vector<std::vector<float>> expectedStereo;
+        batch.processPlanar(inputs, 2, frames, SAMPLE_RATE, ratio, expectedStereo);
+
+        streaming.setup(SAMPLE_RATE, 2, ratio);
+        outputs = runChunked(streaming, stereo, 7u);
+        label = "WSOLA 스테레오 (ratio " + std::to_string(ratio) + "): 블록 처리 = 한 번 처리";
+        check(label.c_str(), outputs[0] == expectedStereo[0] && outputs[1] == expectedStereo[1], failures);
+    }
+
+    // 2. 스트리밍 pitch + tempo = SimplePitchShifter::processWithTempo
+    //    (리샘플 위치를 double로 계산하므로 float 위치를 쓰는 한 번 처리와 아주 작은 차이)
+    {
+        const ResamplerQuality qualities[] = {ResamplerQuality::CUBIC, ResamplerQuality::SINC_16};
+        for (ResamplerQuality quality : qualities) {
+            SimplePitchShifter batch;
+            batch.setResamplerQuality(quality);
+            const float* inputs[] = {left.data(), right.data()};
+            std::vector<std::vector<float>> expected;
+            batch.processWithTempoPlanar(inputs, 2, frames, SAMPLE_RATE, 4.0f, 1.2f, expected);
+
+            StreamingPitchShifter streaming;
+            streaming.setResamplerQuality(quality);
+            streaming.setup(SAMPLE_RATE, 2, 4.0f, 1.2f);
+            std::vector<std::vector<float>> outputs = runChunked(streaming, stereo, 3u);
+
+            float diff = std::max(maxCommonDifference(outputs[0], expected[0]),
+                                  maxCommonDifference(outputs[1], expected[1]));
+            std::string label = std::string("Pitch + Tempo (") +
+                                (quality == ResamplerQuality::CUBIC ? "cubic" : "sinc16") +
+                                "): 한 번 처리와 동일 (차이 " + std::to_string(diff) + ")";
+            check(label.c_str(), diff < 1e-3f, failures);
+        }
+
+        SimplePitchShifter batch;
+        std::vector<float> expected;
+        batch.processWithTempo(left.data(), frames, SAMPLE_RATE, 0.0f, 1.25f, expected);
+        StreamingPitchShifter streaming;
+        streaming.setup(SAMPLE_RATE, 1, 0.0f, 1.25f);
+        std::vector<std::vector<float>> outputs = runChunked(streaming, mono, 5u);
+        check("Tempo만 변경: 한 번 처리와 동일", outputs[0] == expected, failures);
+    }
+
+    // 3. 스트리밍 필터
+    {
+        const FilterType types[] = {FilterType::LOW_PASS, FilterType::BAND_PASS, FilterType::ECHO,
+                                    FilterType::REVERB, FilterType::CHORUS, FilterType::FLANGER,
+                                    FilterType::DISTORTION, FilterType::ROBOT};
+        const char* names[] = {"low-pass", "band-pass", "echo", "reverb", "chorus", "flanger",
+                               "distortion", "robot"};
+        for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t) {
+            // 볼륨 보정 전 커널 결과 = VoiceFilter 커널 (보정은 같은 식으로 따로 적용해 비교)
+            StreamingVoiceFilter streaming;
+            streaming.setup(SAMPLE_RATE, 2, types[t], 0.6f, 0.4f);
+            streaming.setVolumeCorrection(false);
+            std::vector<std::vector<float>> outputs = runChunked(streaming, stereo, 11u + (unsigned int)t);
+            applyVolumeCorrection(stereo, outputs);
+
+            VoiceFilter batch;
+            std::vector<std::vector<float>> expected = stereo;
+            batch.applyFilterPlanar(expected, SAMPLE_RATE, types[t], 0.6f, 0.4f);
+
+            float diff = std::max(maxDifference(outputs[0], expected[0]), maxDifference(outputs[1], expected[1]));
+            std::string label = std::string("필터 ") + names[t] + ": VoiceFilter와 동일 (차이 " +
+                                std::to_string(diff) + ")";
+            check(label.c_str(), diff < 1e-3f, failures);
+        }
+
+        // 볼륨 보정 포함: 블록 크기를 바꿔도 같은 결과 (누적 RMS는 블록 경계에서만 갱신되므로 같은 경계 사용)
+        StreamingVoiceFilter first;
+        StreamingVoiceFilter second;
+        first.setup(SAMPLE_RATE, 2, FilterType::VOICE_CHANGER_MALE_TO_FEMALE, 0.8f);
+        second.setup(SAMPLE_RATE, 2, FilterType::VOICE_CHANGER_MALE_TO_FEMALE, 0.8f);
+        std::vector<std::vector<float>> a = runChunked(first, stereo, 21u);
+        std::vector<std::vector<float>> b = runChunked(second, stereo, 21u);
+        check("음성 변조: 같은 입력 -> 같은 결과, 길이 유지",
+              a == b && a[0].size() > (size_t)frames * 9 / 10 && a[0].size() <= (size_t)frames, failures);
+    }
+
+    // 4. 메모리 스트림 (StreamingChain)
+    {
+        StreamingChain chain;
+        check("스테이지 목록 파싱", chain.parse("pitch:3,2;tempo:1.2;gain:0.9;rate:22050"), failures);
+        std::vector<std::vector<float>> a = runChain(chain, stereo, 31u);
+        std::vector<std::vector<float>> b = runChain(chain, stereo, 97u);
+        check("파이프라인: 블록 크기와 상관없이 같은 결과", a == b, failures);
+
+        long long expectedLength = (long long)(frames / 1.2);
+        long long length = (long long)a[0].size();
+        // (WSOLA 마지막 세그먼트 꼬리만큼은 한 번 처리와 마찬가지로 길어질 수 있음)
+        check("파이프라인: 출력 길이 = 입력 / tempo",
+              std::llabs(length - expectedLength) < SAMPLE_RATE / 20 && a[1].size() == a[0].size(), failures);
+
+        float peak = 0.0f;
+        for (const auto& channel : a) {
+            for (float s : channel) peak = std::max(peak, std::abs(s));
+        }
+        check("파이프라인: gain + 클램프 적용", peak > 0.1f && peak <= 1.0f, failures);
+
+        check("reverse 거부", !chain.parse("pitch:2;reverse"), failures);
+        std::vector<std::vector<float>> c = runChain(chain, stereo, 31u);
+        check("거부된 목록은 기존 스테이지를 바꾸지 않음", c == a, failures);
+    }
+
+    // 5. 파일 -> 파일
+    {
+        const std::string inputPath = "test_streaming_pipeline_input.wav";
+        const std::string outputPath = "test_streaming_pipeline_output.wav";
+        const std::string outputPath2 = "test_streaming_pipeline_output2.wav";
+
+        WavWriter writer;
+        const float* inputs[] = {left.data(), right.data()};
+        bool written = writer.open(inputPath, SAMPLE_RATE, 2, WavSampleFormat::FLOAT32) &&
+                       writer.writeFramesPlanar(inputs, frames) && writer.close();
+        check("입력 WAV 생성", written, failures);
+
+        StreamingPipeline pipeline;
+        pipeline.parse("pitch:-2;tempo:0.8;filter:1,0.5;gain:0.9");
+        pipeline.setChunkFrames(4096);
+        StreamingPipelineReport report;
+        bool ok = pipeline.processFile(inputPath, outputPath, &report);
+        check("파일 처리 성공", ok, failures);
+
+        WavReader reader;
+        bool opened = reader.open(outputPath);
+        long long expectedLength = (long long)(frames / 0.8);
+        check("출력 WAV: 형식 / 채널 유지, 길이 = 입력 / tempo",
+              opened && reader.getChannels() == 2 && reader.getSampleRate() == SAMPLE_RATE &&
+              reader.getFormat() == WavSampleFormat::FLOAT32 &&
+              std::llabs((long long)reader.getFrameCount() - expectedLength) < SAMPLE_RATE / 100, failures);
+        check("처리 결과 보고 (프레임 수 / realtime factor / 버퍼 메모리)",
+              report.inputFrames == (uint64_t)frames && report.outputFrames == reader.getFrameCount() &&
+              report.realtimeFactor > 0.0 && report.bufferBytes > 0 &&
+              report.bufferBytes < 32u * 1024 * 1024, failures);
+
+        // 필터 없는 목록은 청크 크기와 상관없이 같은 파일
+        StreamingPipeline small;
+        StreamingPipeline large;
+        small.parse("pitch:3,2;tempo:1.2");
+        large.parse("pitch:3,2;tempo:1.2");
+        small.setChunkFrames(1000);
+        large.setChunkFrames(30000);
+        small.processFile(inputPath, outputPath);
+        large.processFile(inputPath, outputPath2);
+
+        WavReader smallReader;
+        WavReader largeReader;
+        std::vector<float> smallData;
+        std::vector<float> largeData;
+        if (smallReader.open(outputPath) && largeReader.open(outputPath2)) {
+            smallData.resize((size_t)smallReader.getFrameCount() * 2);
+            largeData.resize((size_t)largeReader.getFrameCount() * 2);
+            smallReader.readFrames(0, smallReader.getFrameCount(), smallData.data());
+            largeReader.readFrames(0, largeReader.getFrameCount(), largeData.data());
+        }
+        check("파일 처리: 청크 크기와 상관없이 같은 결과", !smallData.empty() && smallData == largeData, failures);
+
+        check("없는 입력 파일은 실패", !pipeline.processFile("no_such_file.wav", outputPath), failures);
+
+        std::remove(inputPath.c_str());
+        std::remove(outputPath.c_str());
+        std::remove(outputPath2.c_str());
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
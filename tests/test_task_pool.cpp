@@ -0,0 +1,204 @@
+/**
+ * 작업 풀 (TaskPool) 테스트
+ *
+ * 검증 항목:
+ *   1. parallelFor가 모든 인덱스를 정확히 한 번씩 처리
+ *   2. 작은 작업 / 중첩 호출은 호출 스레드에서 바로 실행
+ *   3. 스레드 수 설정 범위 (1 ~ MAX_THREADS), 처리 중 다른 스레드에서 바꿔도 모든 인덱스 처리
+ *   4. 병렬 처리 결과 = 단일 스레드 결과 (Resampler / WSOLA 다채널 / VoiceFilter / PitchAnalyzer)
+ *
+ * 사용법:
+ *   ./test_task_pool
+ */
+
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/audio/AudioBuffer.h"
+#include "src/dsp/Resampler.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/effects/VoiceFilter.h"
+#include "src/performance/TaskPool.h"
+#include "tests/test_helpers.h"
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+bool samePoints(const std::vector<PitchPoint>& a, const std::vector<PitchPoint>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].time != b[i].time || a[i].frequency != b[i].frequency || a[i].confidence != b[i].confidence) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    작업 풀 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    TaskPool& pool = TaskPool::getInstance();
+
+    // 1. 모든 인덱스를 한 번씩
+    {
+        pool.setThreadCount(4);
+        const int count = 100000;
+        std::vector<std::atomic<int>> hits(count);
+        for (auto& hit : hits) hit = 0;
+        std::atomic<int> calls(0);
+        pool.parallelFor(count, 1000, [&](int begin, int end) {
+            calls++;
+            for (int i = begin; i < end; ++i) hits[i]++;
+        });
+        bool once = true;
+        for (auto& hit : hits) once = once && hit == 1;
+        check("parallelFor: 모든 인덱스를 정확히 한 번씩 처리", once, failures);
+        check("parallelFor: 여러 구간으로 나눠 실행", calls > 1, failures);
+
+        // 반복 호출 (작업자 재사용)
+        bool repeated = true;
+        for (int round = 0; round < 200; ++round) {
+            std::atomic<long long> sum(0);
+            pool.parallelFor(1000, 10, [&](int begin, int end) {
+                long long local = 0;
+                for (int i = begin; i < end; ++i) local += i;
+                sum += local;
+            });
+            repeated = repeated && sum == 999LL * 1000 / 2;
+        }
+        check("parallelFor: 반복 호출 200회 결과 일치", repeated, failures);
+    }
+
+    // 2. 작은 작업 / 중첩 호출
+    {
+        std::thread::id caller = std::this_thread::get_id();
+        bool sameThread = false;
+        pool.parallelFor(10, 100, [&](int begin, int end) {
+            sameThread = std::this_thread::get_id() == caller && begin == 0 && end == 10;
+        });
+        check("작은 작업은 호출 스레드에서 한 번에 실행", sameThread, failures);
+
+        std::atomic<int> total(0);
+        pool.parallelFor(8, 1, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                pool.parallelFor(1000, 1, [&](int innerBegin, int innerEnd) {
+                    total += innerEnd - innerBegin;
+                });
+            }
+        });
+        check("중첩 parallelFor: 교착 없이 모두 처리", total == 8000, failures);
+    }
+
+    // 3. 스레드 수 설정
+    {
+        pool.setThreadCount(100);
+        bool clampedHigh = pool.getThreadCount() == TaskPool::MAX_THREADS;
+        pool.setThreadCount(1);
+        bool single = pool.getThreadCount() == 1;
+        pool.setThreadCount(0);
+        bool automatic = pool.getThreadCount() >= 1 && pool.getThreadCount() <= TaskPool::MAX_THREADS;
+        check("스레드 수: 최대값 제한 / 1 = 단일 스레드 / 0 = 코어 수",
+              clampedHigh && single && automatic && TaskPool::isThreaded(), failures);
+
+        // 다른 스레드가 스레드 수를 계속 바꾸는 동안 parallelFor
+        std::atomic<bool> running(true);
+        std::thread changer([&pool, &running]() {
+            int count = 1;
+            while (running) {
+                pool.setThreadCount(count);
+                count = count % TaskPool::MAX_THREADS + 1;
+                std::this_thread::yield();
+            }
+        });
+        bool complete = true;
+        for (int round = 0; round < 200; ++round) {
+            std::atomic<int> processed(0);
+            pool.parallelFor(1000, 16, [&processed](int begin, int end) {
+                processed += end - begin;
+            });
+            complete = complete && processed == 1000;
+        }
+        running = false;
+        changer.join();
+        pool.setThreadCount(4);
+        check("스레드 수: 처리 중 변경해도 모든 인덱스 처리", complete, failures);
+    }
+
+    // 4. 병렬 처리 결과 = 단일 스레드 결과
+    std::vector<float> left = generateSignal(180.0f, 3.0f, SAMPLE_RATE);
+    std::vector<float> right = generateSignal(240.0f, 3.0f, SAMPLE_RATE);
+    const int frames = (int)left.size();
+    const float* inputs[] = {left.data(), right.data()};
+    {
+        const ResamplerQuality qualities[] = {ResamplerQuality::LINEAR, ResamplerQuality::CUBIC,
+                                              ResamplerQuality::SINC_16};
+        bool same = true;
+        for (ResamplerQuality quality : qualities) {
+            Resampler resampler;
+            resampler.setQuality(quality);
+            std::vector<float> single;
+            std::vector<float> parallel;
+            pool.setThreadCount(1);
+            resampler.process(left.data(), frames, 1.26f, single, 0.9f);
+            pool.setThreadCount(4);
+            resampler.process(left.data(), frames, 1.26f, parallel, 0.9f);
+            same = same && !single.empty() && single == parallel;
+        }
+        check("Resampler: 병렬 = 단일 스레드 (linear / cubic / sinc)", same, failures);
+    }
+    {
+        SimpleTimeStretcher stretcher;
+        std::vector<std::vector<float>> single;
+        std::vector<std::vector<float>> parallel;
+        pool.setThreadCount(1);
+        stretcher.processPlanar(inputs, 2, frames, SAMPLE_RATE, 1.3f, single);
+        pool.setThreadCount(4);
+        stretcher.processPlanar(inputs, 2, frames, SAMPLE_RATE, 1.3f, parallel);
+        check("WSOLA 다채널: 병렬 = 단일 스레드", !single[0].empty() && single == parallel, failures);
+    }
+    {
+        const FilterType types[] = {FilterType::BAND_PASS, FilterType::ECHO, FilterType::REVERB,
+                                    FilterType::CHORUS, FilterType::AM_RADIO};
+        bool same = true;
+        for (FilterType type : types) {
+            VoiceFilter filter;
+            std::vector<std::vector<float>> single = {left, right};
+            std::vector<std::vector<float>> parallel = {left, right};
+            pool.setThreadCount(1);
+            filter.applyFilterPlanar(single, SAMPLE_RATE, type, 0.6f, 0.4f);
+            pool.setThreadCount(4);
+            filter.applyFilterPlanar(parallel, SAMPLE_RATE, type, 0.6f, 0.4f);
+            // AM_RADIO 노이즈는 호출마다 이어지므로 길이만 비교
+            same = same && (type == FilterType::AM_RADIO ? single[0].size() == parallel[0].size()
+                                                         : single == parallel);
+        }
+        check("VoiceFilter 다채널: 병렬 = 단일 스레드", same, failures);
+    }
+    {
+        AudioBuffer buffer(SAMPLE_RATE, 1);
+        buffer.setData(left);
+        PitchAnalyzer analyzer;
+        pool.setThreadCount(1);
+        std::vector<PitchPoint> single = analyzer.analyze(buffer);
+        pool.setThreadCount(4);
+        std::vector<PitchPoint> parallel = analyzer.analyze(buffer);
+        check("PitchAnalyzer: 병렬 = 단일 스레드", !single.empty() && samePoints(single, parallel), failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
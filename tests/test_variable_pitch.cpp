@@ -0,0 +1,169 @@
+/**
+ * VariablePitchRenderer 테스트
+ *
+ * 검증 항목:
+ *   1. 일정한 곡선: 균일 pitch shift와 같은 피치 / 길이
+ *   2. 계단 곡선: 앞 절반 +5 반음, 뒤 절반 -3 반음이 구간별로 반영되는지
+ *   3. duration 곡선 (tempo, applyUniformTimeStretch와 같은 의미): 출력 길이 = 구간별 (입력 길이 / durationRatio)의 합, 피치 유지
+ *   4. FrameData (AudioPreprocessor 프레임)의 pitchSemitones / durationRatio 렌더링
+ *   5. 변화 없는 곡선: 원본 그대로
+ *   6. 같은 durationRatio를 균일 time stretch(SimpleTimeStretcher, applyUniformTimeStretch)에 주면 같은 길이
+ *   7. framesToCurves: samples가 비어 있는 프레임 (applyFrameEdits)도 프레임 중심에 값 배치
+ *
+ * 사용법:
+ *   ./test_variable_pitch
+ */
+
+#include "src/audio/AudioBuffer.h"
+#include "src/audio/AudioPreprocessor.h"
+#include "src/analysis/PitchAnalyzer.h"
+#include "src/dsp/SimpleTimeStretcher.h"
+#include "src/dsp/VariablePitchRenderer.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+const float BASE_FREQUENCY = 200.0f;
+
+bool checkPitch(const char* label, float measured, float semitones, int& failures) {
+    float expected = BASE_FREQUENCY * std::pow(2.0f, semitones / 12.0f);
+    float error = std::abs(measured - expected) / expected;
+    bool ok = error < 0.03f;
+    if (!ok) failures++;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << label << ": 기대 " << expected
+              << " Hz / 측정 " << measured << " Hz" << std::endl;
+    return ok;
+}
+
+bool checkLength(const char* label, size_t actual, float expected, int& failures) {
+    float error = std::abs(actual - expected) / expected;
+    bool ok = error < 0.03f;
+    if (!ok) failures++;
+    std::cout << (ok ? "[PASS] " : "[FAIL] ") << label << ": 기대 " << static_cast<int>(expected)
+              << " / 실제 " << actual << std::endl;
+    return ok;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    VariablePitchRenderer 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    std::vector<float> input = generateVoiceSignal(BASE_FREQUENCY, 2.0f, SAMPLE_RATE);
+    const size_t length = input.size();
+    const size_t half = length / 2;
+
+    VariablePitchRenderer renderer;
+    std::vector<float> output;
+
+    // 1. 일정한 곡선
+    {
+        std::vector<float> pitchCurve(length, 4.0f);
+        renderer.render(input.data(), (int)length, SAMPLE_RATE, pitchCurve, std::vector<float>(), output);
+        checkLength("일정 +4 반음 길이", output.size(), (float)length, failures);
+        checkPitch("일정 +4 반음 피치", measureMedianPitch(output, SAMPLE_RATE), 4.0f, failures);
+    }
+
+    // 2. 계단 곡선 (경계 주변 0.2초는 측정에서 제외)
+    {
+        std::vector<float> pitchCurve(length, 5.0f);
+        std::fill(pitchCurve.begin() + half, pitchCurve.end(), -3.0f);
+        renderer.render(input.data(), (int)length, SAMPLE_RATE, pitchCurve, std::vector<float>(), output);
+        size_t margin = SAMPLE_RATE / 5;
+        size_t boundary = output.size() / 2;
+        checkLength("계단 곡선 길이", output.size(), (float)length, failures);
+        size_t tail = boundary + margin;
+        checkPitch("계단 곡선 앞 절반 (+5)", measureMedianPitch(output.data(), boundary - margin, SAMPLE_RATE),
+                   5.0f, failures);
+        checkPitch("계단 곡선 뒤 절반 (-3)", measureMedianPitch(output.data() + tail, output.size() - tail, SAMPLE_RATE),
+                   -3.0f, failures);
+    }
+
+    // 3. duration 곡선 (앞 절반 1.5배 빠르게, 뒤 절반 0.8배 = 느리게)
+    {
+        std::vector<float> durationCurve(length, 1.5f);
+        std::fill(durationCurve.begin() + half, durationCurve.end(), 0.8f);
+        renderer.render(input.data(), (int)length, SAMPLE_RATE, std::vector<float>(), durationCurve, output);
+        checkLength("duration 곡선 길이", output.size(), half / 1.5f + (length - half) / 0.8f, failures);
+        checkPitch("duration 곡선 피치 유지", measureMedianPitch(output, SAMPLE_RATE), 0.0f, failures);
+    }
+
+    // 4. FrameData 렌더링 (1초 이전 프레임만 +7 반음, 전체 1.25배 빠르게)
+    {
+        AudioBuffer buffer(SAMPLE_RATE, 1);
+        buffer.setData(input);
+        AudioPreprocessor preprocessor;
+        std::vector<FrameData> frames = preprocessor.process(buffer);
+        for (auto& frame : frames) {
+            frame.pitchSemitones = (frame.time < 1.0f) ? 7.0f : 0.0f;
+            frame.durationRatio = 1.25f;
+        }
+
+        AudioBuffer result = renderer.render(buffer, frames);
+        const std::vector<float>& data = result.getData();
+        size_t margin = SAMPLE_RATE / 5;
+        size_t boundary = data.size() / 2;
+        checkLength("FrameData 길이", data.size(), length / 1.25f, failures);
+        size_t tail = boundary + margin;
+        checkPitch("FrameData 앞 절반 (+7)", measureMedianPitch(data.data(), boundary - margin, SAMPLE_RATE),
+                   7.0f, failures);
+        checkPitch("FrameData 뒤 절반 (0)", measureMedianPitch(data.data() + tail, data.size() - tail, SAMPLE_RATE),
+                   0.0f, failures);
+    }
+
+    // 5. 변화 없는 곡선
+    {
+        std::vector<float> pitchCurve(length, 0.0f);
+        std::vector<float> durationCurve(length, 1.0f);
+        renderer.render(input.data(), (int)length, SAMPLE_RATE, pitchCurve, durationCurve, output);
+        bool ok = output == input;
+        if (!ok) failures++;
+        std::cout << (ok ? "[PASS] " : "[FAIL] ") << "변화 없는 곡선: 원본과 동일" << std::endl;
+    }
+
+    // 6. 균일 time stretch와 같은 의미 (1.5 = 1.5배 빠르게)
+    {
+        std::vector<float> durationCurve(length, 1.5f);
+        renderer.render(input.data(), (int)length, SAMPLE_RATE, std::vector<float>(), durationCurve, output);
+        SimpleTimeStretcher stretcher;
+        std::vector<float> uniform;
+        stretcher.process(input.data(), (int)length, SAMPLE_RATE, 1.5f, uniform);
+        checkLength("균일 time stretch와 같은 길이 (durationRatio 1.5)", output.size(), (float)uniform.size(), failures);
+    }
+
+    // 7. samples 없는 프레임 (time / 편집 값만, 20ms 프레임)
+    {
+        const int frameSamples = SAMPLE_RATE / 50;
+        std::vector<FrameData> frames(2);
+        frames[0].time = 0.0f;
+        frames[0].pitchSemitones = 0.0f;
+        frames[1].time = 0.1f;
+        frames[1].pitchSemitones = 10.0f;
+
+        std::vector<float> pitchCurve;
+        std::vector<float> durationCurve;
+        VariablePitchRenderer::framesToCurves(frames, SAMPLE_RATE, (int)length, frameSamples,
+                                              pitchCurve, durationCurve);
+        const int centerA = frameSamples / 2;
+        const int centerB = (int)(0.1f * SAMPLE_RATE) + frameSamples / 2;
+        bool ok = std::abs(pitchCurve[centerA]) < 0.01f
+               && std::abs(pitchCurve[centerB] - 10.0f) < 0.01f
+               && std::abs(pitchCurve[(centerA + centerB) / 2] - 5.0f) < 0.01f;
+        check("framesToCurves: 빈 samples 프레임도 프레임 중심 기준", ok, failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
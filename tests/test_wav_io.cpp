@@ -0,0 +1,243 @@
+/**
+ * WAV 입출력 (WavReader / WavWriter) 테스트
+ *
+ * 검증 항목:
+ *   1. PCM16 / PCM24 / float32 쓰기 -> 읽기 왕복 (양자화 오차 이내)
+ *   2. interleaved / planar 읽기 결과 일치, 구간 읽기 / 파일 끝 처리
+ *   3. 작은 블록으로 여러 번 나눠 쓰기 = 한 번에 쓰기 (바이트 단위 동일)
+ *   4. RF64 (ds64 청크) 쓰기 / 읽기
+ *   5. LIST 등 알 수 없는 청크 + 홀수 크기 패딩 건너뛰기
+ *   6. 저장소의 original.wav 읽기
+ *
+ * 사용법:
+ *   ./test_wav_io
+ */
+
+#include "src/audio/WavFile.h"
+#include "tests/test_helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef PROJECT_SOURCE_DIR
+#define PROJECT_SOURCE_DIR "."
+#endif
+
+std::vector<float> generateInterleaved(int frames, int channels) {
+    std::vector<float> data((size_t)frames * channels);
+    for (int i = 0; i < frames; ++i) {
+        float t = static_cast<float>(i) / SAMPLE_RATE;
+        for (int c = 0; c < channels; ++c) {
+            data[(size_t)i * channels + c] = 0.8f * std::sin(2.0f * M_PI * (220.0f + 110.0f * c) * t);
+        }
+    }
+    return data;
+}
+
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+float maxError(const std::vector<float>& a, const std::vector<float>& b) {
+    if (a.size() != b.size()) return 1e9f;
+    float error = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        error = std::max(error, std::fabs(a[i] - b[i]));
+    }
+    return error;
+}
+
+void appendU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out.push_back((uint8_t)(value >> (8 * i)));
+}
+
+void appendU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back((uint8_t)value);
+    out.push_back((uint8_t)(value >> 8));
+}
+
+void appendId(std::vector<uint8_t>& out, const char* id) {
+    out.insert(out.end(), id, id + 4);
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "    WAV 입출력 (mmap / 블록 쓰기) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::endl;
+
+    int failures = 0;
+    const int frames = 22051;  // 블록 크기의 배수가 아닌 길이
+    const int channels = 2;
+    std::vector<float> signal = generateInterleaved(frames, channels);
+
+    // 1 ~ 3. 형식별 왕복
+    struct FormatCase { WavSampleFormat format; const char* name; float tolerance; };
+    const FormatCase cases[] = {
+        {WavSampleFormat::PCM16, "PCM16", 2.0f / 32767.0f},
+        {WavSampleFormat::PCM24, "PCM24", 2.0f / 8388607.0f},
+        {WavSampleFormat::FLOAT32, "float32", 0.0f},
+    };
+
+    for (const FormatCase& formatCase : cases) {
+        const std::string path = std::string("test_wav_io_") + formatCase.name + ".wav";
+        const std::string chunkedPath = std::string("test_wav_io_") + formatCase.name + "_chunked.wav";
+        std::cout << "  [" << formatCase.name << "]" << std::endl;
+
+        WavWriter writer;
+        bool written = writer.open(path, SAMPLE_RATE, channels, formatCase.format)
+                    && writer.writeFrames(signal.data(), frames) && writer.close();
+
+        // 작은 블록(1000바이트) + 불규칙한 크기로 나눠 쓰기
+        WavWriter chunkedWriter;
+        bool chunkedWritten = chunkedWriter.open(chunkedPath, SAMPLE_RATE, channels, formatCase.format, 1000);
+        for (int offset = 0; offset < frames && chunkedWritten; ) {
+            int count = std::min(frames - offset, 37 + offset % 501);
+            chunkedWritten = chunkedWriter.writeFrames(signal.data() + (size_t)offset * channels, count);
+            offset += count;
+        }
+        chunkedWritten = chunkedWritten && chunkedWriter.getFramesWritten() == (uint64_t)frames
+                      && chunkedWriter.close();
+
+        WavReader reader;
+        bool opened = written && reader.open(path);
+        check("쓰기 / 열기", opened && !reader.isRF64(), failures);
+        check("헤더 (샘플레이트 / 채널 / 형식 / 길이)",
+              reader.getSampleRate() == SAMPLE_RATE && reader.getChannels() == channels
+              && reader.getFormat() == formatCase.format && reader.getFrameCount() == (uint64_t)frames, failures);
+
+        std::vector<float> decoded(signal.size());
+        size_t readCount = reader.readFrames(0, frames, decoded.data());
+        float error = maxError(signal, decoded);
+        std::cout << "  최대 오차: " << error << std::endl;
+        check("왕복 오차 <= 양자화 단계 2개 (32767 곱하기 / 32768 나누기 비대칭 포함)", readCount == (size_t)frames && error <= formatCase.tolerance, failures);
+
+        std::vector<float> left(frames), right(frames);
+        float* planes[] = {left.data(), right.data()};
+        reader.readFramesPlanar(0, frames, planes);
+        bool planarOk = true;
+        for (int i = 0; i < frames; ++i) {
+            planarOk = planarOk && left[i] == decoded[2 * i] && right[i] == decoded[2 * i + 1];
+        }
+        check("planar 읽기 = interleaved 읽기", planarOk, failures);
+
+        std::vector<float> tail(200 * channels);
+        size_t tailCount = reader.readFrames(frames - 50, 200, tail.data());
+        check("구간 읽기 / 파일 끝에서 잘림",
+              tailCount == 50 && tail[0] == decoded[(size_t)(frames - 50) * channels]
+              && reader.getSample(frames - 1, 1) == decoded.back()
+              && reader.readFrames(frames, 10, tail.data()) == 0, failures);
+
+        check("나눠 쓰기 = 한 번에 쓰기 (바이트 동일)",
+              chunkedWritten && readBytes(path) == readBytes(chunkedPath), failures);
+
+        reader.close();
+        std::remove(path.c_str());
+        std::remove(chunkedPath.c_str());
+    }
+
+    // 4. RF64
+    {
+        const std::string path = "test_wav_io_rf64.wav";
+        WavWriter writer;
+        bool written = writer.open(path, SAMPLE_RATE, channels, WavSampleFormat::PCM24, 4096, true)
+                    && writer.writeFrames(signal.data(), frames) && writer.close();
+
+        std::vector<char> bytes = readBytes(path);
+        bool header = bytes.size() > 16 && std::memcmp(bytes.data(), "RF64", 4) == 0
+                   && std::memcmp(bytes.data() + 12, "ds64", 4) == 0;
+
+        WavReader reader;
+        bool opened = written && reader.open(path);
+        std::vector<float> decoded(signal.size());
+        reader.readFrames(0, frames, decoded.data());
+        check("RF64 헤더 (RF64 + ds64)", header, failures);
+        check("RF64 읽기 (ds64 크기 사용)",
+              opened && reader.isRF64() && reader.getFrameCount() == (uint64_t)frames
+              && maxError(signal, decoded) <= 2.0f / 8388607.0f, failures);
+        reader.close();
+        std::remove(path.c_str());
+    }
+
+    // 5. LIST 청크 + 홀수 크기 패딩 (mono PCM16, 3샘플)
+    {
+        const std::string path = "test_wav_io_chunks.wav";
+        std::vector<uint8_t> file;
+        appendId(file, "RIFF");
+        appendU32(file, 0);  // 아래에서 채움
+        appendId(file, "WAVE");
+        appendId(file, "LIST");
+        appendU32(file, 5);  // 홀수 크기 -> 1바이트 패딩
+        file.insert(file.end(), {'I', 'N', 'F', 'O', 'x', 0});
+        appendId(file, "fmt ");
+        appendU32(file, 16);
+        appendU16(file, 1);
+        appendU16(file, 1);
+        appendU32(file, 8000);
+        appendU32(file, 16000);
+        appendU16(file, 2);
+        appendU16(file, 16);
+        appendId(file, "data");
+        appendU32(file, 6);
+        appendU16(file, 16384);
+        appendU16(file, (uint16_t)-32768);
+        appendU16(file, 0);
+        appendId(file, "cue ");  // data 뒤 청크 (무시)
+        appendU32(file, 0);
+        uint32_t riffSize = (uint32_t)file.size() - 8;
+        std::memcpy(file.data() + 4, &riffSize, 4);
+
+        FILE* out = std::fopen(path.c_str(), "wb");
+        std::fwrite(file.data(), 1, file.size(), out);
+        std::fclose(out);
+
+        WavReader reader;
+        bool opened = reader.open(path);
+        check("알 수 없는 청크 / 패딩 건너뛰기",
+              opened && reader.getSampleRate() == 8000 && reader.getFrameCount() == 3
+              && reader.getSample(0, 0) == 0.5f && reader.getSample(1, 0) == -1.0f
+              && reader.getSample(2, 0) == 0.0f, failures);
+        reader.close();
+        std::remove(path.c_str());
+
+        WavReader missing;
+        check("없는 파일은 실패 반환", !missing.open("test_wav_io_missing.wav") && !missing.isOpen(), failures);
+    }
+
+    // 6. 저장소 샘플 파일
+    {
+        WavReader reader;
+        bool opened = reader.open(std::string(PROJECT_SOURCE_DIR) + "/original.wav");
+        bool ok = opened && reader.getFormat() == WavSampleFormat::PCM16 && reader.getChannels() == 1
+               && reader.getFrameCount() > 0;
+        if (ok) {
+            std::vector<float> samples(reader.getFrameCount());
+            reader.readFrames(0, samples.size(), samples.data());
+            float peak = 0.0f;
+            for (float sample : samples) {
+                peak = std::max(peak, std::fabs(sample));
+            }
+            std::cout << "  original.wav: " << reader.getDuration() << "초, peak " << peak << std::endl;
+            ok = peak > 0.0f && peak <= 1.0f;
+        }
+        check("original.wav 읽기", ok, failures);
+    }
+
+    std::cout << std::endl;
+    std::cout << "========================================" << std::endl;
+    if (failures > 0) {
+        std::cout << "테스트 실패: " << failures << "개" << std::endl;
+        std::cout << "========================================" << std::endl;
+        return 1;
+    }
+    std::cout << "테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
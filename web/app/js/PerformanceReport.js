@@ -489,7 +489,7 @@ export class PerformanceReport {
         item.innerHTML = `
             ${expandIcon}
             <div class="trace-item-bar" style="width: ${barWidth}%"></div>
-            <span class="trace-item-label">${func.name}</span>
+            <span class="trace-item-label">${func.name}${func.count > 1 ? ` ×${func.count}` : ''}</span>
             <span class="trace-item-duration">${func.duration.toFixed(2)}ms</span>
             <span class="trace-item-percent">${percent}%</span>
         `;
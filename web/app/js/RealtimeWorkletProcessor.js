@@ -0,0 +1,101 @@
+/**
+ * RealtimeWorkletProcessor - AudioWorklet용 실시간 처리기
+ * main-worklet.mjs (ENVIRONMENT='worklet' 빌드)의 realtime_* C API를 render quantum마다 호출
+ *
+ * 사용법 (메인 스레드):
+ *   await audioContext.audioWorklet.addModule('./js/RealtimeWorkletProcessor.js');
+ *   const wasmBinary = await (await fetch('./main-worklet.wasm')).arrayBuffer();
+ *   const node = new AudioWorkletNode(audioContext, 'realtime-voice-processor', {
+ *       numberOfInputs: 1, numberOfOutputs: 1, outputChannelCount: [2],
+ *       processorOptions: { wasmBinary, spec: 'pitch:4', channels: 2 }
+ *   });
+ *   node.port.postMessage({ type: 'configure', spec: 'pitch:-3;filter:4,0.4,0.5' });
+ *
+ * 워클릿 스코프에는 fetch가 없으므로 wasm 바이너리는 메인 스레드가 넘겨줌
+ */
+import createRealtimeModule from '../main-worklet.mjs';
+
+const QUANTUM_FRAMES = 128;   // Web Audio render quantum (RealtimeProcessor::QUANTUM_FRAMES)
+
+class RealtimeWorkletProcessor extends AudioWorkletProcessor {
+    constructor(options) {
+        super();
+        const { wasmBinary, spec = '', channels = 2 } = options.processorOptions || {};
+        this.module = null;
+        this.handle = 0;
+        this.channels = Math.min(Math.max(channels, 1), 2);
+        this.pendingSpec = spec;
+
+        this.port.onmessage = (event) => {
+            if (event.data && event.data.type === 'configure') {
+                this.pendingSpec = event.data.spec;
+                if (this.module) {
+                    this.configure(this.pendingSpec);
+                }
+            }
+        };
+
+        createRealtimeModule({ wasmBinary }).then((module) => {
+            this.module = module;
+            this.handle = module._realtime_create(sampleRate, this.channels, QUANTUM_FRAMES);
+            if (!this.handle) {
+                this.port.postMessage({ type: 'error', message: 'realtime_create 실패' });
+                return;
+            }
+            // 채널 버퍼 위치는 setup 이후 고정 (HEAPF32 인덱스로 보관)
+            this.inputOffsets = [];
+            this.outputOffsets = [];
+            for (let ch = 0; ch < this.channels; ch++) {
+                this.inputOffsets.push(module._realtime_input(this.handle, ch) >> 2);
+                this.outputOffsets.push(module._realtime_output(this.handle, ch) >> 2);
+            }
+            this.configure(this.pendingSpec);
+        });
+    }
+
+    /**
+     * 스테이지 목록 적용 (할당 있음, render 사이에서만 호출됨)
+     */
+    configure(spec) {
+        if (!this.handle) {
+            return;
+        }
+        const ok = this.module.ccall('realtime_configure', 'number', ['number', 'string'], [this.handle, spec]);
+        this.port.postMessage({
+            type: 'configured',
+            ok: ok === 1,
+            latency: this.module._realtime_latency(this.handle)
+        });
+    }
+
+    process(inputs, outputs) {
+        const output = outputs[0];
+        if (!this.handle) {
+            return true;
+        }
+        const input = inputs[0];
+        const frames = output[0].length;
+        // 메모리가 늘어나면 HEAPF32가 바뀌므로 매번 다시 읽음
+        const heap = this.module.HEAPF32;
+
+        for (let ch = 0; ch < this.channels; ch++) {
+            const source = input.length > 0 ? input[Math.min(ch, input.length - 1)] : null;
+            const offset = this.inputOffsets[ch];
+            if (source) {
+                heap.set(source, offset);
+            } else {
+                heap.fill(0, offset, offset + frames);
+            }
+        }
+
+        this.module._realtime_render(this.handle, frames);
+
+        for (let ch = 0; ch < output.length; ch++) {
+            const offset = this.outputOffsets[Math.min(ch, this.channels - 1)];
+            output[ch].set(heap.subarray(offset, offset + frames));
+        }
+        return true;
+    }
+}
+
+registerProcessor('realtime-voice-processor', RealtimeWorkletProcessor);
@@ -31,9 +31,12 @@ class UnifiedController {
         this.jsTimeStretcher = new SimpleTimeStretcher();
         this.jsPerformanceChecker = new JSPerformanceChecker();
 
-        // C++ 엔진 (WASM Module)
+        // C++ 엔진 (WASM Module, 멀티스레드 빌드는 전용 Worker에서 실행)
         this.cppModule = null;
         this.cppAudioBuffer = null;
+        this.cppWorker = null;
+        this.cppWorkerJobs = new Map();   // 작업 번호 -> { resolve, reject }
+        this.cppWorkerNextId = 0;
 
         // 공통 데이터
         this.originalAudio = null;
@@ -56,10 +59,18 @@ class UnifiedController {
 
     /**
      * WASM 초기화
+     * crossOriginIsolated(COOP/COEP 헤더)이면 SharedArrayBuffer를 쓸 수 있으므로 멀티스레드 빌드(main-mt.js)를
+     * 전용 Worker에서 실행 (embind 호출이 parallelFor가 끝날 때까지 막히므로 메인 스레드에서는 호출하지 않음),
+     * 아니면 (또는 Worker 로드 실패 시) 단일 스레드 빌드(main.js)를 메인 스레드에서 사용
      */
     async initWasm() {
         try {
             console.log('Initializing WASM...');
+            if (self.crossOriginIsolated && await this.startCppWorker()) {
+                this.onWasmReady('pthreads, Worker');
+                return;
+            }
+
             this.cppModule = await Module({
                 locateFile(path) {
                     if (path.endsWith('.wasm')) {
@@ -67,15 +78,7 @@ class UnifiedController {
                     }
                     return path;
                 },
-                onRuntimeInitialized: () => {
-                    console.log('WASM Runtime initialized!');
-                    this.wasmReady = true;
-                    // WASM 로드 완료 후 원본 오디오가 있으면 변환 버튼 활성화
-                    if (this.originalAudio) {
-                        document.getElementById('applyAllEffects').disabled = false;
-                        this.setStatus('준비 완료 (C++ + JS)');
-                    }
-                }
+                onRuntimeInitialized: () => this.onWasmReady('single-threaded')
             });
             window.Module = this.cppModule;
         } catch (error) {
@@ -84,6 +87,74 @@ class UnifiedController {
         }
     }
 
+    onWasmReady(mode) {
+        console.log(`WASM Runtime initialized! (${mode})`);
+        this.wasmReady = true;
+        // WASM 로드 완료 후 원본 오디오가 있으면 변환 버튼 활성화
+        if (this.originalAudio) {
+            document.getElementById('applyAllEffects').disabled = false;
+            this.setStatus('준비 완료 (C++ + JS)');
+        }
+    }
+
+    /**
+     * 멀티스레드 빌드 Worker 시작 (js/WasmProcessingWorker.js)
+     * @returns 모듈 로드 성공 여부 (실패하면 Worker 종료)
+     */
+    async startCppWorker() {
+        const worker = new Worker('./js/WasmProcessingWorker.js');
+        const ready = await new Promise((resolve) => {
+            worker.onmessage = (event) => {
+                if (event.data.type === 'error') {
+                    console.warn('멀티스레드 WASM 빌드 로드 실패, 단일 스레드 빌드 사용:', event.data.message);
+                }
+                resolve(event.data.type === 'ready');
+            };
+            worker.onerror = (event) => {
+                console.warn('멀티스레드 WASM Worker 로드 실패, 단일 스레드 빌드 사용:', event.message);
+                event.preventDefault();
+                resolve(false);
+            };
+        });
+        if (!ready) {
+            worker.terminate();
+            return false;
+        }
+
+        worker.onmessage = (event) => this.handleCppWorkerMessage(event.data);
+        worker.onerror = null;
+        this.cppWorker = worker;
+        return true;
+    }
+
+    handleCppWorkerMessage(message) {
+        if (message.type === 'status') {
+            this.setStatus(message.text);
+            return;
+        }
+        const job = this.cppWorkerJobs.get(message.id);
+        if (!job) {
+            return;
+        }
+        this.cppWorkerJobs.delete(message.id);
+        if (message.type === 'result') {
+            job.resolve(message);
+        } else {
+            job.reject(new Error(message.message));
+        }
+    }
+
+    /**
+     * Worker에 처리 작업 전송 (audio 버퍼는 transfer되므로 복사본을 넘김)
+     */
+    runCppWorkerJob(audio, sampleRate, settings) {
+        return new Promise((resolve, reject) => {
+            const id = ++this.cppWorkerNextId;
+            this.cppWorkerJobs.set(id, { resolve, reject });
+            this.cppWorker.postMessage({ type: 'process', id, audio, sampleRate, settings }, [audio.buffer]);
+        });
+    }
+
     setupEventListeners() {
         // Recording
         document.getElementById('startRecord').addEventListener('click', () => this.startRecording());
@@ -546,6 +617,12 @@ class UnifiedController {
             throw new Error('WASM not ready');
         }
 
+        // 멀티스레드 빌드: Worker에서 처리 (메인 스레드는 결과만 기다림)
+        if (this.cppWorker) {
+            await this.applyEffectsCppWorker();
+            return;
+        }
+
         // C++ PerformanceChecker 생성
         const cppPerfChecker = new this.cppModule.PerformanceChecker();
 
@@ -688,6 +765,36 @@ class UnifiedController {
         console.log('C++ Performance Report (JSON):', JSON.stringify(report, null, 2));
     }
 
+    /**
+     * C++ 엔진으로 효과 적용 (멀티스레드 빌드 Worker, 처리 순서는 applyEffectsCpp와 같음)
+     */
+    async applyEffectsCppWorker() {
+        const filterType = parseInt(document.getElementById('filterType').value);
+        const settings = {
+            pitchShift: parseFloat(document.getElementById('pitchShift').value),
+            timeStretch: parseFloat(document.getElementById('timeStretch').value),
+            filterType: isNaN(filterType) ? null : filterType,
+            filterParam1: parseFloat(document.getElementById('filterParam1').value),
+            filterParam2: parseFloat(document.getElementById('filterParam2').value),
+            reverse: document.getElementById('reversePlayback').checked
+        };
+        const sampleRate = this.originalAudio.getSampleRate();
+        const input = new Float32Array(this.originalAudio.getData());
+
+        const result = await this.runCppWorkerJob(input, sampleRate, settings);
+
+        const audio = new JSAudioBuffer(sampleRate, 1);
+        audio.setData(result.audio);
+        this.processedAudio = audio;
+
+        // C++ 성능 보고서
+        const report = JSON.parse(result.report);
+        this.performanceReport.setCppReport(report);
+
+        console.log('C++ Performance Report:', report);
+        console.log('C++ Performance Report (JSON):', JSON.stringify(report, null, 2));
+    }
+
     resetEffects() {
         document.getElementById('pitchShift').value = 0;
         document.getElementById('pitchValue').textContent = '0';
@@ -0,0 +1,99 @@
+/**
+ * WasmProcessingWorker - 멀티스레드 WASM 빌드(main-mt.js)를 전용 Worker에서 실행
+ * embind 호출은 TaskPool::parallelFor가 끝날 때까지 호출한 스레드를 막으므로
+ * 메인 스레드 대신 이 Worker가 호출하고, UnifiedController는 작업을 보내고 결과만 받음 (UI는 멈추지 않음)
+ * pthread 작업자는 이 Worker가 만듦 (Worker 안에서는 Atomics.wait로 기다릴 수 있음)
+ *
+ * 메시지:
+ *   <- { type: 'ready' } / { type: 'error', message }                 (모듈 로드 결과)
+ *   -> { type: 'process', id, audio: Float32Array, sampleRate, settings }
+ *      settings = { pitchShift, timeStretch, filterType (없으면 null), filterParam1, filterParam2, reverse }
+ *   <- { type: 'status', id, text }                                    (단계별 진행 상태)
+ *   <- { type: 'result', id, audio: Float32Array, report: string } / { type: 'failed', id, message }
+ * audio 버퍼는 양쪽 모두 transfer로 넘김 (복사 없음)
+ */
+importScripts('../main-mt.js');
+
+// wasm / pthread 작업자 스크립트는 앱 폴더 기준 (이 파일은 js/ 아래)
+const appUrl = (path) => new URL('../' + path, self.location.href).href;
+
+let wasm = null;
+// 처리 세션 (입력 / 출력 arena와 DSP 객체를 작업 간에 유지)
+let session = null;
+
+ModuleMT({
+    locateFile: (path) => appUrl(path),
+    mainScriptUrlOrBlob: appUrl('main-mt.js')
+}).then((instance) => {
+    wasm = instance;
+    session = new wasm.ProcessingSession();
+    self.postMessage({ type: 'ready' });
+}, (error) => {
+    self.postMessage({ type: 'error', message: String(error) });
+});
+
+/**
+ * 설정 -> 효과 체인 spec (UnifiedController.applyEffectsCpp와 같은 순서: 피치 -> 속도 -> 필터 -> 역재생)
+ */
+function buildChainSpec(settings) {
+    const stages = [];
+    if (Math.abs(settings.pitchShift) > 0.01) {
+        stages.push(`pitch:${settings.pitchShift}`);
+    }
+    if (Math.abs(settings.timeStretch - 1.0) > 0.01) {
+        stages.push(`tempo:${settings.timeStretch}`);
+    }
+    if (settings.filterType !== null) {
+        stages.push(`filter:${settings.filterType},${settings.filterParam1},${settings.filterParam2}`);
+    }
+    if (settings.reverse) {
+        stages.push('reverse');
+    }
+    return stages.join(';');
+}
+
+/**
+ * 세션 입력 arena에 직접 쓰고 효과 체인 한 번으로 처리 (_malloc / _free 및 효과별 왕복 없음)
+ * 결과는 transfer할 수 있도록 한 번만 복사 (WASM 메모리는 SharedArrayBuffer라 transfer 불가)
+ */
+function runEffects(id, audio, sampleRate, settings) {
+    self.postMessage({ type: 'status', id, text: '효과 적용 중 (C++)...' });
+    const checker = new wasm.PerformanceChecker();
+
+    try {
+        session.setSampleRate(sampleRate);
+        session.setPerformanceChecker(checker);
+        session.reserveInput(audio.length);
+        session.getInputView().set(audio);
+
+        checker.startFeature('chain_total');
+        const ok = session.applyChain(buildChainSpec(settings));
+        checker.endFeature();
+        if (!ok) {
+            throw new Error('효과 체인 처리 실패');
+        }
+
+        return { audio: session.getOutputView().slice(), report: checker.getReportJSON() };
+    } finally {
+        session.setPerformanceChecker(null);
+        checker.delete();
+    }
+}
+
+self.onmessage = (event) => {
+    const message = event.data;
+    if (message.type !== 'process') {
+        return;
+    }
+    if (!wasm) {
+        self.postMessage({ type: 'failed', id: message.id, message: 'WASM not ready' });
+        return;
+    }
+
+    try {
+        const { audio, report } = runEffects(message.id, message.audio, message.sampleRate, message.settings);
+        self.postMessage({ type: 'result', id: message.id, audio, report }, [audio.buffer]);
+    } catch (error) {
+        self.postMessage({ type: 'failed', id: message.id, message: String(error && error.message || error) });
+    }
+};